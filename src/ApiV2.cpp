@@ -0,0 +1,370 @@
+// ApiV2.cpp - Versioned JSON API under /api/v2
+#include "ApiV2.h"
+#include "Globals.h"
+#include "Utility.h"
+#include "RelayControl.h"
+#include "Settings.h"
+#include "CommandQueue.h"
+#include "StatusCache.h"
+#include "JsonReader.h"
+#include "JsonWriter.h"
+#include <math.h>
+
+struct ApiFieldError {
+  char field[JSON_READER_MAX_PATH];
+  const char* code;
+  char message[48];
+};
+
+struct ApiErrors {
+  ApiFieldError list[API_V2_MAX_ERRORS];
+  int count;
+  int omitted;   // Errors past API_V2_MAX_ERRORS
+};
+
+// Actions accepted by POST /api/v2/commands
+static const struct {
+  const char* name;
+  CommandType type;
+  bool dropRelays;    // Relays go off in the handler, before the command queues
+} ACTIONS[] = {
+  {"start",          CMD_START,          false},
+  {"stop",           CMD_STOP,           false},
+  {"force_start",    CMD_FORCE_START,    false},
+  {"force_stop",     CMD_FORCE_STOP,     true},
+  {"emergency_stop", CMD_EMERGENCY_STOP, true},
+  {"clear_manual",   CMD_CLEAR_MANUAL,   false},
+  {"reboot",         CMD_REBOOT,         false},
+};
+#define ACTION_COUNT (sizeof(ACTIONS) / sizeof(ACTIONS[0]))
+
+static void api_add_error(ApiErrors& errors, const char* field, const char* code, const char* message) {
+  if (errors.count >= API_V2_MAX_ERRORS) {
+    errors.omitted++;
+    return;
+  }
+  ApiFieldError& e = errors.list[errors.count++];
+  snprintf(e.field, sizeof(e.field), "%s", field);
+  e.code = code;
+  snprintf(e.message, sizeof(e.message), "%s", message);
+}
+
+static void api_send_errors(AsyncWebServerRequest *req, int status, const char* code, const char* message,
+                            const ApiErrors* errors) {
+  char buffer[1024];
+  JsonWriter json(buffer, sizeof(buffer));
+
+  json.beginObject();
+  json.beginObject("error");
+  json.field("code", code);
+  json.field("message", message);
+  if (errors && errors->count > 0) {
+    json.beginArray("details");
+    for (int i = 0; i < errors->count; i++) {
+      json.beginObject();
+      json.field("field", errors->list[i].field);
+      json.field("code", errors->list[i].code);
+      json.field("message", errors->list[i].message);
+      json.endObject();
+    }
+    json.endArray();
+    if (errors->omitted > 0) json.field("omitted", errors->omitted);
+  }
+  json.endObject();
+  json.endObject();
+
+  req->send(status, "application/json", json.c_str());
+}
+
+static void api_send_error(AsyncWebServerRequest *req, int status, const char* code, const char* message) {
+  api_send_errors(req, status, code, message, NULL);
+}
+
+// ===== REQUEST BODIES =====
+// The body arrives in pieces before the request handler runs. It is collected
+// into _tempObject, which the server frees along with the request.
+static void api_collect_body(AsyncWebServerRequest *req, uint8_t *data, size_t len, size_t index, size_t total) {
+  if (total > API_V2_MAX_BODY) return;   // Handler answers 413
+  if (index == 0) {
+    req->_tempObject = malloc(total + 1);
+  }
+  char *body = (char *)req->_tempObject;
+  if (!body || index + len > total) return;
+  memcpy(body + index, data, len);
+  if (index + len == total) body[total] = '\0';
+}
+
+// NUL-terminated body, or NULL after sending the error
+static const char* api_get_body(AsyncWebServerRequest *req) {
+  if (req->contentLength() > API_V2_MAX_BODY) {
+    api_send_error(req, 413, "body_too_large", "Request body exceeds 1024 bytes");
+    return NULL;
+  }
+  const String& type = req->contentType();
+  if (type.length() > 0 && !type.startsWith("application/json")) {
+    api_send_error(req, 415, "unsupported_media_type", "Content-Type must be application/json");
+    return NULL;
+  }
+  if (req->contentLength() == 0 || req->_tempObject == NULL) {
+    api_send_error(req, 400, "empty_body", "Request body is empty");
+    return NULL;
+  }
+  return (const char *)req->_tempObject;
+}
+
+static bool api_parse_body(AsyncWebServerRequest *req, const char* body, JsonLeafHandler handler, void* context) {
+  JsonReader reader(body);
+  if (reader.parse(handler, context)) return true;
+  if (reader.error()) {
+    char message[64];
+    snprintf(message, sizeof(message), "%s at offset %u", reader.error(), (unsigned)reader.errorOffset());
+    api_send_error(req, 400, "invalid_json", message);
+    return false;
+  }
+  return true;   // Handler stopped early; it has recorded why
+}
+
+// ===== SETTINGS =====
+struct SettingsRequest {
+  SettingsPatch patch;
+  ApiErrors errors;
+};
+
+static bool api_settings_leaf(const JsonLeaf& leaf, void* context) {
+  SettingsRequest& request = *(SettingsRequest *)context;
+
+  int id = settings_find(leaf.path);
+  if (id < 0) {
+    api_add_error(request.errors, leaf.path, "unknown_field", "Not a setting");
+    return true;
+  }
+
+  const SettingInfo* info = settings_get_info(id);
+  float value;
+  if (info->type == SETTING_TYPE_BOOL) {
+    if (leaf.type != JSON_LEAF_BOOL) {
+      api_add_error(request.errors, leaf.path, "wrong_type", "Must be true or false");
+      return true;
+    }
+    value = leaf.boolean ? 1 : 0;
+  } else {
+    if (leaf.type != JSON_LEAF_NUMBER) {
+      api_add_error(request.errors, leaf.path, "wrong_type", "Must be a number");
+      return true;
+    }
+    if (info->type == SETTING_TYPE_INT && leaf.number != floor(leaf.number)) {
+      api_add_error(request.errors, leaf.path, "wrong_type", "Must be a whole number");
+      return true;
+    }
+    if (leaf.number < info->min || leaf.number > info->max) {
+      char message[48];
+      snprintf(message, sizeof(message), "Must be %g to %g", info->min, info->max);
+      api_add_error(request.errors, leaf.path, "out_of_range", message);
+      return true;
+    }
+    value = leaf.number;
+  }
+
+  request.patch.values[id] = value;
+  request.patch.mask |= SETTING_BIT(id);
+  return true;
+}
+
+static void api_send_settings(AsyncWebServerRequest *req) {
+  char buffer[512];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  settings_write_json(json);
+  json.endObject();
+
+  if (json.overflowed()) {
+    api_send_error(req, 500, "internal", "Settings JSON too large");
+    return;
+  }
+  AsyncWebServerResponse *response = req->beginResponse(200, "application/json", json.c_str());
+  response->addHeader("Cache-Control", "no-store");
+  req->send(response);
+}
+
+static void api_patch_settings(AsyncWebServerRequest *req) {
+  const char* body = api_get_body(req);
+  if (!body) return;
+
+  SettingsRequest request;
+  memset(&request, 0, sizeof(request));
+  if (!api_parse_body(req, body, api_settings_leaf, &request)) return;
+
+  if (request.errors.count == 0 && request.patch.mask != 0) {
+    const char* reason;
+    int id = settings_check_patch(request.patch, &reason);
+    if (id >= 0) {
+      const SettingInfo* info = settings_get_info(id);
+      char field[JSON_READER_MAX_PATH];
+      snprintf(field, sizeof(field), "%s%s%s", info->group ? info->group : "", info->group ? "." : "", info->name);
+      api_add_error(request.errors, field, "conflict", reason);
+    }
+  }
+
+  if (request.errors.count > 0 || request.errors.omitted > 0) {
+    api_send_errors(req, 422, "validation_failed", "No settings were changed", &request.errors);
+    return;
+  }
+  if (request.patch.mask == 0) {
+    api_send_error(req, 400, "empty_patch", "Body contains no settings");
+    return;
+  }
+
+  Command command;
+  command_init(&command, CMD_APPLY_SETTINGS);
+  command.settings = request.patch;
+  command_submit(req, command, COMMAND_REPLY_JSON);
+}
+
+// ===== COMMANDS =====
+struct ActionRequest {
+  int action;
+  ApiErrors errors;
+};
+
+static bool api_action_leaf(const JsonLeaf& leaf, void* context) {
+  ActionRequest& request = *(ActionRequest *)context;
+
+  if (strcmp(leaf.path, "action") != 0) {
+    api_add_error(request.errors, leaf.path, "unknown_field", "Only \"action\" is accepted");
+    return true;
+  }
+  if (leaf.type != JSON_LEAF_STRING) {
+    api_add_error(request.errors, leaf.path, "wrong_type", "Must be a string");
+    return true;
+  }
+  for (size_t i = 0; i < ACTION_COUNT; i++) {
+    if (strcmp(leaf.string, ACTIONS[i].name) == 0) {
+      request.action = i;
+      return true;
+    }
+  }
+  api_add_error(request.errors, leaf.path, "unknown_action", "Not a known action");
+  return true;
+}
+
+static void api_post_command(AsyncWebServerRequest *req) {
+  const char* body = api_get_body(req);
+  if (!body) return;
+
+  ActionRequest request;
+  memset(&request, 0, sizeof(request));
+  request.action = -1;
+  if (!api_parse_body(req, body, api_action_leaf, &request)) return;
+
+  if (request.errors.count > 0 || request.errors.omitted > 0) {
+    api_send_errors(req, 422, "validation_failed", "Command not accepted", &request.errors);
+    return;
+  }
+  if (request.action < 0) {
+    api_send_error(req, 400, "missing_action", "Body must contain \"action\"");
+    return;
+  }
+
+  CommandType type = ACTIONS[request.action].type;
+  if (type == CMD_START && !isValidTemperature(readGrillTemperature())) {
+    api_send_error(req, 409, "sensor_invalid", "Cannot start: invalid temperature sensor reading");
+    return;
+  }
+  if (ACTIONS[request.action].dropRelays) {
+    relay_emergency_stop();   // Never waits behind the queue
+  }
+
+  Command command;
+  command_init(&command, type);
+  if (!command_submit(req, command, COMMAND_REPLY_JSON) && type == CMD_EMERGENCY_STOP) {
+    command_post(command);    // No reply slot, but the run state must still clear
+  }
+}
+
+// ===== OPENAPI =====
+static const char OPENAPI_HEAD[] PROGMEM = R"JSON({"openapi":"3.0.3",
+"info":{"title":"ESP32 Grill Controller","version":"2.0.0"},
+"paths":{
+"/api/v2/status":{"get":{"summary":"Live status; supports If-None-Match and ?since=&wait= long-poll","parameters":[
+{"name":"since","in":"query","schema":{"type":"integer"}},{"name":"wait","in":"query","schema":{"type":"integer","maximum":30000}}],
+"responses":{"200":{"description":"Status","content":{"application/json":{"schema":{"type":"object"}}}},"304":{"description":"Unchanged"},"503":{"description":"Starting up"}}}},
+"/api/v2/settings":{"get":{"summary":"All settings","responses":{"200":{"description":"Settings","content":{"application/json":{"schema":{"$ref":"#/components/schemas/Settings"}}}}}},
+"patch":{"summary":"Change any subset of settings atomically","requestBody":{"required":true,"content":{"application/json":{"schema":{"$ref":"#/components/schemas/Settings"}}}},
+"responses":{"200":{"$ref":"#/components/responses/Result"},"400":{"$ref":"#/components/responses/Error"},"413":{"$ref":"#/components/responses/Error"},"415":{"$ref":"#/components/responses/Error"},"422":{"$ref":"#/components/responses/Error"},"503":{"$ref":"#/components/responses/Error"}}},
+"post":{"summary":"Same as PATCH","requestBody":{"required":true,"content":{"application/json":{"schema":{"$ref":"#/components/schemas/Settings"}}}},
+"responses":{"200":{"$ref":"#/components/responses/Result"},"422":{"$ref":"#/components/responses/Error"}}}},
+"/api/v2/commands":{"post":{"summary":"Run a control action","requestBody":{"required":true,"content":{"application/json":{"schema":{"$ref":"#/components/schemas/Command"}}}},
+"responses":{"200":{"$ref":"#/components/responses/Result"},"409":{"$ref":"#/components/responses/Error"},"422":{"$ref":"#/components/responses/Error"},"503":{"$ref":"#/components/responses/Error"}}}}},
+"components":{
+"responses":{"Result":{"description":"Applied by the controller","content":{"application/json":{"schema":{"$ref":"#/components/schemas/Result"}}}},
+"Error":{"description":"Refused; nothing was changed","content":{"application/json":{"schema":{"$ref":"#/components/schemas/Error"}}}}},
+"schemas":{
+"Result":{"type":"object","properties":{"ok":{"type":"boolean"},"queued":{"type":"boolean"},"message":{"type":"string"}}},
+"Error":{"type":"object","properties":{"error":{"type":"object","properties":{"code":{"type":"string"},"message":{"type":"string"},"omitted":{"type":"integer"},
+"details":{"type":"array","items":{"type":"object","properties":{"field":{"type":"string"},"code":{"type":"string"},"message":{"type":"string"}}}}}}}},
+)JSON";
+
+static const char OPENAPI_TAIL[] PROGMEM = R"JSON(}}})JSON";
+
+static void api_send_openapi(AsyncWebServerRequest *req) {
+  AsyncResponseStream *out = req->beginResponseStream("application/json", 4096);
+  out->print(OPENAPI_HEAD);
+
+  out->print("\"Command\":{\"type\":\"object\",\"required\":[\"action\"],\"properties\":{\"action\":{\"type\":\"string\",\"enum\":[");
+  for (size_t i = 0; i < ACTION_COUNT; i++) {
+    out->printf("%s\"%s\"", i > 0 ? "," : "", ACTIONS[i].name);
+  }
+  out->print("]}}},\n");
+
+  // Settings schema, from the table the validator uses
+  static const char* const TYPE_NAMES[] = {"boolean", "integer", "number"};
+  static const char* const OBJECT_OPEN = "{\"type\":\"object\",\"additionalProperties\":false,\"properties\":{";
+  out->printf("\"Settings\":%s", OBJECT_OPEN);
+  const char* group = NULL;
+  bool first = true;
+  for (int i = 0; i < SETTING_COUNT; i++) {
+    const SettingInfo* info = settings_get_info(i);
+    if (info->group != group) {
+      if (group) out->print("}}");
+      if (info->group) {
+        out->printf("%s\"%s\":%s", first ? "" : ",", info->group, OBJECT_OPEN);
+        first = true;
+      }
+      group = info->group;
+    }
+    out->printf("%s\"%s\":{\"type\":\"%s\",\"description\":\"%s\"", first ? "" : ",",
+                info->name, TYPE_NAMES[info->type], info->description);
+    if (info->type != SETTING_TYPE_BOOL) {
+      out->printf(",\"minimum\":%g,\"maximum\":%g", info->min, info->max);
+    }
+    out->print("}");
+    first = false;
+  }
+  if (group) out->print("}}");
+  out->print("}}");
+
+  out->print(OPENAPI_TAIL);
+  req->send(out);
+}
+
+void api_v2_setup_routes() {
+  server.on("/api/v2/status", HTTP_GET, [](AsyncWebServerRequest *req) {
+    status_cache_handle_request(req);
+  });
+
+  server.on("/api/v2/settings", HTTP_GET, [](AsyncWebServerRequest *req) {
+    api_send_settings(req);
+  });
+
+  server.on("/api/v2/settings", HTTP_PATCH | HTTP_POST, [](AsyncWebServerRequest *req) {
+    api_patch_settings(req);
+  }, NULL, api_collect_body);
+
+  server.on("/api/v2/commands", HTTP_POST, [](AsyncWebServerRequest *req) {
+    api_post_command(req);
+  }, NULL, api_collect_body);
+
+  server.on("/api/v2/openapi.json", HTTP_GET, [](AsyncWebServerRequest *req) {
+    api_send_openapi(req);
+  });
+}
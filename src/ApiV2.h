@@ -0,0 +1,23 @@
+// ApiV2.h - Versioned JSON API under /api/v2
+//
+// Settings are read with GET and changed with PATCH (or POST) carrying a JSON
+// object of just the fields to change. The whole body is validated before
+// anything is applied; the accepted patch then runs on loop() as a single
+// command, so the controller never sees half of it, and each NVS namespace
+// it touches is written once. Errors are JSON:
+//   {"error":{"code":"...","message":"...","details":[{"field":..,"code":..,"message":..}]}}
+// GET /api/v2/openapi.json describes the surface; the settings schema in it is
+// generated from the same table the validator uses.
+#ifndef APIV2_H
+#define APIV2_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#define API_V2_MAX_BODY      1024   // Larger bodies are refused with 413
+#define API_V2_MAX_ERRORS    8      // Field errors reported per request
+
+// Registers the /api/v2 routes on server
+void api_v2_setup_routes();
+
+#endif // APIV2_H
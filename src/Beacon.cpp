@@ -0,0 +1,105 @@
+// Beacon.cpp - Opt-in UDP multicast telemetry beacon for fleet aggregation
+#include "Beacon.h"
+#include "Globals.h"
+#include "Ignition.h"
+#include "FanControl.h"
+#include "PelletAccounting.h"
+#include "ProbeAlarm.h"
+#include "RelayControl.h"
+#include "JsonWriter.h"
+#include "Clock.h"
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include <Preferences.h>
+#include <atomic>
+
+static WiFiUDP udp;
+static Preferences beaconPrefs;
+static std::atomic<bool> enabled(false);   // Set from the web handler
+
+static uint8_t deviceId[6];
+static uint32_t sequence = 0;
+static uint32_t sentCount = 0;
+static uint32_t failedCount = 0;
+static size_t lastLength = 0;
+
+void beacon_init() {
+  WiFi.macAddress(deviceId);
+
+  beaconPrefs.begin("beacon", true);
+  enabled = beaconPrefs.getBool("enabled", false);
+  beaconPrefs.end();
+
+  // /set_beacon?enabled=1 - persisted across reboots
+  server.on("/set_beacon", HTTP_GET, [](AsyncWebServerRequest *req) {
+    if (!req->hasParam("enabled")) {
+      req->send(400, "text/plain", "Missing enabled parameter");
+      return;
+    }
+
+    bool on = req->getParam("enabled")->value() == "1";
+    enabled = on;
+    beaconPrefs.begin("beacon", false);
+    beaconPrefs.putBool("enabled", on);
+    beaconPrefs.end();
+    req->send(200, "text/plain", String("Telemetry beacon ") + (on ? "enabled" : "disabled"));
+  });
+
+  server.on("/beacon_stats", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", beacon_get_stats_json());
+  });
+}
+
+void beacon_update(const TelemetryFrame& frame) {
+  if (!enabled || WiFi.status() != WL_CONNECTED) return;
+
+  TelemetryBeacon beacon;
+  memcpy(beacon.deviceId, deviceId, sizeof(deviceId));
+  beacon.sequence = sequence++;
+  beacon.uptimeSec = (uint32_t)(clock_ms() / 1000);
+  beacon.state = 0;
+  if (grillRunning) beacon.state |= TELEMETRY_BEACON_RUNNING;
+  if (relay_get_manual_override_status()) beacon.state |= TELEMETRY_BEACON_MANUAL;
+  if (pellet_is_hopper_low()) beacon.state |= TELEMETRY_BEACON_HOPPER_LOW;
+  if (probe_alarm_get_active_mask()) beacon.state |= TELEMETRY_BEACON_ALARM;
+  if (fan_get_smoke_mode()) beacon.state |= TELEMETRY_BEACON_SMOKE;
+  beacon.ignition = (uint8_t)ignition_get_state();
+  beacon.setpoint = (uint16_t)setpoint;
+  beacon.hopperTenthsLb = (uint16_t)constrain(lroundf(pellet_get_hopper_remaining_lb() * 10), 0L, 65535L);
+  beacon.blowerDuty = relay_get_blower_duty();
+  beacon.name = WiFi.getHostname();
+  beacon.frame = frame;
+
+  uint8_t packet[TELEMETRY_BEACON_MAX];
+  size_t length = telemetry_encode_beacon(&beacon, packet, sizeof(packet));
+
+  if (length == 0 ||
+      !udp.beginPacket(IPAddress(BEACON_GROUP_A, BEACON_GROUP_B, BEACON_GROUP_C, BEACON_GROUP_D), BEACON_PORT) ||
+      udp.write(packet, length) != length ||
+      !udp.endPacket()) {
+    failedCount++;
+    return;
+  }
+  sentCount++;
+  lastLength = length;
+}
+
+String beacon_get_stats_json() {
+  char buffer[192];
+  JsonWriter json(buffer, sizeof(buffer));
+
+  char group[16];
+  snprintf(group, sizeof(group), "%d.%d.%d.%d", BEACON_GROUP_A, BEACON_GROUP_B, BEACON_GROUP_C, BEACON_GROUP_D);
+
+  json.beginObject();
+  json.field("enabled", enabled.load());
+  json.field("group", group);
+  json.field("port", BEACON_PORT);
+  json.field("sequence", sequence);
+  json.field("sent", sentCount);
+  json.field("failed", failedCount);
+  json.field("lastBytes", (unsigned int)lastLength);
+  json.endObject();
+
+  return String(json.c_str());
+}
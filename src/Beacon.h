@@ -0,0 +1,29 @@
+// Beacon.h - Opt-in UDP multicast telemetry beacon for fleet aggregation
+//
+// When enabled, every control cycle sends one small self-contained packet -
+// device id, sequence, run state and the current telemetry snapshot - to a
+// multicast group, so a site with several grills can watch them all with one
+// listener (tools/beacon_listen.py) instead of polling each over HTTP. The
+// packet format is documented in TelemetryCodec.h.
+#ifndef BEACON_H
+#define BEACON_H
+
+#include <Arduino.h>
+#include "TelemetryCodec.h"
+
+#define BEACON_GROUP_A   239     // Multicast group 239.255.71.71 (site-local scope)
+#define BEACON_GROUP_B   255
+#define BEACON_GROUP_C   71
+#define BEACON_GROUP_D   71
+#define BEACON_PORT      47171
+
+// Setup - loads the enabled flag and registers /set_beacon and /beacon_stats
+void beacon_init();
+
+// Network task, once per control cycle, with the cycle's copy of its history sample
+void beacon_update(const TelemetryFrame& frame);
+
+// Status
+String beacon_get_stats_json();
+
+#endif // BEACON_H
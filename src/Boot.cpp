@@ -0,0 +1,136 @@
+// Boot.cpp - Two-lane boot sequence and its timeline
+#include "Boot.h"
+#include "JsonWriter.h"
+#include "Clock.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <atomic>
+#include <memory>
+
+enum BootLane : uint8_t {
+  BOOT_LANE_SETUP = 0,      // setup() and then loop()
+  BOOT_LANE_SERVICES,
+  BOOT_LANE_COUNT
+};
+
+static const char* const LANE_NAMES[BOOT_LANE_COUNT] = {"setup", "services"};
+
+struct BootStage {
+  const char* name;
+  uint32_t atUs;            // Since reset
+  uint32_t durationUs;      // Since the previous mark on the same lane
+  BootLane lane;
+};
+
+static portMUX_TYPE bootMux = portMUX_INITIALIZER_UNLOCKED;
+static BootStage stages[BOOT_MAX_STAGES];
+static int stageCount = 0;
+static uint32_t laneLastUs[BOOT_LANE_COUNT] = {0, 0};
+
+static std::atomic<TaskHandle_t> servicesTask(NULL);
+static std::atomic<bool> servicesReady(false);
+static void (*servicesStart)() = NULL;
+
+// Loop task only
+static bool controlLive = false;
+static bool timelinePrinted = false;
+
+void boot_mark(const char* stage) {
+  uint32_t now = (uint32_t)clock_us();
+  TaskHandle_t services = servicesTask;
+  BootLane lane = (services != NULL && xTaskGetCurrentTaskHandle() == services) ? BOOT_LANE_SERVICES : BOOT_LANE_SETUP;
+
+  portENTER_CRITICAL(&bootMux);
+  if (stageCount < BOOT_MAX_STAGES) {
+    stages[stageCount].name = stage;
+    stages[stageCount].atUs = now;
+    stages[stageCount].durationUs = now - laneLastUs[lane];
+    stages[stageCount].lane = lane;
+    stageCount++;
+  }
+  laneLastUs[lane] = now;
+  portEXIT_CRITICAL(&bootMux);
+}
+
+static void boot_services_task(void *parameter) {
+  servicesTask = xTaskGetCurrentTaskHandle();   // Before the first mark; the creator may not have stored it yet
+  servicesStart();
+  boot_mark("services ready");
+  servicesTask = NULL;
+  servicesReady = true;
+  vTaskDelete(NULL);
+}
+
+void boot_start_services(void (*start)()) {
+  servicesStart = start;
+  laneLastUs[BOOT_LANE_SERVICES] = (uint32_t)clock_us();
+
+  TaskHandle_t handle;
+  if (xTaskCreatePinnedToCore(boot_services_task, "boot", BOOT_TASK_STACK, NULL, BOOT_TASK_PRIORITY,
+                              &handle, BOOT_TASK_CORE) != pdPASS) {
+    Serial.println("⚠️ Boot task creation failed - starting services inline");
+    start();
+    boot_mark("services ready");
+    servicesReady = true;
+  }
+}
+
+bool boot_services_ready() {
+  return servicesReady;
+}
+
+void boot_control_cycle() {
+  if (!controlLive) {
+    controlLive = true;
+    boot_mark("control live");
+  }
+  if (!timelinePrinted && servicesReady) {
+    timelinePrinted = true;
+    boot_print_timeline();
+  }
+}
+
+static int boot_copy_stages(BootStage* out) {
+  portENTER_CRITICAL(&bootMux);
+  int count = stageCount;
+  memcpy(out, stages, count * sizeof(BootStage));
+  portEXIT_CRITICAL(&bootMux);
+  return count;
+}
+
+void boot_print_timeline() {
+  BootStage copy[BOOT_MAX_STAGES];
+  int count = boot_copy_stages(copy);
+
+  Serial.println("\n=== BOOT TIMELINE ===");
+  Serial.println("  since reset   stage took   lane      stage");
+  for (int i = 0; i < count; i++) {
+    Serial.printf("%10lu us %10lu us   %-9s %s\n", (unsigned long)copy[i].atUs,
+                  (unsigned long)copy[i].durationUs, LANE_NAMES[copy[i].lane], copy[i].name);
+  }
+  Serial.println("=====================\n");
+}
+
+String boot_get_timeline_json() {
+  BootStage copy[BOOT_MAX_STAGES];
+  int count = boot_copy_stages(copy);
+
+  std::unique_ptr<char[]> buffer(new char[BOOT_JSON_BUFFER]);   // Too big for the async_tcp stack
+  JsonWriter json(buffer.get(), BOOT_JSON_BUFFER);
+
+  json.beginObject();
+  json.field("servicesReady", (bool)servicesReady);
+  json.beginArray("stages");
+  for (int i = 0; i < count; i++) {
+    json.beginObject();
+    json.field("stage", copy[i].name);
+    json.field("lane", LANE_NAMES[copy[i].lane]);
+    json.field("atUs", (unsigned long)copy[i].atUs);
+    json.field("us", (unsigned long)copy[i].durationUs);
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
+
+  return String(json.c_str());
+}
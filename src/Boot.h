@@ -0,0 +1,37 @@
+// Boot.h - Two-lane boot sequence and its timeline
+//
+// setup() brings up only what control needs - relays, sensors, control state -
+// and returns, so loop() is controlling within a second of reset. Display,
+// WiFi, mDNS and the web server start meanwhile on a one-shot services task on
+// the other core; the tasks that use them wait for boot_services_ready().
+//
+// Each stage calls boot_mark() as it finishes. The timeline (µs since reset,
+// and each stage's own duration on its lane) is printed once both lanes are
+// done and served at /boot_timeline.
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <Arduino.h>
+
+#define BOOT_MAX_STAGES          24
+#define BOOT_TASK_STACK          8192    // Web server setup builds Strings; freed when the task ends
+#define BOOT_TASK_PRIORITY       1
+#define BOOT_TASK_CORE           0
+#define BOOT_JSON_BUFFER         2048
+
+// Any task - records that a stage just finished
+void boot_mark(const char* stage);
+
+// From setup(): runs start() on the services task, or inline if the task
+// cannot be created. boot_services_ready() turns true when start() returns.
+void boot_start_services(void (*start)());
+bool boot_services_ready();
+
+// From loop() every cycle - marks the first control cycle, prints the timeline once
+void boot_control_cycle();
+
+// Timeline
+void boot_print_timeline();
+String boot_get_timeline_json();
+
+#endif // BOOT_H
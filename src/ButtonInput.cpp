@@ -4,6 +4,7 @@
 #include "PelletControl.h"
 #include "Utility.h"
 #include "Ignition.h"
+#include "Clock.h"
 
 void button_init() {
   // Initialize only UP and DOWN buttons (SELECT button disabled)
@@ -14,12 +15,12 @@ void button_init() {
 }
 
 void handle_buttons() {
-  static unsigned long lastButtonTime = 0;
+  static uint64_t lastButtonTime = 0;
   const unsigned long BUTTON_DEBOUNCE = 200;
   static bool up_hold_active = false;
-  static unsigned long up_pressed_at = 0;
+  static uint64_t up_pressed_at = 0;
   
-  unsigned long now = millis();
+  uint64_t now = clock_ms();
 
   // --- HOLD UP BUTTON TO START ---
   if (!grillRunning && digitalRead(BUTTON_UP_PIN) == LOW) {
@@ -28,7 +29,7 @@ void handle_buttons() {
       up_pressed_at = now;
       Serial.println("Hold UP button to start grill");
     }
-    unsigned long held_ms = now - up_pressed_at;
+    unsigned long held_ms = (unsigned long)(now - up_pressed_at);
     
     // Show progress in serial every second
     if (held_ms > 1000 && (held_ms % 1000) < 100) {
@@ -0,0 +1,197 @@
+// CaptivePortal.cpp - DNS responder and OS connectivity probes for AP-mode setup
+#include "CaptivePortal.h"
+#include "Globals.h"
+#include "Metrics.h"
+#include "JsonWriter.h"
+#include "lwip/sockets.h"
+#include <atomic>
+
+// Connectivity checks, with what each OS expects when there is no portal
+struct CaptiveProbe {
+  const char* path;
+  int code;
+  const char* contentType;
+  const char* body;
+};
+
+static const CaptiveProbe PROBES[] = {
+  {"/generate_204",              204, "text/plain", ""},                          // Android, ChromeOS
+  {"/gen_204",                   204, "text/plain", ""},
+  {"/hotspot-detect.html",       200, "text/html",
+   "<HTML><HEAD><TITLE>Success</TITLE></HEAD><BODY>Success</BODY></HTML>"},      // Apple
+  {"/library/test/success.html", 200, "text/html",
+   "<HTML><HEAD><TITLE>Success</TITLE></HEAD><BODY>Success</BODY></HTML>"},
+  {"/connecttest.txt",           200, "text/plain", "Microsoft Connect Test"},    // Windows
+  {"/ncsi.txt",                  200, "text/plain", "Microsoft NCSI"},
+  {"/success.txt",               200, "text/plain", "success\n"},                 // Firefox
+};
+#define PROBE_COUNT (sizeof(PROBES) / sizeof(PROBES[0]))
+
+static TaskHandle_t dnsTaskHandle = NULL;
+static std::atomic<bool> active(false);
+static std::atomic<uint32_t> apAddress(0);   // a.b.c.d packed big-endian
+
+// Responder task only
+static uint8_t packet[CAPTIVE_DNS_PACKET_MAX];
+
+static std::atomic<uint32_t> queryCount(0);
+static std::atomic<uint32_t> answeredCount(0);
+static std::atomic<uint32_t> ignoredCount(0);
+static std::atomic<uint32_t> probeCount(0);
+static std::atomic<uint32_t> redirectCount(0);
+
+// Turns the query in packet[0..length) into its reply, in place. Every A query
+// gets the AP address; other types get an empty answer. Returns the reply
+// length, 0 to drop the packet.
+static size_t captive_dns_reply(uint8_t* data, size_t length, size_t capacity, uint32_t address) {
+  if (length < 12) return 0;
+  if (data[2] & 0x80) return 0;                       // A response, not a query
+  if (data[2] & 0x78) return 0;                       // Opcode other than QUERY
+  if (data[4] != 0 || data[5] != 1) return 0;         // Exactly one question
+
+  size_t pos = 12;
+  while (pos < length && data[pos] != 0) {
+    if (data[pos] & 0xC0) return 0;                   // No compression in a question
+    pos += data[pos] + 1;
+  }
+  if (pos + 5 > length) return 0;                     // Root label, QTYPE, QCLASS
+  uint16_t qtype = (data[pos + 1] << 8) | data[pos + 2];
+  uint16_t qclass = (data[pos + 3] << 8) | data[pos + 4];
+  pos += 5;                                           // Anything after the question is dropped
+
+  bool answer = (qtype == 1 || qtype == 255) && qclass == 1;   // A or ANY, class IN
+  if (answer && pos + 16 > capacity) return 0;
+
+  data[2] = 0x84 | (data[2] & 0x01);                  // Response, authoritative, RD echoed
+  data[3] = 0x80;                                     // Recursion available, NOERROR
+  data[6] = 0;
+  data[7] = answer ? 1 : 0;                           // ANCOUNT
+  data[8] = data[9] = data[10] = data[11] = 0;        // NSCOUNT, ARCOUNT
+  if (!answer) return pos;
+
+  const uint8_t record[16] = {
+    0xC0, 0x0C,                                       // Name: pointer to the question
+    0x00, 0x01, 0x00, 0x01,                           // Type A, class IN
+    0x00, 0x00, 0x00, CAPTIVE_DNS_TTL_S,
+    0x00, 0x04,
+    (uint8_t)(address >> 24), (uint8_t)(address >> 16), (uint8_t)(address >> 8), (uint8_t)address
+  };
+  memcpy(data + pos, record, sizeof(record));
+  return pos + sizeof(record);
+}
+
+static void captive_dns_task(void *parameter) {
+  while (true) {
+    if (!active) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+
+    int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    struct sockaddr_in local = {};
+    local.sin_family = AF_INET;
+    local.sin_port = htons(CAPTIVE_DNS_PORT);
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (sock < 0 || bind(sock, (struct sockaddr *)&local, sizeof(local)) < 0) {
+      Serial.println("❌ Captive DNS: cannot open port 53, retrying");
+      if (sock >= 0) close(sock);
+      vTaskDelay(pdMS_TO_TICKS(1000));
+      continue;
+    }
+    struct timeval timeout = {0, CAPTIVE_DNS_POLL_MS * 1000};
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    Serial.println("🌐 Captive DNS responder started");
+
+    while (active) {
+      struct sockaddr_in from;
+      socklen_t fromLength = sizeof(from);
+      int received = recvfrom(sock, packet, sizeof(packet), 0, (struct sockaddr *)&from, &fromLength);
+      if (received <= 0) continue;   // Timeout - check active again
+
+      queryCount.fetch_add(1, std::memory_order_relaxed);
+      size_t length = captive_dns_reply(packet, received, sizeof(packet), apAddress);
+      if (length == 0) {
+        ignoredCount.fetch_add(1, std::memory_order_relaxed);
+        continue;
+      }
+      sendto(sock, packet, length, 0, (struct sockaddr *)&from, fromLength);
+      answeredCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    close(sock);
+    Serial.println("🌐 Captive DNS responder stopped");
+  }
+}
+
+static String captive_portal_url() {
+  uint32_t address = apAddress;
+  return "http://" + IPAddress(address >> 24, address >> 16, address >> 8, address).toString() + CAPTIVE_PORTAL_PATH;
+}
+
+void captive_portal_init() {
+  if (xTaskCreatePinnedToCore(captive_dns_task, "captive_dns", CAPTIVE_TASK_STACK, NULL,
+                              CAPTIVE_TASK_PRIORITY, &dnsTaskHandle, CAPTIVE_TASK_CORE) != pdPASS) {
+    Serial.println("❌ Captive DNS task creation failed - browse to the AP address directly");
+    dnsTaskHandle = NULL;
+  } else {
+    metrics_register_task("captive_dns", dnsTaskHandle);
+  }
+
+  // Portal up: send the OS to the WiFi page. Otherwise answer like the real check.
+  for (size_t i = 0; i < PROBE_COUNT; i++) {
+    server.on(PROBES[i].path, HTTP_GET, [i](AsyncWebServerRequest *req) {
+      probeCount.fetch_add(1, std::memory_order_relaxed);
+      if (active) {
+        redirectCount.fetch_add(1, std::memory_order_relaxed);
+        req->redirect(captive_portal_url());
+        return;
+      }
+      req->send(PROBES[i].code, PROBES[i].contentType, PROBES[i].body);
+    });
+  }
+
+  server.on("/captive_stats", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", captive_portal_get_stats_json());
+  });
+}
+
+void captive_portal_start(IPAddress apIP) {
+  apAddress = ((uint32_t)apIP[0] << 24) | ((uint32_t)apIP[1] << 16) | ((uint32_t)apIP[2] << 8) | apIP[3];
+  active = true;
+  if (dnsTaskHandle) xTaskNotifyGive(dnsTaskHandle);
+}
+
+void captive_portal_stop() {
+  active = false;   // The task closes its socket within CAPTIVE_DNS_POLL_MS
+}
+
+bool captive_portal_is_active() {
+  return active;
+}
+
+bool captive_portal_redirect(AsyncWebServerRequest *req) {
+  if (!active) return false;
+
+  uint32_t address = apAddress;
+  if (req->host() == IPAddress(address >> 24, address >> 16, address >> 8, address).toString()) return false;
+
+  redirectCount.fetch_add(1, std::memory_order_relaxed);
+  req->redirect(captive_portal_url());
+  return true;
+}
+
+String captive_portal_get_stats_json() {
+  char buffer[192];
+  JsonWriter json(buffer, sizeof(buffer));
+
+  json.beginObject();
+  json.field("active", (bool)active);
+  json.field("dnsQueries", (unsigned long)queryCount.load(std::memory_order_relaxed));
+  json.field("dnsAnswered", (unsigned long)answeredCount.load(std::memory_order_relaxed));
+  json.field("dnsIgnored", (unsigned long)ignoredCount.load(std::memory_order_relaxed));
+  json.field("probes", (unsigned long)probeCount.load(std::memory_order_relaxed));
+  json.field("redirects", (unsigned long)redirectCount.load(std::memory_order_relaxed));
+  json.endObject();
+
+  return String(json.c_str());
+}
@@ -0,0 +1,42 @@
+// CaptivePortal.h - DNS responder and OS connectivity probes for AP-mode setup
+//
+// While the setup AP is up, every DNS A query is answered with the AP address,
+// and the connectivity-check URLs phones and laptops fetch after joining a
+// network (/generate_204, /hotspot-detect.html, /connecttest.txt, ...) are
+// redirected to /wifi - so the OS pops up its "sign in to network" sheet on
+// the WiFi page instead of the user having to know 192.168.4.1.
+//
+// The responder runs on its own low-priority task with one static packet
+// buffer and one socket; it sleeps when the AP is down. Queries are answered
+// one at a time - a burst beyond the socket queue is dropped, never buffered.
+#ifndef CAPTIVEPORTAL_H
+#define CAPTIVEPORTAL_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#define CAPTIVE_DNS_PORT         53
+#define CAPTIVE_DNS_TTL_S        10      // Short, so answers do not outlive the AP
+#define CAPTIVE_DNS_PACKET_MAX   512     // Classic DNS-over-UDP limit; larger queries are dropped
+#define CAPTIVE_DNS_POLL_MS      500     // Receive timeout, so the task notices the AP going down
+#define CAPTIVE_TASK_STACK       2560
+#define CAPTIVE_TASK_PRIORITY    1       // Below WiFi/TCP; control on the other core is unaffected
+#define CAPTIVE_TASK_CORE        0
+#define CAPTIVE_PORTAL_PATH      "/wifi"
+
+// Setup - creates the responder task and registers the probe routes and /captive_stats
+void captive_portal_init();
+
+// Called by the WiFi manager as the setup AP comes up and goes down
+void captive_portal_start(IPAddress apIP);
+void captive_portal_stop();
+
+// For onNotFound: redirects to the portal page when active and the request
+// was for another host. Returns true if the request was answered.
+bool captive_portal_redirect(AsyncWebServerRequest *req);
+
+// Status
+bool captive_portal_is_active();
+String captive_portal_get_stats_json();
+
+#endif // CAPTIVEPORTAL_H
@@ -0,0 +1,41 @@
+// Clock.cpp - Monotonic 64-bit time base
+#include "Clock.h"
+#include <stddef.h>
+
+#ifdef ARDUINO
+#include "esp_timer.h"
+
+static uint64_t clock_hardware_source() {
+  return (uint64_t)esp_timer_get_time();
+}
+#define CLOCK_DEFAULT_SOURCE clock_hardware_source
+#else
+#define CLOCK_DEFAULT_SOURCE clock_manual_source
+#endif
+
+static volatile uint64_t manualNowUs = 0;
+static ClockSource activeSource = CLOCK_DEFAULT_SOURCE;
+
+uint64_t clock_us() {
+  return activeSource();
+}
+
+uint64_t clock_ms() {
+  return activeSource() / 1000;
+}
+
+void clock_set_source(ClockSource source) {
+  activeSource = (source != NULL) ? source : CLOCK_DEFAULT_SOURCE;
+}
+
+uint64_t clock_manual_source() {
+  return manualNowUs;
+}
+
+void clock_manual_set_us(uint64_t us) {
+  manualNowUs = us;
+}
+
+void clock_manual_advance_ms(uint64_t ms) {
+  manualNowUs += ms * 1000;
+}
@@ -0,0 +1,38 @@
+// Clock.h - Monotonic 64-bit time base with an injectable source
+//
+// millis() is 32 bits and wraps after 49.7 days, which breaks deadline
+// comparisons like "millis() > timeout". All control timing goes through
+// clock_ms() instead: a 64-bit millisecond count that never wraps in practice.
+// On the ESP32 the source is esp_timer_get_time(); host builds (no ARDUINO
+// define) start on a manual source that a simulation advances as fast as it
+// likes, and clock_set_source() can swap in any other source at runtime.
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <stdint.h>
+
+typedef uint64_t (*ClockSource)();  // Microseconds since an arbitrary epoch
+
+// Time
+uint64_t clock_us();
+uint64_t clock_ms();
+
+// Milliseconds since a clock_ms() timestamp
+inline uint64_t clock_elapsed_ms(uint64_t since) {
+  return clock_ms() - since;
+}
+
+// True once a clock_ms() deadline has been reached
+inline bool clock_expired(uint64_t deadline) {
+  return clock_ms() >= deadline;
+}
+
+// Source injection - NULL restores the default source
+void clock_set_source(ClockSource source);
+
+// Manual source for host simulation and replay
+uint64_t clock_manual_source();
+void clock_manual_set_us(uint64_t us);
+void clock_manual_advance_ms(uint64_t ms);
+
+#endif // CLOCK_H
@@ -0,0 +1,365 @@
+// CommandQueue.cpp - Control commands from web handlers, applied by loop()
+//
+// Replies use a small pool of tickets. A handler claims a FREE ticket, the
+// command carries its index, and the handler's chunked response answers
+// RESPONSE_TRY_AGAIN (AsyncTCP polls it again) until loop() marks the ticket
+// DONE with a message. The response owns the ticket: when the request is
+// freed - answered, timed out or disconnected - the ticket is released, or
+// marked ABANDONED for loop() to release if the command is still queued.
+#include "CommandQueue.h"
+#include "Globals.h"
+#include "Utility.h"
+#include "Ignition.h"
+#include "PelletControl.h"
+#include "RelayStats.h"
+#include "PelletAccounting.h"
+#include "WiFiManager.h"
+#include "LockFreeQueue.h"
+#include "JsonWriter.h"
+#include "Clock.h"
+#include <atomic>
+#include <memory>
+
+enum TicketState : uint8_t {
+  TICKET_FREE = 0,
+  TICKET_PENDING,     // Claimed by a handler, command queued
+  TICKET_DONE,        // Applied, message ready
+  TICKET_ABANDONED    // Request gone before loop() got to it
+};
+
+struct CommandTicket {
+  std::atomic<uint8_t> state;
+  bool ok;
+  char message[COMMAND_MESSAGE_LEN];
+};
+
+struct QueuedCommand {
+  Command command;
+  uint64_t queuedUs;
+};
+
+static LockFreeQueue<QueuedCommand, COMMAND_QUEUE_SIZE> commandQueue;
+static CommandTicket tickets[COMMAND_TICKETS];
+
+static std::atomic<uint32_t> postedCount(0);
+static std::atomic<uint32_t> droppedCount(0);
+static std::atomic<uint32_t> busyCount(0);
+static std::atomic<uint32_t> timeoutCount(0);
+static uint32_t appliedCount = 0;
+static uint32_t lastLatencyUs = 0;
+static uint32_t maxLatencyUs = 0;
+
+static uint64_t restartAt = 0;   // Deferred ESP.restart(), 0 = none
+
+void command_init(Command* command, CommandType type) {
+  memset(command, 0, sizeof(*command));
+  command->type = type;
+  command->ticket = -1;
+  command->relays = {RELAY_NOCHANGE, RELAY_NOCHANGE, RELAY_NOCHANGE, RELAY_NOCHANGE, 0, false};
+}
+
+bool command_post(const Command& command) {
+  QueuedCommand queued = {command, clock_us()};
+  if (!commandQueue.push(queued)) {
+    droppedCount++;
+    return false;
+  }
+  postedCount++;
+  return true;
+}
+
+static int command_claim_ticket() {
+  for (int i = 0; i < COMMAND_TICKETS; i++) {
+    uint8_t expected = TICKET_FREE;
+    if (tickets[i].state.compare_exchange_strong(expected, TICKET_PENDING)) return i;
+  }
+  return -1;
+}
+
+// Called when the response holding the ticket is destroyed
+static void command_release_ticket(int index) {
+  uint8_t expected = TICKET_PENDING;
+  if (!tickets[index].state.compare_exchange_strong(expected, TICKET_ABANDONED)) {
+    tickets[index].state.store(TICKET_FREE);   // DONE - nobody else touches it
+  }
+}
+
+// Owned by the response filler; releases the ticket when the request is freed
+struct CommandReply {
+  int ticket;
+  uint64_t submitted;
+  CommandReplyFormat format;
+  bool sent;
+  ~CommandReply() { command_release_ticket(ticket); }
+};
+
+static void command_send_busy(AsyncWebServerRequest *req, CommandReplyFormat format, const char* message) {
+  if (format == COMMAND_REPLY_TEXT) {
+    req->send(503, "text/plain", message);
+    return;
+  }
+  char buffer[COMMAND_MESSAGE_LEN + 48];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.beginObject("error");
+  json.field("code", "busy");
+  json.field("message", message);
+  json.endObject();
+  json.endObject();
+  req->send(503, "application/json", json.c_str());
+}
+
+bool command_submit(AsyncWebServerRequest *req, Command& command, CommandReplyFormat format) {
+  int ticket = command_claim_ticket();
+  if (ticket < 0) {
+    busyCount++;
+    command_send_busy(req, format, "Busy - too many commands pending");
+    return false;
+  }
+
+  command.ticket = ticket;
+  if (!command_post(command)) {
+    command.ticket = -1;
+    tickets[ticket].state.store(TICKET_FREE);
+    command_send_busy(req, format, "Busy - command queue full");
+    return false;
+  }
+
+  std::shared_ptr<CommandReply> reply(new CommandReply());
+  reply->ticket = ticket;
+  reply->submitted = clock_ms();
+  reply->format = format;
+  reply->sent = false;
+
+  const char* contentType = (format == COMMAND_REPLY_JSON) ? "application/json" : "text/plain";
+  AsyncWebServerResponse *response = req->beginChunkedResponse(contentType,
+    [reply](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+      if (reply->sent) return 0;
+
+      const char* message;
+      bool ok = true;
+      bool queued = false;
+      CommandTicket& t = tickets[reply->ticket];
+      if (t.state.load(std::memory_order_acquire) == TICKET_DONE) {
+        message = t.message;
+        ok = t.ok;
+      } else if (clock_elapsed_ms(reply->submitted) < COMMAND_TIMEOUT_MS) {
+        return RESPONSE_TRY_AGAIN;
+      } else {
+        timeoutCount++;
+        queued = true;
+        message = "Command queued - controller busy, it will be applied shortly";
+      }
+
+      char text[COMMAND_MESSAGE_LEN + 48];
+      if (reply->format == COMMAND_REPLY_JSON) {
+        JsonWriter json(text, sizeof(text));
+        json.beginObject();
+        json.field("ok", ok);
+        if (queued) json.field("queued", true);
+        json.field("message", message);
+        json.endObject();
+        message = text;
+      }
+
+      size_t length = min(strlen(message), maxLen);
+      memcpy(buffer, message, length);
+      reply->sent = true;
+      return length;
+    });
+  response->addHeader("Cache-Control", "no-store");
+  req->send(response);
+  return true;
+}
+
+// Run one command on the loop task and write its reply text; false if refused
+static bool command_apply(const Command& command, char* message, size_t size) {
+  switch (command.type) {
+    case CMD_SET_TEMP:
+      setpoint = command.temperature;
+      save_setpoint();
+      snprintf(message, size, "Temperature set to %dF", command.temperature);
+      break;
+
+    case CMD_START: {
+      Serial.println("🚀 Command: START grill");
+      if (grillRunning) {
+        snprintf(message, size, "Grill already running");
+        break;
+      }
+      double currentTemp = readGrillTemperature();
+      if (!isValidTemperature(currentTemp)) {
+        Serial.println("   ERROR: Invalid temperature reading, cannot start");
+        snprintf(message, size, "Cannot start: Invalid temperature sensor reading");
+        return false;
+      }
+      Serial.printf("   Starting grill at %.1f°F, target: %.1f°F\n", currentTemp, setpoint);
+      grillRunning = true;
+      relay_clear_manual();   // Manual overrides would fight the ignition sequence
+      ignition_start(currentTemp);
+      snprintf(message, size, "Grill started successfully - ignition sequence initiated");
+      break;
+    }
+
+    case CMD_STOP: {
+      Serial.println("🛑 Command: STOP grill");
+      if (!grillRunning) {
+        snprintf(message, size, "Grill already stopped");
+        break;
+      }
+      grillRunning = false;
+      ignition_stop();
+      relay_clear_manual();
+      RelayRequest stopReq = {RELAY_OFF, RELAY_OFF, RELAY_ON, RELAY_ON};  // Keep fans on for cooling
+      relay_request_auto(&stopReq);
+      snprintf(message, size, "Grill stopped successfully - cooling down");
+      break;
+    }
+
+    case CMD_FORCE_START: {
+      Serial.println("🔧 Command: FORCE START");
+      grillRunning = true;
+      relay_clear_manual();
+      double currentTemp = readGrillTemperature();
+      if (!isValidTemperature(currentTemp)) {
+        currentTemp = 70.0;   // Room temperature fallback
+        Serial.println("   Using fallback temperature for force start");
+      }
+      ignition_start(currentTemp);
+      snprintf(message, size, "Force start completed");
+      break;
+    }
+
+    case CMD_FORCE_STOP:
+      Serial.println("🔧 Command: FORCE STOP");
+      grillRunning = false;
+      ignition_stop();
+      relay_emergency_stop();
+      snprintf(message, size, "Force stop completed");
+      break;
+
+    case CMD_EMERGENCY_STOP:
+      // Relays were already dropped by the caller; this settles the control state
+      grillRunning = false;
+      ignition_stop();
+      snprintf(message, size, "EMERGENCY STOP activated");
+      break;
+
+    case CMD_MANUAL_RELAY: {
+      RelayRequest request = command.relays;
+      relay_request_manual(&request);
+      snprintf(message, size, "Manual override applied");
+      break;
+    }
+
+    case CMD_CLEAR_MANUAL:
+      relay_clear_manual();
+      snprintf(message, size, "Manual override cleared");
+      break;
+
+    case CMD_REBOOT:
+      grillRunning = false;
+      relay_emergency_stop();
+      restartAt = clock_ms() + COMMAND_RESTART_DELAY_MS;
+      snprintf(message, size, "Rebooting...");
+      break;
+
+    case CMD_WIFI_RESET:
+      // Cleared on the network task, which then posts CMD_REBOOT
+      wifiManager.requestReset();
+      snprintf(message, size, "Resetting WiFi settings. Restarting in AP mode...");
+      break;
+
+    case CMD_APPLY_SETTINGS: {
+      const char* reason;
+      if (!settings_apply_patch(command.settings, &reason)) {
+        snprintf(message, size, "Settings not changed: %s", reason);
+        return false;
+      }
+      snprintf(message, size, "Settings updated");
+      break;
+    }
+
+    case CMD_SET_PROBE_TARGET: {
+      const ProbeTargetRequest& request = command.probeTarget;
+      if (!probe_alarm_configure(request.probe, request.target, request.high, request.low,
+                                 request.hysteresis, request.keepWarm)) {
+        snprintf(message, size, "Probe %d could not be configured", request.probe + 1);
+        return false;
+      }
+      snprintf(message, size, "Probe %d target set to %dF", request.probe + 1, (int)request.target);
+      break;
+    }
+
+    case CMD_PROBE_ALARM_ACK:
+      probe_alarm_acknowledge();
+      snprintf(message, size, "Probe alarms acknowledged");
+      break;
+
+    case CMD_RELAY_STATS_RESET:
+      relay_stats_reset(command.relayChannel);   // Flushes to NVS here, not on AsyncTCP
+      snprintf(message, size, "Wear counters reset for %s", relay_stats_channel_name(command.relayChannel));
+      break;
+
+    case CMD_HOPPER_REFILL:
+      // Capacity may have changed since the handler checked it
+      if (command.hopperLevel > pellet_get_hopper_capacity_lb()) {
+        snprintf(message, size, "Level above hopper capacity (%.1f lb)", pellet_get_hopper_capacity_lb());
+        return false;
+      }
+      pellet_hopper_refill(command.hopperLevel);
+      snprintf(message, size, "Hopper level set to %.1f lb", pellet_get_hopper_remaining_lb());
+      break;
+
+    default:
+      snprintf(message, size, "Unknown command");
+      return false;
+  }
+  return true;
+}
+
+void command_process() {
+  QueuedCommand queued;
+  while (commandQueue.pop(queued)) {
+    const Command& command = queued.command;
+    char message[COMMAND_MESSAGE_LEN];
+    bool ok = command_apply(command, message, sizeof(message));
+
+    appliedCount++;
+    lastLatencyUs = (uint32_t)(clock_us() - queued.queuedUs);
+    if (lastLatencyUs > maxLatencyUs) maxLatencyUs = lastLatencyUs;
+
+    if (command.ticket >= 0 && command.ticket < COMMAND_TICKETS) {
+      CommandTicket& t = tickets[command.ticket];
+      snprintf(t.message, sizeof(t.message), "%s", message);
+      t.ok = ok;
+      uint8_t expected = TICKET_PENDING;
+      if (!t.state.compare_exchange_strong(expected, TICKET_DONE)) {
+        t.state.store(TICKET_FREE);   // ABANDONED - the request is gone
+      }
+    }
+  }
+
+  if (restartAt != 0 && clock_expired(restartAt)) {
+    Serial.println("🔄 Restarting on request");
+    ESP.restart();
+  }
+}
+
+String command_get_stats_json() {
+  char buffer[256];
+  JsonWriter json(buffer, sizeof(buffer));
+
+  json.beginObject();
+  json.field("posted", postedCount.load());
+  json.field("applied", appliedCount);
+  json.field("pending", commandQueue.size());
+  json.field("dropped", droppedCount.load());
+  json.field("busy", busyCount.load());
+  json.field("timedOut", timeoutCount.load());
+  json.field("lastLatencyUs", lastLatencyUs);
+  json.field("maxLatencyUs", maxLatencyUs);
+  json.endObject();
+
+  return String(json.c_str());
+}
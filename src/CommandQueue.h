@@ -0,0 +1,70 @@
+// CommandQueue.h - Control commands from web handlers, applied by loop()
+//
+// Handlers validate their parameters, enqueue a Command and return at once;
+// loop() applies it between control cycles, so setpoint, grillRunning and the
+// ignition state are only ever written from the loop task. The HTTP reply is
+// completed with loop()'s result message once the command has run.
+#ifndef COMMANDQUEUE_H
+#define COMMANDQUEUE_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include "RelayControl.h"
+#include "Settings.h"
+#include "ProbeAlarm.h"
+
+#define COMMAND_QUEUE_SIZE     16     // Pending commands (power of two), headroom over the tickets
+#define COMMAND_TICKETS        8      // Replies that can be outstanding at once
+#define COMMAND_MESSAGE_LEN    96
+#define COMMAND_TIMEOUT_MS     3000   // Reply anyway if loop() has not applied it
+#define COMMAND_RESTART_DELAY_MS 1000 // Let the reply reach the browser before restarting
+
+enum CommandType : uint8_t {
+  CMD_SET_TEMP = 0,
+  CMD_START,
+  CMD_STOP,
+  CMD_FORCE_START,
+  CMD_FORCE_STOP,
+  CMD_EMERGENCY_STOP,
+  CMD_MANUAL_RELAY,
+  CMD_CLEAR_MANUAL,
+  CMD_REBOOT,
+  CMD_WIFI_RESET,
+  CMD_APPLY_SETTINGS,
+  CMD_SET_PROBE_TARGET,
+  CMD_PROBE_ALARM_ACK,
+  CMD_RELAY_STATS_RESET,
+  CMD_HOPPER_REFILL,
+  CMD_TYPE_COUNT
+};
+
+struct Command {
+  CommandType type;
+  int8_t ticket;              // Reply slot, -1 = no reply wanted
+  int temperature;            // CMD_SET_TEMP
+  RelayRequest relays;        // CMD_MANUAL_RELAY
+  SettingsPatch settings;     // CMD_APPLY_SETTINGS
+  ProbeTargetRequest probeTarget;   // CMD_SET_PROBE_TARGET
+  uint8_t relayChannel;       // CMD_RELAY_STATS_RESET, RelayChannel
+  float hopperLevel;          // CMD_HOPPER_REFILL, lb (0 = full)
+};
+
+// How the reply to a submitted command is written
+enum CommandReplyFormat : uint8_t {
+  COMMAND_REPLY_TEXT = 0,     // The message as text/plain
+  COMMAND_REPLY_JSON          // {"ok":..,"message":..} for /api/v2
+};
+
+// Producer side - safe from any task
+void command_init(Command* command, CommandType type);
+bool command_post(const Command& command);                          // Fire and forget
+bool command_submit(AsyncWebServerRequest *req, Command& command,   // Replies once applied; false = sent 503
+                    CommandReplyFormat format = COMMAND_REPLY_TEXT);
+
+// Consumer side - call from loop() every iteration
+void command_process();
+
+// Status
+String command_get_stats_json();
+
+#endif // COMMANDQUEUE_H
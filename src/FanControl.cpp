@@ -0,0 +1,131 @@
+// FanControl.cpp - Blower duty controller feeding RelayRequest
+#include "FanControl.h"
+#include "Globals.h"
+#include "Utility.h"
+#include "RelayControl.h"
+#include "Ignition.h"
+#include "Clock.h"
+
+static bool smokeModeEnabled = false;
+static FanMode currentMode = FAN_MODE_IDLE;
+static uint8_t currentDuty = FAN_DUTY_NORMAL;
+static uint64_t smokeCycleStart = 0;
+
+void fan_control_init() {
+  preferences.begin("fan", true);
+  smokeModeEnabled = preferences.getBool("smokeMode", false);
+  preferences.end();
+
+  currentMode = FAN_MODE_IDLE;
+  currentDuty = FAN_DUTY_NORMAL;
+  smokeCycleStart = clock_ms();
+
+  Serial.printf("Fan control initialized: smoke mode %s, blower PWM %s\n",
+                smokeModeEnabled ? "ON" : "OFF", BLOWER_PWM_ENABLED ? "ENABLED" : "DISABLED");
+}
+
+// Pick the mode for this cycle - recovery uses hysteresis so it doesn't chatter
+static FanMode fan_select_mode(double temp) {
+  if (!grillRunning) return FAN_MODE_IDLE;
+
+  IgnitionState ignState = ignition_get_state();
+  if (ignState != IGNITION_OFF && ignState != IGNITION_COMPLETE && ignState != IGNITION_FAILED) {
+    return FAN_MODE_IGNITION;
+  }
+
+  if (isValidTemperature(temp)) {
+    if (currentMode == FAN_MODE_RECOVERY) {
+      if (temp < setpoint - FAN_RECOVERY_EXIT) return FAN_MODE_RECOVERY;
+    } else if (temp < setpoint - FAN_RECOVERY_ENTER) {
+      return FAN_MODE_RECOVERY;
+    }
+  }
+
+  if (smokeModeEnabled && setpoint <= SMOKE_MAX_SETPOINT) {
+    return FAN_MODE_SMOKE;
+  }
+  return FAN_MODE_HOLD;
+}
+
+void fan_control_update() {
+  uint64_t now = clock_ms();
+  double temp = readGrillTemperature();
+
+  FanMode newMode = fan_select_mode(temp);
+  if (newMode != currentMode) {
+    if (newMode == FAN_MODE_SMOKE) smokeCycleStart = now;
+    Serial.printf("Fan mode: %s -> ", fan_get_mode_string().c_str());
+    currentMode = newMode;
+    Serial.println(fan_get_mode_string());
+  }
+
+  uint8_t duty = currentDuty;
+  switch (currentMode) {
+    case FAN_MODE_IDLE:
+      return;  // Leave the blower to whoever stopped the grill
+
+    case FAN_MODE_IGNITION:
+      duty = FAN_DUTY_IGNITION;
+      break;
+
+    case FAN_MODE_RECOVERY:
+      duty = FAN_DUTY_RECOVERY;
+      break;
+
+    case FAN_MODE_SMOKE: {
+      uint64_t cyclePos = (now - smokeCycleStart) % SMOKE_CYCLE_TIME;
+      duty = (cyclePos < SMOKE_PULSE_TIME) ? FAN_DUTY_SMOKE_PULSE : FAN_DUTY_SMOKE_LOW;
+      break;
+    }
+
+    case FAN_MODE_HOLD: {
+      // Trim around the hold duty: +2% per degree below setpoint, -2% per degree above
+      double error = isValidTemperature(temp) ? setpoint - temp : 0.0;
+      int trimmed = FAN_DUTY_NORMAL + (int)(error * 2.0);
+      duty = constrain(trimmed, FAN_DUTY_MIN, 100);
+      break;
+    }
+  }
+
+  if (duty == currentDuty && duty == relay_get_blower_duty()) return;
+  currentDuty = duty;
+
+  RelayRequest dutyReq = {RELAY_NOCHANGE, RELAY_NOCHANGE, RELAY_NOCHANGE, RELAY_NOCHANGE};
+  dutyReq.blowerDuty = duty;
+  dutyReq.setBlowerDuty = true;
+  relay_request_auto(&dutyReq);
+}
+
+void fan_set_smoke_mode(bool enabled) {
+  smokeModeEnabled = enabled;
+  smokeCycleStart = clock_ms();
+
+  preferences.begin("fan", false);
+  preferences.putBool("smokeMode", smokeModeEnabled);
+  preferences.end();
+
+  Serial.printf("Smoke mode %s\n", enabled ? "ENABLED" : "DISABLED");
+}
+
+bool fan_get_smoke_mode() {
+  return smokeModeEnabled;
+}
+
+FanMode fan_get_mode() {
+  return currentMode;
+}
+
+uint8_t fan_get_duty() {
+  return currentDuty;
+}
+
+String fan_get_mode_string() {
+  switch (currentMode) {
+    case FAN_MODE_IDLE: return "IDLE";
+    case FAN_MODE_IGNITION: return "IGNITION";
+    case FAN_MODE_RECOVERY: return "RECOVERY";
+    case FAN_MODE_SMOKE: return "SMOKE";
+    case FAN_MODE_HOLD: return "HOLD";
+    default: return "UNKNOWN";
+  }
+}
@@ -0,0 +1,54 @@
+// FanControl.h - Blower duty controller (smoke cycles, ignition and recovery boost)
+#ifndef FANCONTROL_H
+#define FANCONTROL_H
+
+#include <Arduino.h>
+
+// Fan duty levels (percent)
+#define FAN_DUTY_IGNITION    100  // Full airflow while lighting
+#define FAN_DUTY_RECOVERY    100  // Full airflow when well below setpoint
+#define FAN_DUTY_NORMAL      60   // Holding at setpoint
+#define FAN_DUTY_MIN         35   // Floor for sustained duty - hold-mode trim never goes below it
+#define FAN_DUTY_SMOKE_LOW   30   // Smoldering part of a smoke cycle, below FAN_DUTY_MIN on purpose:
+                                  // it lasts 45 s between 15 s pulses, which the fire pot's embers
+                                  // ride out, and the cycle averages 40% - above the floor
+#define FAN_DUTY_SMOKE_PULSE 70   // Short pulse to keep the fire lit
+
+// Smoke mode cycle
+#define SMOKE_MAX_SETPOINT   225.0  // Smoke cycles only run at or below this setpoint
+#define SMOKE_CYCLE_TIME     60000  // 60 second cycle
+#define SMOKE_PULSE_TIME     15000  // 15 seconds of pulse per cycle
+
+// Keep the smoke cycle's average airflow at or above the sustained floor
+#if (FAN_DUTY_SMOKE_PULSE * SMOKE_PULSE_TIME + FAN_DUTY_SMOKE_LOW * (SMOKE_CYCLE_TIME - SMOKE_PULSE_TIME)) < \
+    (FAN_DUTY_MIN * SMOKE_CYCLE_TIME)
+#error "Smoke cycle averages below FAN_DUTY_MIN"
+#endif
+
+// Recovery band - boost below (setpoint - enter), release above (setpoint - exit)
+#define FAN_RECOVERY_ENTER   25.0
+#define FAN_RECOVERY_EXIT    10.0
+
+// Fan controller modes
+enum FanMode {
+  FAN_MODE_IDLE,
+  FAN_MODE_IGNITION,
+  FAN_MODE_RECOVERY,
+  FAN_MODE_SMOKE,
+  FAN_MODE_HOLD
+};
+
+// Fan control functions
+void fan_control_init();
+void fan_control_update();   // Call once per control cycle
+
+// Smoke mode
+void fan_set_smoke_mode(bool enabled);
+bool fan_get_smoke_mode();
+
+// Status
+FanMode fan_get_mode();
+uint8_t fan_get_duty();
+String fan_get_mode_string();
+
+#endif // FANCONTROL_H
@@ -22,6 +22,15 @@ extern MAX31865Sensor grillSensor;
 #define RELAY_HOPPER_FAN_PIN  25  // GPIO25 - Hopper fan relay
 #define RELAY_BLOWER_FAN_PIN  14  // GPIO14 - Blower fan relay
 
+// ===== BLOWER PWM (optional DC blower on LEDC) =====
+#ifndef BLOWER_PWM_ENABLED
+#define BLOWER_PWM_ENABLED 0      // Set to 1 (or -DBLOWER_PWM_ENABLED=1) for a PWM speed input
+#endif
+#define BLOWER_PWM_PIN        13  // GPIO13 - Blower PWM output
+#define BLOWER_PWM_CHANNEL    0   // LEDC channel
+#define BLOWER_PWM_FREQ       25000 // 25kHz - above audible range for DC fans
+#define BLOWER_PWM_RESOLUTION 8   // 8-bit duty
+
 // ===== MAX31865 PIN DEFINITIONS =====
 #define MAX31865_CS_PIN   5     // GPIO5 - Chip Select
 // SPI uses default pins: SCK=18, MISO=19, MOSI=23
@@ -50,7 +59,7 @@ extern MAX31865Sensor grillSensor;
 extern bool grillRunning;
 extern double setpoint;
 extern AsyncWebServer server;
-extern Preferences preferences;
+extern Preferences preferences;   // Control task only - other tasks keep their own handle
 
 // ===== TEMPERATURE LIMITS =====
 #define MIN_SETPOINT 150.0
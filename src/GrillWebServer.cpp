@@ -1,4 +1,5 @@
 // GrillWebServer.cpp - Complete version with MAX31865 support (no GRILL_TEMP_PIN references)
+#include "GrillWebServer.h"
 #include "Globals.h"
 #include "Utility.h"
 #include "PelletControl.h" 
@@ -8,654 +9,220 @@
 #include "WiFiManager.h"
 #include "TemperatureSensor.h"
 #include "MAX31865Sensor.h"  // Add MAX31865 support
+#include "ProbeAlarm.h"
+#include "ProbePredictor.h"
+#include "FanControl.h"
+#include "PelletAccounting.h"
+#include "RelaySafety.h"
+#include "RelayStats.h"
+#include "Clock.h"
+#include "TelemetryPush.h"
+#include "History.h"
+#include "Metrics.h"
+#include "CommandQueue.h"
+#include "StatusCache.h"
+#include "ApiV2.h"
+#include "HttpAdmission.h"
+#include "Jobs.h"
+#include "Mqtt.h"
+#include "Beacon.h"
+#include "CaptivePortal.h"
+#include "Boot.h"
+#include "Tasks.h"
+#include "WebAssets.h"
 #include <WiFi.h>
 #include <Preferences.h>
 #include <WiFiClient.h>
 #include <ElegantOTA.h>
 
-void setup_grill_server() {
-  // Main dashboard with all 6 temperatures and REAL-TIME relay updates
-// REPLACE the main dashboard route in GrillWebServer.cpp with this properly escaped version:
-
-  // Replace the main dashboard route in GrillWebServer.cpp with this version that includes Prime button
-
-server.on("/", HTTP_GET, [](AsyncWebServerRequest *req) {
-  // Get all sensor data
-  double grillTemp = readGrillTemperature();
-  double ambientTemp = readAmbientTemperature();
-  float meat1 = tempSensor.getFoodTemperature(1);
-  float meat2 = tempSensor.getFoodTemperature(2);
-  float meat3 = tempSensor.getFoodTemperature(3);
-  float meat4 = tempSensor.getFoodTemperature(4);
-  
-  String status = getStatus(grillTemp);
-  bool ignOn = digitalRead(RELAY_IGNITER_PIN) == HIGH;
-  bool augOn = digitalRead(RELAY_AUGER_PIN) == HIGH;
-  bool hopOn = digitalRead(RELAY_HOPPER_FAN_PIN) == HIGH;
-  bool bloOn = digitalRead(RELAY_BLOWER_FAN_PIN) == HIGH;
-  
-  String html = "<!DOCTYPE html><html><head>";
-  html += "<meta charset='utf-8'>";
-  html += "<meta name='viewport' content='width=device-width, initial-scale=1, user-scalable=no'>";
-  html += "<title>Green Mountain Grill Controller</title>";
-  html += "<style>";
-  html += "* { box-sizing: border-box; margin: 0; padding: 0; }";
-  html += "body { background: linear-gradient(135deg, #1e3c72, #2a5298); color: #fff; ";
-  html += "font-family: Arial, sans-serif; padding: 10px; min-height: 100vh; }";
-  html += ".container { max-width: 800px; margin: 0 auto; }";
-  html += ".header { text-align: center; margin-bottom: 20px; }";
-  html += ".header h1 { font-size: 2em; margin-bottom: 10px; }";
-  html += ".grill-temp { background: rgba(255,255,255,0.15); border-radius: 15px; ";
-  html += "padding: 20px; margin-bottom: 20px; text-align: center; border: 2px solid #4ade80; }";
-  html += ".grill-temp-main { font-size: 3em; font-weight: bold; margin-bottom: 10px; }";
-  html += ".grill-temp-set { font-size: 1.2em; margin-bottom: 10px; }";
-  html += ".status { font-size: 1.3em; font-weight: bold; padding: 10px; border-radius: 10px; }";
-  html += ".temp-grid { display: grid; grid-template-columns: repeat(auto-fit, minmax(180px, 1fr)); gap: 15px; margin: 20px 0; }";
-  html += ".temp-card { background: rgba(255,255,255,0.1); padding: 15px; border-radius: 10px; text-align: center; }";
-  html += ".temp-card.grill { border: 2px solid #4ade80; }";
-  html += ".temp-card.ambient { border: 2px solid #60a5fa; }";
-  html += ".temp-card.meat { border: 2px solid #f59e0b; }";
-  html += ".temp-card h3 { font-size: 0.9em; margin-bottom: 8px; opacity: 0.8; }";
-  html += ".temp-value { font-size: 1.8em; font-weight: bold; margin-bottom: 5px; }";
-  html += ".temp-type { font-size: 0.8em; opacity: 0.7; }";
-  html += ".temp-invalid { color: #ef4444; }";
-  html += ".controls { display: grid; grid-template-columns: 1fr 1fr 1fr; gap: 10px; margin: 20px 0; }";
-  html += ".btn { padding: 15px; font-size: 1.1em; font-weight: bold; border: none; ";
-  html += "border-radius: 10px; color: white; cursor: pointer; text-align: center; text-decoration: none; display: block; }";
-  html += ".btn:disabled { opacity: 0.6; cursor: not-allowed; }";
-  html += ".btn-primary { background: #667eea; }";
-  html += ".btn-danger { background: #f093fb; }";
-  html += ".btn-success { background: #4facfe; }";
-  html += ".btn-warning { background: #fbbf24; }";
-  html += ".btn-prime { background: #8b5cf6; }";
-  html += ".temp-presets { display: grid; grid-template-columns: repeat(3, 1fr); gap: 8px; margin: 15px 0; }";
-  html += ".temp-preset { padding: 12px; background: rgba(255,255,255,0.1); border: none; ";
-  html += "border-radius: 8px; color: white; cursor: pointer; }";
-  html += ".relays { display: grid; grid-template-columns: 1fr 1fr; gap: 10px; margin: 20px 0; }";
-  html += ".relay { display: flex; align-items: center; padding: 12px; ";
-  html += "background: rgba(255,255,255,0.1); border-radius: 10px; }";
-  html += ".relay-dot { width: 12px; height: 12px; border-radius: 50%; margin-right: 10px; transition: all 0.3s ease; }";
-  html += ".relay-on { background: #4ade80; box-shadow: 0 0 10px #4ade80; }";
-  html += ".relay-off { background: #6b7280; }";
-  html += ".link-btn { display: inline-block; margin: 5px; padding: 8px 15px; ";
-  html += "background: rgba(255,255,255,0.2); color: white; text-decoration: none; border-radius: 5px; }";
-  html += ".status.igniting { background: #ff6b35; }";
-  html += ".status.heating { background: #ff9a56; }";
-  html += ".status.at-temp { background: #4ecdc4; }";
-  html += ".status.idle { background: rgba(255,255,255,0.2); }";
-  html += "</style></head><body>";
-  
-  html += "<div class='container'>";
-  html += "<div class='header'>";
-  html += "<h1>Green Mountain Grill</h1>";
-  html += "<div>Daniel Boone Controller - PiFire Auger</div>";
-  html += "<div>IP: " + WiFi.localIP().toString() + "</div>";
-  html += "<div style='margin: 15px 0;'>";
-  html += "<a href='/wifi' class='link-btn'>WiFi Settings</a>";
-  html += "<a href='/manual' class='link-btn'>Manual Control</a>";
-  html += "<a href='/pid' class='link-btn'>PID Tuning</a>";
-  html += "<a href='/debug' class='link-btn'>Debug</a>";
-  html += "<a href='/update' class='link-btn'>OTA Update</a>";
-  html += "<a href='/grill_debug' class='link-btn'>Debug Info</a>";
-  html += "</div></div>";
-  
-  html += "<div style='margin: 10px 0; text-align: center;'>";
-  html += "<label style='color: #bbb; font-size: 0.9em;'>Update Speed: ";
-  html += "<select id='updateSpeed' onchange='changeUpdateSpeed()' style='background: #333; color: #fff; border: 1px solid #555; border-radius: 3px; padding: 2px;'>";
-  html += "<option value='1000'>Fast (1s)</option>";
-  html += "<option value='1500' selected>Normal (1.5s)</option>";
-  html += "<option value='3000'>Slow (3s)</option>";
-  html += "<option value='5000'>Very Slow (5s)</option>";
-  html += "<option value='0'>Paused</option>";
-  html += "</select></label></div>";
-
-  // Main grill temperature display
-  html += "<div class='grill-temp'>";
-  if (isValidTemperature(grillTemp)) {
-    html += "<div class='temp-value' id='grill-temp-main'>" + String(grillTemp, 1) + "&deg;F</div>";
-  } else {
-    html += "<div class='temp-value temp-invalid'>ERROR</div>";
+// Send a precompressed page from flash, or 304 when the client's copy is current
+static void send_web_asset(AsyncWebServerRequest *req, const WebAsset *asset) {
+  if (req->hasHeader("If-None-Match") && req->getHeader("If-None-Match")->value() == asset->etag) {
+    AsyncWebServerResponse *response = req->beginResponse(304);
+    response->addHeader("ETag", asset->etag);
+    response->addHeader("Cache-Control", WEB_CACHE_CONTROL);
+    req->send(response);
+    return;
   }
-  html += "<div class='grill-temp-set'>Target: <span id='setpoint'>" + String((int)setpoint) + "</span>&deg;F</div>";
-  String statusClass = status;
-  statusClass.toLowerCase();
-  statusClass.replace(" ", "-");
-  html += "<div class='status " + statusClass + "' id='status'>" + status + "</div>";
-  html += "</div>";
-  
-  // Temperature grid
-  html += "<div class='temp-grid'>";
-  
-  // Grill Temperature Card
-  html += "<div class='temp-card grill'><h3>GRILL TEMPERATURE</h3>";
-  if (isValidTemperature(grillTemp)) {
-    html += "<div class='temp-value' id='grill-temp-card'>" + String(grillTemp, 1) + "&deg;F</div>";
-  } else {
-    html += "<div class='temp-value temp-invalid'>ERROR</div>";
-  }
-  html += "<div class='temp-type'>MAX31865 RTD</div></div>";
-  
-  // Ambient Temperature Card
-  html += "<div class='temp-card ambient'><h3>AMBIENT</h3>";
-  if (ambientTemp > -900) {
-    html += "<div class='temp-value' id='ambient-temp'>" + String(ambientTemp, 1) + "&deg;F</div>";
-  } else {
-    html += "<div class='temp-value temp-invalid'>N/A</div>";
+
+  AsyncWebServerResponse *response = req->beginResponse_P(200, asset->contentType, asset->data, asset->length);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", asset->etag);
+  response->addHeader("Cache-Control", WEB_CACHE_CONTROL);
+  req->send(response);
+}
+
+// Send text formatted with snprintf into a fixed buffer
+static void send_text(AsyncWebServerRequest *req, const char *text, int length, size_t capacity) {
+  if (length < 0 || (size_t)length >= capacity) {
+    req->send(500, "text/plain", "Response too large");
+    return;
   }
-  html += "<div class='temp-type'>10K NTC</div></div>";
-  
-  // Meat Probe Cards
-  html += "<div class='temp-card meat'><h3>MEAT PROBE 1</h3>";
-  if (meat1 > -900) {
-    html += "<div class='temp-value' id='meat1-temp'>" + String(meat1, 1) + "&deg;F</div>";
-  } else {
-    html += "<div class='temp-value temp-invalid'>N/A</div>";
+  AsyncResponseStream *response = req->beginResponseStream("text/plain", length);
+  response->write((const uint8_t *)text, length);
+  req->send(response);
+}
+
+// Numeric query parameter into a settings patch, checked against the SETTINGS
+// range; false after sending 400 - toFloat() would turn "abc" into 0
+static bool setting_from_param(AsyncWebServerRequest *req, const char *param, int id, SettingsPatch *patch) {
+  const SettingInfo *info = settings_get_info(id);
+  String text = req->getParam(param)->value();
+  char *end = NULL;
+  double value = strtod(text.c_str(), &end);
+  if (text.length() == 0 || *end != '\0' || isnan(value) || isinf(value)) {
+    char message[48];
+    snprintf(message, sizeof(message), "%s must be a number", param);
+    req->send(400, "text/plain", message);
+    return false;
   }
-  html += "<div class='temp-type'>1K NTC</div></div>";
-  
-  html += "<div class='temp-card meat'><h3>MEAT PROBE 2</h3>";
-  if (meat2 > -900) {
-    html += "<div class='temp-value' id='meat2-temp'>" + String(meat2, 1) + "&deg;F</div>";
-  } else {
-    html += "<div class='temp-value temp-invalid'>N/A</div>";
+  if (value < info->min || value > info->max) {
+    char message[48];
+    snprintf(message, sizeof(message), "%s out of range (%g-%g)", param, info->min, info->max);
+    req->send(400, "text/plain", message);
+    return false;
   }
-  html += "<div class='temp-type'>1K NTC</div></div>";
-  
-  html += "<div class='temp-card meat'><h3>MEAT PROBE 3</h3>";
-  if (meat3 > -900) {
-    html += "<div class='temp-value' id='meat3-temp'>" + String(meat3, 1) + "&deg;F</div>";
-  } else {
-    html += "<div class='temp-value temp-invalid'>N/A</div>";
+  patch->values[id] = value;
+  patch->mask |= SETTING_BIT(id);
+  return true;
+}
+
+// MAX31865 register dump - runs on the job task
+static void spi_register_dump_job(JobOutput *out) {
+  static const char *const REGISTER_NAMES[] = {"Config", "RTD MSB", "RTD LSB", "High Fault MSB",
+                                               "High Fault LSB", "Low Fault MSB", "Low Fault LSB", "Fault Status"};
+
+  job_printf(out, "MAX31865 Register Dump:\n\n");
+  for (uint8_t reg = 0; reg < 8; reg++) {
+    uint8_t value = grillSensor.readRegister(reg);
+    job_printf(out, "%s (0x%x): 0x%x\n", REGISTER_NAMES[reg], reg, value);
+    delay(10);
   }
-  html += "<div class='temp-type'>1K NTC</div></div>";
-  
-  html += "<div class='temp-card meat'><h3>MEAT PROBE 4</h3>";
-  if (meat4 > -900) {
-    html += "<div class='temp-value' id='meat4-temp'>" + String(meat4, 1) + "&deg;F</div>";
+}
+
+// CS toggle and a config register read - runs on the job task
+static void spi_pin_test_job(JobOutput *out) {
+  job_printf(out, "Pin Connectivity Test:\n\n");
+
+  job_printf(out, "Testing CS Pin (GPIO%d):\n", MAX31865_CS_PIN);
+  grillSensor.pulseChipSelect();
+  job_printf(out, "CS pin toggle test: OK\n\n");
+
+  job_printf(out, "Testing SPI Transaction:\n");
+  uint8_t response = grillSensor.readRegister(0x00);   // Config register
+  job_printf(out, "SPI Response: 0x%x\n", response);
+
+  if (response == 0x00 || response == 0xFF) {
+    job_printf(out, "Status: NO COMMUNICATION\n");
+    job_printf(out, "Check: MOSI/MISO wiring, power, CS pin\n");
   } else {
-    html += "<div class='temp-value temp-invalid'>N/A</div>";
+    job_printf(out, "Status: COMMUNICATION DETECTED\n");
   }
-  html += "<div class='temp-type'>1K NTC</div></div>";
-  html += "</div>"; // End temp-grid
-  
-  // Temperature presets
-  html += "<div class='temp-presets'>";
-  html += "<button class='btn temp-preset' onclick='setTemp(225)'>225&deg;F Low</button>";
-  html += "<button class='btn temp-preset' onclick='setTemp(275)'>275&deg;F Med</button>";
-  html += "<button class='btn temp-preset' onclick='setTemp(325)'>325&deg;F High</button>";
-  html += "<button class='btn temp-preset' onclick='setTemp(200)'>200&deg;F Warm</button>";
-  html += "<button class='btn temp-preset' onclick='setTemp(250)'>250&deg;F Smoke</button>";
-  html += "<button class='btn temp-preset' onclick='setTemp(375)'>375&deg;F Sear</button>";
-  html += "</div>";
-  
-  // Control buttons - NOW WITH 3 COLUMNS INCLUDING PRIME
-  html += "<div class='controls' id='controls'>";
-  if (grillRunning) {
-    html += "<button class='btn btn-danger' onclick='stopGrill()'>STOP Grill</button>";
-    html += "<button class='btn btn-primary' onclick='adjustTemp()'>Adjust Temp</button>";
-    html += "<button class='btn btn-prime' disabled>PRIME (Grill Running)</button>";
-  } else {
-    html += "<button class='btn btn-success' onclick='startGrill()'>START Grill</button>";
-    html += "<button class='btn btn-primary' onclick='adjustTemp()'>Adjust Temp</button>";
-    html += "<button class='btn btn-prime' onclick='primeAuger()'>🌾 PRIME (30s)</button>";
+}
+
+static const JobDefinition SPI_REGISTER_DUMP_JOB = {"spi_register_dump", "text/plain", spi_register_dump_job};
+static const JobDefinition SPI_PIN_TEST_JOB = {"spi_pin_test", "text/plain", spi_pin_test_job};
+
+void setup_grill_server() {
+  // Static pages - dashboard, /manual, /pid, /debug and /wifi. Generated from
+  // web/ by tools/embed_web.py; live values come from the JSON endpoints below.
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    const WebAsset *asset = &WEB_ASSETS[i];
+    server.on(asset->path, HTTP_GET, [asset](AsyncWebServerRequest *req) {
+      send_web_asset(req, asset);
+    });
   }
-  html += "</div>";
-  
-  // Relay status
-  html += "<div class='relays'>";
-  html += "<div class='relay'><div class='relay-dot " + String(ignOn ? "relay-on" : "relay-off") + "' id='igniter-dot'></div><span>Igniter</span></div>";
-  html += "<div class='relay'><div class='relay-dot " + String(augOn ? "relay-on" : "relay-off") + "' id='auger-dot'></div><span>Auger</span></div>";
-  html += "<div class='relay'><div class='relay-dot " + String(hopOn ? "relay-on" : "relay-off") + "' id='hopper-dot'></div><span>Hopper Fan</span></div>";
-  html += "<div class='relay'><div class='relay-dot " + String(bloOn ? "relay-on" : "relay-off") + "' id='blower-dot'></div><span>Blower Fan</span></div>";
-  html += "</div>";
-  html += "</div>"; // End container
 
-  // JavaScript - properly escaped
-  html += "<script>";
-  html += "let updateInterval;";
-  html += "let isPageVisible = true;";
-
-  html += "document.addEventListener('visibilitychange', function() {";
-  html += "  isPageVisible = !document.hidden;";
-  html += "  if (isPageVisible) startRealTimeUpdates(); else stopRealTimeUpdates();";
-  html += "});";
-
-  html += "function startRealTimeUpdates() {";
-  html += "  const speed = parseInt(document.getElementById('updateSpeed').value);";
-  html += "  if (speed === 0) return;";
-  html += "  if (updateInterval) clearInterval(updateInterval);";
-  html += "  updateTemperatures();";
-  html += "  updateInterval = setInterval(updateTemperatures, speed);";
-  html += "}";
+  // Prometheus scrape endpoint, background jobs and per-route HTTP stats
+  // (metrics_init() runs in setup(), on the control task it registers)
+  jobs_init();
 
-  html += "function stopRealTimeUpdates() {";
-  html += "  if (updateInterval) { clearInterval(updateInterval); updateInterval = null; }";
-  html += "}";
+  server.on("/metrics", HTTP_GET, [](AsyncWebServerRequest *req) {
+    metrics_send(req);
+  });
 
-  html += "function updateTemperatures() {";
-  html += "  if (!isPageVisible) return;";
-  html += "  fetch('/status_all').then(response => {";
-  html += "    if (!response.ok) throw new Error('Network error');";
-  html += "    return response.json();";
-  html += "  }).then(data => {";
-  html += "    const grillTempElement = document.getElementById('grill-temp-main');";
-  html += "    const grillTempCardElement = document.getElementById('grill-temp-card');";
-  html += "    if (data.grillTemp > 0) {";
-  html += "      const newTemp = data.grillTemp.toFixed(1);";
-  html += "      grillTempElement.innerHTML = newTemp + '&deg;F';";
-  html += "      grillTempCardElement.innerHTML = newTemp + '&deg;F';";
-  html += "      grillTempElement.className = 'temp-value';";
-  html += "      grillTempCardElement.className = 'temp-value';";
-  html += "    } else {";
-  html += "      grillTempElement.innerHTML = 'ERROR';";
-  html += "      grillTempCardElement.innerHTML = 'ERROR';";
-  html += "      grillTempElement.className = 'temp-value temp-invalid';";
-  html += "      grillTempCardElement.className = 'temp-value temp-invalid';";
-  html += "    }";
-  html += "    const ambientTempElement = document.getElementById('ambient-temp');";
-  html += "    if (data.ambientTemp > -900) {";
-  html += "      ambientTempElement.innerHTML = data.ambientTemp.toFixed(1) + '&deg;F';";
-  html += "      ambientTempElement.className = 'temp-value';";
-  html += "    } else {";
-  html += "      ambientTempElement.innerHTML = 'N/A';";
-  html += "      ambientTempElement.className = 'temp-value temp-invalid';";
-  html += "    }";
-  html += "    ['meat1', 'meat2', 'meat3', 'meat4'].forEach((probe, index) => {";
-  html += "      const temp = data[probe + 'Temp'];";
-  html += "      const element = document.getElementById(probe + '-temp');";
-  html += "      if (temp > -900) {";
-  html += "        element.innerHTML = temp.toFixed(1) + '&deg;F';";
-  html += "        element.className = 'temp-value';";
-  html += "      } else {";
-  html += "        element.innerHTML = 'N/A';";
-  html += "        element.className = 'temp-value temp-invalid';";
-  html += "      }";
-  html += "    });";
-  html += "    document.getElementById('setpoint').textContent = data.setpoint;";
-  html += "    document.getElementById('status').textContent = data.status;";
-  html += "    const igniterDot = document.getElementById('igniter-dot');";
-  html += "    const augerDot = document.getElementById('auger-dot');"; 
-  html += "    const hopperDot = document.getElementById('hopper-dot');";
-  html += "    const blowerDot = document.getElementById('blower-dot');";
-  html += "    if (igniterDot) igniterDot.className = 'relay-dot ' + (data.ignOn ? 'relay-on' : 'relay-off');";
-  html += "    if (augerDot) augerDot.className = 'relay-dot ' + (data.augerOn ? 'relay-on' : 'relay-off');";
-  html += "    if (hopperDot) hopperDot.className = 'relay-dot ' + (data.hopperOn ? 'relay-on' : 'relay-off');";
-  html += "    if (blowerDot) blowerDot.className = 'relay-dot ' + (data.blowerOn ? 'relay-on' : 'relay-off');";
-  html += "    updateControlButtons(data.grillRunning);";
-  html += "  }).catch(err => console.log('Update failed:', err));";
-  html += "}";
+  server.on("/http_stats", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", http_admission_get_stats_json());
+  });
 
-  html += "function updateControlButtons(grillRunning) {";
-  html += "  const controlsDiv = document.getElementById('controls');";
-  html += "  if (grillRunning) {";
-  html += "    controlsDiv.innerHTML = '<button class=\"btn btn-danger\" onclick=\"stopGrill()\">STOP Grill</button><button class=\"btn btn-primary\" onclick=\"adjustTemp()\">Adjust Temp</button><button class=\"btn btn-prime\" disabled>PRIME (Grill Running)</button>';";
-  html += "  } else {";
-  html += "    controlsDiv.innerHTML = '<button class=\"btn btn-success\" onclick=\"startGrill()\">START Grill</button><button class=\"btn btn-primary\" onclick=\"adjustTemp()\">Adjust Temp</button><button class=\"btn btn-prime\" onclick=\"primeAuger()\">🌾 PRIME (30s)</button>';";
-  html += "  }";
-  html += "}";
+  server.on("/job_stats", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", jobs_get_stats_json());
+  });
 
-  html += "function changeUpdateSpeed() { stopRealTimeUpdates(); startRealTimeUpdates(); }";
+  server.on("/boot_timeline", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", boot_get_timeline_json());
+  });
 
-  html += "function setTemp(temp) {";
-  html += "  document.getElementById('setpoint').textContent = temp;";
-  html += "  fetch('/set_temp?temp=' + temp).then(response => response.text()).then(data => {";
-  html += "    console.log('Temperature set');";
-  html += "  }).catch(error => alert('Error setting temperature'));";
-  html += "}";
+  // Per-task priority, stack and CPU use (Tasks.h)
+  server.on("/task_stats", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", tasks_get_stats_json());
+  });
 
-  html += "function startGrill() {";
-  html += "  const button = event.target;";
-  html += "  button.disabled = true;";
-  html += "  button.textContent = 'Starting...';";
-  html += "  fetch('/start').then(response => {";
-  html += "    if (!response.ok) throw new Error('HTTP ' + response.status);";
-  html += "    return response.text();";
-  html += "  }).then(data => {";
-  html += "    alert('Grill Started: ' + data);";
-  html += "    updateTemperatures();";
-  html += "  }).catch(error => {";
-  html += "    alert('Error starting grill: ' + error.message);";
-  html += "    button.disabled = false;";
-  html += "    button.textContent = 'START Grill';";
-  html += "  });";
-  html += "}";
+  server.on("/task_stats.txt", HTTP_GET, [](AsyncWebServerRequest *req) {
+    tasks_send_runtime_stats(req);
+  });
 
-  html += "function stopGrill() {";
-  html += "  if (!confirm('Stop the grill?')) return;";
-  html += "  const button = event.target;";
-  html += "  button.disabled = true;";
-  html += "  button.textContent = 'Stopping...';";
-  html += "  fetch('/stop').then(response => {";
-  html += "    if (!response.ok) throw new Error('HTTP ' + response.status);";
-  html += "    return response.text();";
-  html += "  }).then(data => {";
-  html += "    alert('Grill Stopped: ' + data);";
-  html += "    updateTemperatures();";
-  html += "  }).catch(error => {";
-  html += "    alert('Error stopping grill: ' + error.message);";
-  html += "    button.disabled = false;";
-  html += "    button.textContent = 'STOP Grill';";
-  html += "  });";
-  html += "}";
+  // Live telemetry stream (/events) and its client/bandwidth counters
+  telemetry_push_init();
 
-  html += "function adjustTemp() {";
-  html += "  const currentTemp = document.getElementById('setpoint').textContent;";
-  html += "  const newTemp = prompt('Enter target temperature (150-500F):', currentTemp);";
-  html += "  if (newTemp && !isNaN(newTemp)) {";
-  html += "    const temp = parseInt(newTemp);";
-  html += "    if (temp >= 150 && temp <= 500) {";
-  html += "      setTemp(temp);";
-  html += "    } else {";
-  html += "      alert('Temperature must be between 150F and 500F');";
-  html += "    }";
-  html += "  }";
-  html += "}";
+  server.on("/events_stats", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", telemetry_push_get_stats_json());
+  });
 
-  // ADD PRIME FUNCTION
-  html += "function primeAuger() {";
-  html += "  if (!confirm('Run 30-second PiFire auger prime to fill burn pot?')) return;";
-  html += "  const button = event.target;";
-  html += "  button.disabled = true;";
-  html += "  button.textContent = 'PRIMING... (30s)';";
-  html += "  ";
-  html += "  fetch('/prime_auger').then(response => {";
-  html += "    if (!response.ok) throw new Error('HTTP ' + response.status);";
-  html += "    return response.text();";
-  html += "  }).then(data => {";
-  html += "    alert('Prime Complete: ' + data);";
-  html += "    updateTemperatures();";
-  html += "  }).catch(error => {";
-  html += "    alert('Error priming auger: ' + error.message);";
-  html += "  }).finally(() => {";
-  html += "    button.disabled = false;";
-  html += "    button.textContent = '🌾 PRIME (30s)';";
-  html += "  });";
-  html += "}";
+  // MQTT publisher with Home Assistant discovery - /mqtt_config, /mqtt_stats
+  mqtt_init();
 
-  html += "document.addEventListener('DOMContentLoaded', function() {";
-  html += "  startRealTimeUpdates();";
-  html += "});";
+  // UDP multicast beacon for site-wide aggregation - /set_beacon, /beacon_stats
+  beacon_init();
 
-  html += "</script></body></html>";
-  
-  req->send(200, "text/html", html);
-});
+  // Downsampled history as CSV: /history?from=&to=&points= (seconds of uptime)
+  server.on("/history", HTTP_GET, [](AsyncWebServerRequest *req) {
+    uint32_t now = history_get_now();
+    uint32_t to = req->hasParam("to") ? req->getParam("to")->value().toInt() : now;
+    uint32_t from = req->hasParam("from") ? req->getParam("from")->value().toInt()
+                                          : (to > HISTORY_DEFAULT_SPAN ? to - HISTORY_DEFAULT_SPAN : 0);
+    uint32_t points = req->hasParam("points") ? req->getParam("points")->value().toInt() : HISTORY_DEFAULT_POINTS;
 
-  // Manual Control Page
-  server.on("/manual", HTTP_GET, [](AsyncWebServerRequest *req) {
-    bool ignOn = digitalRead(RELAY_IGNITER_PIN) == HIGH;
-    bool augerOn = digitalRead(RELAY_AUGER_PIN) == HIGH;
-    bool hopperOn = digitalRead(RELAY_HOPPER_FAN_PIN) == HIGH;
-    bool blowerOn = digitalRead(RELAY_BLOWER_FAN_PIN) == HIGH;
-    
-    String html = "<!DOCTYPE html><html><head>";
-    html += "<meta charset='utf-8'>";
-    html += "<meta name='viewport' content='width=device-width, initial-scale=1'>";
-    html += "<title>Manual Control - Grill Controller</title>";
-    html += "<style>";
-    html += "body { background: #1a1a1a; color: #fff; font-family: Arial, sans-serif; padding: 20px; }";
-    html += ".container { max-width: 600px; margin: 0 auto; }";
-    html += "h1 { color: #60a5fa; text-align: center; margin-bottom: 30px; }";
-    html += ".relay-control { background: rgba(255,255,255,0.1); padding: 20px; margin: 15px 0; border-radius: 10px; }";
-    html += ".relay-status { display: flex; align-items: center; margin-bottom: 15px; }";
-    html += ".status-dot { width: 20px; height: 20px; border-radius: 50%; margin-right: 15px; }";
-    html += ".status-on { background: #4ade80; }";
-    html += ".status-off { background: #6b7280; }";
-    html += ".btn { padding: 10px 20px; margin: 5px; background: #059669; color: white; border: none; border-radius: 5px; cursor: pointer; }";
-    html += ".btn-danger { background: #dc2626; }";
-    html += ".btn-warning { background: #f59e0b; }";
-    html += ".warning { background: #fbbf24; color: #000; padding: 15px; border-radius: 5px; margin: 20px 0; }";
-    html += "</style></head><body>";
-    
-    html += "<div class='container'>";
-    html += "<h1>Manual Relay Control</h1>";
-    
-    html += "<div class='warning'>";
-    html += "⚠️ <strong>WARNING:</strong> Manual control overrides automatic safety systems.";
-    html += "</div>";
-    
-    // Relay controls (same as before)
-    html += "<div class='relay-control'>";
-    html += "<div class='relay-status'>";
-    html += "<div class='status-dot " + String(ignOn ? "status-on" : "status-off") + "'></div>";
-    html += "<h3>Igniter</h3>";
-    html += "</div>";
-    html += "<button class='btn' onclick='controlRelay(\"ignite\", \"on\")'>Turn ON</button>";
-    html += "<button class='btn btn-danger' onclick='controlRelay(\"ignite\", \"off\")'>Turn OFF</button>";
-    html += "</div>";
-    
-// Auger
-html += "<div class='relay-control'>";
-html += "<div class='relay-status'>";
-html += "<div class='status-dot " + String(augerOn ? "status-on" : "status-off") + "'></div>";
-html += "<h3>Auger</h3>";
-html += "</div>";
-html += "<button class='btn' onclick='controlRelay(\"auger\", \"on\")'>Turn ON</button>";
-html += "<button class='btn btn-danger' onclick='controlRelay(\"auger\", \"off\")'>Turn OFF</button>";
-html += "</div>";
-
-// Hopper Fan
-html += "<div class='relay-control'>";
-html += "<div class='relay-status'>";
-html += "<div class='status-dot " + String(hopperOn ? "status-on" : "status-off") + "'></div>";
-html += "<h3>Hopper Fan</h3>";
-html += "</div>";
-html += "<button class='btn' onclick='controlRelay(\"hopper\", \"on\")'>Turn ON</button>";
-html += "<button class='btn btn-danger' onclick='controlRelay(\"hopper\", \"off\")'>Turn OFF</button>";
-html += "</div>";
-
-// Blower Fan
-html += "<div class='relay-control'>";
-html += "<div class='relay-status'>";
-html += "<div class='status-dot " + String(blowerOn ? "status-on" : "status-off") + "'></div>";
-html += "<h3>Blower Fan</h3>";
-html += "</div>";
-html += "<button class='btn' onclick='controlRelay(\"blower\", \"on\")'>Turn ON</button>";
-html += "<button class='btn btn-danger' onclick='controlRelay(\"blower\", \"off\")'>Turn OFF</button>";
-html += "</div>";
-
-    // Add other relay controls...
-    
-    html += "<a href='/' class='btn' style='display: block; text-align: center; margin: 20px 0; text-decoration: none;'>Back to Dashboard</a>";
-    html += "</div>";
+    if (from > to) {
+      req->send(400, "text/plain", "from must not be after to");
+      return;
+    }
+    history_send_csv(req, from, to, points);
+  });
 
-    html += "<script>";
-    html += "function controlRelay(relay, state) {";
-    html += "  fetch('/control?relay=' + relay + '&state=' + state)";
-    html += "    .then(response => response.text())";
-    html += "    .then(data => { alert(data); setTimeout(() => location.reload(), 1000); });";
-    html += "}";
-    html += "</script>";
-    
-    html += "</body></html>";
-    req->send(200, "text/html", html);
+  // The last hour of 1 s samples, delta-encoded (see TelemetryCodec.h)
+  server.on("/history.bin", HTTP_GET, [](AsyncWebServerRequest *req) {
+    uint32_t now = history_get_now();
+    uint32_t to = req->hasParam("to") ? req->getParam("to")->value().toInt() : now;
+    uint32_t from = req->hasParam("from") ? req->getParam("from")->value().toInt()
+                                          : (to > HISTORY_DEFAULT_SPAN ? to - HISTORY_DEFAULT_SPAN : 0);
+
+    if (from > to) {
+      req->send(400, "text/plain", "from must not be after to");
+      return;
+    }
+    history_send_binary(req, from, to);
   });
 
-  // ADD THIS TO YOUR EXISTING GrillWebServer.cpp - REPLACE THE PID PAGE SECTION
+  server.on("/history_info", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", history_get_info_json());
+  });
 
-  // Enhanced PID Tuning and Pellet Control Page
-  server.on("/pid", HTTP_GET, [](AsyncWebServerRequest *req) {
+  // PID and pellet feed parameters for the /pid page
+  server.on("/pid_params", HTTP_GET, [](AsyncWebServerRequest *req) {
     float kp, ki, kd;
     getPIDParameters(&kp, &ki, &kd);
-    
-    String html = "<!DOCTYPE html><html><head>";
-    html += "<meta charset='utf-8'>";
-    html += "<meta name='viewport' content='width=device-width, initial-scale=1'>";
-    html += "<title>PID Tuning & Pellet Control</title>";
-    html += "<style>";
-    html += "body { background: #1a1a1a; color: #fff; font-family: Arial, sans-serif; padding: 20px; }";
-    html += ".container { max-width: 800px; margin: 0 auto; }";
-    html += "h1 { color: #60a5fa; text-align: center; margin-bottom: 30px; }";
-    html += "h2 { color: #fbbf24; margin: 30px 0 15px 0; border-bottom: 2px solid #fbbf24; padding-bottom: 5px; }";
-    html += ".section { background: rgba(255,255,255,0.1); padding: 20px; margin: 20px 0; border-radius: 10px; }";
-    html += ".form-group { margin: 15px 0; display: flex; align-items: center; }";
-    html += "label { display: block; margin-bottom: 5px; font-weight: bold; min-width: 200px; }";
-    html += "input, select { padding: 8px; font-size: 1em; border-radius: 5px; border: 1px solid #555; background: #333; color: #fff; margin-left: 10px; }";
-    html += "input[type='number'] { width: 120px; }";
-    html += ".btn { padding: 12px 25px; background: #059669; color: white; border: none; border-radius: 5px; font-size: 1em; cursor: pointer; margin: 10px 5px; }";
-    html += ".btn:hover { background: #047857; }";
-    html += ".btn-warning { background: #f59e0b; }";
-    html += ".btn-warning:hover { background: #d97706; }";
-    html += ".current-value { color: #4ade80; font-weight: bold; }";
-    html += ".description { font-size: 0.9em; color: #bbb; margin-top: 5px; }";
-    html += ".warning { background: #fbbf24; color: #000; padding: 15px; border-radius: 5px; margin: 15px 0; }";
-    html += "</style></head><body>";
-    
-    html += "<div class='container'>";
-    html += "<h1>🎛️ PID Tuning & Pellet Control</h1>";
-    
-    // PID Section
-    html += "<div class='section'>";
-    html += "<h2>PID Parameters</h2>";
-    html += "<div class='warning'>⚠️ <strong>WARNING:</strong> Incorrect PID values can cause temperature instability or poor performance.</div>";
-    
-    html += "<form onsubmit='savePID(event)'>";
-    html += "<div class='form-group'>";
-    html += "<label>Proportional (Kp):</label>";
-    html += "<input type='number' id='kp' step='0.1' min='0' max='10' value='" + String(kp, 2) + "'>";
-    html += "<div class='description'>Current: <span class='current-value'>" + String(kp, 3) + "</span> - Controls immediate response to temperature error</div>";
-    html += "</div>";
-    
-    html += "<div class='form-group'>";
-    html += "<label>Integral (Ki):</label>";
-    html += "<input type='number' id='ki' step='0.001' min='0' max='1' value='" + String(ki, 4) + "'>";
-    html += "<div class='description'>Current: <span class='current-value'>" + String(ki, 4) + "</span> - Eliminates steady-state error over time</div>";
-    html += "</div>";
-    
-    html += "<div class='form-group'>";
-    html += "<label>Derivative (Kd):</label>";
-    html += "<input type='number' id='kd' step='0.1' min='0' max='5' value='" + String(kd, 2) + "'>";
-    html += "<div class='description'>Current: <span class='current-value'>" + String(kd, 3) + "</span> - Prevents overshoot and oscillation</div>";
-    html += "</div>";
-    
-    html += "<button type='submit' class='btn'>💾 Save PID Parameters</button>";
-    html += "<button type='button' class='btn btn-warning' onclick='resetPIDDefaults()'>🔄 Reset to Defaults</button>";
-    html += "</form>";
-    html += "</div>";
-    
-    // Pellet Feed Parameters Section
-    html += "<div class='section'>";
-    html += "<h2>🌾 Pellet Feed Parameters</h2>";
-    html += "<div class='warning'>🔥 <strong>IGNITION TUNING:</strong> Adjust these values to improve ignition performance. More pellets = better ignition but more smoke.</div>";
-    
-    // Get current pellet parameters
-    unsigned long initialFeed = pellet_get_initial_feed_duration();
-    unsigned long lightingFeed = pellet_get_lighting_feed_duration();
-    unsigned long normalFeed = pellet_get_normal_feed_duration();
-    unsigned long lightingInterval = pellet_get_lighting_feed_interval();
-    
-    html += "<form onsubmit='savePelletParams(event)'>";
-    
-    html += "<div class='form-group'>";
-    html += "<label>Initial Feed Duration:</label>";
-    html += "<input type='number' id='initialFeed' min='10' max='120' value='" + String(initialFeed / 1000) + "'> seconds";
-    html += "<div class='description'>Current: <span class='current-value'>" + String(initialFeed / 1000) + "s</span> - First pellet feed when ignition starts (10-120s)</div>";
-    html += "</div>";
-    
-    html += "<div class='form-group'>";
-    html += "<label>Lighting Feed Duration:</label>";
-    html += "<input type='number' id='lightingFeed' min='5' max='60' value='" + String(lightingFeed / 1000) + "'> seconds";
-    html += "<div class='description'>Current: <span class='current-value'>" + String(lightingFeed / 1000) + "s</span> - Pellet feed during lighting phase (5-60s)</div>";
-    html += "</div>";
-    
-    html += "<div class='form-group'>";
-    html += "<label>Normal Feed Duration:</label>";
-    html += "<input type='number' id='normalFeed' min='1' max='30' value='" + String(normalFeed / 1000) + "'> seconds";
-    html += "<div class='description'>Current: <span class='current-value'>" + String(normalFeed / 1000) + "s</span> - Normal operation feed time (1-30s)</div>";
-    html += "</div>";
-    
-    html += "<div class='form-group'>";
-    html += "<label>Lighting Feed Interval:</label>";
-    html += "<input type='number' id='lightingInterval' min='30' max='180' value='" + String(lightingInterval / 1000) + "'> seconds";
-    html += "<div class='description'>Current: <span class='current-value'>" + String(lightingInterval / 1000) + "s</span> - Time between lighting feeds (30-180s)</div>";
-    html += "</div>";
-    
-    html += "<button type='submit' class='btn'>🌾 Save Pellet Parameters</button>";
-    html += "<button type='button' class='btn btn-warning' onclick='resetPelletDefaults()'>🔄 Reset Pellet Defaults</button>";
-    html += "</form>";
-    html += "</div>";
-    
-    // Current Status Section
-    html += "<div class='section'>";
-    html += "<h2>📊 Current Status</h2>";
-    html += "<div id='status-display'>";
-    html += "<p><strong>Grill Running:</strong> " + String(grillRunning ? "YES" : "NO") + "</p>";
-    html += "<p><strong>Target Temperature:</strong> " + String(setpoint, 1) + "°F</p>";
-    html += "<p><strong>Current Temperature:</strong> " + String(readGrillTemperature(), 1) + "°F</p>";
-    html += "<p><strong>Manual Override:</strong> " + String(relay_get_manual_override_status() ? "ACTIVE" : "INACTIVE") + "</p>";
-    html += "</div>";
-    html += "<button class='btn' onclick='refreshStatus()'>🔄 Refresh Status</button>";
-    html += "</div>";
-    
-    html += "<a href='/' class='btn' style='display: block; text-align: center; margin: 30px 0; text-decoration: none;'>← Back to Dashboard</a>";
-    html += "</div>";
 
-    // JavaScript functionality
-    html += "<script>";
-    
-    // Save PID parameters
-    html += "function savePID(event) {";
-    html += "  event.preventDefault();";
-    html += "  const kp = document.getElementById('kp').value;";
-    html += "  const ki = document.getElementById('ki').value;";
-    html += "  const kd = document.getElementById('kd').value;";
-    html += "  ";
-    html += "  fetch(`/set_pid?kp=${kp}&ki=${ki}&kd=${kd}`)";
-    html += "    .then(response => response.text())";
-    html += "    .then(data => {";
-    html += "      alert('PID Parameters Saved: ' + data);";
-    html += "      setTimeout(() => location.reload(), 1000);";
-    html += "    });";
-    html += "}";
-    
-    // Save pellet parameters
-    html += "function savePelletParams(event) {";
-    html += "  event.preventDefault();";
-    html += "  const initialFeed = document.getElementById('initialFeed').value;";
-    html += "  const lightingFeed = document.getElementById('lightingFeed').value;";
-    html += "  const normalFeed = document.getElementById('normalFeed').value;";
-    html += "  const lightingInterval = document.getElementById('lightingInterval').value;";
-    html += "  ";
-    html += "  fetch(`/set_pellet_params?initial=${initialFeed}&lighting=${lightingFeed}&normal=${normalFeed}&interval=${lightingInterval}`)";
-    html += "    .then(response => response.text())";
-    html += "    .then(data => {";
-    html += "      alert('Pellet Parameters Saved: ' + data);";
-    html += "      setTimeout(() => location.reload(), 1000);";
-    html += "    });";
-    html += "}";
-    
-    // Reset functions
-    html += "function resetPIDDefaults() {";
-    html += "  if (confirm('Reset PID to default values? (Kp=1.5, Ki=0.01, Kd=0.5)')) {";
-    html += "    fetch('/set_pid?kp=1.5&ki=0.01&kd=0.5')";
-    html += "      .then(response => response.text())";
-    html += "      .then(data => {";
-    html += "        alert('PID Reset to Defaults');";
-    html += "        location.reload();";
-    html += "      });";
-    html += "  }";
-    html += "}";
-    
-    html += "function resetPelletDefaults() {";
-    html += "  if (confirm('Reset pellet parameters to defaults?')) {";
-    html += "    fetch('/set_pellet_params?initial=45&lighting=20&normal=5&interval=60')";
-    html += "      .then(response => response.text())";
-    html += "      .then(data => {";
-    html += "        alert('Pellet Parameters Reset to Defaults');";
-    html += "        location.reload();";
-    html += "      });";
-    html += "  }";
-    html += "}";
-    
-    // Status refresh
-    html += "function refreshStatus() {";
-    html += "  location.reload();";
-    html += "}";
-    
-    html += "</script>";
-    html += "</body></html>";
-    
-    req->send(200, "text/html", html);
+    String json = "{";
+    json += "\"kp\":" + String(kp, 3) + ",";
+    json += "\"ki\":" + String(ki, 4) + ",";
+    json += "\"kd\":" + String(kd, 3) + ",";
+    json += "\"initialFeed\":" + String(pellet_get_initial_feed_duration()) + ",";
+    json += "\"lightingFeed\":" + String(pellet_get_lighting_feed_duration()) + ",";
+    json += "\"normalFeed\":" + String(pellet_get_normal_feed_duration()) + ",";
+    json += "\"lightingInterval\":" + String(pellet_get_lighting_feed_interval());
+    json += "}";
+    req->send(200, "application/json", json);
   });
 
   // New endpoint for setting pellet parameters
@@ -689,48 +256,16 @@ html += "</div>";
       return;
     }
     
-    // Set the parameters
-    pellet_set_initial_feed_duration(initial);
-    pellet_set_lighting_feed_duration(lighting);
-    pellet_set_normal_feed_duration(normal);
-    pellet_set_lighting_feed_interval(interval);
-    
-    String response = "Pellet parameters updated: ";
-    response += "Initial=" + String(initial/1000) + "s, ";
-    response += "Lighting=" + String(lighting/1000) + "s, ";
-    response += "Normal=" + String(normal/1000) + "s, ";
-    response += "Interval=" + String(interval/1000) + "s";
-    
-    req->send(200, "text/plain", response);
-  });
-
-  // Debug Control Page
-  server.on("/debug", HTTP_GET, [](AsyncWebServerRequest *req) {
-    String html = "<!DOCTYPE html><html><head>";
-    html += "<meta charset='utf-8'>";
-    html += "<title>Debug Control</title>";
-    html += "<style>";
-    html += "body { background: #1a1a1a; color: #fff; font-family: Arial, sans-serif; padding: 20px; }";
-    html += ".container { max-width: 600px; margin: 0 auto; }";
-    html += ".btn { padding: 15px 30px; background: #059669; color: white; border: none; border-radius: 5px; cursor: pointer; margin: 10px; }";
-    html += "</style></head><body>";
-    
-    html += "<div class='container'>";
-    html += "<h1>Debug Control Center</h1>";
-    html += "<button class='btn' onclick='toggleDebug(\"grill\")'>Toggle Grill Debug</button>";
-    html += "<button class='btn' onclick='toggleDebug(\"meat\")'>Toggle Meat Debug</button>";
-    html += "<a href='/' class='btn'>Back to Dashboard</a>";
-    html += "</div>";
-    
-    html += "<script>";
-    html += "function toggleDebug(sensor) {";
-    html += "  fetch('/set_individual_debug?sensor=' + sensor + '&enabled=1')";
-    html += "    .then(response => response.text())";
-    html += "    .then(data => alert(data));";
-    html += "}";
-    html += "</script></body></html>";
-    
-    req->send(200, "text/html", html);
+    // Applied by loop() as one settings patch - one NVS write
+    Command command;
+    command_init(&command, CMD_APPLY_SETTINGS);
+    command.settings.mask = SETTING_BIT(SETTING_FEED_INITIAL) | SETTING_BIT(SETTING_FEED_LIGHTING) |
+                            SETTING_BIT(SETTING_FEED_NORMAL) | SETTING_BIT(SETTING_FEED_INTERVAL);
+    command.settings.values[SETTING_FEED_INITIAL] = initial / 1000;
+    command.settings.values[SETTING_FEED_LIGHTING] = lighting / 1000;
+    command.settings.values[SETTING_FEED_NORMAL] = normal / 1000;
+    command.settings.values[SETTING_FEED_INTERVAL] = interval / 1000;
+    command_submit(req, command);
   });
 
   // MAX31865 Sensor Page
@@ -753,26 +288,26 @@ html += "</div>";
     html += "<div class='container'>";
     html += "<h1>🌡️ MAX31865 RTD Sensor Status</h1>";
     
-    // Get current readings
-    float temp = grillSensor.readTemperatureF();
-    float resistance = grillSensor.readRTD();
+    // Current readings, from the sensor snapshot
+    float temp = readGrillTemperature();
+    float resistance = readGrillResistance();
    // uint16_t rawValue = grillSensor.readRTDRaw();
     //uint8_t fault = grillSensor.readFault();
     //bool connected = grillSensor.isConnected();
     
     // Temperature reading
     String tempClass = (temp > 32.0 && temp < 600.0) ? "good" : "bad";
-    html += "<div class='reading " + tempClass + "'>";
+    html += "<div class='reading " + tempClass + "' id='temp-reading'>";
     html += "<h3>🔥 Temperature Reading</h3>";
-    html += "<div class='value'>" + String(temp, 1) + " °F</div>";
-    html += "<div>" + String((temp - 32.0) * 5.0 / 9.0, 1) + " °C</div>";
+    html += "<div class='value' id='temp-f'>" + String(temp, 1) + " °F</div>";
+    html += "<div id='temp-c'>" + String((temp - 32.0) * 5.0 / 9.0, 1) + " °C</div>";
     html += "</div>";
     
     // Resistance reading
     String resClass = (resistance > 80.0 && resistance < 200.0) ? "good" : "bad";
-    html += "<div class='reading " + resClass + "'>";
+    html += "<div class='reading " + resClass + "' id='res-reading'>";
     html += "<h3>⚡ RTD Resistance</h3>";
-    html += "<div class='value'>" + String(resistance, 2) + " Ω</div>";
+    html += "<div class='value' id='res-value'>" + String(resistance, 2) + " Ω</div>";
     html += "<div>Expected: ~108Ω at 70°F, ~138Ω at 200°F</div>";
     html += "</div>";
   
@@ -798,45 +333,31 @@ html += "</div>";
     html += "    .then(response => response.text())";
     html += "    .then(data => { alert(data); location.reload(); });";
     html += "}";
-    html += "setInterval(() => location.reload(), 10000);";  // Auto-refresh every 10 seconds
+    // Live readings from the telemetry stream instead of reloading the page
+    html += "function showReading(data) {";
+    html += "  if (data.grillTemp !== undefined) {";
+    html += "    document.getElementById('temp-f').textContent = data.grillTemp.toFixed(1) + ' °F';";
+    html += "    document.getElementById('temp-c').textContent = ((data.grillTemp - 32) * 5 / 9).toFixed(1) + ' °C';";
+    html += "    document.getElementById('temp-reading').className = 'reading ' + (data.grillTemp > 32 && data.grillTemp < 600 ? 'good' : 'bad');";
+    html += "  }";
+    html += "  if (data.rtdOhms !== undefined) {";
+    html += "    document.getElementById('res-value').textContent = data.rtdOhms.toFixed(2) + ' Ω';";
+    html += "    document.getElementById('res-reading').className = 'reading ' + (data.rtdOhms > 80 && data.rtdOhms < 200 ? 'good' : 'bad');";
+    html += "  }";
+    html += "}";
+    html += "if (window.EventSource) {";
+    html += "  const source = new EventSource('/events');";
+    html += "  source.addEventListener('snapshot', e => showReading(JSON.parse(e.data)));";
+    html += "  source.addEventListener('delta', e => showReading(JSON.parse(e.data)));";
+    html += "} else {";
+    html += "  setInterval(() => location.reload(), 10000);";
+    html += "}";
     html += "</script>";
     
     html += "</body></html>";
     req->send(200, "text/html", html);
   });
 
-  // Enhanced status endpoint with all 6 temperatures
-  server.on("/status_all", HTTP_GET, [](AsyncWebServerRequest *req) {
-    double grillTemp = readGrillTemperature();
-    double ambientTemp = readAmbientTemperature();
-    float meat1 = tempSensor.getFoodTemperature(1);
-    float meat2 = tempSensor.getFoodTemperature(2);
-    float meat3 = tempSensor.getFoodTemperature(3);
-    float meat4 = tempSensor.getFoodTemperature(4);
-    
-    bool ignOn = digitalRead(RELAY_IGNITER_PIN) == HIGH;
-    bool augerOn = digitalRead(RELAY_AUGER_PIN) == HIGH;
-    bool hopperOn = digitalRead(RELAY_HOPPER_FAN_PIN) == HIGH;
-    bool blowerOn = digitalRead(RELAY_BLOWER_FAN_PIN) == HIGH;
-    String status = getStatus(grillTemp);
-
-    String json = "{";
-    json += "\"grillTemp\":" + String(grillTemp, 1) + ",";
-    json += "\"ambientTemp\":" + String(ambientTemp, 1) + ",";
-    json += "\"meat1Temp\":" + String(meat1, 1) + ",";
-    json += "\"meat2Temp\":" + String(meat2, 1) + ",";
-    json += "\"meat3Temp\":" + String(meat3, 1) + ",";
-    json += "\"meat4Temp\":" + String(meat4, 1) + ",";
-    json += "\"setpoint\":" + String((int)setpoint) + ",";
-    json += "\"status\":\"" + status + "\",";
-    json += "\"ignOn\":" + String(ignOn ? "true" : "false") + ",";
-    json += "\"augerOn\":" + String(augerOn ? "true" : "false") + ",";
-    json += "\"hopperOn\":" + String(hopperOn ? "true" : "false") + ",";
-    json += "\"blowerOn\":" + String(blowerOn ? "true" : "false");
-    json += "}";
-    req->send(200, "application/json", json);
-  });
-
   // Temperature setting endpoint
   server.on("/set_temp", HTTP_GET, [](AsyncWebServerRequest *req) {
     if (!req->hasParam("temp")) { 
@@ -845,161 +366,263 @@ html += "</div>";
     }
     
     int newTemp = req->getParam("temp")->value().toInt();
-    if (newTemp < 150 || newTemp > 500) {
+    if (newTemp < MIN_SETPOINT || newTemp > MAX_SETPOINT) {
       req->send(400, "text/plain", "Temperature out of range (150-500F)");
       return;
     }
     
-    setpoint = newTemp;
-    save_setpoint();
-    req->send(200, "text/plain", "Temperature set to " + String(newTemp) + "F");
+    Command command;
+    command_init(&command, CMD_SET_TEMP);
+    command.temperature = newTemp;
+    command_submit(req, command);
   });
 
-  // Control endpoints
+  // Smoke mode (low-airflow blower cycles at low setpoints)
+  server.on("/set_smoke_mode", HTTP_GET, [](AsyncWebServerRequest *req) {
+    if (!req->hasParam("enabled")) {
+      req->send(400, "text/plain", "Missing enabled parameter");
+      return;
+    }
+    
+    Command command;
+    command_init(&command, CMD_APPLY_SETTINGS);
+    command.settings.mask = SETTING_BIT(SETTING_SMOKE_MODE);
+    command.settings.values[SETTING_SMOKE_MODE] = req->getParam("enabled")->value() == "1" ? 1 : 0;
+    command_submit(req, command);
+  });
+
+  // Relay task request counters per source
+  server.on("/relay_queue", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", relay_get_queue_json());
+  });
   
-  // FIXED Control endpoints with proper error handling and debugging
-  server.on("/start", HTTP_GET, [](AsyncWebServerRequest *req) {
-    Serial.println("🚀 Web request: START grill");
+  // Relay interlock state and trip counters
+  server.on("/relay_safety", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", relay_safety_get_json());
+  });
+  
+  // Relay wear and duty-cycle telemetry
+  server.on("/relay_stats", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", relay_stats_get_json());
+  });
+  
+  server.on("/relay_stats_reset", HTTP_GET, [](AsyncWebServerRequest *req) {
+    if (!req->hasParam("relay")) {
+      req->send(400, "text/plain", "Missing relay parameter");
+      return;
+    }
     
-    if (grillRunning) {
-      Serial.println("   Grill already running");
-      req->send(200, "text/plain", "Grill already running");
+    int channel = relay_stats_find_channel(req->getParam("relay")->value());
+    if (channel < 0) {
+      req->send(400, "text/plain", "Unknown relay (igniter, auger, hopper, blower)");
       return;
     }
     
-    // Check for valid temperature reading before starting
-    double currentTemp = readGrillTemperature();
-    if (!isValidTemperature(currentTemp)) {
-      Serial.println("   ERROR: Invalid temperature reading, cannot start");
-      req->send(400, "text/plain", "Cannot start: Invalid temperature sensor reading");
+    Command command;
+    command_init(&command, CMD_RELAY_STATS_RESET);
+    command.relayChannel = channel;
+    command_submit(req, command);
+  });
+  
+  // Pellet usage and hopper estimate
+  server.on("/pellet_usage", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", pellet_get_accounting_json());
+  });
+  
+  server.on("/set_pellet_calibration", HTTP_GET, [](AsyncWebServerRequest *req) {
+    if (!req->hasParam("gps")) {
+      req->send(400, "text/plain", "Missing gps parameter");
       return;
     }
     
-    Serial.printf("   Starting grill at %.1f°F, target: %.1f°F\n", currentTemp, setpoint);
+    float gps = req->getParam("gps")->value().toFloat();
+    if (gps < 0.1 || gps > 50.0) {
+      req->send(400, "text/plain", "Calibration out of range (0.1-50 g/s)");
+      return;
+    }
     
-    // Set grill running flag
-    grillRunning = true;
+    Command command;
+    command_init(&command, CMD_APPLY_SETTINGS);
+    command.settings.mask = SETTING_BIT(SETTING_PELLET_CALIBRATION);
+    command.settings.values[SETTING_PELLET_CALIBRATION] = gps;
+    command_submit(req, command);
+  });
+  
+  server.on("/set_hopper", HTTP_GET, [](AsyncWebServerRequest *req) {
+    if (!req->hasParam("capacity") || !req->hasParam("low")) {
+      req->send(400, "text/plain", "Missing capacity or low parameter");
+      return;
+    }
     
-    // Clear any manual overrides that might interfere
-    relay_clear_manual();
+    float capacity = req->getParam("capacity")->value().toFloat();
+    float low = req->getParam("low")->value().toFloat();
+    if (capacity < 1 || capacity > 100 || low < 0 || low > capacity) {
+      req->send(400, "text/plain", "Hopper values out of range (capacity 1-100 lb, low 0-capacity)");
+      return;
+    }
     
-    // Start the ignition sequence
-    ignition_start(currentTemp);
+    Command command;
+    command_init(&command, CMD_APPLY_SETTINGS);
+    command.settings.mask = SETTING_BIT(SETTING_HOPPER_CAPACITY) | SETTING_BIT(SETTING_HOPPER_LOW);
+    command.settings.values[SETTING_HOPPER_CAPACITY] = capacity;
+    command.settings.values[SETTING_HOPPER_LOW] = low;
+    command_submit(req, command);
+  });
+  
+  server.on("/hopper_refill", HTTP_GET, [](AsyncWebServerRequest *req) {
+    float level = req->hasParam("lb") ? req->getParam("lb")->value().toFloat() : 0.0;
+    if (level < 0 || level > pellet_get_hopper_capacity_lb()) {
+      req->send(400, "text/plain", "Level out of range (0-capacity, 0 = full)");
+      return;
+    }
     
-    Serial.println("   ✅ Grill started successfully - ignition sequence initiated");
-    req->send(200, "text/plain", "Grill started successfully - ignition sequence initiated");
+    Command command;
+    command_init(&command, CMD_HOPPER_REFILL);
+    command.hopperLevel = level;
+    command_submit(req, command);
   });
 
-  server.on("/stop", HTTP_GET, [](AsyncWebServerRequest *req) {
-    Serial.println("🛑 Web request: STOP grill");
+  // Probe target and alarm configuration
+  server.on("/set_probe_target", HTTP_GET, [](AsyncWebServerRequest *req) {
+    if (!req->hasParam("probe") || !req->hasParam("target")) {
+      req->send(400, "text/plain", "Missing probe or target parameter");
+      return;
+    }
+    
+    int probe = req->getParam("probe")->value().toInt();
+    float target = req->getParam("target")->value().toFloat();
+    float high = req->hasParam("high") ? req->getParam("high")->value().toFloat() : 0.0;
+    float low = req->hasParam("low") ? req->getParam("low")->value().toFloat() : 0.0;
+    float hyst = req->hasParam("hyst") ? req->getParam("hyst")->value().toFloat() : 2.0;
+    bool keepWarm = req->hasParam("keepwarm") && req->getParam("keepwarm")->value() == "1";
     
-    if (!grillRunning) {
-      Serial.println("   Grill already stopped");
-      req->send(200, "text/plain", "Grill already stopped");
+    if (probe < 1 || probe > MAX_PROBES) {
+      req->send(400, "text/plain", "Probe out of range (1-4)");
+      return;
+    }
+    if (target < 0 || target > 250 || high < 0 || high > 250 || low < 0 || low > 250) {
+      req->send(400, "text/plain", "Probe temperatures out of range (0-250F, 0 = off)");
       return;
     }
     
-    Serial.println("   Stopping grill and ignition sequence");
+    Command command;
+    command_init(&command, CMD_SET_PROBE_TARGET);
+    command.probeTarget = {(uint8_t)(probe - 1), target, high, low, hyst, keepWarm};
+    command_submit(req, command);
+  });
+  
+  server.on("/set_keep_warm", HTTP_GET, [](AsyncWebServerRequest *req) {
+    if (!req->hasParam("temp")) {
+      req->send(400, "text/plain", "Missing temp parameter");
+      return;
+    }
     
-    // Stop grill operations
-    grillRunning = false;
+    int temp = req->getParam("temp")->value().toInt();
+    if (temp < MIN_SETPOINT || temp > MAX_SETPOINT) {
+      req->send(400, "text/plain", "Keep-warm temperature out of range (150-500F)");
+      return;
+    }
     
-    // Stop ignition sequence
-    ignition_stop();
+    Command command;
+    command_init(&command, CMD_APPLY_SETTINGS);
+    command.settings.mask = SETTING_BIT(SETTING_KEEP_WARM);
+    command.settings.values[SETTING_KEEP_WARM] = temp;
+    command_submit(req, command);
+  });
+  
+  server.on("/probe_targets", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", probe_alarm_get_config_json());
+  });
+  
+  server.on("/probe_alarms", HTTP_GET, [](AsyncWebServerRequest *req) {
+    uint32_t since = req->hasParam("since") ? req->getParam("since")->value().toInt() : 0;
+    req->send(200, "application/json", probe_alarm_get_events_json(since));
+  });
+  
+  server.on("/probe_alarm_ack", HTTP_GET, [](AsyncWebServerRequest *req) {
+    Command command;
+    command_init(&command, CMD_PROBE_ALARM_ACK);
+    command_submit(req, command);
+  });
+
+  // Control endpoints
+  
+  // FIXED Control endpoints with proper error handling and debugging
+  server.on("/start", HTTP_GET, [](AsyncWebServerRequest *req) {
+    Serial.println("🚀 Web request: START grill");
     
-    // Clear any manual overrides
-    relay_clear_manual();
+    // Refuse early on a bad sensor so the page sees an error status; loop() checks again
+    if (!isValidTemperature(readGrillTemperature())) {
+      Serial.println("   ERROR: Invalid temperature reading, cannot start");
+      req->send(400, "text/plain", "Cannot start: Invalid temperature sensor reading");
+      return;
+    }
     
-    // Turn off all relays safely
-    RelayRequest stopReq = {RELAY_OFF, RELAY_OFF, RELAY_ON, RELAY_ON}; // Keep fans on for cooling
-    relay_request_auto(&stopReq);
+    Command command;
+    command_init(&command, CMD_START);
+    command_submit(req, command);
+  });
+
+  server.on("/stop", HTTP_GET, [](AsyncWebServerRequest *req) {
+    Serial.println("🛑 Web request: STOP grill");
     
-    Serial.println("   ✅ Grill stopped successfully - cooling down");
-    req->send(200, "text/plain", "Grill stopped successfully - cooling down");
+    Command command;
+    command_init(&command, CMD_STOP);
+    command_submit(req, command);
   });
 
   // Enhanced status endpoint with detailed grill state
   server.on("/status_all", HTTP_GET, [](AsyncWebServerRequest *req) {
-    double grillTemp = readGrillTemperature();
-    double ambientTemp = readAmbientTemperature();
-    float meat1 = tempSensor.getFoodTemperature(1);
-    float meat2 = tempSensor.getFoodTemperature(2);
-    float meat3 = tempSensor.getFoodTemperature(3);
-    float meat4 = tempSensor.getFoodTemperature(4);
-    
-    bool ignOn = digitalRead(RELAY_IGNITER_PIN) == HIGH;
-    bool augerOn = digitalRead(RELAY_AUGER_PIN) == HIGH;
-    bool hopperOn = digitalRead(RELAY_HOPPER_FAN_PIN) == HIGH;
-    bool blowerOn = digitalRead(RELAY_BLOWER_FAN_PIN) == HIGH;
-    String status = getStatus(grillTemp);
-
-    String json = "{";
-    json += "\"grillTemp\":" + String(grillTemp, 1) + ",";
-    json += "\"ambientTemp\":" + String(ambientTemp, 1) + ",";
-    json += "\"meat1Temp\":" + String(meat1, 1) + ",";
-    json += "\"meat2Temp\":" + String(meat2, 1) + ",";
-    json += "\"meat3Temp\":" + String(meat3, 1) + ",";
-    json += "\"meat4Temp\":" + String(meat4, 1) + ",";
-    json += "\"setpoint\":" + String((int)setpoint) + ",";
-    json += "\"status\":\"" + status + "\",";
-    json += "\"grillRunning\":" + String(grillRunning ? "true" : "false") + ",";
-    json += "\"ignitionState\":\"" + ignition_get_status_string() + "\",";
-    json += "\"ignOn\":" + String(ignOn ? "true" : "false") + ",";
-    json += "\"augerOn\":" + String(augerOn ? "true" : "false") + ",";
-    json += "\"hopperOn\":" + String(hopperOn ? "true" : "false") + ",";
-    json += "\"blowerOn\":" + String(blowerOn ? "true" : "false") + ",";
-    json += "\"manualOverride\":" + String(relay_get_manual_override_status() ? "true" : "false");
-    json += "}";
-    
-    req->send(200, "application/json", json);
+    status_cache_handle_request(req);
   });
 
   // Debug endpoint to check grill state
   server.on("/grill_debug", HTTP_GET, [](AsyncWebServerRequest *req) {
-    String debug = "Grill Debug Info:\\n";
-    debug += "Grill Running: " + String(grillRunning ? "YES" : "NO") + "\\n";
-    debug += "Ignition State: " + ignition_get_status_string() + "\\n";
-    debug += "Grill Temperature: " + String(readGrillTemperature(), 1) + "°F\\n";
-    debug += "Target Temperature: " + String(setpoint, 1) + "°F\\n";
-    debug += "Manual Override: " + String(relay_get_manual_override_status() ? "ACTIVE" : "INACTIVE") + "\\n";
-    debug += "Free Memory: " + String(ESP.getFreeHeap()) + " bytes\\n";
-    debug += "\\nRelay States:\\n";
-    debug += "Igniter: " + String(digitalRead(RELAY_IGNITER_PIN) ? "ON" : "OFF") + "\\n";
-    debug += "Auger: " + String(digitalRead(RELAY_AUGER_PIN) ? "ON" : "OFF") + "\\n";
-    debug += "Hopper Fan: " + String(digitalRead(RELAY_HOPPER_FAN_PIN) ? "ON" : "OFF") + "\\n";
-    debug += "Blower Fan: " + String(digitalRead(RELAY_BLOWER_FAN_PIN) ? "ON" : "OFF") + "\\n";
-    
-    req->send(200, "text/plain", debug);
+    char buffer[DEBUG_TEXT_BUFFER];
+    int length = snprintf(buffer, sizeof(buffer),
+      "Grill Debug Info:\\n"
+      "Grill Running: %s\\n"
+      "Ignition State: %s\\n"
+      "Grill Temperature: %.1f°F\\n"
+      "Target Temperature: %.1f°F\\n"
+      "Manual Override: %s\\n"
+      "Free Memory: %lu bytes\\n"
+      "\\nRelay States:\\n"
+      "Igniter: %s\\n"
+      "Auger: %s\\n"
+      "Hopper Fan: %s\\n"
+      "Blower Fan: %s\\n",
+      grillRunning ? "YES" : "NO",
+      ignition_get_status_string().c_str(),
+      readGrillTemperature(),
+      setpoint,
+      relay_get_manual_override_status() ? "ACTIVE" : "INACTIVE",
+      (unsigned long)ESP.getFreeHeap(),
+      digitalRead(RELAY_IGNITER_PIN) ? "ON" : "OFF",
+      digitalRead(RELAY_AUGER_PIN) ? "ON" : "OFF",
+      digitalRead(RELAY_HOPPER_FAN_PIN) ? "ON" : "OFF",
+      digitalRead(RELAY_BLOWER_FAN_PIN) ? "ON" : "OFF");
+
+    send_text(req, buffer, length, sizeof(buffer));
   });
 
   // Force start endpoint for troubleshooting
   server.on("/force_start", HTTP_GET, [](AsyncWebServerRequest *req) {
     Serial.println("🔧 FORCE START requested via web");
     
-    grillRunning = true;
-    relay_clear_manual();
-    
-    // Get current temperature or use default
-    double currentTemp = readGrillTemperature();
-    if (!isValidTemperature(currentTemp)) {
-      currentTemp = 70.0; // Use room temperature as fallback
-      Serial.println("   Using fallback temperature for force start");
-    }
-    
-    ignition_start(currentTemp);
-    
-    req->send(200, "text/plain", "Force start completed");
+    Command command;
+    command_init(&command, CMD_FORCE_START);
+    command_submit(req, command);
   });
 
   // Force stop endpoint for troubleshooting  
   server.on("/force_stop", HTTP_GET, [](AsyncWebServerRequest *req) {
     Serial.println("🔧 FORCE STOP requested via web");
     
-    grillRunning = false;
-    ignition_stop();
-    relay_emergency_stop();
-    
-    req->send(200, "text/plain", "Force stop completed");
+    relay_emergency_stop();   // Relays drop now; loop() settles the run state
+    Command command;
+    command_init(&command, CMD_FORCE_STOP);
+    command_submit(req, command);
   });
 
   // Manual relay control endpoints
@@ -1012,35 +635,39 @@ html += "</div>";
     String relayName = req->getParam("relay")->value();
     String state = req->getParam("state")->value();
     
-    RelayRequest manualReq = {RELAY_NOCHANGE, RELAY_NOCHANGE, RELAY_NOCHANGE, RELAY_NOCHANGE};
+    Command command;
+    command_init(&command, CMD_MANUAL_RELAY);
     RelayState relayState = (state == "on") ? RELAY_ON : RELAY_OFF;
     
     if (relayName == "hopper") {
-      manualReq.hopperFan = relayState;
+      command.relays.hopperFan = relayState;
     } else if (relayName == "auger") {
-      manualReq.auger = relayState;
+      command.relays.auger = relayState;
     } else if (relayName == "ignite") {
-      manualReq.igniter = relayState;
+      command.relays.igniter = relayState;
     } else if (relayName == "blower") {
-      manualReq.blowerFan = relayState;
+      command.relays.blowerFan = relayState;
     } else {
       req->send(400, "text/plain", "Invalid relay name");
       return;
     }
     
-    relay_request_manual(&manualReq);
-    req->send(200, "text/plain", "Manual override: " + relayName + " = " + state);
+    command_submit(req, command);
   });
 
   server.on("/clear_manual", HTTP_GET, [](AsyncWebServerRequest *req) {
-    relay_clear_manual();
-    req->send(200, "text/plain", "Manual override cleared");
+    Command command;
+    command_init(&command, CMD_CLEAR_MANUAL);
+    command_submit(req, command);
   });
 
   server.on("/emergency_stop", HTTP_GET, [](AsyncWebServerRequest *req) {
-    relay_emergency_stop();
-    grillRunning = false;
-    req->send(200, "text/plain", "EMERGENCY STOP activated");
+    relay_emergency_stop();   // Never waits behind the queue
+    Command command;
+    command_init(&command, CMD_EMERGENCY_STOP);
+    if (!command_submit(req, command)) {
+      command_post(command);    // No reply slot, but the run state must still clear
+    }
   });
 
   // PID tuning endpoint
@@ -1050,12 +677,16 @@ html += "</div>";
       return;
     }
     
-    float kp = req->getParam("kp")->value().toFloat();
-    float ki = req->getParam("ki")->value().toFloat();
-    float kd = req->getParam("kd")->value().toFloat();
-    
-    setPIDParameters(kp, ki, kd);
-    req->send(200, "text/plain", "PID parameters updated");
+    // Applied by loop() as one settings patch, so /api/v2/settings and this
+    // endpoint share the SETTINGS ranges and the apply path
+    Command command;
+    command_init(&command, CMD_APPLY_SETTINGS);
+    if (!setting_from_param(req, "kp", SETTING_PID_KP, &command.settings) ||
+        !setting_from_param(req, "ki", SETTING_PID_KI, &command.settings) ||
+        !setting_from_param(req, "kd", SETTING_PID_KD, &command.settings)) {
+      return;
+    }
+    command_submit(req, command);
   });
 
   // Debug control endpoints
@@ -1104,17 +735,21 @@ html += "</div>";
 
   // System diagnostics endpoint
   server.on("/diagnostics", HTTP_GET, [](AsyncWebServerRequest *req) {
-    String diag = "System Diagnostics:\\n";
-    diag += "Grill Temperature: " + String(readGrillTemperature(), 1) + "F (MAX31865)\\n";
-    diag += "Ambient Temperature: " + String(readAmbientTemperature(), 1) + "F\\n";
-    //diag += "MAX31865 Status: " + String(grillSensor.isConnected() ? "OK" : "ERROR") + "\\n";
-    //if (grillSensor.hasFault()) {
-    //  diag += "MAX31865 Fault: " + grillSensor.getFaultString() + "\\n";
-   // }
-    diag += "Grill Running: " + String(grillRunning ? "YES" : "NO") + "\\n";
-    diag += "Free Memory: " + String(ESP.getFreeHeap()) + " bytes\\n";
-    diag += "Uptime: " + String(millis() / 1000) + " seconds\\n";
-    req->send(200, "text/plain", diag);
+    char buffer[DEBUG_TEXT_BUFFER];
+    int length = snprintf(buffer, sizeof(buffer),
+      "System Diagnostics:\\n"
+      "Grill Temperature: %.1fF (MAX31865)\\n"
+      "Ambient Temperature: %.1fF\\n"
+      "Grill Running: %s\\n"
+      "Free Memory: %lu bytes\\n"
+      "Uptime: %lu seconds\\n",
+      readGrillTemperature(),
+      readAmbientTemperature(),
+      grillRunning ? "YES" : "NO",
+      (unsigned long)ESP.getFreeHeap(),
+      (unsigned long)(clock_ms() / 1000));
+
+    send_text(req, buffer, length, sizeof(buffer));
   });
 
   server.on("/reboot", HTTP_GET, [](AsyncWebServerRequest *req) {
@@ -1144,14 +779,20 @@ html += "</div>";
   });
 
   server.on("/do_reboot", HTTP_POST, [](AsyncWebServerRequest *req) {
-    req->send(200, "text/plain", "Rebooting...");
-    grillRunning = false;
-    relay_emergency_stop();
-    delay(1000);
-    ESP.restart();
+    Command command;
+    command_init(&command, CMD_REBOOT);
+    command_submit(req, command);
   });
 
+  server.on("/command_stats", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", command_get_stats_json());
+  });
+
+  // JSON API - settings, commands and OpenAPI schema
+  api_v2_setup_routes();
+
   server.onNotFound([](AsyncWebServerRequest *req) {
+    if (captive_portal_redirect(req)) return;   // Setup AP: other hosts' URLs go to /wifi
     req->send(404, "text/plain", "Not Found");
   });
 
@@ -1160,8 +801,10 @@ html += "</div>";
   
   ElegantOTA.onStart([]() {
     Serial.println("OTA update started!");
-    grillRunning = false;
     relay_emergency_stop();
+    Command command;
+    command_init(&command, CMD_EMERGENCY_STOP);
+    command_post(command);
   });
   
   ElegantOTA.onEnd([](bool success) {
@@ -1264,24 +907,26 @@ server.on("/spi_test", HTTP_GET, [](AsyncWebServerRequest *req) {
   html += "    });";
   html += "}";
   
+  html += "function runJob(url, target) {";
+  html += "  const show = text => {";
+  html += "    document.getElementById(target).innerHTML = text.replace(/\\n/g, '<br>');";
+  html += "    document.getElementById(target).className = 'test-result';";
+  html += "  };";
+  html += "  const poll = url => fetch(url).then(response => {";
+  html += "    if (response.status != 202) return response.text().then(show);";
+  html += "    return response.json().then(job => setTimeout(() => poll('/job?id=' + job.id), 500));";
+  html += "  }).catch(err => show('Error: ' + err));";
+  html += "  poll(url);";
+  html += "}";
+  
   html += "function readRegisters() {";
   html += "  document.getElementById('register-dump').innerHTML = 'Reading registers...';";
-  html += "  fetch('/spi_register_dump')";
-  html += "    .then(response => response.text())";
-  html += "    .then(data => {";
-  html += "      document.getElementById('register-dump').innerHTML = data.replace(/\\n/g, '<br>');";
-  html += "      document.getElementById('register-dump').className = 'test-result';";
-  html += "    });";
+  html += "  runJob('/spi_register_dump', 'register-dump');";
   html += "}";
   
   html += "function testPins() {";
   html += "  document.getElementById('pin-test').innerHTML = 'Testing pin connectivity...';";
-  html += "  fetch('/spi_pin_test')";
-  html += "    .then(response => response.text())";
-  html += "    .then(data => {";
-  html += "      document.getElementById('pin-test').innerHTML = data.replace(/\\n/g, '<br>');";
-  html += "      document.getElementById('pin-test').className = 'test-result';";
-  html += "    });";
+  html += "  runJob('/spi_pin_test', 'pin-test');";
   html += "}";
   
   html += "function resetSPI() {";
@@ -1308,68 +953,13 @@ server.on("/spi_test", HTTP_GET, [](AsyncWebServerRequest *req) {
 //  req->send(200, "text/plain", result);
 //});
 
-// Register dump endpoint
+// Register dump and pin test - SPI with delays, so run as background jobs
 server.on("/spi_register_dump", HTTP_GET, [](AsyncWebServerRequest *req) {
-  String dump = "MAX31865 Register Dump:\\n\\n";
-  
-  // Read all important registers
-  uint8_t registers[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
-  String regNames[] = {"Config", "RTD MSB", "RTD LSB", "High Fault MSB", 
-                       "High Fault LSB", "Low Fault MSB", "Low Fault LSB", "Fault Status"};
-  
-  for (int i = 0; i < 8; i++) {
-    // Read register
-    digitalWrite(MAX31865_CS_PIN, LOW);
-    delayMicroseconds(10);
-    SPI.beginTransaction(SPISettings(1000000, MSBFIRST, SPI_MODE1));
-    SPI.transfer(registers[i]);
-    uint8_t value = SPI.transfer(0x00);
-    SPI.endTransaction();
-    delayMicroseconds(10);
-    digitalWrite(MAX31865_CS_PIN, HIGH);
-    
-    dump += regNames[i] + " (0x" + String(registers[i], HEX) + "): 0x" + String(value, HEX) + "\\n";
-    delay(10);
-  }
-  
-  req->send(200, "text/plain", dump);
+  job_start(req, &SPI_REGISTER_DUMP_JOB);
 });
 
-// Pin test endpoint
 server.on("/spi_pin_test", HTTP_GET, [](AsyncWebServerRequest *req) {
-  String result = "Pin Connectivity Test:\\n\\n";
-  
-  // Test CS pin
-  result += "Testing CS Pin (GPIO" + String(MAX31865_CS_PIN) + "):\\n";
-  pinMode(MAX31865_CS_PIN, OUTPUT);
-  digitalWrite(MAX31865_CS_PIN, HIGH);
-  delay(10);
-  digitalWrite(MAX31865_CS_PIN, LOW);
-  delay(10);
-  digitalWrite(MAX31865_CS_PIN, HIGH);
-  result += "CS pin toggle test: OK\\n\\n";
-  
-  // Test basic SPI transaction
-  result += "Testing SPI Transaction:\\n";
-  digitalWrite(MAX31865_CS_PIN, LOW);
-  delayMicroseconds(10);
-  SPI.beginTransaction(SPISettings(1000000, MSBFIRST, SPI_MODE1));
-  SPI.transfer(0x00);  // Config register read
-  uint8_t response = SPI.transfer(0x00);
-  SPI.endTransaction();
-  delayMicroseconds(10);
-  digitalWrite(MAX31865_CS_PIN, HIGH);
-  
-  result += "SPI Response: 0x" + String(response, HEX) + "\\n";
-  
-  if (response == 0x00 || response == 0xFF) {
-    result += "Status: NO COMMUNICATION\\n";
-    result += "Check: MOSI/MISO wiring, power, CS pin\\n";
-  } else {
-    result += "Status: COMMUNICATION DETECTED\\n";
-  }
-  
-  req->send(200, "text/plain", result);
+  job_start(req, &SPI_PIN_TEST_JOB);
 });
 
 // SPI reset endpoint
@@ -1388,5 +978,6 @@ server.on("/spi_pin_test", HTTP_GET, [](AsyncWebServerRequest *req) {
 //});
 
   server.begin();
+  metrics_register_task("async_tcp", xTaskGetHandle("async_tcp"));   // Created by begin()
   Serial.println("Web server started with MAX31865 support");
 }
\ No newline at end of file
@@ -7,6 +7,13 @@
 
 #include <ESPAsyncWebServer.h>
 
+// Static pages are revalidated daily; after an OTA update the ETag changes
+// and the next revalidation fetches the new page
+#define WEB_CACHE_CONTROL "public, max-age=86400"
+
+// Fixed response buffer for the plain-text diagnostics (stack of the AsyncTCP task)
+#define DEBUG_TEXT_BUFFER   512
+
 extern AsyncWebServer server;
 extern double setpoint;
 extern bool grillRunning;
@@ -0,0 +1,546 @@
+// History.cpp - Fixed-memory temperature and relay history with downsampled queries
+//
+// Each tier is a ring indexed by absolute slot number (uptime seconds divided
+// by the tier period), so a slot's time is implied by its position and gaps
+// in sampling are filled with empty records rather than shifting the ring.
+// loop() writes one raw sample per second and folds it into the rollup
+// accumulators; the web task reads records one at a time under historyMux.
+//
+// Queries pick the finest tier that still covers the requested start and
+// stream the rows through Largest-Triangle-Three-Buckets, choosing points by
+// grill temperature, so a 1 h or 24 h window costs the same to plot.
+#include "History.h"
+#include "Globals.h"
+#include "Utility.h"
+#include "TemperatureSensor.h"
+#include "JsonWriter.h"
+#include "TelemetryCodec.h"
+#include "Clock.h"
+#include "freertos/FreeRTOS.h"
+#include <memory>
+
+#define HISTORY_CHANNELS   6   // grill, ambient, probe 1-4
+#define HISTORY_RELAYS     4   // igniter, auger, hopper fan, blower fan
+#define HISTORY_GRILL      0
+
+static_assert(HISTORY_CHANNELS == TELEMETRY_CODEC_CHANNELS, "binary export carries every history channel");
+
+// 1 s sample - relays as a bitmask
+struct __attribute__((packed)) HistorySample {
+  int16_t temp[HISTORY_CHANNELS];
+  uint8_t relays;
+};
+
+// 10 s / 1 min rollup - relays as percent on-time
+struct HistoryRollup {
+  int16_t grillMin;
+  int16_t grillMax;
+  int16_t avg[HISTORY_CHANNELS];
+  uint8_t relayDuty[HISTORY_RELAYS];
+};
+
+// Common row handed to the query side, whatever tier it came from
+struct HistoryRow {
+  uint32_t time;
+  int16_t grillMin;
+  int16_t grillMax;
+  int16_t avg[HISTORY_CHANNELS];
+  uint8_t relayDuty[HISTORY_RELAYS];
+};
+
+struct HistoryTier {
+  const char* name;
+  uint32_t periodSec;
+  uint32_t slots;
+  size_t recordSize;
+  uint8_t* data;
+  uint32_t newest;   // Absolute slot number of the newest record
+  uint32_t count;    // Valid records, at most slots
+};
+
+// Running sums for the rollup currently being filled
+struct HistoryAccumulator {
+  uint32_t slot;
+  uint16_t samples;
+  int32_t sum[HISTORY_CHANNELS];
+  uint16_t valid[HISTORY_CHANNELS];
+  int16_t grillMin;
+  int16_t grillMax;
+  uint16_t relayOn[HISTORY_RELAYS];
+};
+
+enum { TIER_RAW = 0, TIER_10S, TIER_1MIN, TIER_COUNT };
+
+static HistoryTier tiers[TIER_COUNT] = {
+  {"1s",   1,  HISTORY_RAW_SLOTS,  sizeof(HistorySample), NULL, 0, 0},
+  {"10s",  10, HISTORY_10S_SLOTS,  sizeof(HistoryRollup), NULL, 0, 0},
+  {"1min", 60, HISTORY_1MIN_SLOTS, sizeof(HistoryRollup), NULL, 0, 0},
+};
+
+static HistoryAccumulator accumulators[TIER_COUNT];   // TIER_RAW unused
+static portMUX_TYPE historyMux = portMUX_INITIALIZER_UNLOCKED;  // loop writes, web task reads
+
+static const uint8_t RELAY_PINS[HISTORY_RELAYS] = {
+  RELAY_IGNITER_PIN, RELAY_AUGER_PIN, RELAY_HOPPER_FAN_PIN, RELAY_BLOWER_FAN_PIN
+};
+
+static const HistorySample EMPTY_SAMPLE = {
+  {HISTORY_NO_VALUE, HISTORY_NO_VALUE, HISTORY_NO_VALUE, HISTORY_NO_VALUE, HISTORY_NO_VALUE, HISTORY_NO_VALUE}, 0
+};
+
+static const HistoryRollup EMPTY_ROLLUP = {
+  HISTORY_NO_VALUE, HISTORY_NO_VALUE,
+  {HISTORY_NO_VALUE, HISTORY_NO_VALUE, HISTORY_NO_VALUE, HISTORY_NO_VALUE, HISTORY_NO_VALUE, HISTORY_NO_VALUE},
+  {0, 0, 0, 0}
+};
+
+static uint32_t lastSampleSec = 0;
+static bool started = false;
+
+static int16_t history_encode_temp(double tempF) {
+  if (tempF < -900.0 || isnan(tempF)) return HISTORY_NO_VALUE;
+  long tenths = lround(tempF * 10.0);
+  return (int16_t)constrain(tenths, (long)INT16_MIN + 1, (long)INT16_MAX);
+}
+
+static void history_reset_accumulator(HistoryAccumulator& acc, uint32_t slot) {
+  memset(&acc, 0, sizeof(acc));
+  acc.slot = slot;
+  acc.grillMin = INT16_MAX;
+  acc.grillMax = INT16_MIN;
+}
+
+// Caller holds historyMux
+static uint8_t* history_record_at(const HistoryTier& tier, uint32_t slot) {
+  return tier.data + (size_t)(slot % tier.slots) * tier.recordSize;
+}
+
+// Store a record at an absolute slot, blanking any slots skipped since the last one
+static void history_store(HistoryTier& tier, uint32_t slot, const void* record, const void* empty) {
+  if (!tier.data) return;
+
+  portENTER_CRITICAL(&historyMux);
+  if (tier.count > 0 && slot <= tier.newest) {
+    portEXIT_CRITICAL(&historyMux);
+    return;   // Clock never runs backwards; ignore a duplicate slot
+  }
+  if (tier.count > 0) {
+    uint32_t gap = slot - tier.newest - 1;
+    if (gap > tier.slots) gap = tier.slots;
+    for (uint32_t s = slot - gap; s < slot; s++) {
+      memcpy(history_record_at(tier, s), empty, tier.recordSize);
+    }
+    tier.count = min(tier.count + gap + 1, tier.slots);
+  } else {
+    tier.count = 1;
+  }
+  memcpy(history_record_at(tier, slot), record, tier.recordSize);
+  tier.newest = slot;
+  portEXIT_CRITICAL(&historyMux);
+}
+
+static void history_flush_accumulator(int t) {
+  HistoryAccumulator& acc = accumulators[t];
+  if (acc.samples == 0) return;
+
+  HistoryRollup rollup;
+  rollup.grillMin = acc.valid[HISTORY_GRILL] ? acc.grillMin : HISTORY_NO_VALUE;
+  rollup.grillMax = acc.valid[HISTORY_GRILL] ? acc.grillMax : HISTORY_NO_VALUE;
+  for (int c = 0; c < HISTORY_CHANNELS; c++) {
+    rollup.avg[c] = acc.valid[c] ? (int16_t)(acc.sum[c] / (int32_t)acc.valid[c]) : HISTORY_NO_VALUE;
+  }
+  for (int r = 0; r < HISTORY_RELAYS; r++) {
+    rollup.relayDuty[r] = (uint8_t)(acc.relayOn[r] * 100 / acc.samples);
+  }
+  history_store(tiers[t], acc.slot, &rollup, &EMPTY_ROLLUP);
+}
+
+static void history_accumulate(int t, uint32_t nowSec, const HistorySample& sample) {
+  HistoryAccumulator& acc = accumulators[t];
+  uint32_t slot = nowSec / tiers[t].periodSec;
+
+  if (slot != acc.slot) {
+    history_flush_accumulator(t);
+    history_reset_accumulator(acc, slot);
+  }
+
+  acc.samples++;
+  for (int c = 0; c < HISTORY_CHANNELS; c++) {
+    if (sample.temp[c] == HISTORY_NO_VALUE) continue;
+    acc.sum[c] += sample.temp[c];
+    acc.valid[c]++;
+  }
+  if (sample.temp[HISTORY_GRILL] != HISTORY_NO_VALUE) {
+    acc.grillMin = min(acc.grillMin, sample.temp[HISTORY_GRILL]);
+    acc.grillMax = max(acc.grillMax, sample.temp[HISTORY_GRILL]);
+  }
+  for (int r = 0; r < HISTORY_RELAYS; r++) {
+    if (sample.relays & (1 << r)) acc.relayOn[r]++;
+  }
+}
+
+void history_init() {
+  size_t total = 0;
+  for (int t = 0; t < TIER_COUNT; t++) {
+    HistoryTier& tier = tiers[t];
+    size_t bytes = (size_t)tier.slots * tier.recordSize;
+    tier.data = (uint8_t*)malloc(bytes);
+    if (!tier.data) {
+      Serial.printf("❌ History: could not allocate %s tier (%u bytes) - tier disabled\n",
+                    tier.name, (unsigned)bytes);
+      continue;
+    }
+    total += bytes;
+    history_reset_accumulator(accumulators[t], 0);
+  }
+
+  Serial.printf("📈 History: %u bytes (1s x %u, 10s x %u, 1min x %u)\n", (unsigned)total,
+                (unsigned)HISTORY_RAW_SLOTS, (unsigned)HISTORY_10S_SLOTS, (unsigned)HISTORY_1MIN_SLOTS);
+}
+
+void history_update() {
+  uint32_t nowSec = (uint32_t)(clock_ms() / 1000);
+  if (started && nowSec == lastSampleSec) return;
+
+  HistorySample sample;
+  sample.temp[0] = history_encode_temp(readGrillTemperature());
+  sample.temp[1] = history_encode_temp(readAmbientTemperature());
+  for (int p = 0; p < 4; p++) {
+    sample.temp[2 + p] = history_encode_temp(readProbeTemperature(p + 1));
+  }
+  sample.relays = 0;
+  for (int r = 0; r < HISTORY_RELAYS; r++) {
+    if (digitalRead(RELAY_PINS[r]) == HIGH) sample.relays |= (1 << r);
+  }
+
+  history_store(tiers[TIER_RAW], nowSec, &sample, &EMPTY_SAMPLE);
+  for (int t = TIER_10S; t < TIER_COUNT; t++) {
+    if (tiers[t].data) history_accumulate(t, nowSec, sample);
+  }
+
+  lastSampleSec = nowSec;
+  started = true;
+}
+
+// Copy one record out as a common row; false once the slot has been overwritten
+static bool history_read_row(int t, uint32_t slot, HistoryRow* row) {
+  const HistoryTier& tier = tiers[t];
+  bool valid = false;
+
+  portENTER_CRITICAL(&historyMux);
+  if (tier.data && tier.count > 0 && slot <= tier.newest && tier.newest - slot < tier.count) {
+    const uint8_t* record = history_record_at(tier, slot);
+    if (t == TIER_RAW) {
+      const HistorySample* sample = (const HistorySample*)record;
+      row->grillMin = row->grillMax = sample->temp[HISTORY_GRILL];
+      for (int c = 0; c < HISTORY_CHANNELS; c++) row->avg[c] = sample->temp[c];
+      for (int r = 0; r < HISTORY_RELAYS; r++) row->relayDuty[r] = (sample->relays & (1 << r)) ? 100 : 0;
+    } else {
+      const HistoryRollup* rollup = (const HistoryRollup*)record;
+      row->grillMin = rollup->grillMin;
+      row->grillMax = rollup->grillMax;
+      memcpy(row->avg, rollup->avg, sizeof(row->avg));
+      memcpy(row->relayDuty, rollup->relayDuty, sizeof(row->relayDuty));
+    }
+    valid = true;
+  }
+  portEXIT_CRITICAL(&historyMux);
+
+  if (!valid) {
+    row->grillMin = row->grillMax = HISTORY_NO_VALUE;
+    for (int c = 0; c < HISTORY_CHANNELS; c++) row->avg[c] = HISTORY_NO_VALUE;
+    memset(row->relayDuty, 0, sizeof(row->relayDuty));
+  }
+
+  row->time = slot * tier.periodSec;
+  return valid;
+}
+
+// Grill value used to rank LTTB candidates; gaps count as zero
+static float history_row_value(int t, uint32_t slot) {
+  HistoryRow row;
+  if (!history_read_row(t, slot, &row) || row.avg[HISTORY_GRILL] == HISTORY_NO_VALUE) return 0.0;
+  return row.avg[HISTORY_GRILL];
+}
+
+// Streaming LTTB over slots [first, first + total) of one tier
+struct HistoryQuery {
+  int tier;
+  uint32_t first;
+  uint32_t total;
+  uint32_t points;
+  uint32_t emitted;
+  uint32_t previous;   // Index (from first) of the last selected point
+  char line[128];
+  size_t lineLength;
+  size_t linePos;
+};
+
+static int32_t history_next_index(HistoryQuery& q) {
+  if (q.emitted >= q.points || q.emitted >= q.total) return -1;
+
+  // Few enough rows - return every one
+  if (q.points >= q.total) return q.emitted;
+
+  // First and last rows are always kept, so two points span the whole range
+  if (q.emitted == 0) return 0;
+  if (q.emitted == q.points - 1) return q.total - 1;
+
+  // Buckets span the rows between the fixed first and last points
+  double every = (double)(q.total - 2) / (q.points - 2);
+  uint32_t bucket = q.emitted - 1;
+  uint32_t start = (uint32_t)(bucket * every) + 1;
+  uint32_t end = min((uint32_t)((bucket + 1) * every) + 1, q.total - 1);
+
+  // Average of the next bucket is the third triangle vertex
+  uint32_t nextStart = end;
+  uint32_t nextEnd = min((uint32_t)((bucket + 2) * every) + 1, q.total);
+  double avgX = 0.0, avgY = 0.0;
+  for (uint32_t i = nextStart; i < nextEnd; i++) {
+    avgX += i;
+    avgY += history_row_value(q.tier, q.first + i);
+  }
+  uint32_t nextCount = nextEnd - nextStart;
+  if (nextCount > 0) {
+    avgX /= nextCount;
+    avgY /= nextCount;
+  }
+
+  double aX = q.previous;
+  double aY = history_row_value(q.tier, q.first + q.previous);
+  double bestArea = -1.0;
+  uint32_t best = start;
+  for (uint32_t i = start; i < end; i++) {
+    double area = fabs((aX - avgX) * (history_row_value(q.tier, q.first + i) - aY) - (aX - i) * (avgY - aY));
+    if (area > bestArea) {
+      bestArea = area;
+      best = i;
+    }
+  }
+  return best;
+}
+
+static int history_format_temp(char* out, size_t size, int16_t value) {
+  if (value == HISTORY_NO_VALUE) {
+    if (size > 0) out[0] = '\0';
+    return 0;
+  }
+  int whole = value / 10;
+  int tenth = abs(value % 10);
+  const char* sign = (value < 0 && whole == 0) ? "-" : "";
+  return snprintf(out, size, "%s%d.%d", sign, whole, tenth);
+}
+
+static void history_format_row(HistoryQuery& q, const HistoryRow& row) {
+  char temps[HISTORY_CHANNELS + 2][10];
+  history_format_temp(temps[0], sizeof(temps[0]), row.avg[HISTORY_GRILL]);
+  history_format_temp(temps[1], sizeof(temps[1]), row.grillMin);
+  history_format_temp(temps[2], sizeof(temps[2]), row.grillMax);
+  for (int c = 1; c < HISTORY_CHANNELS; c++) {
+    history_format_temp(temps[2 + c], sizeof(temps[2 + c]), row.avg[c]);
+  }
+
+  int length = snprintf(q.line, sizeof(q.line), "%lu,%s,%s,%s,%s,%s,%s,%s,%s,%u,%u,%u,%u\n",
+                        (unsigned long)row.time, temps[0], temps[1], temps[2], temps[3],
+                        temps[4], temps[5], temps[6], temps[7],
+                        row.relayDuty[0], row.relayDuty[1], row.relayDuty[2], row.relayDuty[3]);
+  q.lineLength = (length > 0) ? min((size_t)length, sizeof(q.line) - 1) : 0;
+  q.linePos = 0;
+}
+
+// Pick the finest tier whose oldest record reaches back to from
+static int history_pick_tier(uint32_t from) {
+  int fallback = -1;
+  for (int t = 0; t < TIER_COUNT; t++) {
+    const HistoryTier& tier = tiers[t];
+    if (!tier.data) continue;
+    fallback = t;
+    portENTER_CRITICAL(&historyMux);
+    uint32_t oldest = (tier.newest - (tier.count > 0 ? tier.count - 1 : 0)) * tier.periodSec;
+    bool full = tier.count >= tier.slots;
+    portEXIT_CRITICAL(&historyMux);
+    if (from >= oldest || !full) return t;
+  }
+  return fallback;
+}
+
+void history_send_csv(AsyncWebServerRequest *req, uint32_t from, uint32_t to, uint32_t points) {
+  int t = history_pick_tier(from);
+  if (t < 0) {
+    req->send(503, "text/plain", "History unavailable");
+    return;
+  }
+
+  const HistoryTier& tier = tiers[t];
+  std::shared_ptr<HistoryQuery> q(new HistoryQuery());
+  q->tier = t;
+  q->points = constrain(points, (uint32_t)2, (uint32_t)HISTORY_MAX_POINTS);
+
+  // Clamp the request to what this tier holds
+  portENTER_CRITICAL(&historyMux);
+  uint32_t newest = tier.newest;
+  uint32_t oldest = tier.newest - (tier.count > 0 ? tier.count - 1 : 0);
+  bool empty = (tier.count == 0);
+  portEXIT_CRITICAL(&historyMux);
+
+  uint32_t first = max((from + tier.periodSec - 1) / tier.periodSec, oldest);
+  uint32_t last = min(to / tier.periodSec, newest);
+  q->first = first;
+  q->total = (empty || last < first) ? 0 : last - first + 1;
+
+  int length = snprintf(q->line, sizeof(q->line),
+                        "# tier=%s now=%lu rows=%lu\n"
+                        "t,grill,grillMin,grillMax,ambient,probe1,probe2,probe3,probe4,igniter,auger,hopperFan,blowerFan\n",
+                        tier.name, (unsigned long)history_get_now(),
+                        (unsigned long)min(q->points, q->total));
+  q->lineLength = (length > 0) ? min((size_t)length, sizeof(q->line) - 1) : 0;
+
+  AsyncWebServerResponse *response = req->beginChunkedResponse("text/csv",
+    [q](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+      size_t written = 0;
+      while (written < maxLen) {
+        if (q->linePos >= q->lineLength) {
+          int32_t next = history_next_index(*q);
+          if (next < 0) break;
+          HistoryRow row;
+          history_read_row(q->tier, q->first + next, &row);   // Slots overwritten meanwhile come back empty
+          history_format_row(*q, row);
+          q->previous = next;
+          q->emitted++;
+        }
+        size_t chunk = min(q->lineLength - q->linePos, maxLen - written);
+        memcpy(buffer + written, q->line + q->linePos, chunk);
+        q->linePos += chunk;
+        written += chunk;
+      }
+      return written;
+    });
+  response->addHeader("Cache-Control", "no-store");
+  req->send(response);
+}
+
+// Raw samples through the delta encoder, one frame per second of the range
+struct HistoryBinaryQuery {
+  uint32_t next;
+  uint32_t last;
+  TelemetryEncoder encoder;
+  uint8_t pending[TELEMETRY_CODEC_MAX_HEADER];   // Also holds one frame (MAX_FRAME is smaller)
+  size_t pendingLength;
+  size_t pendingPos;
+};
+
+static bool history_read_sample(uint32_t slot, TelemetryFrame* frame) {
+  const HistoryTier& tier = tiers[TIER_RAW];
+  bool valid = false;
+
+  portENTER_CRITICAL(&historyMux);
+  if (tier.data && tier.count > 0 && slot <= tier.newest && tier.newest - slot < tier.count) {
+    const HistorySample* sample = (const HistorySample*)history_record_at(tier, slot);
+    memcpy(frame->temp, sample->temp, sizeof(frame->temp));
+    frame->relays = sample->relays;
+    valid = true;
+  }
+  portEXIT_CRITICAL(&historyMux);
+
+  if (!valid) {
+    memcpy(frame->temp, EMPTY_SAMPLE.temp, sizeof(frame->temp));
+    frame->relays = 0;
+  }
+  return valid;
+}
+
+bool history_get_latest(TelemetryFrame* frame) {
+  return history_read_sample(tiers[TIER_RAW].newest, frame);
+}
+
+void history_send_binary(AsyncWebServerRequest *req, uint32_t from, uint32_t to) {
+  const HistoryTier& tier = tiers[TIER_RAW];
+  if (!tier.data) {
+    req->send(503, "text/plain", "History unavailable");
+    return;
+  }
+
+  portENTER_CRITICAL(&historyMux);
+  uint32_t newest = tier.newest;
+  uint32_t oldest = tier.newest - (tier.count > 0 ? tier.count - 1 : 0);
+  bool empty = (tier.count == 0);
+  portEXIT_CRITICAL(&historyMux);
+
+  std::shared_ptr<HistoryBinaryQuery> q(new HistoryBinaryQuery());
+  q->next = max(from, oldest);
+  q->last = min(to, newest);
+  uint32_t frames = (empty || q->last < q->next) ? 0 : q->last - q->next + 1;
+  if (frames == 0) q->next = q->last + 1;
+
+  telemetry_encoder_init(&q->encoder, TELEMETRY_CODEC_KEYFRAME);
+  q->pendingLength = telemetry_encode_header(&q->encoder, tier.periodSec, q->next, frames,
+                                            q->pending, sizeof(q->pending));
+
+  AsyncWebServerResponse *response = req->beginChunkedResponse("application/octet-stream",
+    [q](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+      size_t written = 0;
+      while (written < maxLen) {
+        if (q->pendingPos >= q->pendingLength) {
+          if (q->next > q->last) break;
+          TelemetryFrame frame;
+          history_read_sample(q->next++, &frame);
+          q->pendingLength = telemetry_encode_frame(&q->encoder, &frame, q->pending, sizeof(q->pending));
+          q->pendingPos = 0;
+        }
+        size_t chunk = min(q->pendingLength - q->pendingPos, maxLen - written);
+        memcpy(buffer + written, q->pending + q->pendingPos, chunk);
+        q->pendingPos += chunk;
+        written += chunk;
+      }
+      return written;
+    });
+  response->addHeader("Cache-Control", "no-store");
+  req->send(response);
+}
+
+uint32_t history_get_now() {
+  portENTER_CRITICAL(&historyMux);
+  uint32_t now = tiers[TIER_RAW].count > 0 ? tiers[TIER_RAW].newest : 0;
+  portEXIT_CRITICAL(&historyMux);
+  return now;
+}
+
+size_t history_get_memory_bytes() {
+  size_t total = 0;
+  for (int t = 0; t < TIER_COUNT; t++) {
+    if (tiers[t].data) total += (size_t)tiers[t].slots * tiers[t].recordSize;
+  }
+  return total;
+}
+
+String history_get_info_json() {
+  char buffer[512];
+  JsonWriter json(buffer, sizeof(buffer));
+
+  json.beginObject();
+  json.field("now", history_get_now());
+  json.field("bytes", (unsigned long)history_get_memory_bytes());
+  json.beginArray("tiers");
+  for (int t = 0; t < TIER_COUNT; t++) {
+    const HistoryTier& tier = tiers[t];
+    portENTER_CRITICAL(&historyMux);
+    uint32_t count = tier.count;
+    uint32_t newest = tier.newest;
+    portEXIT_CRITICAL(&historyMux);
+
+    json.beginObject();
+    json.field("name", tier.name);
+    json.field("periodSec", tier.periodSec);
+    json.field("slots", tier.slots);
+    json.field("recordBytes", (unsigned long)tier.recordSize);
+    json.field("allocated", tier.data != NULL);
+    json.field("count", count);
+    json.field("oldest", count > 0 ? (newest - count + 1) * tier.periodSec : 0);
+    json.field("newest", count > 0 ? newest * tier.periodSec : 0);
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
+
+  return String(json.c_str());
+}
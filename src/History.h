@@ -0,0 +1,41 @@
+// History.h - Fixed-memory temperature and relay history with downsampled queries
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include "TelemetryCodec.h"
+
+// Tiers: 1 s raw samples, then 10 s and 1 min rollups (grill min/max/avg,
+// other channels averaged, relays as percent on-time)
+#define HISTORY_RAW_SLOTS       3600   // 1 hour at 1 s
+#define HISTORY_10S_SLOTS       1080   // 3 hours at 10 s
+#define HISTORY_1MIN_SLOTS      1440   // 24 hours at 1 min
+
+// Query limits
+#define HISTORY_DEFAULT_POINTS  300
+#define HISTORY_MAX_POINTS      1000
+#define HISTORY_DEFAULT_SPAN    3600   // Seconds when from= is omitted
+
+// Temperatures are stored in 0.1°F; this marks a missing reading
+#define HISTORY_NO_VALUE        INT16_MIN
+
+// History functions
+void history_init();       // Allocates the tiers - call once from setup()
+void history_update();     // Call once per second from loop()
+
+// Streams CSV for [from, to] seconds of uptime, LTTB-downsampled to at most points rows
+void history_send_csv(AsyncWebServerRequest *req, uint32_t from, uint32_t to, uint32_t points);
+
+// Streams every 1 s sample in [from, to] in the TelemetryCodec binary format
+void history_send_binary(AsyncWebServerRequest *req, uint32_t from, uint32_t to);
+
+// Copies the newest 1 s sample; false (and no readings) before the first one
+bool history_get_latest(TelemetryFrame* frame);
+
+// Status
+uint32_t history_get_now();          // Seconds of uptime of the newest sample
+size_t history_get_memory_bytes();   // Total bytes allocated for all tiers
+String history_get_info_json();
+
+#endif // HISTORY_H
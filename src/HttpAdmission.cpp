@@ -0,0 +1,233 @@
+// HttpAdmission.cpp - Request admission, concurrency cap and per-route latency
+//
+// The admission handler is first in the server's handler list. canHandle()
+// runs for every request once its headers are parsed: it answers true only to
+// refuse the request (handleRequest() then sends the 503), and false to let
+// the normal route handle it. An admitted request carries a small ticket in
+// its onDisconnect callback; the ticket is released when the request object
+// is freed, which also covers requests handed over to the event stream.
+#include "HttpAdmission.h"
+#include "Globals.h"
+#include "Metrics.h"
+#include "JsonWriter.h"
+#include "Clock.h"
+#include <atomic>
+#include <memory>
+
+struct HttpRoute {
+  const char* path;
+  HttpRouteClass cls;
+  uint32_t budgetMs;      // 0 = not checked (streams)
+};
+
+// Exact paths; anything else is counted under "other"
+static const HttpRoute ROUTES[] = {
+  {"/stop",                HTTP_CONTROL, 3500},
+  {"/force_stop",          HTTP_CONTROL, 3500},
+  {"/emergency_stop",      HTTP_CONTROL, 3500},
+  {"/control",             HTTP_CONTROL, 3500},
+  {"/clear_manual",        HTTP_CONTROL, 3500},
+  {"/api/v2/commands",     HTTP_CONTROL, 3500},
+  {"/",                    HTTP_NORMAL,  1000},
+  {"/status_all",          HTTP_NORMAL,  31000},   // Long-poll may park for 30 s
+  {"/api/v2/status",       HTTP_NORMAL,  31000},
+  {"/api/v2/settings",     HTTP_NORMAL,  3500},
+  {"/events",              HTTP_NORMAL,  0},
+  {"/job",                 HTTP_NORMAL,  500},
+  {"/wifi_scan",           HTTP_NORMAL,  500},     // Served from the scan cache
+  {"/spi_register_dump",   HTTP_NORMAL,  500},
+  {"/spi_pin_test",        HTTP_NORMAL,  500},
+  {"/history",             HTTP_HEAVY,   5000},
+  {"/history.bin",         HTTP_HEAVY,   5000},
+  {"/metrics",             HTTP_HEAVY,   1000},
+  {"/task_stats",          HTTP_HEAVY,   1000},
+  {"/task_stats.txt",      HTTP_HEAVY,   1000},
+  {"/max31865",            HTTP_HEAVY,   2000},
+  {"/spi_test",            HTTP_HEAVY,   2000},
+  {"/update",              HTTP_HEAVY,   5000},
+  {"/api/v2/openapi.json", HTTP_HEAVY,   1000},
+};
+#define ROUTE_COUNT (sizeof(ROUTES) / sizeof(ROUTES[0]))
+#define ROUTE_OTHER ROUTE_COUNT
+#define OTHER_BUDGET_MS 2000
+
+static const char* const CLASS_NAMES[] = {"control", "normal", "heavy"};
+
+struct HttpRouteStats {
+  std::atomic<uint32_t> requests;
+  std::atomic<uint32_t> rejected;
+  std::atomic<uint32_t> overBudget;
+  std::atomic<uint32_t> sumMs;
+  std::atomic<uint32_t> maxMs;
+};
+
+static HttpRouteStats routeStats[ROUTE_COUNT + 1];   // Last is "other"
+
+static std::atomic<int> inFlight(0);
+static std::atomic<int> heavyInFlight(0);
+static std::atomic<int> heavyPeak(0);
+static std::atomic<uint32_t> rejectedBusy(0);
+static std::atomic<uint32_t> rejectedHeap(0);
+static uint64_t lastOverrunLog = 0;
+
+static size_t http_find_route(const char* url) {
+  for (size_t i = 0; i < ROUTE_COUNT; i++) {
+    if (strcmp(url, ROUTES[i].path) == 0) return i;
+  }
+  return ROUTE_OTHER;
+}
+
+static HttpRouteClass http_route_class(size_t route) {
+  return route < ROUTE_COUNT ? ROUTES[route].cls : HTTP_NORMAL;
+}
+
+static uint32_t http_route_budget(size_t route) {
+  return route < ROUTE_COUNT ? ROUTES[route].budgetMs : OTHER_BUDGET_MS;
+}
+
+static const char* http_route_name(size_t route) {
+  return route < ROUTE_COUNT ? ROUTES[route].path : "other";
+}
+
+// Held by an admitted request; releases its slot and records latency when freed
+struct HttpTicket {
+  size_t route;
+  uint64_t startUs;
+
+  ~HttpTicket() {
+    HttpRouteClass cls = http_route_class(route);
+    if (cls != HTTP_CONTROL) inFlight--;
+    if (cls == HTTP_HEAVY) heavyInFlight--;
+
+    uint64_t us = clock_us() - startUs;
+    metrics_observe(METRIC_HTTP_REQUEST_US, (uint32_t)min(us, (uint64_t)UINT32_MAX));
+
+    uint32_t ms = (uint32_t)(us / 1000);
+    HttpRouteStats& stats = routeStats[route];
+    stats.sumMs.fetch_add(ms, std::memory_order_relaxed);
+    uint32_t seen = stats.maxMs.load(std::memory_order_relaxed);
+    while (ms > seen && !stats.maxMs.compare_exchange_weak(seen, ms)) {}
+
+    uint32_t budget = http_route_budget(route);
+    if (budget > 0 && ms > budget) {
+      stats.overBudget.fetch_add(1, std::memory_order_relaxed);
+      if (clock_elapsed_ms(lastOverrunLog) >= HTTP_OVERRUN_LOG_MS) {
+        lastOverrunLog = clock_ms();
+        Serial.printf("⏱️ HTTP %s took %lu ms (budget %lu ms)\n", http_route_name(route),
+                      (unsigned long)ms, (unsigned long)budget);
+      }
+    }
+  }
+};
+
+class AdmissionHandler : public AsyncWebHandler {
+public:
+  bool canHandle(AsyncWebServerRequest *request) override {
+    metrics_count(METRIC_HTTP_REQUESTS);
+
+    size_t route = http_find_route(request->url().c_str());
+    HttpRouteClass cls = http_route_class(route);
+    routeStats[route].requests.fetch_add(1, std::memory_order_relaxed);
+
+    if (cls != HTTP_CONTROL) {
+      uint32_t heap = ESP.getFreeHeap();
+      if (heap < HTTP_HEAP_MIN || (cls == HTTP_HEAVY && heap < HTTP_HEAP_MIN_HEAVY)) {
+        rejectedHeap++;
+        routeStats[route].rejected.fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
+      if (inFlight.load() >= HTTP_MAX_IN_FLIGHT ||
+          (cls == HTTP_HEAVY && heavyInFlight.load() >= HTTP_MAX_HEAVY)) {
+        rejectedBusy++;
+        routeStats[route].rejected.fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
+      inFlight++;
+      if (cls == HTTP_HEAVY) {
+        int now = ++heavyInFlight;
+        int peak = heavyPeak.load();
+        while (now > peak && !heavyPeak.compare_exchange_weak(peak, now)) {}
+      }
+    }
+
+    std::shared_ptr<HttpTicket> ticket(new HttpTicket());
+    ticket->route = route;
+    ticket->startUs = clock_us();
+    request->onDisconnect([ticket]() {});   // Released with the request
+    return false;
+  }
+
+  // Only reached for refused requests
+  void handleRequest(AsyncWebServerRequest *request) override {
+    bool lowHeap = ESP.getFreeHeap() < HTTP_HEAP_MIN_HEAVY;
+    AsyncWebServerResponse *response = request->beginResponse(503, "text/plain",
+      lowHeap ? "Low memory - try again shortly" : "Busy - try again shortly");
+    response->addHeader("Retry-After", String(lowHeap ? HTTP_RETRY_LOW_HEAP_S : HTTP_RETRY_BUSY_S));
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+  }
+};
+
+void http_admission_init() {
+  server.addHandler(new AdmissionHandler());
+}
+
+String http_admission_get_stats_json() {
+  std::unique_ptr<char[]> buffer(new char[HTTP_STATS_JSON_BUFFER]);   // Too big for the async_tcp stack
+  JsonWriter json(buffer.get(), HTTP_STATS_JSON_BUFFER);
+
+  json.beginObject();
+  json.field("inFlight", inFlight.load());
+  json.field("heavyInFlight", heavyInFlight.load());
+  json.field("heavyPeak", heavyPeak.load());
+  json.field("rejectedBusy", rejectedBusy.load());
+  json.field("rejectedHeap", rejectedHeap.load());
+  json.field("freeHeap", (unsigned long)ESP.getFreeHeap());
+  json.beginArray("routes");
+  for (size_t i = 0; i <= ROUTE_COUNT; i++) {
+    HttpRouteStats& stats = routeStats[i];
+    uint32_t requests = stats.requests.load();
+    if (requests == 0) continue;
+    uint32_t rejected = stats.rejected.load();
+    uint32_t served = requests - rejected;
+    json.beginObject();
+    json.field("path", http_route_name(i));
+    json.field("class", CLASS_NAMES[http_route_class(i)]);
+    json.field("requests", requests);
+    json.field("rejected", rejected);
+    json.field("avgMs", served > 0 ? stats.sumMs.load() / served : 0);
+    json.field("maxMs", stats.maxMs.load());
+    json.field("budgetMs", http_route_budget(i));
+    json.field("overBudget", stats.overBudget.load());
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
+
+  return String(json.c_str());
+}
+
+void http_admission_write_metrics(Print *out) {
+  out->printf("# HELP grill_http_rejected_total Requests refused with 503 by admission control\n"
+              "# TYPE grill_http_rejected_total counter\n");
+  out->printf("grill_http_rejected_total{reason=\"busy\"} %lu\n", (unsigned long)rejectedBusy.load());
+  out->printf("grill_http_rejected_total{reason=\"heap\"} %lu\n", (unsigned long)rejectedHeap.load());
+
+  out->printf("# HELP grill_http_heavy_in_flight Heavy requests being served\n"
+              "# TYPE grill_http_heavy_in_flight gauge\n");
+  out->printf("grill_http_heavy_in_flight %d\n", heavyInFlight.load());
+
+  out->printf("# HELP grill_http_route_seconds_sum Time spent serving each route\n"
+              "# TYPE grill_http_route_seconds_sum counter\n");
+  for (size_t i = 0; i <= ROUTE_COUNT; i++) {
+    out->printf("grill_http_route_seconds_sum{route=\"%s\"} %.3f\n", http_route_name(i),
+                routeStats[i].sumMs.load() / 1000.0);
+  }
+
+  out->printf("# HELP grill_http_route_over_budget_total Requests slower than their route budget\n"
+              "# TYPE grill_http_route_over_budget_total counter\n");
+  for (size_t i = 0; i <= ROUTE_COUNT; i++) {
+    out->printf("grill_http_route_over_budget_total{route=\"%s\"} %lu\n", http_route_name(i),
+                (unsigned long)routeStats[i].overBudget.load());
+  }
+}
@@ -0,0 +1,40 @@
+// HttpAdmission.h - Request admission, concurrency cap and per-route latency
+//
+// Every request passes one handler, registered ahead of all routes, once its
+// headers are parsed. Routes are classed by cost: CONTROL requests (stop,
+// emergency stop, commands) are always admitted; NORMAL requests are refused
+// only when the heap is nearly gone; HEAVY pages and exports are limited to a
+// few at a time and refused early under memory pressure. A refused request
+// gets 503 with Retry-After before any handler allocates for it.
+//
+// Latency is headers-parsed to request freed, per route, and compared with the
+// route's budget; overruns are counted and logged.
+#ifndef HTTPADMISSION_H
+#define HTTPADMISSION_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#define HTTP_MAX_HEAVY            2       // Heavy requests in flight at once
+#define HTTP_MAX_IN_FLIGHT        8       // All non-control requests in flight
+#define HTTP_HEAP_MIN_HEAVY       40000   // Free heap below which heavy requests are refused
+#define HTTP_HEAP_MIN             16000   // Free heap below which everything but control is refused
+#define HTTP_RETRY_BUSY_S         2
+#define HTTP_RETRY_LOW_HEAP_S     5
+#define HTTP_OVERRUN_LOG_MS       10000   // At most one budget overrun log line per this period
+#define HTTP_STATS_JSON_BUFFER    3072
+
+enum HttpRouteClass : uint8_t {
+  HTTP_CONTROL = 0,
+  HTTP_NORMAL,
+  HTTP_HEAVY
+};
+
+// Setup - call before any route is registered, so it is consulted first
+void http_admission_init();
+
+// Status
+String http_admission_get_stats_json();
+void http_admission_write_metrics(Print *out);   // Prometheus lines for /metrics
+
+#endif // HTTPADMISSION_H
@@ -3,10 +3,11 @@
 #include "Globals.h"
 #include "Utility.h"
 #include "RelayControl.h"
+#include "Clock.h"
 
 // Ignition state tracking
 static IgnitionState currentState = IGNITION_OFF;
-static unsigned long stateStartTime = 0;
+static uint64_t stateStartTime = 0;
 static double ignitionTargetTemp = 0;
 static double startingTemp = 0;
 static double peakTemp = 0;
@@ -27,9 +28,9 @@ static bool ignitionRequested = false;
 
 // PiFire-style auger control structure
 struct PiFireAugerControl {
-  unsigned long lastCycleTime = 0;
+  uint64_t lastCycleTime = 0;
   bool augerCurrentlyOn = false;
-  unsigned long currentCycleStartTime = 0;
+  uint64_t currentCycleStartTime = 0;
   
   // PiFire-style cycle parameters that respond to temperature error
   unsigned long baseAugerOnTime = 15000;     // Base 15 seconds ON
@@ -83,19 +84,19 @@ void pifire_calculate_timing() {
   }
   
   // Debug output every 30 seconds
-  static unsigned long lastTempDebug = 0;
-  if (millis() - lastTempDebug >= 30000) {
+  static uint64_t lastTempDebug = 0;
+  if (clock_ms() - lastTempDebug >= 30000) {
     Serial.printf("PiFire Temp Control: Current=%.1f°F, Target=%.1f°F, Error=%.1f°F\n",
                   currentTemp, targetTemp, tempError);
     Serial.printf("PiFire Timing: ON=%lu sec, OFF=%lu sec\n",
                   piFireAuger.currentOnTime / 1000, piFireAuger.currentOffTime / 1000);
-    lastTempDebug = millis();
+    lastTempDebug = clock_ms();
   }
 }
 
 // FIXED: PiFire auger control - no recursion
 void pifire_auger_cycle() {
-  unsigned long now = millis();
+  uint64_t now = clock_ms();
   
   // Don't do anything if grill isn't running
   if (!grillRunning) {
@@ -187,13 +188,13 @@ void ignition_start(double currentTemp) {
   ignitionRequested = true;
   
   // Reset PiFire auger state
-  piFireAuger.lastCycleTime = millis();
+  piFireAuger.lastCycleTime = clock_ms();
   piFireAuger.augerCurrentlyOn = false;
   piFireAuger.currentCycleStartTime = 0;
   
   // Start with preheat phase
   currentState = IGNITION_PREHEAT;
-  stateStartTime = millis();
+  stateStartTime = clock_ms();
   
   // Turn on fans only during preheat - no igniter yet
   RelayRequest preheatReq = {RELAY_OFF, RELAY_OFF, RELAY_ON, RELAY_ON};
@@ -248,8 +249,8 @@ void ignition_loop() {
     return;
   }
   
-  unsigned long now = millis();
-  unsigned long stateTime = now - stateStartTime;
+  uint64_t now = clock_ms();
+  unsigned long stateTime = (unsigned long)(now - stateStartTime);
   double currentTemp = readTemperature();
   
   // Update peak temperature
@@ -350,7 +351,7 @@ void ignition_loop() {
   }
   
   // Debug output every 30 seconds during ignition
-  static unsigned long lastIgnitionDebug = 0;
+  static uint64_t lastIgnitionDebug = 0;
   if (now - lastIgnitionDebug >= 30000) {
     Serial.printf("Ignition: %s, Temp: %.1f°F, Time: %lu sec\n",
                   ignition_get_status_string().c_str(),
@@ -365,7 +366,7 @@ void pifire_manual_auger_prime() {
   
   // Reset cycle state
   piFireAuger.augerCurrentlyOn = false;
-  piFireAuger.lastCycleTime = millis();
+  piFireAuger.lastCycleTime = clock_ms();
   
   // Simple manual prime
   RelayRequest primeReq = {RELAY_NOCHANGE, RELAY_ON, RELAY_NOCHANGE, RELAY_NOCHANGE};
@@ -390,10 +391,10 @@ String pifire_get_status() {
   if (!grillRunning) return "IDLE";
   
   if (piFireAuger.augerCurrentlyOn) {
-    unsigned long remaining = piFireAuger.currentOnTime - (millis() - piFireAuger.currentCycleStartTime);
+    unsigned long remaining = piFireAuger.currentOnTime - (unsigned long)clock_elapsed_ms(piFireAuger.currentCycleStartTime);
     return "FEEDING (" + String(remaining / 1000) + "s ON)";
   } else {
-    unsigned long remaining = piFireAuger.currentOffTime - (millis() - piFireAuger.lastCycleTime);
+    unsigned long remaining = piFireAuger.currentOffTime - (unsigned long)clock_elapsed_ms(piFireAuger.lastCycleTime);
     return "WAITING (" + String(remaining / 1000) + "s OFF)";
   }
 }
@@ -0,0 +1,275 @@
+// Jobs.cpp - Blocking diagnostics run on a background task, results polled over HTTP
+//
+// Slots are claimed and reclaimed only by web handlers (the async_tcp task);
+// the worker only moves a slot from QUEUED through RUNNING to DONE. jobMux
+// covers every slot access, and result buffers are freed outside it.
+#include "Jobs.h"
+#include "Globals.h"
+#include "Metrics.h"
+#include "JsonWriter.h"
+#include "Clock.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include <stdarg.h>
+
+enum JobState : uint8_t {
+  JOB_FREE = 0,
+  JOB_QUEUED,
+  JOB_RUNNING,
+  JOB_DONE
+};
+
+static const char* const STATE_NAMES[] = {"free", "queued", "running", "done"};
+
+struct JobSlot {
+  uint32_t id;
+  const JobDefinition* job;
+  JobState state;
+  uint64_t finishedAt;
+  uint32_t runMs;
+  char* result;             // NULL when DONE means the buffer could not be allocated
+  size_t length;
+};
+
+static JobSlot slots[JOB_SLOTS];
+static portMUX_TYPE jobMux = portMUX_INITIALIZER_UNLOCKED;
+static QueueHandle_t jobQueue = NULL;
+static TaskHandle_t jobTaskHandle = NULL;
+static uint32_t nextId = 1;
+
+static uint32_t startedCount = 0;
+static uint32_t joinedCount = 0;
+static uint32_t busyCount = 0;
+static uint32_t completedCount = 0;
+
+void job_printf(JobOutput* out, const char* format, ...) {
+  if (out->length + 1 >= out->capacity) return;
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(out->buffer + out->length, out->capacity - out->length, format, args);
+  va_end(args);
+  if (n > 0) out->length = min(out->length + (size_t)n, out->capacity - 1);
+}
+
+static void job_task(void *parameter) {
+  uint8_t index;
+  while (true) {
+    if (xQueueReceive(jobQueue, &index, portMAX_DELAY) != pdTRUE) continue;
+
+    portENTER_CRITICAL(&jobMux);
+    JobSlot& slot = slots[index];
+    const JobDefinition* job = slot.job;
+    slot.state = JOB_RUNNING;
+    portEXIT_CRITICAL(&jobMux);
+
+    uint64_t start = clock_ms();
+    char* buffer = (char *)malloc(JOB_RESULT_MAX);
+    JobOutput out = {buffer, buffer ? (size_t)JOB_RESULT_MAX : 0, 0};
+    if (buffer) {
+      buffer[0] = '\0';
+      job->run(&out);
+      char* shrunk = (char *)realloc(buffer, out.length + 1);
+      if (shrunk) buffer = shrunk;
+    }
+
+    portENTER_CRITICAL(&jobMux);
+    slot.result = buffer;
+    slot.length = out.length;
+    slot.finishedAt = clock_ms();
+    slot.runMs = (uint32_t)(slot.finishedAt - start);
+    slot.state = JOB_DONE;
+    completedCount++;
+    portEXIT_CRITICAL(&jobMux);
+  }
+}
+
+void job_start(AsyncWebServerRequest *req, const JobDefinition* job) {
+  if (jobQueue == NULL) {
+    req->send(503, "text/plain", "Background jobs unavailable");
+    return;
+  }
+
+  uint32_t id = 0;
+  int claimed = -1;
+  char* stale = NULL;
+
+  portENTER_CRITICAL(&jobMux);
+  // Join a run of the same job that has not finished yet
+  for (int i = 0; i < JOB_SLOTS; i++) {
+    if (slots[i].job == job && (slots[i].state == JOB_QUEUED || slots[i].state == JOB_RUNNING)) {
+      id = slots[i].id;
+      joinedCount++;
+      break;
+    }
+  }
+
+  if (id == 0) {
+    // A free slot, else the oldest finished one
+    for (int i = 0; i < JOB_SLOTS; i++) {
+      if (slots[i].state == JOB_FREE) {
+        claimed = i;
+        break;
+      }
+      if (slots[i].state == JOB_DONE && (claimed < 0 || slots[i].finishedAt < slots[claimed].finishedAt)) {
+        claimed = i;
+      }
+    }
+    if (claimed >= 0) {
+      JobSlot& slot = slots[claimed];
+      stale = slot.result;
+      slot.id = id = nextId++;
+      slot.job = job;
+      slot.state = JOB_QUEUED;
+      slot.result = NULL;
+      slot.length = 0;
+      slot.runMs = 0;
+      startedCount++;
+    } else {
+      busyCount++;
+    }
+  }
+  portEXIT_CRITICAL(&jobMux);
+
+  free(stale);
+
+  if (id == 0) {
+    AsyncWebServerResponse *response = req->beginResponse(503, "text/plain", "Busy - background jobs in progress");
+    response->addHeader("Retry-After", "2");
+    req->send(response);
+    return;
+  }
+  if (claimed >= 0) {
+    uint8_t index = claimed;
+    xQueueSend(jobQueue, &index, 0);   // Holds JOB_SLOTS entries, one per slot at most
+    Serial.printf("🧰 Job %lu (%s) queued\n", (unsigned long)id, job->name);
+  }
+
+  char poll[24];
+  snprintf(poll, sizeof(poll), "/job?id=%lu", (unsigned long)id);
+  char buffer[96];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("id", (unsigned long)id);
+  json.field("poll", poll);
+  json.endObject();
+
+  AsyncWebServerResponse *response = req->beginResponse(202, "application/json", json.c_str());
+  response->addHeader("Location", poll);
+  response->addHeader("Cache-Control", "no-store");
+  req->send(response);
+}
+
+static void job_send_result(AsyncWebServerRequest *req, uint32_t id) {
+  JobState state = JOB_FREE;
+  const JobDefinition* job = NULL;
+  const char* result = NULL;
+  size_t length = 0;
+
+  // Result buffers are only freed by job_start(), on this same task
+  portENTER_CRITICAL(&jobMux);
+  for (int i = 0; i < JOB_SLOTS; i++) {
+    if (slots[i].id == id && slots[i].state != JOB_FREE) {
+      state = slots[i].state;
+      job = slots[i].job;
+      result = slots[i].result;
+      length = slots[i].length;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&jobMux);
+
+  if (state == JOB_FREE) {
+    req->send(404, "text/plain", "Unknown or expired job");
+    return;
+  }
+
+  if (state != JOB_DONE) {
+    char buffer[64];
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginObject();
+    json.field("id", (unsigned long)id);
+    json.field("state", STATE_NAMES[state]);
+    json.endObject();
+    AsyncWebServerResponse *response = req->beginResponse(202, "application/json", json.c_str());
+    response->addHeader("Retry-After", "1");
+    response->addHeader("Cache-Control", "no-store");
+    req->send(response);
+    return;
+  }
+
+  if (result == NULL) {
+    req->send(500, "text/plain", "Job could not allocate its result buffer");
+    return;
+  }
+
+  AsyncResponseStream *response = req->beginResponseStream(job->contentType, length);
+  response->write((const uint8_t *)result, length);
+  response->addHeader("Cache-Control", "no-store");
+  req->send(response);
+}
+
+// Free results nobody has collected within JOB_KEEP_MS
+static void job_expire() {
+  char* stale[JOB_SLOTS];
+  int count = 0;
+
+  portENTER_CRITICAL(&jobMux);
+  for (int i = 0; i < JOB_SLOTS; i++) {
+    if (slots[i].state == JOB_DONE && clock_elapsed_ms(slots[i].finishedAt) >= JOB_KEEP_MS) {
+      stale[count++] = slots[i].result;
+      slots[i].result = NULL;
+      slots[i].state = JOB_FREE;
+    }
+  }
+  portEXIT_CRITICAL(&jobMux);
+
+  for (int i = 0; i < count; i++) free(stale[i]);
+}
+
+void jobs_init() {
+  jobQueue = xQueueCreate(JOB_SLOTS, sizeof(uint8_t));
+  if (jobQueue == NULL ||
+      xTaskCreatePinnedToCore(job_task, "jobs", JOB_TASK_STACK, NULL, JOB_TASK_PRIORITY,
+                              &jobTaskHandle, JOB_TASK_CORE) != pdPASS) {
+    Serial.println("❌ Job task creation failed - diagnostics unavailable");
+    return;
+  }
+  metrics_register_task("jobs", jobTaskHandle);
+
+  server.on("/job", HTTP_GET, [](AsyncWebServerRequest *req) {
+    if (!req->hasParam("id")) {
+      req->send(400, "text/plain", "Missing id parameter");
+      return;
+    }
+    job_expire();
+    job_send_result(req, strtoul(req->getParam("id")->value().c_str(), NULL, 10));
+  });
+}
+
+String jobs_get_stats_json() {
+  char buffer[512];
+  JsonWriter json(buffer, sizeof(buffer));
+
+  json.beginObject();
+  json.field("started", startedCount);
+  json.field("joined", joinedCount);
+  json.field("busy", busyCount);
+  json.field("completed", completedCount);
+  json.beginArray("slots");
+  portENTER_CRITICAL(&jobMux);
+  for (int i = 0; i < JOB_SLOTS; i++) {
+    if (slots[i].state == JOB_FREE) continue;
+    json.beginObject();
+    json.field("id", (unsigned long)slots[i].id);
+    json.field("job", slots[i].job->name);
+    json.field("state", STATE_NAMES[slots[i].state]);
+    json.field("runMs", slots[i].runMs);
+    json.endObject();
+  }
+  portEXIT_CRITICAL(&jobMux);
+  json.endArray();
+  json.endObject();
+
+  return String(json.c_str());
+}
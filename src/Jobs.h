@@ -0,0 +1,46 @@
+// Jobs.h - Blocking diagnostics run on a background task, results polled over HTTP
+//
+// Work that blocks for milliseconds to seconds (WiFi scans, SPI register dumps)
+// must not run inside an async web handler, where it stalls the TCP stack, or
+// on loop(), where it delays control. A handler calls job_start() instead: the
+// job is queued for the worker task and the client gets 202 with the job id,
+// then polls GET /job?id=<n> until it answers 200 with the result. A job that
+// is already queued or running is joined rather than started twice.
+#ifndef JOBS_H
+#define JOBS_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#define JOB_SLOTS            4
+#define JOB_RESULT_MAX       2048    // Result text, allocated when the job runs
+#define JOB_KEEP_MS          60000   // Finished results kept this long for polling
+#define JOB_TASK_STACK       4096
+#define JOB_TASK_PRIORITY    1       // Same as logging, below network; off control's core
+#define JOB_TASK_CORE        0
+
+// Result text sink passed to a job
+struct JobOutput {
+  char* buffer;
+  size_t capacity;
+  size_t length;
+};
+
+void job_printf(JobOutput* out, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+struct JobDefinition {
+  const char* name;
+  const char* contentType;          // Of the finished result
+  void (*run)(JobOutput* out);      // Runs on the job task
+};
+
+// Setup - creates the worker task and GET /job
+void jobs_init();
+
+// Queue (or join) a job and answer 202 {"id":..,"poll":"/job?id=.."}; 503 when all slots are busy
+void job_start(AsyncWebServerRequest *req, const JobDefinition* job);
+
+// Status
+String jobs_get_stats_json();
+
+#endif // JOBS_H
@@ -0,0 +1,229 @@
+// JsonReader.cpp - Recursive-descent JSON parser reporting leaves by path
+#include "JsonReader.h"
+#include <stdlib.h>
+#include <string.h>
+
+JsonReader::JsonReader(const char* text) : text(text), p(text), handler(NULL), context(NULL),
+    pathLen(0), errorText(NULL), errorAt(0), stopped(false) {
+  path[0] = '\0';
+}
+
+bool JsonReader::fail(const char* message) {
+  if (!errorText && !stopped) {
+    errorText = message;
+    errorAt = p - text;
+  }
+  return false;
+}
+
+void JsonReader::skipSpace() {
+  while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+}
+
+// Append ".segment" (or "segment" at the root); the caller restores pathLen
+bool JsonReader::pushPath(const char* segment) {
+  size_t n = strlen(segment);
+  size_t need = pathLen + (pathLen > 0 ? 1 : 0) + n;
+  if (need >= sizeof(path)) return fail("Key path too long");
+  if (pathLen > 0) path[pathLen++] = '.';
+  memcpy(path + pathLen, segment, n);
+  pathLen += n;
+  path[pathLen] = '\0';
+  return true;
+}
+
+bool JsonReader::emit(JsonLeaf& leaf) {
+  leaf.path = path;
+  if (!handler(leaf, context)) {
+    stopped = true;
+    return false;
+  }
+  return true;
+}
+
+bool JsonReader::parseString(char* out, size_t capacity) {
+  if (*p != '"') return fail("Expected string");
+  p++;
+  size_t n = 0;
+  while (*p != '"') {
+    char c = *p;
+    if (c == '\0' || (uint8_t)c < 0x20) return fail("Unterminated string");
+    if (c == '\\') {
+      p++;
+      switch (*p) {
+        case '"':  c = '"';  break;
+        case '\\': c = '\\'; break;
+        case '/':  c = '/';  break;
+        case 'b':  c = '\b'; break;
+        case 'f':  c = '\f'; break;
+        case 'n':  c = '\n'; break;
+        case 'r':  c = '\r'; break;
+        case 't':  c = '\t'; break;
+        case 'u': {
+          // Only ASCII is meaningful to us; anything wider becomes '?'
+          unsigned code = 0;
+          for (int i = 1; i <= 4; i++) {
+            char h = p[i];
+            unsigned digit;
+            if (h >= '0' && h <= '9') digit = h - '0';
+            else if (h >= 'a' && h <= 'f') digit = h - 'a' + 10;
+            else if (h >= 'A' && h <= 'F') digit = h - 'A' + 10;
+            else return fail("Bad \\u escape");
+            code = (code << 4) | digit;
+          }
+          p += 4;
+          c = (code > 0 && code < 0x80) ? (char)code : '?';
+          break;
+        }
+        default:
+          return fail("Bad escape");
+      }
+    }
+    if (n + 1 >= capacity) return fail("String too long");
+    out[n++] = c;
+    p++;
+  }
+  p++;
+  out[n] = '\0';
+  return true;
+}
+
+bool JsonReader::parseLiteral(const char* word) {
+  size_t n = strlen(word);
+  if (strncmp(p, word, n) != 0) return fail("Unexpected token");
+  p += n;
+  return true;
+}
+
+bool JsonReader::parseObject(int depth) {
+  p++;   // '{'
+  skipSpace();
+  if (*p == '}') {
+    p++;
+    return true;
+  }
+
+  while (true) {
+    char key[JSON_READER_MAX_PATH];
+    skipSpace();
+    if (!parseString(key, sizeof(key))) return false;
+    skipSpace();
+    if (*p != ':') return fail("Expected ':'");
+    p++;
+
+    size_t saved = pathLen;
+    if (!pushPath(key)) return false;
+    if (!parseValue(depth + 1)) return false;
+    pathLen = saved;
+    path[pathLen] = '\0';
+
+    skipSpace();
+    if (*p == ',') {
+      p++;
+      continue;
+    }
+    if (*p == '}') {
+      p++;
+      return true;
+    }
+    return fail("Expected ',' or '}'");
+  }
+}
+
+bool JsonReader::parseArray(int depth) {
+  p++;   // '['
+  skipSpace();
+  if (*p == ']') {
+    p++;
+    return true;
+  }
+
+  for (int index = 0; ; index++) {
+    char segment[12];
+    snprintf(segment, sizeof(segment), "%d", index);
+
+    size_t saved = pathLen;
+    if (!pushPath(segment)) return false;
+    if (!parseValue(depth + 1)) return false;
+    pathLen = saved;
+    path[pathLen] = '\0';
+
+    skipSpace();
+    if (*p == ',') {
+      p++;
+      continue;
+    }
+    if (*p == ']') {
+      p++;
+      return true;
+    }
+    return fail("Expected ',' or ']'");
+  }
+}
+
+bool JsonReader::parseValue(int depth) {
+  skipSpace();
+  JsonLeaf leaf;
+  leaf.boolean = false;
+  leaf.number = 0.0;
+  leaf.string = NULL;
+
+  switch (*p) {
+    case '{':
+    case '[':
+      if (depth >= JSON_READER_MAX_DEPTH) return fail("Nested too deeply");
+      return (*p == '{') ? parseObject(depth) : parseArray(depth);
+
+    case '"':
+      if (!parseString(scratch, sizeof(scratch))) return false;
+      leaf.type = JSON_LEAF_STRING;
+      leaf.string = scratch;
+      return emit(leaf);
+
+    case 't':
+    case 'f':
+      leaf.boolean = (*p == 't');
+      if (!parseLiteral(leaf.boolean ? "true" : "false")) return false;
+      leaf.type = JSON_LEAF_BOOL;
+      return emit(leaf);
+
+    case 'n':
+      if (!parseLiteral("null")) return false;
+      leaf.type = JSON_LEAF_NULL;
+      return emit(leaf);
+
+    default: {
+      // strtod also takes hex, inf and nan - only let JSON number syntax reach it
+      if (*p != '-' && (*p < '0' || *p > '9')) return fail("Unexpected token");
+      char* end;
+      leaf.number = strtod(p, &end);
+      if (end == p) return fail("Bad number");
+      for (const char* c = p; c < end; c++) {
+        if (*c == 'x' || *c == 'X' || *c == 'i' || *c == 'I' || *c == 'n' || *c == 'N') {
+          return fail("Bad number");
+        }
+      }
+      p = end;
+      leaf.type = JSON_LEAF_NUMBER;
+      return emit(leaf);
+    }
+  }
+}
+
+bool JsonReader::parse(JsonLeafHandler handler, void* context) {
+  this->handler = handler;
+  this->context = context;
+  p = text;
+  pathLen = 0;
+  path[0] = '\0';
+  errorText = NULL;
+  errorAt = 0;
+  stopped = false;
+
+  skipSpace();
+  if (*p != '{') return fail("Body must be a JSON object");
+  if (!parseValue(0)) return false;
+  skipSpace();
+  if (*p != '\0') return fail("Trailing characters after object");
+  return true;
+}
@@ -0,0 +1,66 @@
+// JsonReader.h - Minimal JSON parser for request bodies
+//
+// Walks a NUL-terminated document once and reports every scalar as a leaf with
+// its dotted path ("pid.kp"; array elements use their index, "probes.0"). No
+// tree is built and nothing is allocated - paths and unescaped strings live in
+// small fixed buffers, so over-long keys or strings are a parse error.
+#ifndef JSONREADER_H
+#define JSONREADER_H
+
+#include <Arduino.h>
+
+#define JSON_READER_MAX_DEPTH   4
+#define JSON_READER_MAX_PATH    48
+#define JSON_READER_MAX_STRING  64
+
+enum JsonLeafType : uint8_t {
+  JSON_LEAF_NULL = 0,
+  JSON_LEAF_BOOL,
+  JSON_LEAF_NUMBER,
+  JSON_LEAF_STRING
+};
+
+struct JsonLeaf {
+  const char* path;
+  JsonLeafType type;
+  bool boolean;
+  double number;
+  const char* string;
+};
+
+// Return false to stop parsing (parse() then returns false with no syntax error)
+typedef bool (*JsonLeafHandler)(const JsonLeaf& leaf, void* context);
+
+class JsonReader {
+public:
+  explicit JsonReader(const char* text);
+
+  bool parse(JsonLeafHandler handler, void* context);   // Top level must be an object
+
+  const char* error() const { return errorText; }       // NULL when stopped by the handler
+  size_t errorOffset() const { return errorAt; }
+
+private:
+  const char* text;
+  const char* p;
+  JsonLeafHandler handler;
+  void* context;
+  char path[JSON_READER_MAX_PATH];
+  size_t pathLen;
+  char scratch[JSON_READER_MAX_STRING];
+  const char* errorText;
+  size_t errorAt;
+  bool stopped;
+
+  bool fail(const char* message);
+  void skipSpace();
+  bool pushPath(const char* segment);
+  bool parseValue(int depth);
+  bool parseObject(int depth);
+  bool parseArray(int depth);
+  bool parseString(char* out, size_t capacity);
+  bool parseLiteral(const char* word);
+  bool emit(JsonLeaf& leaf);
+};
+
+#endif // JSONREADER_H
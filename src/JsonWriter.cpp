@@ -0,0 +1,160 @@
+// JsonWriter.cpp - Fixed-buffer JSON formatting
+#include "JsonWriter.h"
+#include <math.h>
+#include <string.h>
+
+static const uint32_t POW10[] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+#define JSON_MAX_DECIMALS 6
+
+JsonWriter::JsonWriter(char* buffer, size_t capacity) : buf(buffer), cap(capacity) {
+  reset();
+}
+
+void JsonWriter::reset() {
+  len = 0;
+  overflow = (cap == 0);
+  needComma = false;
+  if (cap > 0) buf[0] = '\0';
+}
+
+void JsonWriter::put(char c) {
+  if (len + 1 >= cap) {
+    overflow = true;
+    return;
+  }
+  buf[len++] = c;
+  buf[len] = '\0';
+}
+
+void JsonWriter::write(const char* s, size_t n) {
+  if (len + n >= cap) {
+    overflow = true;
+    n = (cap > len + 1) ? cap - len - 1 : 0;
+  }
+  memcpy(buf + len, s, n);
+  len += n;
+  if (cap > 0) buf[len] = '\0';
+}
+
+// Digits are produced in reverse into a small scratch buffer
+void JsonWriter::writeUnsigned(uint64_t v, uint8_t minDigits) {
+  char digits[20];
+  uint8_t n = 0;
+  do {
+    digits[n++] = '0' + (v % 10);
+    v /= 10;
+  } while (v > 0 && n < sizeof(digits));
+  while (n < minDigits && n < sizeof(digits)) digits[n++] = '0';
+  while (n > 0) put(digits[--n]);
+}
+
+void JsonWriter::separator() {
+  if (needComma) put(',');
+  needComma = true;
+}
+
+void JsonWriter::beginObject(const char* key) {
+  if (key) this->key(key);
+  else separator();
+  put('{');
+  needComma = false;
+}
+
+void JsonWriter::endObject() {
+  put('}');
+  needComma = true;
+}
+
+void JsonWriter::beginArray(const char* key) {
+  if (key) this->key(key);
+  else separator();
+  put('[');
+  needComma = false;
+}
+
+void JsonWriter::endArray() {
+  put(']');
+  needComma = true;
+}
+
+void JsonWriter::key(const char* name) {
+  value(name);
+  put(':');
+  needComma = false;   // The value that follows belongs to this key
+}
+
+void JsonWriter::value(long v) {
+  separator();
+  if (v < 0) {
+    put('-');
+    writeUnsigned((uint64_t)(-(int64_t)v), 1);
+  } else {
+    writeUnsigned((uint64_t)v, 1);
+  }
+}
+
+void JsonWriter::value(unsigned long v) {
+  separator();
+  writeUnsigned(v, 1);
+}
+
+void JsonWriter::value(float v, uint8_t decimals) {
+  if (isnan(v) || isinf(v)) {
+    null();
+    return;
+  }
+  separator();
+  if (decimals > JSON_MAX_DECIMALS) decimals = JSON_MAX_DECIMALS;
+
+  // Round once in fixed point so 99.96 -> "100.0" carries into the integer part
+  double scaled = fabs((double)v) * POW10[decimals] + 0.5;
+  uint64_t fixed = (uint64_t)scaled;
+  if (v < 0 && fixed > 0) put('-');
+
+  writeUnsigned(fixed / POW10[decimals], 1);
+  if (decimals > 0) {
+    put('.');
+    writeUnsigned(fixed % POW10[decimals], decimals);
+  }
+}
+
+void JsonWriter::value(bool v) {
+  separator();
+  if (v) write("true", 4);
+  else write("false", 5);
+}
+
+void JsonWriter::value(const char* s) {
+  separator();
+  put('"');
+  for (const char* p = s ? s : ""; *p; p++) {
+    char c = *p;
+    switch (c) {
+      case '"':  write("\\\"", 2); break;
+      case '\\': write("\\\\", 2); break;
+      case '\n': write("\\n", 2); break;
+      case '\r': write("\\r", 2); break;
+      case '\t': write("\\t", 2); break;
+      default:
+        if ((uint8_t)c < 0x20) {
+          static const char HEX_DIGITS[] = "0123456789abcdef";
+          write("\\u00", 4);
+          put(HEX_DIGITS[(c >> 4) & 0x0F]);
+          put(HEX_DIGITS[c & 0x0F]);
+        } else {
+          put(c);
+        }
+    }
+  }
+  put('"');
+}
+
+void JsonWriter::null() {
+  separator();
+  write("null", 4);
+}
+
+void JsonWriter::raw(const char* json) {
+  separator();
+  write(json, strlen(json));
+}
@@ -0,0 +1,62 @@
+// JsonWriter.h - Streaming JSON writer into a caller-owned fixed buffer
+//
+// Formats numbers and escapes strings in place, with no String temporaries and
+// no heap allocation. Commas are inserted automatically. Output that does not
+// fit is truncated and flagged - check overflowed() before sending.
+#ifndef JSONWRITER_H
+#define JSONWRITER_H
+
+#include <Arduino.h>
+
+class JsonWriter {
+public:
+  JsonWriter(char* buffer, size_t capacity);
+
+  void reset();
+
+  // Structure
+  void beginObject(const char* key = NULL);
+  void endObject();
+  void beginArray(const char* key = NULL);
+  void endArray();
+  void key(const char* name);
+
+  // Values (inside an array, or after key())
+  void value(long v);
+  void value(unsigned long v);
+  void value(int v)                                        { value((long)v); }
+  void value(unsigned int v)                               { value((unsigned long)v); }
+  void value(float v, uint8_t decimals);   // NaN/inf are written as null
+  void value(bool v);
+  void value(const char* s);               // Quoted and escaped
+  void null();
+  void raw(const char* json);              // Pre-formatted JSON, copied verbatim
+
+  // key + value
+  void field(const char* name, long v)                     { key(name); value(v); }
+  void field(const char* name, unsigned long v)            { key(name); value(v); }
+  void field(const char* name, int v)                      { key(name); value((long)v); }
+  void field(const char* name, unsigned int v)             { key(name); value((unsigned long)v); }
+  void field(const char* name, float v, uint8_t decimals)  { key(name); value(v, decimals); }
+  void field(const char* name, bool v)                     { key(name); value(v); }
+  void field(const char* name, const char* s)              { key(name); value(s); }
+  void fieldNull(const char* name)                         { key(name); null(); }
+
+  const char* c_str() const { return buf; }
+  size_t length() const { return len; }
+  bool overflowed() const { return overflow; }
+
+private:
+  char* buf;
+  size_t cap;
+  size_t len;
+  bool overflow;
+  bool needComma;
+
+  void put(char c);
+  void write(const char* s, size_t n);
+  void writeUnsigned(uint64_t v, uint8_t minDigits);
+  void separator();
+};
+
+#endif // JSONWRITER_H
@@ -0,0 +1,74 @@
+// LockFreeQueue.h - Bounded lock-free queue for passing small messages between tasks
+//
+// Per-slot sequence numbers (Vyukov style) let any number of producers push
+// concurrently without a mutex; a single consumer task drains it. Push never
+// blocks - when the queue is full it returns false and the caller counts a drop.
+#ifndef LOCKFREEQUEUE_H
+#define LOCKFREEQUEUE_H
+
+#include <Arduino.h>
+#include <atomic>
+
+template <typename T, uint32_t CAPACITY>
+class LockFreeQueue {
+  static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+public:
+  LockFreeQueue() : head(0), tail(0) {
+    for (uint32_t i = 0; i < CAPACITY; i++) {
+      slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  // Safe from any task (not from ISRs)
+  bool push(const T& item) {
+    uint32_t pos = tail.load(std::memory_order_relaxed);
+    for (;;) {
+      Slot& slot = slots[pos & (CAPACITY - 1)];
+      uint32_t seq = slot.seq.load(std::memory_order_acquire);
+      int32_t diff = (int32_t)(seq - pos);
+      if (diff == 0) {
+        if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          slot.item = item;
+          slot.seq.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;  // Full
+      } else {
+        pos = tail.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Consumer side - call from the owning task only
+  bool pop(T& item) {
+    uint32_t pos = head.load(std::memory_order_relaxed);
+    Slot& slot = slots[pos & (CAPACITY - 1)];
+    uint32_t seq = slot.seq.load(std::memory_order_acquire);
+    if ((int32_t)(seq - (pos + 1)) < 0) return false;  // Empty, or producer still writing
+
+    item = slot.item;
+    slot.seq.store(pos + CAPACITY, std::memory_order_release);
+    head.store(pos + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  uint32_t size() const {
+    return tail.load(std::memory_order_relaxed) - head.load(std::memory_order_relaxed);
+  }
+
+  uint32_t capacity() const { return CAPACITY; }
+
+private:
+  struct Slot {
+    std::atomic<uint32_t> seq;
+    T item;
+  };
+
+  Slot slots[CAPACITY];
+  std::atomic<uint32_t> head;
+  std::atomic<uint32_t> tail;
+};
+
+#endif // LOCKFREEQUEUE_H
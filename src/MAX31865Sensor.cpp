@@ -19,6 +19,7 @@ MAX31865Sensor::MAX31865Sensor() {
   csPin = 0;
   rref = 430.0;
   rnominal = 100.0;
+  busLock = NULL;
 }
 
 bool MAX31865Sensor::begin(uint8_t cs_pin, float ref_resistor, float nominal_resistor) {
@@ -28,9 +29,10 @@ bool MAX31865Sensor::begin(uint8_t cs_pin, float ref_resistor, float nominal_res
   
   Serial.printf("MAX31865: CS=GPIO%d, RREF=%.0fΩ, Test Resistor=%.0fΩ\n", cs_pin, ref_resistor, nominal_resistor);
   
+  if (busLock == NULL) busLock = xSemaphoreCreateMutex();
+  
   pinMode(csPin, OUTPUT);
   digitalWrite(csPin, HIGH);
-  delay(200);
   
   // Simple config: enable bias and auto mode
   uint8_t config = MAX31865_CONFIG_BIAS | MAX31865_CONFIG_MODEAUTO | MAX31865_CONFIG_FILT60HZ | 0x02; // FAULTCLR
@@ -38,7 +40,7 @@ bool MAX31865Sensor::begin(uint8_t cs_pin, float ref_resistor, float nominal_res
   
   if (writeRegister(MAX31865_CONFIG_REG, config)) {
     Serial.println("MAX31865: Config written successfully");
-    delay(200); // Wait for first conversion
+    delay(MAX31865_FIRST_CONVERSION_MS);
     
     // Test read
     float testTemp = readTemperatureF();
@@ -53,7 +55,16 @@ bool MAX31865Sensor::begin(uint8_t cs_pin, float ref_resistor, float nominal_res
   return false;
 }
 
+void MAX31865Sensor::lockBus() {
+  if (busLock) xSemaphoreTake(busLock, portMAX_DELAY);
+}
+
+void MAX31865Sensor::unlockBus() {
+  if (busLock) xSemaphoreGive(busLock);
+}
+
 uint8_t MAX31865Sensor::readRegister8(uint8_t reg) {
+  lockBus();
   digitalWrite(csPin, LOW);
   delayMicroseconds(10);
   
@@ -64,6 +75,7 @@ uint8_t MAX31865Sensor::readRegister8(uint8_t reg) {
   
   delayMicroseconds(10);
   digitalWrite(csPin, HIGH);
+  unlockBus();
   
   return data;
 }
@@ -75,6 +87,7 @@ uint16_t MAX31865Sensor::readRegister16(uint8_t reg) {
 }
 
 bool MAX31865Sensor::writeRegister(uint8_t reg, uint8_t data) {
+  lockBus();
   digitalWrite(csPin, LOW);
   delayMicroseconds(10);
   
@@ -85,11 +98,20 @@ bool MAX31865Sensor::writeRegister(uint8_t reg, uint8_t data) {
   
   delayMicroseconds(10);
   digitalWrite(csPin, HIGH);
+  unlockBus();
   
-  delay(50);
   return true; // Assume success for simplicity
 }
 
+// Toggle CS with no transfer - wiring check for the diagnostics page
+void MAX31865Sensor::pulseChipSelect() {
+  lockBus();
+  digitalWrite(csPin, LOW);
+  delayMicroseconds(100);
+  digitalWrite(csPin, HIGH);
+  unlockBus();
+}
+
 float MAX31865Sensor::readRTD() {
   //if (!initialized) return -1.0;
   
@@ -4,6 +4,12 @@
 
 #include <Arduino.h>
 #include <SPI.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// Bias settling (~10 ms) plus one conversion with the 60 Hz filter (~52 ms);
+// the only wait in begin(). Register writes take effect immediately.
+#define MAX31865_FIRST_CONVERSION_MS  65
 
 class MAX31865Sensor {
 private:
@@ -11,7 +17,10 @@ private:
   uint8_t csPin;
   float rref;
   float rnominal;
+  SemaphoreHandle_t busLock;    // CS and transfer together, so diagnostics can run from another task
   
+  void lockBus();
+  void unlockBus();
   uint8_t readRegister8(uint8_t reg);
   uint16_t readRegister16(uint8_t reg);
   bool writeRegister(uint8_t reg, uint8_t data);
@@ -24,6 +33,10 @@ public:
   float readRTD();
   bool isInitialized() { return initialized; }
   void setDebug(bool enable) {} // Dummy for compatibility
+  
+  // Diagnostics - bus-locked, safe from any task
+  uint8_t readRegister(uint8_t reg) { return readRegister8(reg); }
+  void pulseChipSelect();
 };
 
 extern MAX31865Sensor grillSensor;
@@ -23,18 +23,208 @@
 #include "WiFiManager.h"
 #include "GrillWebServer.h"
 #include "Settings.h"
+#include "ProbeAlarm.h"
+#include "ProbePredictor.h"
+#include "FanControl.h"
+#include "PelletAccounting.h"
+#include "RelaySafety.h"
+#include "RelayStats.h"
+#include "Clock.h"
+#include "TelemetryPush.h"
+#include "History.h"
+#include "Metrics.h"
+#include "CommandQueue.h"
+#include "StatusCache.h"
+#include "HttpAdmission.h"
+#include "Mqtt.h"
+#include "Beacon.h"
+#include "Boot.h"
+#include "Tasks.h"
 
 // Debug and safety monitoring variables
-static unsigned long lastHealthCheck = 0;
-static unsigned long lastWatchdogFeed = 0;
+static uint64_t lastHealthCheck = 0;
+static uint64_t lastWatchdogFeed = 0;
 static bool systemHealthy = true;
 
+// Display, WiFi, mDNS and the web server - on the boot services task while
+// loop() is already controlling (Boot.h)
+static void start_services() {
+  // Initialize OLED (optional)
+  Serial.println("Initializing OLED display...");
+  if (oledDisplay.begin()) {
+    Serial.println("✅ OLED display initialized");
+  } else {
+    Serial.println("⚠️  OLED display not found - continuing without it");
+  }
+  boot_mark("display");
+  
+  // Admission control sees every request first, so it goes in before any route
+  http_admission_init();
+  
+  // Initialize WiFi - connects in the background from wifiManager.loop()
+  Serial.println("Initializing WiFi...");
+  wifiManager.begin();
+  Serial.println("✅ WiFi manager initialized");
+  boot_mark("wifi");
+  
+  wifiManager.beginMDNS();
+  boot_mark("mdns");
+  
+  // Initialize web server
+  Serial.println("Initializing web server...");
+  setup_grill_server();
+  Serial.println("✅ Web server initialized");
+  boot_mark("web server");
+  
+  Serial.println("\n🔧 PIFIRE AUGER FEATURES:");
+  Serial.println("- Simple time-based auger cycling (15s ON / 60s OFF)");
+  Serial.println("- Separate auger control from ignition state machine");
+  Serial.println("- Manual prime function available");
+  Serial.println("- No complex auger trigger logic");
+  Serial.println("- Proven PiFire-style reliability");
+  
+  Serial.println("\n📋 AVAILABLE COMMANDS:");
+  Serial.println("  test_temp       - Test 100Ω resistor reading");
+  Serial.println("  debug_on/off    - Toggle debug output");
+  Serial.println("  health          - Show system health");
+  Serial.println("  relay_status    - Show relay status");
+  Serial.println("  pellet_status   - Show pellet control status");
+  Serial.println("  reset_reason    - Show last reset reason");
+  Serial.println("  prime_auger     - Manual 30-second auger prime");
+  Serial.println("  help            - Show all commands");
+  Serial.println("=====================================\n");
+}
+
+// acquisition - sensor reads once a second into the snapshot; wakes control
+static void acquisition_task(void *parameter) {
+  esp_task_wdt_add(NULL);
+  SensorSnapshot sample;
+  memset(&sample, 0, sizeof(sample));
+  sample.grillF = readGrillTemperature();
+  TickType_t lastWake = xTaskGetTickCount();
+  
+  while (true) {
+    // Keep the last valid grill reading across a bad conversion, but say so
+    double grillTemp = sampleGrillTemperature();
+    sample.grillValid = isValidTemperature(grillTemp);
+    if (sample.grillValid) {
+      sample.grillF = grillTemp;
+      sample.grillValidMs = clock_ms();
+    }
+    sample.rtdOhms = grillSensor.readRTD();
+    sample.ambientF = sampleAmbientTemperature();
+    
+    // Meat probes - ADS1115 over I2C, shared with the OLED through Wire's lock
+    tempSensor.updateAll(sample.probeF, sample.probeValid);
+    
+    sample.takenMs = clock_ms();
+    tasks_publish_sample(sample);
+    
+    esp_task_wdt_reset();
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(TEMP_UPDATE_INTERVAL));
+  }
+}
+
+// Sensor tests block on live reads and delays, so they run here rather than on control
+static bool ui_run_diagnostic(String command) {
+  command.trim();
+  if (command == "test_temp") {
+    testGrillSensor();
+  } else if (command == "test_meat") {
+    testSpecificProbe();
+  } else if (command == "test_ambient") {
+    testAmbientSensor();
+  } else if (command == "diag") {
+    runTemperatureDiagnostics();
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// ui - OLED pages and serial line input; sensor tests run here, other lines go to control
+static void ui_task(void *parameter) {
+  char line[TASK_SERIAL_LINE_MAX];
+  size_t length = 0;
+  TickType_t lastWake = xTaskGetTickCount();
+  
+  while (true) {
+    while (Serial.available()) {
+      char c = Serial.read();
+      if (c == '\n' || c == '\r') {
+        if (length == 0) continue;
+        line[length] = '\0';
+        length = 0;
+        if (ui_run_diagnostic(String(line))) continue;
+        if (!tasks_post_serial_line(line)) {
+          Serial.println("⚠️ Serial command dropped - control is busy");
+        }
+      } else if (length < sizeof(line) - 1) {
+        line[length++] = c;
+      }
+    }
+    
+    if (boot_services_ready()) oledDisplay.update();
+    
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(TASK_UI_PERIOD_MS));
+  }
+}
+
+// network - WiFi upkeep, then this cycle's readings out to SSE, beacon and MQTT
+static void network_task(void *parameter) {
+  while (!boot_services_ready()) {
+    vTaskDelay(pdMS_TO_TICKS(MAIN_LOOP_INTERVAL));
+  }
+  
+  while (true) {
+    ControlCycle cycle;
+    bool cycled = tasks_wait_cycle(&cycle, pdMS_TO_TICKS(MAIN_LOOP_INTERVAL));
+    
+    wifiManager.loop();
+    if (!cycled) continue;
+    
+    // Push this cycle's readings to connected browsers
+    telemetry_push_update();
+    
+    // Multicast this cycle's sample to fleet listeners (opt-in)
+    if (cycle.haveFrame) beacon_update(cycle.frame);
+    
+    // MQTT connection upkeep and on-change state/telemetry
+    mqtt_update();
+  }
+}
+
+// logging - health checks and the periodic status print
+static void logging_task(void *parameter) {
+  uint64_t lastStatusPrint = clock_ms();
+  TickType_t lastWake = xTaskGetTickCount();
+  
+  while (true) {
+    monitorSystemHealth();
+    
+    if (clock_elapsed_ms(lastStatusPrint) >= STATUS_PRINT_INTERVAL) {
+      printSystemStatus();
+      lastStatusPrint = clock_ms();
+    }
+    
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(TASK_LOGGING_PERIOD_MS));
+  }
+}
+
+// Control is the loop task itself (Tasks.h)
+static const TaskSpec TASKS[] = {
+  {"acquisition", acquisition_task, TASK_ACQUISITION_STACK, TASK_ACQUISITION_PRIORITY, TASK_ACQUISITION_CORE},
+  {"ui",          ui_task,          TASK_UI_STACK,          TASK_UI_PRIORITY,          TASK_UI_CORE},
+  {"network",     network_task,     TASK_NETWORK_STACK,     TASK_NETWORK_PRIORITY,     TASK_NETWORK_CORE},
+  {"logging",     logging_task,     TASK_LOGGING_STACK,     TASK_LOGGING_PRIORITY,     TASK_LOGGING_CORE},
+};
+
 void setup() {
   Serial.begin(115200);
-  while (!Serial) delay(10);
   
-  // Wait a moment for serial to stabilize
-  delay(1000);
+  // Initialize relay control first (safety) - outputs to a known state before anything else
+  relay_init();
+  boot_mark("relays");
   
   Serial.println("\n=====================================");
   Serial.println("ESP32 GRILL CONTROLLER - PIFIRE AUGER VERSION");
@@ -71,11 +261,6 @@ void setup() {
   Serial.println("- MOSI Pin: GPIO23 (ESP32 default)");
   Serial.println("- MISO Pin: GPIO19 (ESP32 default)");
     
-  // Initialize relay control first (safety)
-  Serial.println("Initializing relay control...");
-  relay_init();
-  Serial.println("✅ Relay control initialized");
-  
   // Feed watchdog after each major initialization step
   esp_task_wdt_reset();
   
@@ -87,6 +272,7 @@ void setup() {
   } else {
     Serial.println("✅ MAX31865 initialized successfully");
   }
+  boot_mark("grill sensor");
   
   esp_task_wdt_reset();
   
@@ -102,6 +288,11 @@ void setup() {
   } else {
     Serial.println("❌ ADS1115 meat probes failed to initialize");
   }
+  boot_mark("probes");
+  
+  // Load probe targets and alarm thresholds
+  probe_alarm_init();
+  probe_predictor_init();
   
   esp_task_wdt_reset();
   
@@ -114,110 +305,117 @@ void setup() {
   ignition_init();
   Serial.println("✅ Ignition system with PiFire auger control initialized");
   
+  fan_control_init();
+  pellet_accounting_init();
+  
   Serial.println("Initializing button input...");
   button_init();
   Serial.println("✅ Button input initialized");
   
-  esp_task_wdt_reset();
-  
-  // Initialize OLED (optional)
-  Serial.println("Initializing OLED display...");
-  if (oledDisplay.begin()) {
-    Serial.println("✅ OLED display initialized");
-  } else {
-    Serial.println("⚠️  OLED display not found - continuing without it");
-  }
-  
-  // Initialize WiFi
-  Serial.println("Initializing WiFi...");
-  wifiManager.begin();
-  Serial.println("✅ WiFi manager initialized");
-  
-  esp_task_wdt_reset();
-  
   // Load settings
   Serial.println("Loading settings...");
   load_setpoint();
   Serial.println("✅ Settings loaded");
   
-  // Initialize web server
-  Serial.println("Initializing web server...");
-  setup_grill_server();
-  Serial.println("✅ Web server initialized");
+  // Temperature history tiers (allocated before the web server takes its share of heap)
+  history_init();
+  
+  // Control task stack/CPU in /metrics
+  metrics_init();
+  boot_mark("control state");
   
   esp_task_wdt_reset();
   
-  Serial.println("Setup complete! PiFire auger control version active!");
+  // Queues, control priority, then the pinned tasks around it
+  tasks_init();
+  for (size_t i = 0; i < sizeof(TASKS) / sizeof(TASKS[0]); i++) {
+    tasks_create(TASKS[i]);
+  }
+  boot_mark("tasks");
+  
+  // Everything network-facing comes up on the other core; control starts now
+  boot_start_services(start_services);
   
   // Show sensor status
   printCalibrationStatus();
   
-  Serial.println("\n🔧 PIFIRE AUGER FEATURES:");
-  Serial.println("- Simple time-based auger cycling (15s ON / 60s OFF)");
-  Serial.println("- Separate auger control from ignition state machine");
-  Serial.println("- Manual prime function available");
-  Serial.println("- No complex auger trigger logic");
-  Serial.println("- Proven PiFire-style reliability");
-  
-  Serial.println("\n📋 AVAILABLE COMMANDS:");
-  Serial.println("  test_temp       - Test 100Ω resistor reading");
-  Serial.println("  debug_on/off    - Toggle debug output");
-  Serial.println("  health          - Show system health");
-  Serial.println("  relay_status    - Show relay status");
-  Serial.println("  pellet_status   - Show pellet control status");
-  Serial.println("  reset_reason    - Show last reset reason");
-  Serial.println("  prime_auger     - Manual 30-second auger prime");
-  Serial.println("  help            - Show all commands");
-  Serial.println("=====================================\n");
-  
   // Final system check
   systemHealthy = true;
-  Serial.println("🚀 System ready with PiFire auger control!");
+  Serial.println("🚀 Control running - network services starting in the background");
 }
 
+// Control task - woken by each sensor sample, and at least every 100ms
 void loop() {
-  static unsigned long lastMainLoop = 0;
-  static unsigned long lastTempUpdate = 0;
-  static unsigned long lastStatusPrint = 0;
+  static uint64_t lastMainLoop = 0;
+  static uint64_t lastTempUpdate = 0;
+  
+  uint64_t sinceMain = clock_elapsed_ms(lastMainLoop);
+  TickType_t wait = sinceMain >= MAIN_LOOP_INTERVAL ? 0 : pdMS_TO_TICKS(MAIN_LOOP_INTERVAL - sinceMain);
+  bool sampled = tasks_wait_sample(wait);
   
-  unsigned long now = millis();
+  uint64_t now = clock_ms();
   
   // Feed watchdog timer more frequently
   feedWatchdog();
   
-  // Monitor system health
-  monitorSystemHealth();
+  // Serial commands - lines assembled by the ui task
+  char line[TASK_SERIAL_LINE_MAX];
+  while (tasks_next_serial_line(line)) {
+    handleSerialCommand(String(line));
+  }
   
-  // Handle serial commands
-  handleSerialCommands();
+  // Apply queued web commands between control cycles
+  command_process();
   
   // Main control loop - every 100ms
   if (now - lastMainLoop >= MAIN_LOOP_INTERVAL) {
+    if (lastMainLoop != 0) {
+      metrics_observe_jitter(METRIC_LOOP_JITTER_US, now - lastMainLoop, MAIN_LOOP_INTERVAL);
+    }
     
     // Handle buttons
     handle_buttons();
     
-    // Update WiFi manager
-    wifiManager.loop();
-    
     // Update relay control (includes manual override timeout)
     relay_update();
     
-    // Update OLED display
-    oledDisplay.update();
-    
     lastMainLoop = now;
   }
   
-  // Temperature and control updates - every 1 second
-  if (now - lastTempUpdate >= TEMP_UPDATE_INTERVAL) {
+  // Control cycle - on every sample; on time if acquisition has stalled
+  bool stale = now - lastTempUpdate >= TASK_SAMPLE_STALE_MS;
+  if (sampled || stale) {
+    if (stale && !sampled) {
+      Serial.println("⚠️ No sensor sample - control running on the last readings");
+    }
+    if (lastTempUpdate != 0) {
+      metrics_observe_jitter(METRIC_CONTROL_JITTER_US, now - lastTempUpdate, TEMP_UPDATE_INTERVAL);
+    }
     
-    // Update meat probe sensors
-    tempSensor.updateAll();
+    // Evaluate probe targets/alarms from the readings just taken
+    probe_alarm_update();
+    
+    // Advance the finish-time estimators with this cycle's readings
+    SensorSnapshot sample;
+    tasks_get_sample(&sample);
+    probe_predictor_update(sample.grillF, sample.probeF, sample.probeValid, (now - lastTempUpdate) / 1000.0);
+    
+    // Pit temperature for the relay interlocks - this sample's raw validity, not
+    // the held value, so a failed MAX31865 reaches the rules as unknown
+    relay_safety_set_temperature(sample.grillValid ? sample.grillF : NAN, sample.grillValidMs);
     
     // Run ignition sequence (includes PiFire auger control)
     ignition_loop();
     
+    // Blower duty follows the ignition/cook phase (smoke cycles, boost)
+    fan_control_update();
+    
+    // Fold auger runtime into pellet usage, hopper level and burn rate
+    pellet_accounting_update();
+    
+    // Relay wear counters - flushes to flash on its own schedule
+    relay_stats_update();
+    
     // REMOVED: All pellet control - PiFire auger control handles everything now
     // NO MORE: debugPelletFeedLoop() or pellet_feed_loop()
     
@@ -229,17 +427,21 @@ void loop() {
       grillRunning = false;
     }
     
+    // One history sample per second
+    history_update();
+    
+    // Republish /status_all if anything in it changed
+    if (boot_services_ready()) status_cache_update();
+    
+    // First cycle marks control live; the boot timeline prints once services are up too
+    boot_control_cycle();
+    
+    // Wake the network task to publish this cycle, with a copy of its history sample
+    TelemetryFrame frame;
+    tasks_publish_cycle(history_get_latest(&frame) ? &frame : NULL);
+    
     lastTempUpdate = now;
   }
-  
-  // Status printing - every 10 seconds
-  if (now - lastStatusPrint >= STATUS_PRINT_INTERVAL) {
-    printSystemStatus();
-    lastStatusPrint = now;
-  }
-  
-  // Allow other tasks to run
-  yield();
 }
 
 void printResetReason() {
@@ -302,24 +504,24 @@ void printResetReason() {
 }
 
 void monitorSystemHealth() {
-  if (millis() - lastHealthCheck > 5000) { // Every 5 seconds
+  if (clock_elapsed_ms(lastHealthCheck) > 5000) { // Every 5 seconds
     uint32_t freeHeap = ESP.getFreeHeap();
-    UBaseType_t stackRemaining = uxTaskGetStackHighWaterMark(NULL);
+    UBaseType_t stackRemaining = uxTaskGetStackHighWaterMark(tasks_get_control_handle());
     
     // Only print health info during issues or every 60 seconds
-    static unsigned long lastHealthPrint = 0;
+    static uint64_t lastHealthPrint = 0;
     bool shouldPrint = false;
     
     if (freeHeap < 15000 || stackRemaining < 1000) {
       shouldPrint = true;
-    } else if (millis() - lastHealthPrint > 60000) {
+    } else if (clock_elapsed_ms(lastHealthPrint) > 60000) {
       shouldPrint = true;
-      lastHealthPrint = millis();
+      lastHealthPrint = clock_ms();
     }
     
     if (shouldPrint) {
       Serial.printf("💗 Health: Heap=%d bytes, Stack=%d bytes, Uptime=%lu sec\n", 
-                    freeHeap, stackRemaining, millis() / 1000);
+                    freeHeap, stackRemaining, (unsigned long)(clock_ms() / 1000));
     }
     
     // Check for critically low memory
@@ -334,14 +536,14 @@ void monitorSystemHealth() {
       systemHealthy = false;
     }
     
-    lastHealthCheck = millis();
+    lastHealthCheck = clock_ms();
   }
 }
 
 void feedWatchdog() {
-  if (millis() - lastWatchdogFeed > 500) { // Feed every 500ms (was 1000ms)
+  if (clock_elapsed_ms(lastWatchdogFeed) > 500) { // Feed every 500ms (was 1000ms)
     esp_task_wdt_reset();
-    lastWatchdogFeed = millis();
+    lastWatchdogFeed = clock_ms();
   }
 }
 
@@ -351,8 +553,8 @@ void printSystemStatus() {
   // System health
   Serial.printf("🏥 System Health: %s\n", systemHealthy ? "HEALTHY" : "⚠️ ISSUES DETECTED");
   Serial.printf("💾 Free Memory: %d bytes\n", ESP.getFreeHeap());
-  Serial.printf("📚 Stack Remaining: %d bytes\n", uxTaskGetStackHighWaterMark(NULL));
-  Serial.printf("⏰ Uptime: %lu seconds\n", millis() / 1000);
+  Serial.printf("📚 Stack Remaining: %d bytes\n", uxTaskGetStackHighWaterMark(tasks_get_control_handle()));
+  Serial.printf("⏰ Uptime: %lu seconds\n", (unsigned long)(clock_ms() / 1000));
   
   // Grill temperature
   double grillTemp = readGrillTemperature();
@@ -360,7 +562,7 @@ void printSystemStatus() {
   if (!isValidTemperature(grillTemp)) {
     Serial.print(" (SENSOR ERROR)");
   } else {
-    Serial.printf(" (R: %.1fΩ)", grillSensor.readRTD());
+    Serial.printf(" (R: %.1fΩ)", readGrillResistance());
   }
   Serial.println();
   
@@ -374,7 +576,7 @@ void printSystemStatus() {
   
   // Meat probes
   for (int i = 1; i <= 4; i++) {
-    float temp = tempSensor.getFoodTemperature(i);
+    float temp = readProbeTemperature(i);
     Serial.printf("🥩 Meat Probe %d: %.1f°F", i, temp);
     if (!isValidTemperature(temp)) {
       Serial.print(" (NO PROBE)");
@@ -413,84 +615,84 @@ void printSystemStatus() {
   Serial.println("----------------------------------\n");
 }
 
-void handleSerialCommands() {
-  if (Serial.available()) {
-    String command = Serial.readStringUntil('\n');
-    command.trim();
-    
-    // Handle calibration and temperature commands
-    if (command.startsWith("max_") || command.startsWith("cal_")) {
-      handleCalibrationCommands(command);
-      return;
-    }
-    
-    // Debug and system commands
-    if (command == "test_temp") {
-      testGrillSensor();
-    } else if (command == "test_meat") {
-      testSpecificProbe();
-    } else if (command == "test_ambient") {
-      testAmbientSensor();
-    } else if (command == "diag") {
-      runTemperatureDiagnostics();
-    } else if (command == "status") {
-      printSystemStatus();
-    } else if (command == "health") {
-      Serial.printf("System Health: %s\n", systemHealthy ? "HEALTHY" : "ISSUES DETECTED");
-      Serial.printf("Free Memory: %d bytes\n", ESP.getFreeHeap());
-      Serial.printf("Stack Remaining: %d bytes\n", uxTaskGetStackHighWaterMark(NULL));
-      Serial.printf("Uptime: %lu seconds\n", millis() / 1000);
-    } else if (command == "relay_status") {
-      relay_print_status();
-    } else if (command == "pellet_status") {
-      pellet_print_diagnostics();
-    } else if (command == "reset_reason") {
-      printResetReason();
-    } else if (command == "debug_on") {
-      setAllDebug(true);
-    } else if (command == "debug_off") {
-      setAllDebug(false);
-    } else if (command == "clear_manual") {
-      relay_force_clear_manual();
-    } else if (command == "emergency_stop") {
-      relay_emergency_stop();
-      grillRunning = false;
-      Serial.println("Emergency stop activated!");
-    } else if (command == "prime_auger") {
-      pifire_manual_auger_prime();
-    } else if (command == "restart") {
-      Serial.println("Restarting ESP32...");
-      delay(1000);
-      ESP.restart();
-    } else if (command == "help") {
-      Serial.println("\n=== AVAILABLE COMMANDS ===");
-      Serial.println("TEMPERATURE TESTING:");
-      Serial.println("  test_temp       - Test 100Ω resistor reading");
-      Serial.println("  test_meat       - Test all meat probes");
-      Serial.println("  test_ambient    - Test ambient sensor");
-      Serial.println("  diag            - Run temperature diagnostics");
-      Serial.println("");
-      Serial.println("SYSTEM MONITORING:");
-      Serial.println("  status          - Print detailed system status");
-      Serial.println("  health          - Show system health summary");
-      Serial.println("  relay_status    - Show relay control status");
-      Serial.println("  pellet_status   - Show pellet control diagnostics");
-      Serial.println("  reset_reason    - Show last reset reason");
-      Serial.println("");
-      Serial.println("PIFIRE AUGER CONTROL:");
-      Serial.println("  prime_auger     - Manual 30-second auger prime");
-      Serial.println("");
-      Serial.println("DEBUG CONTROL:");
-      Serial.println("  debug_on/off    - Toggle debug output");
-      Serial.println("  clear_manual    - Force clear manual relay override");
-      Serial.println("  emergency_stop  - Emergency stop all operations");
-      Serial.println("  restart         - Restart ESP32");
-      Serial.println("");
-      Serial.println("HELP:");
-      Serial.println("  help            - Show this help message");
-      Serial.println("=========================\n");
-    } else if (command.length() > 0) {
-      Serial.println("Unknown command. Type 'help' for available commands.");
-    }
+void handleSerialCommand(String command) {
+  command.trim();
+  
+  // Handle calibration and temperature commands
+  if (command.startsWith("max_") || command.startsWith("cal_")) {
+    handleCalibrationCommands(command);
+    return;
+  }
+  
+  // Debug and system commands (sensor tests are run by the ui task)
+  if (command == "status") {
+    printSystemStatus();
+  } else if (command == "health") {
+    Serial.printf("System Health: %s\n", systemHealthy ? "HEALTHY" : "ISSUES DETECTED");
+    Serial.printf("Free Memory: %d bytes\n", ESP.getFreeHeap());
+    Serial.printf("Stack Remaining: %d bytes\n", uxTaskGetStackHighWaterMark(NULL));
+    Serial.printf("Uptime: %lu seconds\n", (unsigned long)(clock_ms() / 1000));
+  } else if (command == "relay_status") {
+    relay_print_status();
+  } else if (command == "pellet_status") {
+    pellet_print_diagnostics();
+  } else if (command == "reset_reason") {
+    printResetReason();
+  } else if (command == "debug_on") {
+    setAllDebug(true);
+  } else if (command == "debug_off") {
+    setAllDebug(false);
+  } else if (command == "clear_manual") {
+    relay_force_clear_manual();
+  } else if (command == "emergency_stop") {
+    relay_emergency_stop();
+    grillRunning = false;
+    Serial.println("Emergency stop activated!");
+  } else if (command == "prime_auger") {
+    pifire_manual_auger_prime();
+  } else if (command == "alarm_ack") {
+    probe_alarm_acknowledge();
+  } else if (command == "pellet_usage") {
+    Serial.println(pellet_get_accounting_json());
+  } else if (command == "hopper_refill") {
+    pellet_hopper_refill(0);
+  } else if (command == "restart") {
+    Serial.println("Restarting ESP32...");
+    delay(1000);
+    ESP.restart();
+  } else if (command == "help") {
+    Serial.println("\n=== AVAILABLE COMMANDS ===");
+    Serial.println("TEMPERATURE TESTING:");
+    Serial.println("  test_temp       - Test 100Ω resistor reading");
+    Serial.println("  test_meat       - Test all meat probes");
+    Serial.println("  test_ambient    - Test ambient sensor");
+    Serial.println("  diag            - Run temperature diagnostics");
+    Serial.println("");
+    Serial.println("SYSTEM MONITORING:");
+    Serial.println("  status          - Print detailed system status");
+    Serial.println("  health          - Show system health summary");
+    Serial.println("  relay_status    - Show relay control status");
+    Serial.println("  pellet_status   - Show pellet control diagnostics");
+    Serial.println("  reset_reason    - Show last reset reason");
+    Serial.println("");
+    Serial.println("PIFIRE AUGER CONTROL:");
+    Serial.println("  prime_auger     - Manual 30-second auger prime");
+    Serial.println("  pellet_usage    - Show pellet usage and hopper estimate");
+    Serial.println("  hopper_refill   - Mark hopper as filled to capacity");
+    Serial.println("");
+    Serial.println("PROBE ALARMS:");
+    Serial.println("  alarm_ack       - Acknowledge active probe alarms");
+    Serial.println("");
+    Serial.println("DEBUG CONTROL:");
+    Serial.println("  debug_on/off    - Toggle debug output");
+    Serial.println("  clear_manual    - Force clear manual relay override");
+    Serial.println("  emergency_stop  - Emergency stop all operations");
+    Serial.println("  restart         - Restart ESP32");
+    Serial.println("");
+    Serial.println("HELP:");
+    Serial.println("  help            - Show this help message");
+    Serial.println("=========================\n");
+  } else if (command.length() > 0) {
+    Serial.println("Unknown command. Type 'help' for available commands.");
   }
 }
\ No newline at end of file
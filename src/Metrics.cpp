@@ -0,0 +1,169 @@
+// Metrics.cpp - Runtime counters and latency histograms for /metrics
+//
+// Hot paths only ever fetch_add a 32-bit std::atomic (a single S32C1I loop
+// on the ESP32, no lock and no critical section). Everything else - heap,
+// task stacks, relay switch counts - is read when /metrics is scraped.
+//
+// Histogram sums are 32-bit microsecond counters that wrap after ~71
+// minutes of accumulated time; the scrape handler widens them to 64 bits
+// by adding the change since the previous scrape, so scrape more often
+// than that (any normal Prometheus interval does).
+#include "Metrics.h"
+#include "RelayStats.h"
+#include "HttpAdmission.h"
+#include "Clock.h"
+#include <atomic>
+
+static const uint32_t BUCKET_BOUNDS_US[] = {
+  50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000
+};
+#define METRIC_BUCKETS (sizeof(BUCKET_BOUNDS_US) / sizeof(BUCKET_BOUNDS_US[0]))
+
+struct MetricHistogramState {
+  std::atomic<uint32_t> buckets[METRIC_BUCKETS + 1];   // Last is +Inf
+  std::atomic<uint32_t> count;
+  std::atomic<uint32_t> sumUs;
+};
+
+static std::atomic<uint32_t> counters[METRIC_COUNTER_COUNT];
+static MetricHistogramState histograms[METRIC_HISTOGRAM_COUNT];
+
+// Widened histogram sums - only touched by the scrape handler
+static uint64_t sumTotalUs[METRIC_HISTOGRAM_COUNT];
+static uint32_t sumLastUs[METRIC_HISTOGRAM_COUNT];
+
+static struct {
+  const char* name;
+  TaskHandle_t handle;
+} tasks[METRICS_MAX_TASKS];
+static int taskCount = 0;
+
+// Exposition names, in MetricCounter order. A family's HELP/TYPE is written
+// when the name changes, so entries sharing a name must be adjacent - the
+// exposition format allows each family only one group
+static const struct {
+  const char* name;
+  const char* labels;
+  const char* help;
+} COUNTER_INFO[METRIC_COUNTER_COUNT] = {
+  {"grill_sensor_reads_total",  "sensor=\"max31865\"", "Sensor reads attempted"},
+  {"grill_sensor_reads_total",  "sensor=\"ads1115\"",  "Sensor reads attempted"},
+  {"grill_sensor_reads_total",  "sensor=\"ambient\"",  "Sensor reads attempted"},
+  {"grill_sensor_errors_total", "sensor=\"max31865\"", "Sensor reads that returned no valid temperature"},
+  {"grill_sensor_errors_total", "sensor=\"ads1115\"",  "Sensor reads that returned no valid temperature"},
+  {"grill_sensor_errors_total", "sensor=\"ambient\"",  "Sensor reads that returned no valid temperature"},
+  {"grill_http_requests_total", "",                    "HTTP requests received"},
+  {"grill_wifi_events_total",   "event=\"connected\"",    "WiFi connection events"},
+  {"grill_wifi_events_total",   "event=\"failed\"",       "WiFi connection events"},
+  {"grill_wifi_events_total",   "event=\"disconnected\"", "WiFi connection events"},
+};
+
+static const struct {
+  const char* name;
+  const char* help;
+} HISTOGRAM_INFO[METRIC_HISTOGRAM_COUNT] = {
+  {"grill_spi_read_seconds",          "MAX31865 temperature read over SPI"},
+  {"grill_i2c_read_seconds",          "ADS1115 conversion and read over I2C"},
+  {"grill_loop_jitter_seconds",       "100 ms loop cycle start, late against its period"},
+  {"grill_control_jitter_seconds",    "1 s control cycle start, late against its period"},
+  {"grill_http_request_seconds",      "HTTP request from parsed headers to connection close"},
+};
+
+void metrics_count(MetricCounter counter, uint32_t n) {
+  counters[counter].fetch_add(n, std::memory_order_relaxed);
+}
+
+void metrics_observe(MetricHistogram histogram, uint32_t us) {
+  MetricHistogramState& h = histograms[histogram];
+  size_t bucket = 0;
+  while (bucket < METRIC_BUCKETS && us > BUCKET_BOUNDS_US[bucket]) bucket++;
+  h.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  h.count.fetch_add(1, std::memory_order_relaxed);
+  h.sumUs.fetch_add(us, std::memory_order_relaxed);
+}
+
+void metrics_observe_jitter(MetricHistogram histogram, uint64_t elapsedMs, unsigned long periodMs) {
+  uint64_t lateMs = elapsedMs > periodMs ? elapsedMs - periodMs : 0;
+  metrics_observe(histogram, (uint32_t)min(lateMs * 1000, (uint64_t)UINT32_MAX));
+}
+
+void metrics_init() {
+  metrics_register_task("control", xTaskGetCurrentTaskHandle());
+}
+
+void metrics_register_task(const char* name, TaskHandle_t task) {
+  if (task == NULL || taskCount >= METRICS_MAX_TASKS) return;
+  tasks[taskCount].name = name;
+  tasks[taskCount].handle = task;
+  taskCount++;
+}
+
+static void metrics_write_header(AsyncResponseStream *out, const char* name, const char* type, const char* help) {
+  out->printf("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+static void metrics_write_histogram(AsyncResponseStream *out, int index) {
+  MetricHistogramState& h = histograms[index];
+  const char* name = HISTOGRAM_INFO[index].name;
+
+  // Widen the wrapping 32-bit sum
+  uint32_t sum = h.sumUs.load(std::memory_order_relaxed);
+  sumTotalUs[index] += (uint32_t)(sum - sumLastUs[index]);
+  sumLastUs[index] = sum;
+
+  metrics_write_header(out, name, "histogram", HISTOGRAM_INFO[index].help);
+  uint32_t cumulative = 0;
+  for (size_t b = 0; b < METRIC_BUCKETS; b++) {
+    cumulative += h.buckets[b].load(std::memory_order_relaxed);
+    out->printf("%s_bucket{le=\"%g\"} %lu\n", name, BUCKET_BOUNDS_US[b] / 1e6, (unsigned long)cumulative);
+  }
+  cumulative += h.buckets[METRIC_BUCKETS].load(std::memory_order_relaxed);
+  out->printf("%s_bucket{le=\"+Inf\"} %lu\n", name, (unsigned long)cumulative);
+  out->printf("%s_sum %.6f\n", name, sumTotalUs[index] / 1e6);
+  out->printf("%s_count %lu\n", name, (unsigned long)cumulative);
+}
+
+void metrics_send(AsyncWebServerRequest *req) {
+  AsyncResponseStream *out = req->beginResponseStream("text/plain; version=0.0.4");
+
+  const char* previous = "";
+  for (int i = 0; i < METRIC_COUNTER_COUNT; i++) {
+    if (strcmp(COUNTER_INFO[i].name, previous) != 0) {
+      metrics_write_header(out, COUNTER_INFO[i].name, "counter", COUNTER_INFO[i].help);
+      previous = COUNTER_INFO[i].name;
+    }
+    unsigned long value = counters[i].load(std::memory_order_relaxed);
+    if (COUNTER_INFO[i].labels[0]) out->printf("%s{%s} %lu\n", COUNTER_INFO[i].name, COUNTER_INFO[i].labels, value);
+    else out->printf("%s %lu\n", COUNTER_INFO[i].name, value);
+  }
+
+  metrics_write_header(out, "grill_relay_switches_total", "counter", "Relay OFF to ON transitions (persisted)");
+  for (int ch = 0; ch < RELAY_CH_COUNT; ch++) {
+    out->printf("grill_relay_switches_total{relay=\"%s\"} %lu\n", relay_stats_channel_name(ch),
+                (unsigned long)relay_stats_get_switch_count(ch));
+  }
+
+  for (int i = 0; i < METRIC_HISTOGRAM_COUNT; i++) {
+    metrics_write_histogram(out, i);
+  }
+
+  http_admission_write_metrics(out);
+
+  metrics_write_header(out, "grill_heap_free_bytes", "gauge", "Free heap");
+  out->printf("grill_heap_free_bytes %lu\n", (unsigned long)ESP.getFreeHeap());
+  metrics_write_header(out, "grill_heap_min_free_bytes", "gauge", "Lowest free heap since boot");
+  out->printf("grill_heap_min_free_bytes %lu\n", (unsigned long)ESP.getMinFreeHeap());
+  metrics_write_header(out, "grill_heap_largest_block_bytes", "gauge", "Largest allocatable heap block");
+  out->printf("grill_heap_largest_block_bytes %lu\n", (unsigned long)ESP.getMaxAllocHeap());
+
+  metrics_write_header(out, "grill_task_stack_free_bytes", "gauge", "Task stack high-water mark (least free ever)");
+  for (int i = 0; i < taskCount; i++) {
+    out->printf("grill_task_stack_free_bytes{task=\"%s\"} %lu\n", tasks[i].name,
+                (unsigned long)uxTaskGetStackHighWaterMark(tasks[i].handle));
+  }
+
+  metrics_write_header(out, "grill_uptime_seconds", "gauge", "Seconds since boot");
+  out->printf("grill_uptime_seconds %lu\n", (unsigned long)(clock_ms() / 1000));
+
+  req->send(out);
+}
@@ -0,0 +1,50 @@
+// Metrics.h - Runtime counters and latency histograms for /metrics
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Counters - monotonic, Prometheus computes rates from them. Counters that
+// share an exposition name (one family) must be adjacent - see COUNTER_INFO
+enum MetricCounter {
+  METRIC_GRILL_READS = 0,
+  METRIC_PROBE_READS,
+  METRIC_AMBIENT_READS,
+  METRIC_GRILL_ERRORS,
+  METRIC_PROBE_ERRORS,
+  METRIC_AMBIENT_ERRORS,
+  METRIC_HTTP_REQUESTS,
+  METRIC_WIFI_CONNECTS,
+  METRIC_WIFI_FAILURES,
+  METRIC_WIFI_DISCONNECTS,
+  METRIC_COUNTER_COUNT
+};
+
+// Histograms - all observations in microseconds
+enum MetricHistogram {
+  METRIC_SPI_READ_US = 0,        // MAX31865 temperature read
+  METRIC_I2C_READ_US,            // ADS1115 single-ended conversion
+  METRIC_LOOP_JITTER_US,         // 100 ms loop start, late against its period
+  METRIC_CONTROL_JITTER_US,      // 1 s control cycle start, late against its period
+  METRIC_HTTP_REQUEST_US,        // Headers parsed to request freed (HttpAdmission)
+  METRIC_HISTOGRAM_COUNT
+};
+
+#define METRICS_MAX_TASKS   10
+
+// Hot-path updates - relaxed atomics, no locks, safe from any task
+void metrics_count(MetricCounter counter, uint32_t n = 1);
+void metrics_observe(MetricHistogram histogram, uint32_t us);
+void metrics_observe_jitter(MetricHistogram histogram, uint64_t elapsedMs, unsigned long periodMs);
+
+// Setup
+void metrics_init();                                         // Registers the control (loop) task
+void metrics_register_task(const char* name, TaskHandle_t task);   // Stack high-water mark
+
+// Prometheus text exposition format
+void metrics_send(AsyncWebServerRequest *req);
+
+#endif // METRICS_H
@@ -0,0 +1,566 @@
+// Mqtt.cpp - MQTT telemetry, state and commands with Home Assistant discovery
+//
+// AsyncMqttClient callbacks run on the AsyncTCP task. They only subscribe,
+// post commands and raise flags; mqtt_update() on the network task owns the
+// connection state machine, the backoff and every state/telemetry/discovery
+// publish. A config saved from the web page is staged under mqttMux and
+// applied there as well.
+//
+// Change detection keeps a hash of the last payload sent on each topic rather
+// than a copy of it.
+#include "Mqtt.h"
+#include "Globals.h"
+#include "Utility.h"
+#include "TemperatureSensor.h"
+#include "Ignition.h"
+#include "FanControl.h"
+#include "PelletAccounting.h"
+#include "ProbeAlarm.h"
+#include "RelayControl.h"
+#include "WiFiManager.h"
+#include "CommandQueue.h"
+#include "JsonWriter.h"
+#include "Clock.h"
+#include <AsyncMqttClient.h>
+#include <Preferences.h>
+#include <atomic>
+
+enum MqttState : uint8_t {
+  MQTT_DISABLED = 0,
+  MQTT_WAITING_WIFI,
+  MQTT_CONNECTING,
+  MQTT_CONNECTED,
+  MQTT_BACKOFF
+};
+
+static const char* const STATE_NAMES[] = {"disabled", "waitingWifi", "connecting", "connected", "backoff"};
+
+// Home Assistant entities announced on connect
+enum MqttEntityKind : uint8_t {
+  ENTITY_SENSOR = 0,
+  ENTITY_BINARY_SENSOR,
+  ENTITY_NUMBER,
+  ENTITY_SWITCH
+};
+
+struct MqttEntity {
+  MqttEntityKind kind;
+  const char* objectId;
+  const char* name;
+  bool fromState;           // Field is in <base>/state, else <base>/telemetry
+  const char* field;
+  const char* unit;         // NULL = none
+  const char* deviceClass;  // NULL = none
+};
+
+static const MqttEntity ENTITIES[] = {
+  {ENTITY_SENSOR,        "grill_temp",     "Grill Temperature",   false, "grillTemp",     "°F", "temperature"},
+  {ENTITY_SENSOR,        "ambient_temp",   "Ambient Temperature", false, "ambientTemp",   "°F", "temperature"},
+  {ENTITY_SENSOR,        "meat1_temp",     "Probe 1",             false, "meat1Temp",     "°F", "temperature"},
+  {ENTITY_SENSOR,        "meat2_temp",     "Probe 2",             false, "meat2Temp",     "°F", "temperature"},
+  {ENTITY_SENSOR,        "meat3_temp",     "Probe 3",             false, "meat3Temp",     "°F", "temperature"},
+  {ENTITY_SENSOR,        "meat4_temp",     "Probe 4",             false, "meat4Temp",     "°F", "temperature"},
+  {ENTITY_SENSOR,        "blower_duty",    "Blower Duty",         false, "blowerDuty",    "%",  NULL},
+  {ENTITY_SENSOR,        "hopper_lb",      "Hopper Pellets",      false, "hopperLb",      "lb", "weight"},
+  {ENTITY_SENSOR,        "burn_rate",      "Pellet Burn Rate",    false, "burnRate",      "lb/h", NULL},
+  {ENTITY_SENSOR,        "status",         "Status",              true,  "status",        NULL, NULL},
+  {ENTITY_SENSOR,        "ignition_state", "Ignition State",      true,  "ignitionState", NULL, NULL},
+  {ENTITY_SENSOR,        "fan_mode",       "Fan Mode",            true,  "fanMode",       NULL, NULL},
+  {ENTITY_BINARY_SENSOR, "hopper_low",     "Hopper Low",          true,  "hopperLow",     NULL, "problem"},
+  {ENTITY_BINARY_SENSOR, "manual_override","Manual Override",     true,  "manualOverride", NULL, NULL},
+  {ENTITY_NUMBER,        "setpoint",       "Setpoint",            true,  "setpoint",      "°F", "temperature"},
+  {ENTITY_SWITCH,        "power",          "Grill",               true,  "grillRunning",  NULL, NULL},
+};
+#define ENTITY_COUNT (sizeof(ENTITIES) / sizeof(ENTITIES[0]))
+
+static const char* const COMPONENTS[] = {"sensor", "binary_sensor", "number", "switch"};
+
+static AsyncMqttClient client;
+static Preferences mqttPrefs;
+static portMUX_TYPE mqttMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Active config - pointers into it are held by the client, only changed while disconnected
+static MqttConfig config;
+static MqttConfig pendingConfig;
+static bool configPending = false;
+
+static char clientId[24];
+static char nodeId[20];
+static char availabilityTopic[MQTT_TOPIC_LEN + 16];
+static char stateTopic[MQTT_TOPIC_LEN + 16];
+static char telemetryTopic[MQTT_TOPIC_LEN + 16];
+static char setpointTopic[MQTT_TOPIC_LEN + 16];
+static char powerTopic[MQTT_TOPIC_LEN + 16];
+
+static MqttState state = MQTT_DISABLED;
+static uint64_t stateSince = 0;
+static uint64_t retryAt = 0;
+static uint32_t backoffMs = MQTT_BACKOFF_MIN_MS;
+static size_t discoveryIndex = ENTITY_COUNT;   // Next entity to announce
+static uint32_t lastStateHash = 0;
+static uint32_t lastTelemetryHash = 0;
+static uint64_t lastTelemetryAt = 0;
+
+// Set from the AsyncTCP task
+static std::atomic<bool> connectedEvent(false);
+static std::atomic<bool> disconnectedEvent(false);
+static std::atomic<uint8_t> disconnectReason(0);
+static std::atomic<uint32_t> commandsPosted(0);
+static std::atomic<uint32_t> commandsRejected(0);
+
+static bool disconnectSeen = false;
+static uint32_t connectCount = 0;
+static uint32_t disconnectCount = 0;
+static uint32_t publishedCount = 0;
+static uint32_t publishFailedCount = 0;
+
+// FNV-1a, for change detection
+static uint32_t mqtt_hash(const char* data, size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= (uint8_t)data[i];
+    hash *= 16777619u;
+  }
+  return hash ? hash : 1;   // 0 means "nothing sent yet"
+}
+
+static void mqtt_load_config(MqttConfig* out) {
+  mqttPrefs.begin("mqtt", true);
+  out->enabled = mqttPrefs.getBool("enabled", false);
+  mqttPrefs.getString("host", out->host, sizeof(out->host));
+  out->port = mqttPrefs.getUShort("port", MQTT_DEFAULT_PORT);
+  mqttPrefs.getString("user", out->user, sizeof(out->user));
+  mqttPrefs.getString("password", out->password, sizeof(out->password));
+  mqttPrefs.getString("base", out->baseTopic, sizeof(out->baseTopic));
+  mqttPrefs.end();
+
+  if (out->baseTopic[0] == '\0') {
+    snprintf(out->baseTopic, sizeof(out->baseTopic), "grill/%s", nodeId + 6);   // nodeId is "grill_<mac>"
+  }
+}
+
+static void mqtt_save_config(const MqttConfig& in) {
+  mqttPrefs.begin("mqtt", false);
+  mqttPrefs.putBool("enabled", in.enabled);
+  mqttPrefs.putString("host", in.host);
+  mqttPrefs.putUShort("port", in.port);
+  mqttPrefs.putString("user", in.user);
+  mqttPrefs.putString("password", in.password);
+  mqttPrefs.putString("base", in.baseTopic);
+  mqttPrefs.end();
+}
+
+// Point the client at the active config - only while disconnected
+static void mqtt_configure_client() {
+  snprintf(availabilityTopic, sizeof(availabilityTopic), "%s/availability", config.baseTopic);
+  snprintf(stateTopic, sizeof(stateTopic), "%s/state", config.baseTopic);
+  snprintf(telemetryTopic, sizeof(telemetryTopic), "%s/telemetry", config.baseTopic);
+  snprintf(setpointTopic, sizeof(setpointTopic), "%s/setpoint/set", config.baseTopic);
+  snprintf(powerTopic, sizeof(powerTopic), "%s/power/set", config.baseTopic);
+
+  client.setServer(config.host, config.port);
+  client.setCredentials(config.user[0] ? config.user : NULL, config.password[0] ? config.password : NULL);
+  client.setWill(availabilityTopic, 1, true, "offline");
+}
+
+static void mqtt_set_state(MqttState next) {
+  state = next;
+  stateSince = clock_ms();
+}
+
+static void mqtt_enter_backoff() {
+  retryAt = clock_ms() + backoffMs + random(backoffMs / 4);   // Jitter so a fleet does not reconnect in step
+  Serial.printf("📡 MQTT: retrying in %lu ms\n", (unsigned long)(retryAt - clock_ms()));
+  backoffMs = min(backoffMs * 2, (uint32_t)MQTT_BACKOFF_MAX_MS);
+  mqtt_set_state(MQTT_BACKOFF);
+}
+
+static bool mqtt_publish(const char* topic, uint8_t qos, bool retain, const char* payload, size_t length) {
+  if (client.publish(topic, qos, retain, payload, length) == 0) {
+    publishFailedCount++;
+    return false;
+  }
+  publishedCount++;
+  return true;
+}
+
+// ===== AsyncTCP callbacks =====
+
+static void mqtt_on_connect(bool sessionPresent) {
+  client.subscribe(setpointTopic, 1);
+  client.subscribe(powerTopic, 1);
+  client.publish(availabilityTopic, 1, true, "online");
+  connectedEvent = true;
+}
+
+static void mqtt_on_disconnect(AsyncMqttClientDisconnectReason reason) {
+  disconnectReason = (uint8_t)reason;
+  disconnectedEvent = true;
+}
+
+static void mqtt_reject(const char* topic, const char* payload, const char* reason) {
+  commandsRejected++;
+  Serial.printf("⚠️ MQTT: rejected '%s' on %s - %s\n", payload, topic, reason);
+}
+
+static void mqtt_on_message(char* topic, char* payload, AsyncMqttClientMessageProperties properties,
+                            size_t len, size_t index, size_t total) {
+  char text[16];
+  if (index != 0 || len != total || len >= sizeof(text)) {
+    mqtt_reject(topic, "", "payload too long");
+    return;
+  }
+  memcpy(text, payload, len);
+  text[len] = '\0';
+
+  Command command;
+  if (strcmp(topic, setpointTopic) == 0) {
+    // Same limits as /set_temp; Home Assistant may send "225.0"
+    char* end;
+    double value = strtod(text, &end);
+    if (end == text || *end != '\0' || value != floor(value)) {
+      mqtt_reject(topic, text, "not a whole number");
+      return;
+    }
+    if (value < MIN_SETPOINT || value > MAX_SETPOINT) {
+      mqtt_reject(topic, text, "temperature out of range (150-500F)");
+      return;
+    }
+    command_init(&command, CMD_SET_TEMP);
+    command.temperature = (int)value;
+  } else if (strcmp(topic, powerTopic) == 0) {
+    if (strcmp(text, "start") == 0 || strcmp(text, "ON") == 0) {
+      command_init(&command, CMD_START);
+    } else if (strcmp(text, "stop") == 0 || strcmp(text, "OFF") == 0) {
+      command_init(&command, CMD_STOP);
+    } else {
+      mqtt_reject(topic, text, "expected start or stop");
+      return;
+    }
+  } else {
+    return;
+  }
+
+  if (command_post(command)) {
+    commandsPosted++;
+  } else {
+    mqtt_reject(topic, text, "command queue full");
+  }
+}
+
+// ===== Publishing (network task) =====
+
+static void mqtt_write_device(JsonWriter& json) {
+  json.beginObject("device");
+  json.beginArray("identifiers");
+  json.value(nodeId);
+  json.endArray();
+  json.field("name", "Grill Controller");
+  json.field("manufacturer", "ESP32-Grill");
+  json.field("model", "ESP32 Pellet Grill Controller");
+  json.endObject();
+}
+
+// Announce one entity; false if the client could not take it yet
+static bool mqtt_publish_discovery(const MqttEntity& entity) {
+  char topic[96];
+  snprintf(topic, sizeof(topic), "%s/%s/%s/%s/config", MQTT_DISCOVERY_PREFIX,
+           COMPONENTS[entity.kind], nodeId, entity.objectId);
+
+  char uniqueId[48];
+  snprintf(uniqueId, sizeof(uniqueId), "%s_%s", nodeId, entity.objectId);
+
+  char buffer[MQTT_PAYLOAD_MAX + 128];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("name", entity.name);
+  json.field("unique_id", uniqueId);
+  json.field("state_topic", entity.fromState ? stateTopic : telemetryTopic);
+  json.field("availability_topic", availabilityTopic);
+  if (entity.unit) json.field("unit_of_measurement", entity.unit);
+  if (entity.deviceClass) json.field("device_class", entity.deviceClass);
+
+  char tmpl[96];
+  switch (entity.kind) {
+    case ENTITY_BINARY_SENSOR:
+      snprintf(tmpl, sizeof(tmpl), "{{ 'ON' if value_json.%s else 'OFF' }}", entity.field);
+      break;
+    case ENTITY_SWITCH:
+      snprintf(tmpl, sizeof(tmpl), "{{ 'start' if value_json.%s else 'stop' }}", entity.field);
+      json.field("command_topic", powerTopic);
+      json.field("payload_on", "start");
+      json.field("payload_off", "stop");
+      break;
+    case ENTITY_NUMBER:
+      snprintf(tmpl, sizeof(tmpl), "{{ value_json.%s }}", entity.field);
+      json.field("command_topic", setpointTopic);
+      json.field("min", (int)MIN_SETPOINT);
+      json.field("max", (int)MAX_SETPOINT);
+      json.field("step", 5);
+      break;
+    default:
+      snprintf(tmpl, sizeof(tmpl), "{{ value_json.%s }}", entity.field);
+      if (entity.unit) json.field("state_class", "measurement");
+      break;
+  }
+  json.field("value_template", tmpl);
+  mqtt_write_device(json);
+  json.endObject();
+
+  if (json.overflowed()) {
+    Serial.printf("❌ MQTT: discovery config for %s too large\n", entity.objectId);
+    return true;   // Skip it rather than retry forever
+  }
+  return mqtt_publish(topic, 1, true, json.c_str(), json.length());
+}
+
+// Run state - retained, published whenever it changes
+static void mqtt_publish_state() {
+  char buffer[MQTT_PAYLOAD_MAX];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("grillRunning", grillRunning);
+  json.field("setpoint", (int)setpoint);
+  json.field("status", getStatus(readGrillTemperature()).c_str());
+  json.field("ignitionState", ignition_get_status_string().c_str());
+  json.field("fanMode", fan_get_mode_string().c_str());
+  json.field("smokeMode", fan_get_smoke_mode());
+  json.field("manualOverride", relay_get_manual_override_status());
+  json.field("hopperLow", pellet_is_hopper_low());
+  json.field("alarm", probe_alarm_get_active_text().c_str());
+  json.endObject();
+  if (json.overflowed()) return;
+
+  uint32_t hash = mqtt_hash(json.c_str(), json.length());
+  if (hash == lastStateHash) return;
+  if (mqtt_publish(stateTopic, 1, true, json.c_str(), json.length())) lastStateHash = hash;
+}
+
+// Sensor readings - QoS 0, on change but no more often than MQTT_TELEMETRY_MIN_MS
+static void mqtt_publish_telemetry() {
+  if (lastTelemetryAt != 0 && clock_elapsed_ms(lastTelemetryAt) < MQTT_TELEMETRY_MIN_MS) return;
+
+  char buffer[MQTT_PAYLOAD_MAX];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("grillTemp", (float)readGrillTemperature(), 1);
+  json.field("ambientTemp", (float)readAmbientTemperature(), 1);
+  json.field("meat1Temp", readProbeTemperature(1), 1);
+  json.field("meat2Temp", readProbeTemperature(2), 1);
+  json.field("meat3Temp", readProbeTemperature(3), 1);
+  json.field("meat4Temp", readProbeTemperature(4), 1);
+  json.field("blowerDuty", (int)relay_get_blower_duty());
+  json.field("hopperLb", pellet_get_hopper_remaining_lb(), 1);
+  json.field("burnRate", pellet_get_burn_rate(), 2);
+  json.endObject();
+  if (json.overflowed()) return;
+
+  uint32_t hash = mqtt_hash(json.c_str(), json.length());
+  if (hash == lastTelemetryHash && clock_elapsed_ms(lastTelemetryAt) < MQTT_TELEMETRY_MAX_MS) return;
+  if (mqtt_publish(telemetryTopic, 0, false, json.c_str(), json.length())) {
+    lastTelemetryHash = hash;
+    lastTelemetryAt = clock_ms();
+  }
+}
+
+// ===== Connection state machine (network task) =====
+
+static void mqtt_apply_pending_config() {
+  MqttConfig next;
+  portENTER_CRITICAL(&mqttMux);
+  bool pending = configPending;
+  if (pending) {
+    next = pendingConfig;
+    configPending = false;
+  }
+  portEXIT_CRITICAL(&mqttMux);
+  if (!pending) return;
+
+  mqtt_save_config(next);
+  if (client.connected() || state == MQTT_CONNECTING) client.disconnect(true);
+  connectedEvent = false;
+  disconnectedEvent = false;
+
+  config = next;
+  mqtt_configure_client();
+  backoffMs = MQTT_BACKOFF_MIN_MS;
+  mqtt_set_state(config.enabled ? MQTT_WAITING_WIFI : MQTT_DISABLED);
+  Serial.printf("📡 MQTT: %s %s:%u, base topic %s\n", config.enabled ? "enabled" : "disabled",
+                config.host, config.port, config.baseTopic);
+}
+
+static const char* mqtt_disconnect_reason_string(uint8_t reason) {
+  switch ((AsyncMqttClientDisconnectReason)reason) {
+    case AsyncMqttClientDisconnectReason::TCP_DISCONNECTED:                 return "TCP disconnected";
+    case AsyncMqttClientDisconnectReason::MQTT_UNACCEPTABLE_PROTOCOL_VERSION: return "protocol version refused";
+    case AsyncMqttClientDisconnectReason::MQTT_IDENTIFIER_REJECTED:         return "client id rejected";
+    case AsyncMqttClientDisconnectReason::MQTT_SERVER_UNAVAILABLE:          return "server unavailable";
+    case AsyncMqttClientDisconnectReason::MQTT_MALFORMED_CREDENTIALS:       return "malformed credentials";
+    case AsyncMqttClientDisconnectReason::MQTT_NOT_AUTHORIZED:              return "not authorized";
+    default:                                                                return "other";
+  }
+}
+
+void mqtt_update() {
+  mqtt_apply_pending_config();
+  if (state == MQTT_DISABLED) return;
+
+  if (connectedEvent.exchange(false) && state == MQTT_CONNECTING) {
+    connectCount++;
+    backoffMs = MQTT_BACKOFF_MIN_MS;
+    discoveryIndex = 0;
+    lastStateHash = 0;
+    lastTelemetryHash = 0;
+    lastTelemetryAt = 0;
+    mqtt_set_state(MQTT_CONNECTED);
+    Serial.printf("✅ MQTT: connected to %s:%u\n", config.host, config.port);
+  }
+  if (disconnectedEvent.exchange(false) && (state == MQTT_CONNECTED || state == MQTT_CONNECTING)) {
+    if (state == MQTT_CONNECTED) disconnectCount++;
+    disconnectSeen = true;
+    Serial.printf("📡 MQTT: disconnected (%s)\n", mqtt_disconnect_reason_string(disconnectReason));
+    mqtt_enter_backoff();
+  }
+
+  switch (state) {
+    case MQTT_BACKOFF:
+      if (!clock_expired(retryAt)) break;
+      mqtt_set_state(MQTT_WAITING_WIFI);
+      // fall through
+    case MQTT_WAITING_WIFI:
+      if (wifiManager.isConnected()) {
+        mqtt_set_state(MQTT_CONNECTING);
+        client.connect();
+      }
+      break;
+
+    case MQTT_CONNECTING:
+      if (clock_elapsed_ms(stateSince) >= MQTT_CONNECT_TIMEOUT_MS) {
+        Serial.println("📡 MQTT: connect timed out");
+        client.disconnect(true);
+        mqtt_enter_backoff();
+      }
+      break;
+
+    case MQTT_CONNECTED:
+      for (int sent = 0; discoveryIndex < ENTITY_COUNT && sent < MQTT_DISCOVERY_PER_CYCLE; sent++) {
+        if (!mqtt_publish_discovery(ENTITIES[discoveryIndex])) break;   // Client busy, next cycle
+        discoveryIndex++;
+      }
+      mqtt_publish_state();
+      mqtt_publish_telemetry();
+      break;
+
+    default:
+      break;
+  }
+}
+
+// ===== Web config =====
+
+static bool mqtt_copy_param(AsyncWebServerRequest *req, const char* name, char* out, size_t size) {
+  if (!req->hasParam(name, true)) return true;   // Absent = keep current
+  const String& value = req->getParam(name, true)->value();
+  if (value.length() >= size) return false;
+  strcpy(out, value.c_str());
+  return true;
+}
+
+static bool mqtt_valid_base_topic(const char* topic) {
+  size_t length = strlen(topic);
+  if (length == 0 || topic[0] == '/' || topic[length - 1] == '/') return false;
+  return strpbrk(topic, "+# ") == NULL;
+}
+
+void mqtt_init() {
+  uint8_t mac[6];
+  WiFi.macAddress(mac);
+  snprintf(nodeId, sizeof(nodeId), "grill_%02x%02x%02x", mac[3], mac[4], mac[5]);
+  snprintf(clientId, sizeof(clientId), "grill-%02x%02x%02x", mac[3], mac[4], mac[5]);
+
+  mqtt_load_config(&config);
+  client.setClientId(clientId);
+  client.setKeepAlive(MQTT_KEEPALIVE_S);
+  client.onConnect(mqtt_on_connect);
+  client.onDisconnect(mqtt_on_disconnect);
+  client.onMessage(mqtt_on_message);
+  mqtt_configure_client();
+  mqtt_set_state(config.enabled ? MQTT_WAITING_WIFI : MQTT_DISABLED);
+
+  server.on("/mqtt_config", HTTP_GET, [](AsyncWebServerRequest *req) {
+    char buffer[384];
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginObject();
+    json.field("enabled", config.enabled);
+    json.field("host", config.host);
+    json.field("port", (unsigned int)config.port);
+    json.field("user", config.user);
+    json.field("hasPassword", config.password[0] != '\0');   // Never sent back
+    json.field("baseTopic", config.baseTopic);
+    json.endObject();
+    req->send(200, "application/json", json.c_str());
+  });
+
+  server.on("/mqtt_config", HTTP_POST, [](AsyncWebServerRequest *req) {
+    MqttConfig next = config;
+    if (req->hasParam("enabled", true)) next.enabled = req->getParam("enabled", true)->value() == "1";
+    if (!mqtt_copy_param(req, "host", next.host, sizeof(next.host)) ||
+        !mqtt_copy_param(req, "user", next.user, sizeof(next.user)) ||
+        !mqtt_copy_param(req, "password", next.password, sizeof(next.password)) ||
+        !mqtt_copy_param(req, "base", next.baseTopic, sizeof(next.baseTopic))) {
+      req->send(400, "text/plain", "Value too long");
+      return;
+    }
+    if (req->hasParam("port", true)) {
+      long port = req->getParam("port", true)->value().toInt();
+      if (port < 1 || port > 65535) {
+        req->send(400, "text/plain", "Port out of range (1-65535)");
+        return;
+      }
+      next.port = port;
+    }
+    if (next.enabled && next.host[0] == '\0') {
+      req->send(400, "text/plain", "Broker host required");
+      return;
+    }
+    if (!mqtt_valid_base_topic(next.baseTopic)) {
+      req->send(400, "text/plain", "Invalid base topic");
+      return;
+    }
+
+    portENTER_CRITICAL(&mqttMux);
+    pendingConfig = next;
+    configPending = true;
+    portEXIT_CRITICAL(&mqttMux);
+    req->send(200, "text/plain", next.enabled ? "MQTT settings saved - connecting" : "MQTT disabled");
+  });
+
+  server.on("/mqtt_stats", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", mqtt_get_stats_json());
+  });
+}
+
+bool mqtt_is_connected() {
+  return state == MQTT_CONNECTED;
+}
+
+String mqtt_get_stats_json() {
+  char buffer[384];
+  JsonWriter json(buffer, sizeof(buffer));
+
+  json.beginObject();
+  json.field("state", STATE_NAMES[state]);
+  json.field("stateForMs", (unsigned long)clock_elapsed_ms(stateSince));
+  json.field("backoffMs", backoffMs);
+  json.field("connects", connectCount);
+  json.field("disconnects", disconnectCount);
+  if (disconnectSeen) json.field("lastDisconnect", mqtt_disconnect_reason_string(disconnectReason));
+  json.field("published", publishedCount);
+  json.field("publishFailed", publishFailedCount);
+  json.field("discoverySent", (unsigned int)discoveryIndex);
+  json.field("commandsPosted", commandsPosted.load());
+  json.field("commandsRejected", commandsRejected.load());
+  json.endObject();
+
+  return String(json.c_str());
+}
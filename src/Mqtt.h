@@ -0,0 +1,55 @@
+// Mqtt.h - MQTT telemetry, state and commands with Home Assistant discovery
+//
+// Topics under the configured base (default grill/<mac>):
+//   <base>/availability   "online"/"offline", retained (offline is the last will)
+//   <base>/state          JSON of run state and setpoint, retained, QoS 1, on change
+//   <base>/telemetry      JSON of sensor readings, QoS 0, on change (rate-limited)
+//   <base>/setpoint/set   Command: target temperature in °F
+//   <base>/power/set      Command: "start"/"ON" or "stop"/"OFF"
+// Commands are range-checked like /set_temp and applied by loop() through the
+// command queue. Discovery configs go to homeassistant/<component>/<node>/...
+// on every connect.
+//
+// The client runs on AsyncTCP: connecting never blocks the network task.
+// Failed or dropped connections are retried with exponential backoff.
+#ifndef MQTT_H
+#define MQTT_H
+
+#include <Arduino.h>
+
+#define MQTT_DEFAULT_PORT          1883
+#define MQTT_KEEPALIVE_S           30
+#define MQTT_CONNECT_TIMEOUT_MS    15000   // Give up on a connect attempt after this
+#define MQTT_BACKOFF_MIN_MS        2000
+#define MQTT_BACKOFF_MAX_MS        120000
+#define MQTT_TELEMETRY_MIN_MS      5000    // At most one telemetry message per this period
+#define MQTT_TELEMETRY_MAX_MS      60000   // Republish unchanged telemetry this often
+#define MQTT_DISCOVERY_PER_CYCLE   4       // Discovery configs sent per mqtt_update() call
+#define MQTT_DISCOVERY_PREFIX      "homeassistant"
+
+#define MQTT_HOST_LEN              64
+#define MQTT_USER_LEN              32
+#define MQTT_PASSWORD_LEN          64
+#define MQTT_TOPIC_LEN             48      // Base topic
+#define MQTT_PAYLOAD_MAX           512
+
+struct MqttConfig {
+  bool enabled;
+  char host[MQTT_HOST_LEN];
+  uint16_t port;
+  char user[MQTT_USER_LEN];
+  char password[MQTT_PASSWORD_LEN];
+  char baseTopic[MQTT_TOPIC_LEN];
+};
+
+// Setup - loads the config and registers /mqtt_config and /mqtt_stats
+void mqtt_init();
+
+// Call once per control cycle from the network task - connects, publishes, applies config
+void mqtt_update();
+
+// Status
+bool mqtt_is_connected();
+String mqtt_get_stats_json();
+
+#endif // MQTT_H
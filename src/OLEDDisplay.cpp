@@ -5,6 +5,10 @@
 #include "WiFiManager.h"
 #include "Ignition.h"
 #include "RelayControl.h"  // Added this include for relay_is_safe_state()
+#include "ProbeAlarm.h"
+#include "ProbePredictor.h"
+#include "Clock.h"
+#include "Tasks.h"
 #include <WiFi.h>
 
 OLEDDisplayManager oledDisplay;
@@ -60,14 +64,23 @@ void OLEDDisplayManager::showBootScreen() {
   display.setCursor(0, 55);
   display.println("Initializing...");
   
+  // Stays up until update() draws the first page - no wait, boot carries on
   display.display();
-  delay(2000);
 }
 
 void OLEDDisplayManager::update() {
   if (!displayConnected) return;
   
-  unsigned long now = millis();
+  uint64_t now = clock_ms();
+  
+  // Jump to the main page when a new probe alarm fires
+  static uint32_t lastAlarmSeq = 0;
+  if (probe_alarm_get_sequence() != lastAlarmSeq) {
+    lastAlarmSeq = probe_alarm_get_sequence();
+    if (probe_alarm_get_active_mask()) {
+      setPage(PAGE_MAIN);
+    }
+  }
   
   // Auto-rotate pages if enabled
   if (autoRotate && now - pageStartTime > autoRotateInterval) {
@@ -122,14 +135,32 @@ void OLEDDisplayManager::drawMainPage() {
     display.println("F");
   }
   
+  // Finish-time estimate for the first probe with a cook target
+  display.setTextSize(1);
+  SensorSnapshot sample;
+  tasks_get_sample(&sample);
+  for (int i = 0; i < MAX_PROBES; i++) {
+    if (tempSensor.probes[i].targetTemp <= 0.0 || !sample.probeValid[i]) continue;
+    display.setCursor(72, 40);
+    if (probe_predictor_is_stalled(i)) {
+      display.printf("P%d STALL", i + 1);
+    } else {
+      display.printf("P%d %s", i + 1, probe_predictor_format_eta(probe_predictor_get_eta(i)).c_str());
+    }
+    break;
+  }
+  
   // Target temperature
   display.setTextSize(1);
   display.setCursor(10, 50);
   display.printf("Target: %.0fF", setpoint);
   
-  // Status indicator
+  // Status indicator - active probe alarm takes priority
   display.setCursor(0, 57);
-  if (grillRunning) {
+  String alarmText = probe_alarm_get_active_text();
+  if (alarmText.length() > 0) {
+    display.println(alarmText);
+  } else if (grillRunning) {
     display.println("RUNNING");
   } else {
     display.println("IDLE");
@@ -156,7 +187,7 @@ void OLEDDisplayManager::drawGrillPage() {
     display.printf("Temp Error: %.1fF\n", error);
     
     // Running time (simplified)
-    display.printf("Running: %s\n", formatTime(millis() / 1000).c_str());
+    display.printf("Running: %s\n", formatTime((unsigned long)(clock_ms() / 1000)).c_str());
     
     // Progress bar for ignition (if active)
     if (ignition_get_state() != IGNITION_OFF && ignition_get_state() != IGNITION_COMPLETE) {
@@ -240,7 +271,7 @@ void OLEDDisplayManager::drawDebugPage() {
   display.setCursor(0, 15);
   
   // System info
-  display.printf("Uptime: %s\n", formatTime(millis() / 1000).c_str());
+  display.printf("Uptime: %s\n", formatTime((unsigned long)(clock_ms() / 1000)).c_str());
   display.printf("Free RAM: %d\n", ESP.getFreeHeap());
   display.printf("CPU Freq: %d MHz\n", ESP.getCpuFreqMHz());
   
@@ -253,9 +284,9 @@ void OLEDDisplayManager::drawDebugPage() {
   }
   
   // Loop timing
-  static unsigned long lastLoop = 0;
-  unsigned long loopTime = millis() - lastLoop;
-  lastLoop = millis();
+  static uint64_t lastLoop = 0;
+  unsigned long loopTime = (unsigned long)clock_elapsed_ms(lastLoop);
+  lastLoop = clock_ms();
   display.printf("Loop: %lu ms", loopTime);
 }
 
@@ -315,7 +346,7 @@ void OLEDDisplayManager::drawCenteredText(String text, int y) {
 
 void OLEDDisplayManager::setPage(DisplayPage page) {
   currentPage = page;
-  pageStartTime = millis();
+  pageStartTime = clock_ms();
 }
 
 void OLEDDisplayManager::nextPage() {
@@ -342,7 +373,7 @@ void OLEDDisplayManager::enableAutoRotate(bool enable, unsigned long interval) {
   autoRotate = enable;
   autoRotateInterval = interval;
   if (enable) {
-    pageStartTime = millis();
+    pageStartTime = clock_ms();
   }
 }
 
@@ -27,8 +27,8 @@ class OLEDDisplayManager {
 private:
   Adafruit_SSD1306 display;
   DisplayPage currentPage;
-  unsigned long lastUpdate;
-  unsigned long pageStartTime;
+  uint64_t lastUpdate;
+  uint64_t pageStartTime;
   bool displayConnected;
   bool autoRotate;
   unsigned long autoRotateInterval;
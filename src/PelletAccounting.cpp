@@ -0,0 +1,237 @@
+// PelletAccounting.cpp - Pellet usage from auger runtime
+//
+// Counters are kept in auger milliseconds and converted to pounds with the
+// grams-per-second calibration when reported, so a recalibration corrects
+// past estimates too. Counters live in RAM and are flushed to the "pelletacct"
+// namespace every PELLET_FLUSH_INTERVAL_MS, plus on cook stop and config changes.
+#include "PelletAccounting.h"
+#include "Globals.h"
+#include "RelayControl.h"
+#include "Clock.h"
+
+static float calGramsPerSec = PELLET_DEFAULT_GRAMS_PER_SEC;
+static float hopperCapacityLb = PELLET_DEFAULT_HOPPER_LB;
+static float lowAlarmLb = PELLET_DEFAULT_LOW_LB;
+
+// Runtime counters (auger milliseconds)
+static uint64_t lifetimeMs = 0;
+static uint64_t cookMs = 0;
+static uint64_t lastRuntimeMs = 0;    // Last relay runtime sample
+
+// Hopper level at the last refill, and the lifetime counter at that moment
+static float hopperLbAtFill = PELLET_DEFAULT_HOPPER_LB;
+static uint64_t lifetimeMsAtFill = 0;
+static bool hopperLowLatched = false;
+
+// Burn rate window
+static uint64_t rateSamples[PELLET_RATE_SAMPLES];
+static uint64_t rateSampleTimes[PELLET_RATE_SAMPLES];
+static int rateHead = 0;
+static int rateCount = 0;
+static uint64_t lastRateSample = 0;
+
+static bool wasRunning = false;
+static bool dirty = false;
+static uint64_t lastFlush = 0;
+
+static float pellet_ms_to_lb(uint64_t ms) {
+  return (ms / 1000.0) * calGramsPerSec / GRAMS_PER_LB;
+}
+
+static void pellet_reset_rate_window() {
+  rateHead = 0;
+  rateCount = 0;
+  lastRateSample = 0;
+}
+
+static void pellet_load_accounting() {
+  preferences.begin("pelletacct", true);
+  calGramsPerSec = preferences.getFloat("calGps", PELLET_DEFAULT_GRAMS_PER_SEC);
+  hopperCapacityLb = preferences.getFloat("hopperCap", PELLET_DEFAULT_HOPPER_LB);
+  lowAlarmLb = preferences.getFloat("lowAlarm", PELLET_DEFAULT_LOW_LB);
+  lifetimeMs = preferences.getULong64("lifeMs", 0);
+  cookMs = preferences.getULong64("cookMs", 0);
+  hopperLbAtFill = preferences.getFloat("fillLb", hopperCapacityLb);
+  lifetimeMsAtFill = preferences.getULong64("fillMs", 0);
+  preferences.end();
+}
+
+void pellet_accounting_flush() {
+  preferences.begin("pelletacct", false);
+  preferences.putFloat("calGps", calGramsPerSec);
+  preferences.putFloat("hopperCap", hopperCapacityLb);
+  preferences.putFloat("lowAlarm", lowAlarmLb);
+  preferences.putULong64("lifeMs", lifetimeMs);
+  preferences.putULong64("cookMs", cookMs);
+  preferences.putFloat("fillLb", hopperLbAtFill);
+  preferences.putULong64("fillMs", lifetimeMsAtFill);
+  preferences.end();
+
+  dirty = false;
+  lastFlush = clock_ms();
+}
+
+void pellet_accounting_init() {
+  pellet_load_accounting();
+
+  lastRuntimeMs = relay_get_auger_runtime_ms();
+  wasRunning = grillRunning;
+  hopperLowLatched = false;
+  dirty = false;
+  lastFlush = clock_ms();
+  pellet_reset_rate_window();
+
+  Serial.printf("Pellet accounting initialized: %.2f g/s, hopper %.1f/%.1f lb, lifetime %.1f lb\n",
+                calGramsPerSec, pellet_get_hopper_remaining_lb(), hopperCapacityLb, pellet_get_lifetime_lb());
+}
+
+void pellet_accounting_update() {
+  uint64_t now = clock_ms();
+
+  // New cook starts the per-cook counter; a finished cook is flushed right away
+  if (grillRunning && !wasRunning) {
+    cookMs = 0;
+    dirty = true;
+    pellet_reset_rate_window();
+    Serial.println("Pellet accounting: new cook started");
+  } else if (!grillRunning && wasRunning) {
+    Serial.printf("Pellet accounting: cook used %.2f lb (%.0f auger sec)\n",
+                  pellet_get_cook_lb(), pellet_get_cook_auger_seconds());
+    pellet_accounting_flush();
+  }
+  wasRunning = grillRunning;
+
+  // Fold in auger runtime since the last cycle
+  uint64_t runtime = relay_get_auger_runtime_ms();
+  if (runtime > lastRuntimeMs) {
+    uint64_t delta = runtime - lastRuntimeMs;
+    lifetimeMs += delta;
+    if (grillRunning) cookMs += delta;
+    dirty = true;
+  }
+  lastRuntimeMs = runtime;
+
+  // Burn rate samples
+  if (rateCount == 0 || now - lastRateSample >= PELLET_RATE_SAMPLE_MS) {
+    rateSamples[rateHead] = lifetimeMs;
+    rateSampleTimes[rateHead] = now;
+    rateHead = (rateHead + 1) % PELLET_RATE_SAMPLES;
+    if (rateCount < PELLET_RATE_SAMPLES) rateCount++;
+    lastRateSample = now;
+  }
+
+  // Low-hopper alarm with hysteresis
+  float remaining = pellet_get_hopper_remaining_lb();
+  if (!hopperLowLatched && remaining <= lowAlarmLb) {
+    hopperLowLatched = true;
+    Serial.printf("⚠️ LOW HOPPER: ~%.1f lb remaining\n", remaining);
+  } else if (hopperLowLatched && remaining > lowAlarmLb + PELLET_LOW_HYSTERESIS_LB) {
+    hopperLowLatched = false;
+  }
+
+  if (dirty && now - lastFlush >= PELLET_FLUSH_INTERVAL_MS) {
+    pellet_accounting_flush();
+  }
+}
+
+void pellet_set_calibration(float gramsPerSecond) {
+  calGramsPerSec = constrain(gramsPerSecond, 0.1, 50.0);
+  pellet_accounting_flush();
+  Serial.printf("Pellet calibration set to %.2f g/s\n", calGramsPerSec);
+}
+
+float pellet_get_calibration() {
+  return calGramsPerSec;
+}
+
+void pellet_set_hopper_config(float capacityLb, float lowAlarm) {
+  hopperCapacityLb = constrain(capacityLb, 1.0, 100.0);
+  lowAlarmLb = constrain(lowAlarm, 0.0, hopperCapacityLb);
+  pellet_accounting_flush();
+  Serial.printf("Hopper capacity %.1f lb, low alarm at %.1f lb\n", hopperCapacityLb, lowAlarmLb);
+}
+
+// Calibration and hopper together, with a single flush
+void pellet_set_accounting_config(float gramsPerSecond, float capacityLb, float lowAlarm) {
+  calGramsPerSec = constrain(gramsPerSecond, 0.1, 50.0);
+  hopperCapacityLb = constrain(capacityLb, 1.0, 100.0);
+  lowAlarmLb = constrain(lowAlarm, 0.0, hopperCapacityLb);
+  pellet_accounting_flush();
+  Serial.printf("Pellet calibration %.2f g/s, hopper %.1f lb, low alarm at %.1f lb\n",
+                calGramsPerSec, hopperCapacityLb, lowAlarmLb);
+}
+
+float pellet_get_hopper_low_lb() {
+  return lowAlarmLb;
+}
+
+void pellet_hopper_refill(float levelLb) {
+  hopperLbAtFill = (levelLb > 0.0) ? min(levelLb, hopperCapacityLb) : hopperCapacityLb;
+  lifetimeMsAtFill = lifetimeMs;
+  hopperLowLatched = false;
+  pellet_accounting_flush();
+  Serial.printf("Hopper refilled to %.1f lb\n", hopperLbAtFill);
+}
+
+void pellet_reset_lifetime() {
+  lifetimeMs = 0;
+  lifetimeMsAtFill = 0;
+  pellet_reset_rate_window();
+  pellet_accounting_flush();
+  Serial.println("Pellet lifetime counter reset");
+}
+
+float pellet_get_cook_auger_seconds() {
+  return cookMs / 1000.0;
+}
+
+float pellet_get_lifetime_auger_seconds() {
+  return lifetimeMs / 1000.0;
+}
+
+float pellet_get_cook_lb() {
+  return pellet_ms_to_lb(cookMs);
+}
+
+float pellet_get_lifetime_lb() {
+  return pellet_ms_to_lb(lifetimeMs);
+}
+
+float pellet_get_hopper_remaining_lb() {
+  float used = pellet_ms_to_lb(lifetimeMs - lifetimeMsAtFill);
+  return max(hopperLbAtFill - used, 0.0f);
+}
+
+float pellet_get_hopper_capacity_lb() {
+  return hopperCapacityLb;
+}
+
+bool pellet_is_hopper_low() {
+  return hopperLowLatched;
+}
+
+float pellet_get_burn_rate() {
+  if (rateCount < 2) return 0.0;
+
+  int newest = (rateHead + PELLET_RATE_SAMPLES - 1) % PELLET_RATE_SAMPLES;
+  int oldest = (rateHead + PELLET_RATE_SAMPLES - rateCount) % PELLET_RATE_SAMPLES;
+  float hours = (rateSampleTimes[newest] - rateSampleTimes[oldest]) / 3600000.0;
+  if (hours <= 0.0) return 0.0;
+  return pellet_ms_to_lb(rateSamples[newest] - rateSamples[oldest]) / hours;
+}
+
+String pellet_get_accounting_json() {
+  String json = "{";
+  json += "\"cookAugerSec\":" + String(pellet_get_cook_auger_seconds(), 0) + ",";
+  json += "\"cookLb\":" + String(pellet_get_cook_lb(), 2) + ",";
+  json += "\"lifetimeAugerSec\":" + String(pellet_get_lifetime_auger_seconds(), 0) + ",";
+  json += "\"lifetimeLb\":" + String(pellet_get_lifetime_lb(), 1) + ",";
+  json += "\"hopperLb\":" + String(pellet_get_hopper_remaining_lb(), 1) + ",";
+  json += "\"hopperCapacity\":" + String(hopperCapacityLb, 1) + ",";
+  json += "\"lowAlarmLb\":" + String(lowAlarmLb, 1) + ",";
+  json += "\"hopperLow\":" + String(hopperLowLatched ? "true" : "false") + ",";
+  json += "\"burnRate\":" + String(pellet_get_burn_rate(), 2) + ",";
+  json += "\"gramsPerSec\":" + String(calGramsPerSec, 2);
+  json += "}";
+  return json;
+}
@@ -0,0 +1,46 @@
+// PelletAccounting.h - Auger runtime counters, hopper level estimate and burn rate
+#ifndef PELLETACCOUNTING_H
+#define PELLETACCOUNTING_H
+
+#include <Arduino.h>
+
+// Calibration and hopper defaults
+#define PELLET_DEFAULT_GRAMS_PER_SEC  2.5    // Auger output, measured by weighing a timed run
+#define PELLET_DEFAULT_HOPPER_LB      18.0   // Hopper capacity
+#define PELLET_DEFAULT_LOW_LB         3.0    // Low-hopper alarm threshold
+#define PELLET_LOW_HYSTERESIS_LB      1.0    // Level above threshold that re-arms the alarm
+#define GRAMS_PER_LB                  453.592
+
+// Burn rate window - one sample per minute, rate over the last 10 minutes
+#define PELLET_RATE_SAMPLE_MS         60000
+#define PELLET_RATE_SAMPLES           11
+
+// Coalesce NVS writes - flush dirty counters at most this often while cooking
+#define PELLET_FLUSH_INTERVAL_MS      300000
+
+// Accounting functions
+void pellet_accounting_init();
+void pellet_accounting_update();   // Call once per control cycle
+void pellet_accounting_flush();    // Write dirty counters to flash now
+
+// Calibration and hopper management
+void pellet_set_calibration(float gramsPerSecond);
+float pellet_get_calibration();
+void pellet_set_hopper_config(float capacityLb, float lowAlarmLb);
+void pellet_set_accounting_config(float gramsPerSecond, float capacityLb, float lowAlarmLb);   // One flush
+void pellet_hopper_refill(float levelLb);   // levelLb <= 0 means filled to capacity
+void pellet_reset_lifetime();
+
+// Status
+float pellet_get_cook_auger_seconds();
+float pellet_get_lifetime_auger_seconds();
+float pellet_get_cook_lb();
+float pellet_get_lifetime_lb();
+float pellet_get_hopper_remaining_lb();
+float pellet_get_hopper_capacity_lb();
+float pellet_get_hopper_low_lb();
+bool pellet_is_hopper_low();
+float pellet_get_burn_rate();               // lb/hr, over the rate window
+String pellet_get_accounting_json();
+
+#endif // PELLETACCOUNTING_H
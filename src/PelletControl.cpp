@@ -4,17 +4,18 @@
 #include "Utility.h"
 #include "RelayControl.h"
 #include "Ignition.h"
+#include "Clock.h"
 
 // PID controller instance
 static PIDController pid;
 static double targetTemp = 225.0;
 
 // Feed control parameters
-static unsigned long lastFeedTime = 0;
+static uint64_t lastFeedTime = 0;
 static unsigned long feedDuration = 0;
 static unsigned long feedInterval = 60000; // Base feed interval (1 minute)
 static bool feedCycleActive = false;
-static unsigned long feedCycleStartTime = 0;
+static uint64_t feedCycleStartTime = 0;
 
 // ADJUSTABLE PELLET FEED PARAMETERS FOR IGNITION
 // These can be modified via web interface for better ignition performance
@@ -65,7 +66,7 @@ void pellet_init() {
   
   // Initialize feed control
   targetTemp = setpoint;
-  lastFeedTime = millis();
+  lastFeedTime = clock_ms();
   feedCycleActive = false;
   
   // Load pellet feed parameters from preferences
@@ -83,7 +84,7 @@ void pellet_init() {
 void pellet_feed_loop() {
   if (!grillRunning) return;
   
-  unsigned long now = millis();
+  uint64_t now = clock_ms();
   double currentTemp = readTemperature();
   
   // Skip if temperature reading is invalid
@@ -134,16 +135,16 @@ void pellet_feed_loop() {
   }
   
   // Debug output every 30 seconds
-  static unsigned long lastDebug = 0;
+  static uint64_t lastDebug = 0;
   if (now - lastDebug >= 30000) {
     Serial.printf("🌾 Pellet Control: Temp=%.1f°F, Target=%.1f°F, Error=%.1f°F, PID=%.1f, Next feed in %lu sec\n",
                   currentTemp, targetTemp, tempError, pidOutput,
-                  (feedInterval - (now - lastFeedTime)) / 1000);
+                  (unsigned long)((feedInterval - (now - lastFeedTime)) / 1000));
     lastDebug = now;
   }
 }
 
-void pellet_handle_ignition_feeding(unsigned long now) {
+void pellet_handle_ignition_feeding(uint64_t now) {
   IgnitionState currentState = ignition_get_state();
   
   switch (currentState) {
@@ -213,17 +214,17 @@ void pellet_execute_feed_cycle() {
     relay_request_auto(&startFeed);
     
     feedCycleActive = true;
-    feedCycleStartTime = millis();
+    feedCycleStartTime = clock_ms();
     
     Serial.printf("🌾 Starting feed cycle: %lu ms duration\n", feedDuration);
   } else {
     // No feed needed, just update timing
-    lastFeedTime = millis();
+    lastFeedTime = clock_ms();
   }
 }
 
 float calculatePID(PIDController* pid, float setpoint, float measurement) {
-  unsigned long now = millis();
+  uint64_t now = clock_ms();
   
   // Calculate time delta
   float dt = (now - pid->last_time) / 1000.0; // Convert to seconds
@@ -265,7 +266,7 @@ void resetPID(PIDController* pid) {
   pid->integral = 0.0;
   pid->previous_error = 0.0;
   pid->output = 0.0;
-  pid->last_time = millis();
+  pid->last_time = clock_ms();
 }
 
 void setPIDParameters(float kp, float ki, float kd) {
@@ -298,11 +299,11 @@ String pellet_get_status() {
   if (!grillRunning) return "IDLE";
   
   if (feedCycleActive) {
-    unsigned long remaining = feedDuration - (millis() - feedCycleStartTime);
+    unsigned long remaining = feedDuration - (unsigned long)clock_elapsed_ms(feedCycleStartTime);
     return "FEEDING (" + String(remaining / 1000) + "s)";
   }
   
-  unsigned long nextFeed = feedInterval - (millis() - lastFeedTime);
+  unsigned long nextFeed = feedInterval - (unsigned long)clock_elapsed_ms(lastFeedTime);
   if (nextFeed > 60000) {
     return "WAITING (" + String(nextFeed / 60000) + "min)";
   } else {
@@ -320,7 +321,7 @@ void pellet_print_diagnostics() {
   Serial.printf("Current Feed Duration: %lu ms\n", feedDuration);
   Serial.printf("Current Feed Interval: %lu ms\n", feedInterval);
   Serial.printf("Feed Cycle Active: %s\n", feedCycleActive ? "YES" : "NO");
-  Serial.printf("Time Since Last Feed: %lu sec\n", (millis() - lastFeedTime) / 1000);
+  Serial.printf("Time Since Last Feed: %lu sec\n", (unsigned long)(clock_elapsed_ms(lastFeedTime) / 1000));
   Serial.printf("Ignition State: %s\n", ignition_get_status_string().c_str());
   Serial.printf("Status: %s\n", pellet_get_status().c_str());
   
@@ -373,6 +374,18 @@ void pellet_set_lighting_feed_interval(unsigned long interval) {
   Serial.printf("Lighting feed interval set to %lu ms (%.1f sec)\n", lightingFeedInterval, lightingFeedInterval / 1000.0);
 }
 
+// All four at once - one NVS write instead of one per parameter
+void pellet_set_feed_parameters(unsigned long initial, unsigned long lighting, unsigned long normal, unsigned long interval) {
+  initialFeedDuration = constrain(initial, 10000, 120000);
+  lightingFeedDuration = constrain(lighting, 5000, 60000);
+  normalFeedDuration = constrain(normal, 1000, 30000);
+  lightingFeedInterval = constrain(interval, 30000, 180000);
+  savePelletParameters();
+  Serial.printf("Feed parameters set: initial %lus, lighting %lus, normal %lus, interval %lus\n",
+                initialFeedDuration / 1000, lightingFeedDuration / 1000,
+                normalFeedDuration / 1000, lightingFeedInterval / 1000);
+}
+
 void savePelletParameters() {
   preferences.begin("pellet", false);
   preferences.putULong("initialFeed", initialFeedDuration);
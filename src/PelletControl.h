@@ -12,7 +12,7 @@ struct PIDController {
   float integral;             // Integral accumulator
   float previous_error;       // Previous error for derivative
   float output;               // Current PID output
-  unsigned long last_time;    // Last calculation time
+  uint64_t last_time;         // Last calculation time (clock_ms)
   float output_min, output_max; // Output limits
 };
 
@@ -31,7 +31,7 @@ void resetPID(PIDController* pid);
 // Feed timing and control
 void pellet_calculate_feed_time(double temperature_error);
 void pellet_execute_feed_cycle();
-void pellet_handle_ignition_feeding(unsigned long now);
+void pellet_handle_ignition_feeding(uint64_t now);
 
 // Status and diagnostics
 String pellet_get_status();
@@ -47,6 +47,7 @@ void pellet_set_initial_feed_duration(unsigned long duration);
 void pellet_set_lighting_feed_duration(unsigned long duration);
 void pellet_set_normal_feed_duration(unsigned long duration);
 void pellet_set_lighting_feed_interval(unsigned long interval);
+void pellet_set_feed_parameters(unsigned long initial, unsigned long lighting, unsigned long normal, unsigned long interval);
 
 // Parameter persistence
 void savePelletParameters();
@@ -0,0 +1,281 @@
+// ProbeAlarm.cpp - Meat probe target/alarm evaluation with hysteresis
+#include "ProbeAlarm.h"
+#include "Globals.h"
+#include "Clock.h"
+#include "Tasks.h"
+#include "Utility.h"
+
+// Per-probe alarm latches
+struct ProbeAlarmState {
+  bool targetLatched;
+  bool highLatched;
+  bool lowArmed;            // Low alarm only arms once the probe has risen above it
+  bool lowLatched;
+  bool keepWarmApplied;
+};
+
+static ProbeAlarmState alarmState[MAX_PROBES];
+static ProbeAlarmEvent events[PROBE_ALARM_EVENT_COUNT];
+static uint32_t lastEventSeq = 0;
+static uint8_t activeMask = 0;
+static uint32_t lastSeenSequence = 0;   // Sensor snapshot last evaluated
+static double keepWarmSetpoint = KEEP_WARM_SETPOINT_DEFAULT;
+
+static void probe_alarm_push_event(int probeIndex, ProbeAlarmType type, float temp) {
+  lastEventSeq++;
+  ProbeAlarmEvent& ev = events[lastEventSeq % PROBE_ALARM_EVENT_COUNT];
+  ev.seq = lastEventSeq;
+  ev.probe = probeIndex;
+  ev.type = type;
+  ev.temperature = temp;
+  ev.timestamp = clock_ms();
+
+  Serial.printf("🔔 PROBE %d ALARM: %s at %.1f°F\n", probeIndex + 1,
+                probe_alarm_type_string(type).c_str(), temp);
+}
+
+static void probe_alarm_apply_keep_warm(int probeIndex, float temp) {
+  if (!grillRunning || alarmState[probeIndex].keepWarmApplied) return;
+  if (setpoint <= keepWarmSetpoint) return;  // Already at or below keep-warm
+
+  alarmState[probeIndex].keepWarmApplied = true;
+  setpoint = keepWarmSetpoint;
+  save_setpoint();
+  probe_alarm_push_event(probeIndex, PROBE_ALARM_KEEP_WARM, temp);
+}
+
+static void probe_alarm_reset_state(int probeIndex) {
+  alarmState[probeIndex].targetLatched = false;
+  alarmState[probeIndex].highLatched = false;
+  alarmState[probeIndex].lowArmed = false;
+  alarmState[probeIndex].lowLatched = false;
+  alarmState[probeIndex].keepWarmApplied = false;
+  activeMask &= ~(1 << probeIndex);
+}
+
+void probe_alarm_init() {
+  for (int i = 0; i < MAX_PROBES; i++) {
+    probe_alarm_reset_state(i);
+  }
+  for (int i = 0; i < PROBE_ALARM_EVENT_COUNT; i++) {
+    events[i].seq = 0;
+  }
+  lastEventSeq = 0;
+  activeMask = 0;
+
+  probe_alarm_load();
+  Serial.printf("Probe alarms initialized (keep-warm %.0f°F)\n", keepWarmSetpoint);
+}
+
+void probe_alarm_update() {
+  // Only evaluate fresh, valid samples from the snapshot - never trigger a probe read here
+  SensorSnapshot sample;
+  if (!tasks_get_sample(&sample) || sample.sequence == lastSeenSequence) return;
+  lastSeenSequence = sample.sequence;
+
+  for (int i = 0; i < MAX_PROBES; i++) {
+    const ProbeConfig& probe = tempSensor.probes[i];
+    ProbeAlarmState& state = alarmState[i];
+
+    if (!sample.probeValid[i]) continue;
+
+    float temp = sample.probeF[i];
+    float hyst = probe.alarmHysteresis > 0.0 ? probe.alarmHysteresis : 0.0;
+    bool wasLatched = state.targetLatched || state.highLatched || state.lowLatched;
+
+    // Cook target
+    if (probe.targetTemp > 0.0) {
+      if (!state.targetLatched && temp >= probe.targetTemp) {
+        state.targetLatched = true;
+        activeMask |= (1 << i);
+        probe_alarm_push_event(i, PROBE_ALARM_TARGET, temp);
+        if (probe.keepWarmOnTarget) {
+          probe_alarm_apply_keep_warm(i, temp);
+        }
+      } else if (state.targetLatched && temp < probe.targetTemp - hyst) {
+        state.targetLatched = false;
+        state.keepWarmApplied = false;
+      }
+    }
+
+    // High alarm
+    if (probe.alarmHigh > 0.0) {
+      if (!state.highLatched && temp >= probe.alarmHigh) {
+        state.highLatched = true;
+        activeMask |= (1 << i);
+        probe_alarm_push_event(i, PROBE_ALARM_HIGH, temp);
+      } else if (state.highLatched && temp < probe.alarmHigh - hyst) {
+        state.highLatched = false;
+      }
+    }
+
+    // Low alarm - arms once the probe is clear of the threshold
+    if (probe.alarmLow > 0.0) {
+      if (!state.lowArmed && temp > probe.alarmLow + hyst) {
+        state.lowArmed = true;
+      }
+      if (state.lowArmed && !state.lowLatched && temp <= probe.alarmLow) {
+        state.lowLatched = true;
+        activeMask |= (1 << i);
+        probe_alarm_push_event(i, PROBE_ALARM_LOW, temp);
+      } else if (state.lowLatched && temp > probe.alarmLow + hyst) {
+        state.lowLatched = false;
+      }
+    }
+
+    // All latches released - alarm re-armed
+    if (wasLatched && !state.targetLatched && !state.highLatched && !state.lowLatched) {
+      activeMask &= ~(1 << i);
+      probe_alarm_push_event(i, PROBE_ALARM_CLEARED, temp);
+    }
+  }
+}
+
+bool probe_alarm_configure(int probeIndex, float target, float high, float low,
+                           float hysteresis, bool keepWarm) {
+  if (probeIndex < 0 || probeIndex >= MAX_PROBES) return false;
+
+  ProbeConfig& probe = tempSensor.probes[probeIndex];
+  probe.targetTemp = target;
+  probe.alarmHigh = high;
+  probe.alarmLow = low;
+  probe.alarmHysteresis = constrain(hysteresis, 0.0, 20.0);
+  probe.keepWarmOnTarget = keepWarm;
+  probe_alarm_reset_state(probeIndex);
+  probe_alarm_save();
+
+  Serial.printf("Probe %d alarms: target=%.0f°F high=%.0f°F low=%.0f°F hyst=%.1f°F keepWarm=%s\n",
+                probeIndex + 1, target, high, low, probe.alarmHysteresis, keepWarm ? "YES" : "NO");
+  return true;
+}
+
+void probe_alarm_set_keep_warm_setpoint(double temp) {
+  keepWarmSetpoint = constrain(temp, MIN_SETPOINT, MAX_SETPOINT);
+  probe_alarm_save();
+  Serial.printf("Keep-warm setpoint set to %.0f°F\n", keepWarmSetpoint);
+}
+
+double probe_alarm_get_keep_warm_setpoint() {
+  return keepWarmSetpoint;
+}
+
+uint32_t probe_alarm_get_sequence() {
+  return lastEventSeq;
+}
+
+uint8_t probe_alarm_get_active_mask() {
+  return activeMask;
+}
+
+void probe_alarm_acknowledge() {
+  activeMask = 0;
+  Serial.println("Probe alarms acknowledged");
+}
+
+String probe_alarm_get_active_text() {
+  for (int i = 0; i < MAX_PROBES; i++) {
+    if (!(activeMask & (1 << i))) continue;
+
+    const char* what = "ALARM";
+    if (alarmState[i].targetLatched) what = "DONE";
+    else if (alarmState[i].highLatched) what = "HIGH";
+    else if (alarmState[i].lowLatched) what = "LOW";
+    return "P" + String(i + 1) + " " + what + " " + String(readProbeTemperature(i + 1), 0) + "F";
+  }
+  return "";
+}
+
+String probe_alarm_type_string(ProbeAlarmType type) {
+  switch (type) {
+    case PROBE_ALARM_TARGET: return "TARGET";
+    case PROBE_ALARM_HIGH: return "HIGH";
+    case PROBE_ALARM_LOW: return "LOW";
+    case PROBE_ALARM_CLEARED: return "CLEARED";
+    case PROBE_ALARM_KEEP_WARM: return "KEEP_WARM";
+    default: return "NONE";
+  }
+}
+
+String probe_alarm_get_events_json(uint32_t sinceSeq) {
+  String json = "{\"seq\":" + String(lastEventSeq) + ",";
+  json += "\"active\":" + String(activeMask) + ",";
+  json += "\"events\":[";
+
+  // Walk oldest to newest among the retained events
+  uint32_t first = lastEventSeq > PROBE_ALARM_EVENT_COUNT ? lastEventSeq - PROBE_ALARM_EVENT_COUNT + 1 : 1;
+  if (first <= sinceSeq) first = sinceSeq + 1;
+  bool firstItem = true;
+  for (uint32_t seq = first; seq <= lastEventSeq; seq++) {
+    const ProbeAlarmEvent& ev = events[seq % PROBE_ALARM_EVENT_COUNT];
+    if (ev.seq != seq) continue;
+
+    if (!firstItem) json += ",";
+    firstItem = false;
+    json += "{\"seq\":" + String(ev.seq) + ",";
+    json += "\"probe\":" + String(ev.probe + 1) + ",";
+    json += "\"type\":\"" + probe_alarm_type_string(ev.type) + "\",";
+    json += "\"temp\":" + String(ev.temperature, 1) + ",";
+    json += "\"age\":" + String((unsigned long)(clock_elapsed_ms(ev.timestamp) / 1000)) + "}";
+  }
+
+  json += "]}";
+  return json;
+}
+
+String probe_alarm_get_config_json() {
+  String json = "{\"keepWarm\":" + String(keepWarmSetpoint, 0) + ",\"probes\":[";
+  for (int i = 0; i < MAX_PROBES; i++) {
+    const ProbeConfig& probe = tempSensor.probes[i];
+    if (i > 0) json += ",";
+    json += "{\"probe\":" + String(i + 1) + ",";
+    json += "\"target\":" + String(probe.targetTemp, 0) + ",";
+    json += "\"high\":" + String(probe.alarmHigh, 0) + ",";
+    json += "\"low\":" + String(probe.alarmLow, 0) + ",";
+    json += "\"hyst\":" + String(probe.alarmHysteresis, 1) + ",";
+    json += "\"keepWarm\":" + String(probe.keepWarmOnTarget ? "true" : "false") + "}";
+  }
+  json += "]}";
+  return json;
+}
+
+void probe_alarm_save() {
+  char key[16];
+  preferences.begin("probes", false);
+  preferences.putFloat("keepWarm", keepWarmSetpoint);
+  for (int i = 0; i < MAX_PROBES; i++) {
+    const ProbeConfig& probe = tempSensor.probes[i];
+    snprintf(key, sizeof(key), "p%d_target", i);
+    preferences.putFloat(key, probe.targetTemp);
+    snprintf(key, sizeof(key), "p%d_high", i);
+    preferences.putFloat(key, probe.alarmHigh);
+    snprintf(key, sizeof(key), "p%d_low", i);
+    preferences.putFloat(key, probe.alarmLow);
+    snprintf(key, sizeof(key), "p%d_hyst", i);
+    preferences.putFloat(key, probe.alarmHysteresis);
+    snprintf(key, sizeof(key), "p%d_warm", i);
+    preferences.putBool(key, probe.keepWarmOnTarget);
+  }
+  preferences.end();
+  Serial.println("Probe alarm settings saved to flash");
+}
+
+void probe_alarm_load() {
+  char key[16];
+  preferences.begin("probes", true);
+  keepWarmSetpoint = preferences.getFloat("keepWarm", KEEP_WARM_SETPOINT_DEFAULT);
+  for (int i = 0; i < MAX_PROBES; i++) {
+    ProbeConfig& probe = tempSensor.probes[i];
+    snprintf(key, sizeof(key), "p%d_target", i);
+    probe.targetTemp = preferences.getFloat(key, 0.0);
+    snprintf(key, sizeof(key), "p%d_high", i);
+    probe.alarmHigh = preferences.getFloat(key, 0.0);
+    snprintf(key, sizeof(key), "p%d_low", i);
+    probe.alarmLow = preferences.getFloat(key, 0.0);
+    snprintf(key, sizeof(key), "p%d_hyst", i);
+    probe.alarmHysteresis = preferences.getFloat(key, 2.0);
+    snprintf(key, sizeof(key), "p%d_warm", i);
+    probe.keepWarmOnTarget = preferences.getBool(key, false);
+  }
+  preferences.end();
+  Serial.println("Probe alarm settings loaded from flash");
+}
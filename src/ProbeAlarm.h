@@ -0,0 +1,70 @@
+// ProbeAlarm.h - Meat probe cook targets, alarms and keep-warm handoff
+#ifndef PROBEALARM_H
+#define PROBEALARM_H
+
+#include <Arduino.h>
+#include "TemperatureSensor.h"
+
+// Keep-warm setpoint used when a target probe finishes the cook
+#define KEEP_WARM_SETPOINT_DEFAULT 165.0
+
+// Number of recent alarm events kept for web clients
+#define PROBE_ALARM_EVENT_COUNT 16
+
+// Alarm event types
+enum ProbeAlarmType {
+  PROBE_ALARM_NONE = 0,
+  PROBE_ALARM_TARGET,     // Probe reached its cook target
+  PROBE_ALARM_HIGH,       // Probe rose to its high alarm
+  PROBE_ALARM_LOW,        // Probe fell to its low alarm
+  PROBE_ALARM_CLEARED,    // Probe retreated past hysteresis, alarm re-armed
+  PROBE_ALARM_KEEP_WARM   // Grill dropped to keep-warm setpoint
+};
+
+// Alarm event record
+struct ProbeAlarmEvent {
+  uint32_t seq;           // Monotonic event number (0 = empty slot)
+  uint8_t probe;          // Probe index (0-3)
+  ProbeAlarmType type;
+  float temperature;      // Probe temperature when the event fired
+  uint64_t timestamp;
+};
+
+// One probe's cook target and alarms, as posted by /set_probe_target
+struct ProbeTargetRequest {
+  uint8_t probe;          // Probe index (0-3)
+  float target;
+  float high;
+  float low;
+  float hysteresis;
+  bool keepWarm;
+};
+
+// Alarm control functions
+void probe_alarm_init();
+void probe_alarm_update();   // Control task, once per sample - reads the sensor snapshot only
+
+// Configuration, control task only - web handlers post CMD_SET_PROBE_TARGET,
+// CMD_PROBE_ALARM_ACK or the keepWarm setting (probeIndex 0-3, thresholds of 0
+// disable that alarm)
+bool probe_alarm_configure(int probeIndex, float target, float high, float low,
+                           float hysteresis, bool keepWarm);
+void probe_alarm_set_keep_warm_setpoint(double temp);
+double probe_alarm_get_keep_warm_setpoint();
+
+// Status
+uint32_t probe_alarm_get_sequence();    // Latest event sequence number
+uint8_t probe_alarm_get_active_mask();  // Bit per probe with an unacknowledged alarm
+void probe_alarm_acknowledge();         // Control task only
+String probe_alarm_get_active_text();   // Short text for OLED, empty if none
+String probe_alarm_type_string(ProbeAlarmType type);
+
+// Web interface
+String probe_alarm_get_events_json(uint32_t sinceSeq);
+String probe_alarm_get_config_json();
+
+// Persistence
+void probe_alarm_save();
+void probe_alarm_load();
+
+#endif // PROBEALARM_H
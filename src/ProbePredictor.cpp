@@ -0,0 +1,148 @@
+// ProbePredictor.cpp - Online Newton-cooling fit of probe temperature against pit temperature
+//
+// Model: dT/dt = k * (Tpit - T). Every PREDICTOR_STEP_SECONDS the smoothed rate of rise
+// and the pit/probe difference update exponentially weighted sums, and k is the
+// least-squares slope through the origin. Time to target then follows from the
+// closed-form solution: t = ln((Tpit - T) / (Tpit - Ttarget)) / k.
+#include "ProbePredictor.h"
+#include <math.h>
+
+static ProbePredictorState predictors[MAX_PROBES];
+
+static const float TEMP_SMOOTHING = 0.2;  // Per-sample EWMA weight
+static const float RATE_SMOOTHING = 0.3;  // Per-step EWMA weight
+
+void probe_predictor_reset(int probeIndex) {
+  if (probeIndex < 0 || probeIndex >= MAX_PROBES) return;
+
+  ProbePredictorState& state = predictors[probeIndex];
+  state.primed = false;
+  state.smoothTemp = 0.0;
+  state.smoothPit = 0.0;
+  state.stepStartTemp = 0.0;
+  state.stepElapsed = 0.0;
+  state.rate = 0.0;
+  state.sxx = 0.0;
+  state.sxy = 0.0;
+  state.steps = 0;
+  state.stalled = false;
+  state.etaSeconds = -1;
+}
+
+void probe_predictor_init() {
+  for (int i = 0; i < MAX_PROBES; i++) {
+    probe_predictor_reset(i);
+  }
+  Serial.println("Probe finish-time predictor initialized");
+}
+
+void probe_predictor_step(ProbePredictorState* state, float probeTemp, float pitTemp,
+                          float target, float dtSeconds) {
+  if (!state->primed) {
+    state->primed = true;
+    state->smoothTemp = probeTemp;
+    state->smoothPit = pitTemp;
+    state->stepStartTemp = probeTemp;
+    state->stepElapsed = 0.0;
+    state->steps = 0;
+    state->etaSeconds = -1;
+    return;
+  }
+
+  state->smoothTemp += TEMP_SMOOTHING * (probeTemp - state->smoothTemp);
+  state->smoothPit += TEMP_SMOOTHING * (pitTemp - state->smoothPit);
+  state->stepElapsed += dtSeconds;
+
+  if (state->stepElapsed < PREDICTOR_STEP_SECONDS) return;
+
+  // Rate of rise over this step
+  float hours = state->stepElapsed / 3600.0;
+  float stepRate = (state->smoothTemp - state->stepStartTemp) / hours;
+  state->rate = (state->steps == 0) ? stepRate : state->rate + RATE_SMOOTHING * (stepRate - state->rate);
+
+  // Windowed least-squares fit of rate = k * (pit - probe)
+  float drive = state->smoothPit - state->smoothTemp;
+  state->sxx *= PREDICTOR_FORGET;
+  state->sxy *= PREDICTOR_FORGET;
+  if (drive > 5.0) {
+    state->sxx += drive * drive;
+    state->sxy += drive * stepRate;
+  }
+
+  state->steps++;
+  state->stepStartTemp = state->smoothTemp;
+  state->stepElapsed = 0.0;
+
+  // Stall: rise flattens out inside the collagen band
+  bool inBand = state->smoothTemp >= PREDICTOR_STALL_MIN_TEMP &&
+                state->smoothTemp <= PREDICTOR_STALL_MAX_TEMP;
+  if (!state->stalled) {
+    if (state->steps >= PREDICTOR_MIN_STEPS && inBand && state->rate < PREDICTOR_STALL_ENTER) {
+      state->stalled = true;
+    }
+  } else if (!inBand || state->rate > PREDICTOR_STALL_EXIT) {
+    state->stalled = false;
+  }
+
+  // Time to target
+  state->etaSeconds = -1;
+  if (target <= 0.0 || state->steps < PREDICTOR_MIN_STEPS) return;
+
+  if (state->smoothTemp >= target) {
+    state->etaSeconds = 0;
+    return;
+  }
+
+  float k = (state->sxx > 0.0) ? state->sxy / state->sxx : 0.0;
+  float pitMargin = state->smoothPit - target;
+  if (k <= 0.0 || pitMargin < 1.0) return;  // Pit can't carry the probe to target
+
+  float etaHours = logf((state->smoothPit - state->smoothTemp) / pitMargin) / k;
+  if (etaHours > 0.0 && etaHours < 48.0) {
+    state->etaSeconds = (long)(etaHours * 3600.0);
+  }
+}
+
+void probe_predictor_update(double pitTemp, const float* probeTemps, const bool* probeValid, float dtSeconds) {
+  for (int i = 0; i < MAX_PROBES; i++) {
+    // Start over whenever the probe drops out - a reinserted probe is a new curve
+    if (!probeValid[i]) {
+      if (predictors[i].primed) probe_predictor_reset(i);
+      continue;
+    }
+
+    probe_predictor_step(&predictors[i], probeTemps[i], pitTemp, tempSensor.probes[i].targetTemp, dtSeconds);
+  }
+}
+
+long probe_predictor_get_eta(int probeIndex) {
+  if (probeIndex < 0 || probeIndex >= MAX_PROBES) return -1;
+  return predictors[probeIndex].etaSeconds;
+}
+
+bool probe_predictor_is_stalled(int probeIndex) {
+  if (probeIndex < 0 || probeIndex >= MAX_PROBES) return false;
+  return predictors[probeIndex].stalled;
+}
+
+float probe_predictor_get_rate(int probeIndex) {
+  if (probeIndex < 0 || probeIndex >= MAX_PROBES) return 0.0;
+  return predictors[probeIndex].rate;
+}
+
+float probe_predictor_get_k(int probeIndex) {
+  if (probeIndex < 0 || probeIndex >= MAX_PROBES) return 0.0;
+  const ProbePredictorState& state = predictors[probeIndex];
+  return (state.sxx > 0.0) ? state.sxy / state.sxx : 0.0;
+}
+
+String probe_predictor_format_eta(long etaSeconds) {
+  if (etaSeconds < 0) return "--";
+  if (etaSeconds == 0) return "DONE";
+
+  unsigned long minutes = (etaSeconds + 59) / 60;
+  if (minutes >= 60) {
+    return String(minutes / 60) + "h" + String(minutes % 60) + "m";
+  }
+  return String(minutes) + "m";
+}
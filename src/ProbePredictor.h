@@ -0,0 +1,48 @@
+// ProbePredictor.h - Meat probe finish-time estimator with stall detection
+#ifndef PROBEPREDICTOR_H
+#define PROBEPREDICTOR_H
+
+#include <Arduino.h>
+#include "TemperatureSensor.h"
+
+// Estimator tuning
+#define PREDICTOR_STEP_SECONDS   30.0   // Rate/fit update interval
+#define PREDICTOR_MIN_STEPS      6      // Steps before an ETA is reported (3 minutes)
+#define PREDICTOR_FORGET         0.95   // Exponential window for the cooling fit (~10 minutes)
+#define PREDICTOR_STALL_MIN_TEMP 145.0  // Collagen stall band
+#define PREDICTOR_STALL_MAX_TEMP 180.0
+#define PREDICTOR_STALL_ENTER    3.0    // °F/hr rise below which we call it a stall
+#define PREDICTOR_STALL_EXIT     6.0    // °F/hr rise that ends the stall
+
+// Per-probe estimator state - constant size, no sample history
+struct ProbePredictorState {
+  bool primed;
+  float smoothTemp;    // EWMA probe temperature
+  float smoothPit;     // EWMA pit temperature
+  float stepStartTemp; // smoothTemp at the start of the current step
+  float stepElapsed;   // Seconds accumulated in the current step
+  float rate;          // Smoothed rate of rise, °F/hr
+  float sxx, sxy;      // Weighted sums for the Newton cooling fit
+  uint16_t steps;
+  bool stalled;
+  long etaSeconds;     // -1 = unknown, 0 = at target
+};
+
+// Estimator functions
+void probe_predictor_init();
+void probe_predictor_update(double pitTemp, const float* probeTemps,   // Once per control cycle, with
+                            const bool* probeValid, float dtSeconds);  // the sensor snapshot's probes
+void probe_predictor_reset(int probeIndex);
+
+// Core step (pure - no sensor access), exposed for offline replay of cook traces
+void probe_predictor_step(ProbePredictorState* state, float probeTemp, float pitTemp,
+                          float target, float dtSeconds);
+
+// Status
+long probe_predictor_get_eta(int probeIndex);       // Seconds, -1 if unknown
+bool probe_predictor_is_stalled(int probeIndex);
+float probe_predictor_get_rate(int probeIndex);     // °F/hr
+float probe_predictor_get_k(int probeIndex);        // Fitted cooling coefficient, 1/hr
+String probe_predictor_format_eta(long etaSeconds); // "2h15m", "45m", "--"
+
+#endif // PROBEPREDICTOR_H
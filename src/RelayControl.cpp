@@ -1,150 +1,356 @@
-// RelayControl.cpp - Simplified version with auger debugging removed
+// RelayControl.cpp - Single-owner relay task with prioritized request arbitration
+//
+// Producers (control loop, web handlers, OTA callback) never touch the relay
+// GPIOs. They post RelayRequests tagged with a source into a lock-free queue
+// and wake the relay task. The relay task is the only writer: it folds queued
+// requests into one layer per source, merges the layers channel by channel
+// (emergency > safety > manual > auto), runs the interlock rules over the
+// result and applies it with one GPIO.out_w1ts and one GPIO.out_w1tc write
+// per commit.
 #include "RelayControl.h"
 #include "Globals.h"
+#include "LockFreeQueue.h"
+#include "RelaySafety.h"
+#include "RelayStats.h"
+#include "Clock.h"
+#include "Metrics.h"
+#include "soc/gpio_struct.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 
-// Simple state tracking
-static bool igniterState = false;
-static bool augerState = false;
-static bool hopperState = false;
-static bool blowerState = false;
-static bool manualOverrideActive = false;
-static unsigned long manualOverrideTimeout = 0;
+static_assert(RELAY_IGNITER_PIN < 32 && RELAY_AUGER_PIN < 32 &&
+              RELAY_HOPPER_FAN_PIN < 32 && RELAY_BLOWER_FAN_PIN < 32,
+              "Relay pins must be in GPIO bank 0 for single-register commits");
+
+// Queued message
+enum RelayOp : uint8_t {
+  RELAY_OP_REQUEST,   // Merge request into the source layer
+  RELAY_OP_CLEAR      // Drop the source layer (manual/safety release)
+};
+
+struct RelayMessage {
+  RelayRequest request;
+  uint8_t source;
+  uint8_t op;
+};
+
+static LockFreeQueue<RelayMessage, RELAY_QUEUE_SIZE> relayQueue;
+static TaskHandle_t relayTaskHandle = NULL;
+static TaskHandle_t fallbackTaskHandle = NULL;   // setup()/loop() task - consumes while the relay task is missing
+static std::atomic<bool> emergencyPending(false);
+
+// Per-source layers - only touched by the relay task
+static RelayRequest autoLayer;
+static RelayRequest manualLayer;
+static RelayRequest safetyLayer;
+
+// Per-source counters
+struct RelaySourceCounters {
+  std::atomic<uint32_t> posted;
+  std::atomic<uint32_t> dropped;
+  uint32_t applied;
+};
+static RelaySourceCounters sourceCounters[RELAY_SOURCE_COUNT];
+static uint32_t commitCount = 0;
+static uint32_t queueHighWater = 0;
+
+// Committed state - written by the relay task, read anywhere
+static volatile bool igniterState = false;
+static volatile bool augerState = false;
+static volatile bool hopperState = false;
+static volatile bool blowerState = false;
+static volatile uint8_t blowerDuty = 100;  // PWM duty applied while the blower relay is on
+static uint64_t augerOnSince = 0;
+static uint64_t augerRuntimeMs = 0;  // Accumulated auger on-time since boot
+static portMUX_TYPE augerRuntimeMux = portMUX_INITIALIZER_UNLOCKED;  // 64-bit counter read from other tasks
+static volatile bool manualOverrideActive = false;
+static volatile uint64_t manualOverrideTimeout = 0;
 static const unsigned long MANUAL_OVERRIDE_DURATION = 300000; // 5 minutes timeout
 
+static const char* SOURCE_NAMES[RELAY_SOURCE_COUNT] = {"emergency", "safety", "manual", "auto"};
+
+// Drive the blower PWM output from the committed relay state and duty
+static void relay_write_blower_pwm() {
+#if BLOWER_PWM_ENABLED
+  uint32_t maxDuty = (1 << BLOWER_PWM_RESOLUTION) - 1;
+  uint32_t duty = blowerState ? (maxDuty * blowerDuty) / 100 : 0;
+  ledcWrite(BLOWER_PWM_CHANNEL, duty);
+#endif
+}
+
+// Accumulate auger on-time across every path that changes the auger state
+static void relay_track_auger(bool newState) {
+  portENTER_CRITICAL(&augerRuntimeMux);
+  if (newState && !augerState) {
+    augerOnSince = clock_ms();
+  } else if (!newState && augerState) {
+    augerRuntimeMs += clock_ms() - augerOnSince;
+  }
+  augerState = newState;
+  portEXIT_CRITICAL(&augerRuntimeMux);
+}
+
+static void relay_layer_reset(RelayRequest* layer) {
+  layer->igniter = RELAY_NOCHANGE;
+  layer->auger = RELAY_NOCHANGE;
+  layer->hopperFan = RELAY_NOCHANGE;
+  layer->blowerFan = RELAY_NOCHANGE;
+  layer->blowerDuty = 0;
+  layer->setBlowerDuty = false;
+}
+
+static void relay_layer_all_off(RelayRequest* layer) {
+  layer->igniter = RELAY_OFF;
+  layer->auger = RELAY_OFF;
+  layer->hopperFan = RELAY_OFF;
+  layer->blowerFan = RELAY_OFF;
+}
+
+static void relay_layer_merge(RelayRequest* layer, const RelayRequest* request) {
+  if (request->igniter != RELAY_NOCHANGE) layer->igniter = request->igniter;
+  if (request->auger != RELAY_NOCHANGE) layer->auger = request->auger;
+  if (request->hopperFan != RELAY_NOCHANGE) layer->hopperFan = request->hopperFan;
+  if (request->blowerFan != RELAY_NOCHANGE) layer->blowerFan = request->blowerFan;
+  if (request->setBlowerDuty) {
+    layer->blowerDuty = min(request->blowerDuty, (uint8_t)100);
+    layer->setBlowerDuty = true;
+  }
+}
+
+// Highest-priority layer with an opinion wins; auto always has one
+static bool relay_arbitrate(RelayState safety, RelayState manual, RelayState autoState) {
+  if (safety != RELAY_NOCHANGE) return safety == RELAY_ON;
+  if (manualOverrideActive && manual != RELAY_NOCHANGE) return manual == RELAY_ON;
+  return autoState == RELAY_ON;
+}
+
+static void relay_handle_message(const RelayMessage& msg) {
+  switch (msg.source) {
+    case RELAY_SOURCE_AUTO:
+      relay_layer_merge(&autoLayer, &msg.request);
+      break;
+
+    case RELAY_SOURCE_MANUAL:
+      if (msg.op == RELAY_OP_CLEAR) {
+        if (manualOverrideActive) Serial.println("Manual override cleared");
+        manualOverrideActive = false;
+        manualOverrideTimeout = 0;
+        relay_layer_reset(&manualLayer);
+      } else {
+        if (!manualOverrideActive) Serial.println("Manual control activated");
+        manualOverrideActive = true;
+        manualOverrideTimeout = clock_ms() + MANUAL_OVERRIDE_DURATION;
+        relay_layer_merge(&manualLayer, &msg.request);
+      }
+      break;
+
+    case RELAY_SOURCE_SAFETY:
+      if (msg.op == RELAY_OP_CLEAR) {
+        relay_layer_reset(&safetyLayer);
+      } else {
+        relay_layer_merge(&safetyLayer, &msg.request);
+      }
+      break;
+  }
+  sourceCounters[msg.source].applied++;
+}
+
+static void relay_commit() {
+  uint32_t depth = relayQueue.size();
+  if (depth > queueHighWater) queueHighWater = depth;
+
+  RelayMessage msg;
+  while (relayQueue.pop(msg)) {
+    relay_handle_message(msg);
+  }
+
+  // Emergency outranks everything posted in the same batch
+  if (emergencyPending.exchange(false)) {
+    Serial.println("EMERGENCY STOP - All relays OFF");
+    relay_layer_all_off(&autoLayer);
+    relay_layer_reset(&manualLayer);
+    manualOverrideActive = false;
+    manualOverrideTimeout = 0;
+    sourceCounters[RELAY_SOURCE_EMERGENCY].applied++;
+  }
+
+  // Manual override timeout hands control back to the auto layer
+  if (manualOverrideActive && clock_expired(manualOverrideTimeout)) {
+    Serial.println("Manual override timeout - returning to auto control");
+    manualOverrideActive = false;
+    manualOverrideTimeout = 0;
+    relay_layer_reset(&manualLayer);
+  }
+
+  bool ign = relay_arbitrate(safetyLayer.igniter, manualLayer.igniter, autoLayer.igniter);
+  bool aug = relay_arbitrate(safetyLayer.auger, manualLayer.auger, autoLayer.auger);
+  bool hop = relay_arbitrate(safetyLayer.hopperFan, manualLayer.hopperFan, autoLayer.hopperFan);
+  bool blo = relay_arbitrate(safetyLayer.blowerFan, manualLayer.blowerFan, autoLayer.blowerFan);
+
+  // Interlocks run on every commit, whatever the source
+  RelayOutputs outputs = {ign, aug, hop, blo};
+  relay_safety_enforce(&outputs);
+  ign = outputs.igniter;
+  aug = outputs.auger;
+  hop = outputs.hopperFan;
+  blo = outputs.blowerFan;
+
+  // Wear and duty telemetry sees every commit, changed or not
+  bool states[RELAY_CH_COUNT] = {ign, aug, hop, blo};
+  relay_stats_record(states);
+
+  uint8_t duty = autoLayer.blowerDuty;
+  if (safetyLayer.setBlowerDuty) duty = safetyLayer.blowerDuty;
+  else if (manualOverrideActive && manualLayer.setBlowerDuty) duty = manualLayer.blowerDuty;
+
+  if (ign == igniterState && aug == augerState && hop == hopperState &&
+      blo == blowerState && duty == blowerDuty) {
+    return;
+  }
+
+  // One register write per direction
+  uint32_t setMask = 0;
+  uint32_t clearMask = 0;
+  (ign ? setMask : clearMask) |= (1UL << RELAY_IGNITER_PIN);
+  (aug ? setMask : clearMask) |= (1UL << RELAY_AUGER_PIN);
+  (hop ? setMask : clearMask) |= (1UL << RELAY_HOPPER_FAN_PIN);
+  (blo ? setMask : clearMask) |= (1UL << RELAY_BLOWER_FAN_PIN);
+  GPIO.out_w1ts = setMask;
+  GPIO.out_w1tc = clearMask;
+
+  relay_track_auger(aug);
+  igniterState = ign;
+  hopperState = hop;
+  blowerState = blo;
+  blowerDuty = duty;
+  relay_write_blower_pwm();
+  commitCount++;
+}
+
+static void relay_task(void* param) {
+  for (;;) {
+    // Woken by producers; the timeout keeps the manual override timer running
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(RELAY_TASK_PERIOD_MS));
+    relay_commit();
+  }
+}
+
+// Wake the owner. The queue has a single consumer, so without a relay task
+// (during setup, or if it failed to start) only the setup/loop task commits;
+// other producers leave their request for relay_update() on the next loop.
+static void relay_kick() {
+  if (relayTaskHandle != NULL) {
+    xTaskNotifyGive(relayTaskHandle);
+  } else if (xTaskGetCurrentTaskHandle() == fallbackTaskHandle) {
+    relay_commit();
+  }
+}
+
+static void relay_post(RelaySource source, RelayOp op, const RelayRequest* request) {
+  RelayMessage msg;
+  if (request != NULL) {
+    msg.request = *request;
+  } else {
+    relay_layer_reset(&msg.request);
+  }
+  msg.source = source;
+  msg.op = op;
+
+  sourceCounters[source].posted++;
+  if (!relayQueue.push(msg)) {
+    sourceCounters[source].dropped++;
+    Serial.printf("⚠️ Relay queue full - %s request dropped\n", SOURCE_NAMES[source]);
+  }
+  relay_kick();
+}
+
 void relay_init() {
   Serial.println("Initializing relay control...");
-  
+  fallbackTaskHandle = xTaskGetCurrentTaskHandle();
+
   // Initialize all relay pins as outputs
   pinMode(RELAY_IGNITER_PIN, OUTPUT);
   pinMode(RELAY_AUGER_PIN, OUTPUT);
   pinMode(RELAY_HOPPER_FAN_PIN, OUTPUT);
   pinMode(RELAY_BLOWER_FAN_PIN, OUTPUT);
-  
+
   // Start with all relays off
   digitalWrite(RELAY_IGNITER_PIN, LOW);
   digitalWrite(RELAY_AUGER_PIN, LOW);
   digitalWrite(RELAY_HOPPER_FAN_PIN, LOW);
   digitalWrite(RELAY_BLOWER_FAN_PIN, LOW);
-  
+
   igniterState = false;
   augerState = false;
   hopperState = false;
   blowerState = false;
   manualOverrideActive = false;
   manualOverrideTimeout = 0;
-  
-  Serial.printf("✅ Relay pins initialized: IGN=%d, AUG=%d, HOP=%d, BLO=%d\n", 
+
+  relay_layer_reset(&autoLayer);
+  relay_layer_all_off(&autoLayer);
+  autoLayer.blowerDuty = 100;
+  autoLayer.setBlowerDuty = true;
+  relay_layer_reset(&manualLayer);
+  relay_layer_reset(&safetyLayer);
+  relay_safety_init();
+  relay_stats_init();
+
+#if BLOWER_PWM_ENABLED
+  ledcSetup(BLOWER_PWM_CHANNEL, BLOWER_PWM_FREQ, BLOWER_PWM_RESOLUTION);
+  ledcAttachPin(BLOWER_PWM_PIN, BLOWER_PWM_CHANNEL);
+  blowerDuty = 100;
+  relay_write_blower_pwm();
+  Serial.printf("✅ Blower PWM on GPIO%d (LEDC ch %d, %d Hz)\n", BLOWER_PWM_PIN, BLOWER_PWM_CHANNEL, BLOWER_PWM_FREQ);
+#endif
+
+  if (relayTaskHandle == NULL) {
+    BaseType_t created = xTaskCreatePinnedToCore(relay_task, "relay", RELAY_TASK_STACK, NULL,
+                                                 RELAY_TASK_PRIORITY, &relayTaskHandle, 1);
+    if (created != pdPASS) {
+      relayTaskHandle = NULL;
+      Serial.println("❌ Relay task creation failed - committing from loop()");
+    } else {
+      metrics_register_task("relay", relayTaskHandle);
+    }
+  }
+
+  Serial.printf("✅ Relay pins initialized: IGN=%d, AUG=%d, HOP=%d, BLO=%d\n",
                 RELAY_IGNITER_PIN, RELAY_AUGER_PIN, RELAY_HOPPER_FAN_PIN, RELAY_BLOWER_FAN_PIN);
 }
 
 void relay_update() {
-  // Check for manual override timeout
-  if (manualOverrideActive && millis() > manualOverrideTimeout) {
-    Serial.println("Manual override timeout - returning to auto control");
-    manualOverrideActive = false;
-    manualOverrideTimeout = 0;
+  // The relay task commits on its own; only fall back to loop() if it couldn't start
+  if (relayTaskHandle == NULL) {
+    relay_commit();
   }
 }
 
-void relay_commit() {
-  // Nothing needed in simple version
-}
-
 void relay_request_auto(RelayRequest* request) {
-  if (manualOverrideActive) {
-    Serial.println("Auto request ignored - manual override active");
-    return;
-  }
-  
-  // Apply the auto request directly
-  if (request->igniter != RELAY_NOCHANGE) {
-    bool newState = (request->igniter == RELAY_ON);
-    if (newState != igniterState) {
-      digitalWrite(RELAY_IGNITER_PIN, newState ? HIGH : LOW);
-      igniterState = newState;
-    }
-  }
-  
-  if (request->auger != RELAY_NOCHANGE) {
-    bool newState = (request->auger == RELAY_ON);
-    if (newState != augerState) {
-      digitalWrite(RELAY_AUGER_PIN, newState ? HIGH : LOW);
-      augerState = newState;
-    }
-  }
-  
-  if (request->hopperFan != RELAY_NOCHANGE) {
-    bool newState = (request->hopperFan == RELAY_ON);
-    if (newState != hopperState) {
-      digitalWrite(RELAY_HOPPER_FAN_PIN, newState ? HIGH : LOW);
-      hopperState = newState;
-    }
-  }
-  
-  if (request->blowerFan != RELAY_NOCHANGE) {
-    bool newState = (request->blowerFan == RELAY_ON);
-    if (newState != blowerState) {
-      digitalWrite(RELAY_BLOWER_FAN_PIN, newState ? HIGH : LOW);
-      blowerState = newState;
-    }
-  }
+  relay_post(RELAY_SOURCE_AUTO, RELAY_OP_REQUEST, request);
 }
 
 void relay_request_manual(RelayRequest* request) {
-  manualOverrideActive = true;
-  manualOverrideTimeout = millis() + MANUAL_OVERRIDE_DURATION;
-  Serial.println("Manual control activated");
-  
-  // Apply manual request immediately
-  if (request->igniter != RELAY_NOCHANGE) {
-    bool newState = (request->igniter == RELAY_ON);
-    digitalWrite(RELAY_IGNITER_PIN, newState ? HIGH : LOW);
-    igniterState = newState;
-  }
-  
-  if (request->auger != RELAY_NOCHANGE) {
-    bool newState = (request->auger == RELAY_ON);
-    digitalWrite(RELAY_AUGER_PIN, newState ? HIGH : LOW);
-    augerState = newState;
-  }
-  
-  if (request->hopperFan != RELAY_NOCHANGE) {
-    bool newState = (request->hopperFan == RELAY_ON);
-    digitalWrite(RELAY_HOPPER_FAN_PIN, newState ? HIGH : LOW);
-    hopperState = newState;
-  }
-  
-  if (request->blowerFan != RELAY_NOCHANGE) {
-    bool newState = (request->blowerFan == RELAY_ON);
-    digitalWrite(RELAY_BLOWER_FAN_PIN, newState ? HIGH : LOW);
-    blowerState = newState;
-  }
+  relay_post(RELAY_SOURCE_MANUAL, RELAY_OP_REQUEST, request);
+}
+
+void relay_request_safety(RelayRequest* request) {
+  relay_post(RELAY_SOURCE_SAFETY, RELAY_OP_REQUEST, request);
+}
+
+void relay_clear_safety() {
+  relay_post(RELAY_SOURCE_SAFETY, RELAY_OP_CLEAR, NULL);
 }
 
 void relay_clear_manual() {
-  manualOverrideActive = false;
-  manualOverrideTimeout = 0;
-  Serial.println("Manual override cleared");
+  relay_post(RELAY_SOURCE_MANUAL, RELAY_OP_CLEAR, NULL);
 }
 
 void relay_emergency_stop() {
-  Serial.println("EMERGENCY STOP - All relays OFF");
-  
-  // Turn off all relays immediately
-  digitalWrite(RELAY_IGNITER_PIN, LOW);
-  digitalWrite(RELAY_AUGER_PIN, LOW);
-  digitalWrite(RELAY_HOPPER_FAN_PIN, LOW);
-  digitalWrite(RELAY_BLOWER_FAN_PIN, LOW);
-  
-  // Update state tracking
-  igniterState = false;
-  augerState = false;
-  hopperState = false;
-  blowerState = false;
-  
-  // Clear manual override in emergency
-  manualOverrideActive = false;
-  manualOverrideTimeout = 0;
+  // Flag rather than queue so an emergency can never be dropped on a full queue
+  sourceCounters[RELAY_SOURCE_EMERGENCY].posted++;
+  emergencyPending = true;
+  relay_kick();
 }
 
 void relay_clear_emergency() {
@@ -152,7 +358,7 @@ void relay_clear_emergency() {
 }
 
 bool relay_is_safe_state() {
-  return true; // Simple version always returns true
+  return relay_safety_get_trip_mask() == 0;
 }
 
 void relay_print_status() {
@@ -160,11 +366,45 @@ void relay_print_status() {
   Serial.printf("Igniter: %s\n", igniterState ? "ON" : "OFF");
   Serial.printf("Auger: %s\n", augerState ? "ON" : "OFF");
   Serial.printf("Hopper Fan: %s\n", hopperState ? "ON" : "OFF");
-  Serial.printf("Blower Fan: %s\n", blowerState ? "ON" : "OFF");
+  Serial.printf("Blower Fan: %s (duty %d%%%s)\n", blowerState ? "ON" : "OFF", blowerDuty,
+                BLOWER_PWM_ENABLED ? "" : ", PWM disabled");
   Serial.printf("Manual Override: %s\n", manualOverrideActive ? "ACTIVE" : "INACTIVE");
+  uint8_t tripMask = relay_safety_get_trip_mask();
+  Serial.printf("Interlocks: %s\n", tripMask ? "TRIPPED" : "OK");
+  for (int i = 0; i < SAFETY_RULE_COUNT; i++) {
+    if (tripMask & (1 << i)) Serial.printf("  🛑 %s\n", relay_safety_rule_name(i));
+  }
+  Serial.printf("Relay Task: %s, %lu commits, queue %lu/%lu (high %lu)\n",
+                relayTaskHandle != NULL ? "RUNNING" : "INLINE", (unsigned long)commitCount,
+                (unsigned long)relayQueue.size(), (unsigned long)relayQueue.capacity(),
+                (unsigned long)queueHighWater);
+  for (int i = 0; i < RELAY_SOURCE_COUNT; i++) {
+    Serial.printf("  %-9s posted=%lu applied=%lu dropped=%lu\n", SOURCE_NAMES[i],
+                  (unsigned long)sourceCounters[i].posted.load(), (unsigned long)sourceCounters[i].applied,
+                  (unsigned long)sourceCounters[i].dropped.load());
+  }
+  relay_stats_print();
   Serial.println("===================\n");
 }
 
+String relay_get_queue_json() {
+  String json = "{\"task\":" + String(relayTaskHandle != NULL ? "true" : "false") + ",";
+  json += "\"commits\":" + String(commitCount) + ",";
+  json += "\"queueDepth\":" + String(relayQueue.size()) + ",";
+  json += "\"queueCapacity\":" + String(relayQueue.capacity()) + ",";
+  json += "\"queueHigh\":" + String(queueHighWater) + ",";
+  json += "\"sources\":[";
+  for (int i = 0; i < RELAY_SOURCE_COUNT; i++) {
+    if (i > 0) json += ",";
+    json += "{\"source\":\"" + String(SOURCE_NAMES[i]) + "\",";
+    json += "\"posted\":" + String(sourceCounters[i].posted.load()) + ",";
+    json += "\"applied\":" + String(sourceCounters[i].applied) + ",";
+    json += "\"dropped\":" + String(sourceCounters[i].dropped.load()) + "}";
+  }
+  json += "]}";
+  return json;
+}
+
 void relay_apply_state(RelayRequest* request) {
   if (manualOverrideActive) {
     relay_request_manual(request);
@@ -198,6 +438,29 @@ void relay_set_blower_fan(bool state) {
   relay_request_manual(&req);
 }
 
+void relay_set_blower_duty(uint8_t dutyPercent) {
+  RelayRequest req = {RELAY_NOCHANGE, RELAY_NOCHANGE, RELAY_NOCHANGE, RELAY_NOCHANGE};
+  req.blowerDuty = dutyPercent;
+  req.setBlowerDuty = true;
+  relay_request_manual(&req);
+}
+
+uint8_t relay_get_blower_duty() {
+  return blowerDuty;
+}
+
+// Auger runtime (feeds pellet accounting)
+bool relay_get_auger_state() {
+  return augerState;
+}
+
+uint64_t relay_get_auger_runtime_ms() {
+  portENTER_CRITICAL(&augerRuntimeMux);
+  uint64_t runtime = augerRuntimeMs + (augerState ? clock_ms() - augerOnSince : 0);
+  portEXIT_CRITICAL(&augerRuntimeMux);
+  return runtime;
+}
+
 // Status functions
 bool relay_get_manual_override_status() {
   return manualOverrideActive;
@@ -205,11 +468,11 @@ bool relay_get_manual_override_status() {
 
 unsigned long relay_get_manual_override_remaining() {
   if (!manualOverrideActive) return 0;
-  return (manualOverrideTimeout > millis()) ? (manualOverrideTimeout - millis()) / 1000 : 0;
+  uint64_t now = clock_ms();
+  return (manualOverrideTimeout > now) ? (manualOverrideTimeout - now) / 1000 : 0;
 }
 
 void relay_force_clear_manual() {
-  manualOverrideActive = false;
-  manualOverrideTimeout = 0;
+  relay_clear_manual();
   Serial.println("Manual override forcibly cleared");
 }
\ No newline at end of file
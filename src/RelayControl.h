@@ -11,12 +11,29 @@ enum RelayState {
   RELAY_NOCHANGE = 2  // Don't change current state
 };
 
+// Request sources, highest priority first
+enum RelaySource {
+  RELAY_SOURCE_EMERGENCY = 0,
+  RELAY_SOURCE_SAFETY,
+  RELAY_SOURCE_MANUAL,
+  RELAY_SOURCE_AUTO,
+  RELAY_SOURCE_COUNT
+};
+
+// Relay task
+#define RELAY_QUEUE_SIZE       16    // Pending requests (power of two)
+#define RELAY_TASK_STACK       3072
+#define RELAY_TASK_PRIORITY    5     // Above loop() so commits land promptly
+#define RELAY_TASK_PERIOD_MS   100   // Idle wake-up for the manual override timer
+
 // Relay request structure for coordinated control
 struct RelayRequest {
   RelayState igniter;
   RelayState auger;
   RelayState hopperFan;
   RelayState blowerFan;
+  uint8_t blowerDuty;   // Blower PWM duty 0-100%, committed with the relay states
+  bool setBlowerDuty;   // false = leave blower PWM unchanged
 };
 
 // Safety interlocks and timing
@@ -31,17 +48,19 @@ struct RelayTiming {
 // Relay control functions
 void relay_init();
 void relay_update();
-void relay_commit();
 void relay_clear_manual();
 
-// Request relay changes
+// Request relay changes - queued to the relay task, safe from any task
 void relay_request_auto(RelayRequest* request);
 void relay_request_manual(RelayRequest* request);
+void relay_request_safety(RelayRequest* request);
+void relay_clear_safety();
 
 // Safety and status
 bool relay_is_safe_state();
 void relay_emergency_stop();
 void relay_print_status();
+String relay_get_queue_json();   // Per-source request counters
 
 // Internal functions
 void relay_apply_state(RelayRequest* request);
@@ -53,4 +72,12 @@ void relay_set_auger(bool state);
 void relay_set_hopper_fan(bool state);
 void relay_set_blower_fan(bool state);
 
+// Blower PWM (committed together with the blower relay)
+void relay_set_blower_duty(uint8_t dutyPercent);
+uint8_t relay_get_blower_duty();
+
+// Auger runtime (includes the current on-period)
+bool relay_get_auger_state();
+uint64_t relay_get_auger_runtime_ms();
+
 #endif
\ No newline at end of file
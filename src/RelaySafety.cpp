@@ -0,0 +1,210 @@
+// RelaySafety.cpp - Relay interlock rule table
+//
+// relay_commit() hands the arbitrated outputs to relay_safety_enforce() before
+// they reach the GPIOs. Each rule is a fixed-cost check that can only switch
+// outputs off, so a commit costs O(rules) with no allocation, and no request
+// source - manual override included - can get past a tripped interlock.
+#include "RelaySafety.h"
+#include <math.h>
+#include "Clock.h"
+
+typedef bool (*RelaySafetyCheck)(RelaySafetyState* state, RelayOutputs* outputs,
+                                 float pitTemp, uint64_t now);
+
+static RelaySafetyState safetyState;
+static volatile float safetyPitTemp = NAN;
+static volatile uint32_t safetyPitTempTime = 0;  // Low 32 bits of the reading's clock_ms() - single-word, tear-free
+static const unsigned long SAFETY_TEMP_STALE_MS = 10000;  // Temperature older than this is unknown
+static const unsigned long AUGER_BUCKET_MS = SAFETY_AUGER_WINDOW_MS / SAFETY_AUGER_BUCKETS;
+
+// Over-temperature: latch igniter and auger off until the pit cools
+static bool rule_overtemp(RelaySafetyState* state, RelayOutputs* outputs, float pitTemp, uint64_t now) {
+  if (!isnan(pitTemp)) {
+    if (pitTemp >= SAFETY_OVERTEMP_TRIP) state->overTempLatched = true;
+    else if (pitTemp < SAFETY_OVERTEMP_RESET) state->overTempLatched = false;
+  }
+  if (!state->overTempLatched) return false;
+
+  outputs->igniter = false;
+  outputs->auger = false;
+  return true;
+}
+
+// Igniter continuous on-time: locked off until it is requested off once
+static bool rule_igniter_timeout(RelaySafetyState* state, RelayOutputs* outputs, float pitTemp, uint64_t now) {
+  if (!outputs->igniter) {
+    state->igniterLocked = false;
+    return false;
+  }
+  if (!state->igniterLocked && state->igniterWasOn &&
+      now - state->igniterOnSince >= SAFETY_IGNITER_MAX_ON_MS) {
+    state->igniterLocked = true;
+  }
+  if (!state->igniterLocked) return false;
+
+  outputs->igniter = false;
+  return true;
+}
+
+// Igniter in an already hot pit - an unknown temperature keeps the last verdict,
+// so a sensor that dies in a hot pit cannot re-enable the igniter
+static bool rule_igniter_hot(RelaySafetyState* state, RelayOutputs* outputs, float pitTemp, uint64_t now) {
+  if (!isnan(pitTemp)) state->pitHot = pitTemp > SAFETY_IGNITER_MAX_TEMP;
+  if (!outputs->igniter || !state->pitHot) return false;
+
+  outputs->igniter = false;
+  return true;
+}
+
+// Feeding a lit fire pot with no combustion air - lit until a valid reading says otherwise
+static bool rule_auger_no_blower(RelaySafetyState* state, RelayOutputs* outputs, float pitTemp, uint64_t now) {
+  if (!isnan(pitTemp)) state->pitLit = pitTemp >= SAFETY_LIT_TEMP;
+  if (!outputs->auger || outputs->blowerFan || !state->pitLit) return false;
+
+  outputs->auger = false;
+  return true;
+}
+
+// Auger duty ceiling over the rolling window
+static bool rule_auger_duty(RelaySafetyState* state, RelayOutputs* outputs, float pitTemp, uint64_t now) {
+  float duty = relay_safety_auger_duty(state);
+  if (state->augerDutyLatched && duty <= SAFETY_AUGER_RESUME_DUTY) {
+    state->augerDutyLatched = false;
+  } else if (!state->augerDutyLatched && duty >= SAFETY_AUGER_MAX_DUTY) {
+    state->augerDutyLatched = true;
+  }
+  if (!state->augerDutyLatched) return false;
+
+  outputs->auger = false;
+  return true;
+}
+
+// Evaluated in order; index matches RelaySafetyRule
+static const struct {
+  const char* name;
+  RelaySafetyCheck check;
+} SAFETY_RULES[SAFETY_RULE_COUNT] = {
+  {"over-temperature",   rule_overtemp},
+  {"igniter max on-time", rule_igniter_timeout},
+  {"igniter above max temp", rule_igniter_hot},
+  {"auger without blower", rule_auger_no_blower},
+  {"auger duty ceiling", rule_auger_duty},
+};
+
+void relay_safety_reset(RelaySafetyState* state) {
+  memset(state, 0, sizeof(RelaySafetyState));
+}
+
+float relay_safety_auger_duty(const RelaySafetyState* state) {
+  uint32_t total = 0;
+  for (int i = 0; i < SAFETY_AUGER_BUCKETS; i++) {
+    total += state->augerBucketMs[i];
+  }
+  return (float)total / SAFETY_AUGER_WINDOW_MS;
+}
+
+// Fold elapsed auger on-time into the duty buckets
+static void relay_safety_account(RelaySafetyState* state, uint64_t now) {
+  if (state->augerWasOn) {
+    state->augerBucketMs[state->augerBucket] += now - state->lastEval;
+  }
+
+  uint64_t elapsed = now - state->augerBucketStart;
+  if (elapsed >= SAFETY_AUGER_WINDOW_MS) {
+    memset(state->augerBucketMs, 0, sizeof(state->augerBucketMs));
+    state->augerBucketStart = now;
+    return;
+  }
+  while (elapsed >= AUGER_BUCKET_MS) {
+    state->augerBucket = (state->augerBucket + 1) % SAFETY_AUGER_BUCKETS;
+    state->augerBucketMs[state->augerBucket] = 0;
+    state->augerBucketStart += AUGER_BUCKET_MS;
+    elapsed -= AUGER_BUCKET_MS;
+  }
+}
+
+uint8_t relay_safety_evaluate(RelaySafetyState* state, RelayOutputs* outputs,
+                              float pitTemp, uint64_t now) {
+  if (!state->started) {
+    state->started = true;
+    state->lastEval = now;
+    state->augerBucketStart = now;
+  }
+  relay_safety_account(state, now);
+
+  uint8_t mask = 0;
+  for (int i = 0; i < SAFETY_RULE_COUNT; i++) {
+    if (SAFETY_RULES[i].check(state, outputs, pitTemp, now)) {
+      mask |= (1 << i);
+      if (!(state->tripMask & (1 << i))) state->tripCount[i]++;
+    }
+  }
+
+  // Track what actually goes out
+  if (outputs->igniter && !state->igniterWasOn) state->igniterOnSince = now;
+  state->igniterWasOn = outputs->igniter;
+  state->augerWasOn = outputs->auger;
+  state->lastEval = now;
+  state->tripMask = mask;
+  return mask;
+}
+
+void relay_safety_init() {
+  relay_safety_reset(&safetyState);
+  safetyPitTemp = NAN;
+  safetyPitTempTime = 0;
+  Serial.printf("Relay interlocks armed: %d rules\n", SAFETY_RULE_COUNT);
+}
+
+// Age runs from when the sensor was read, not from this call, so a stalled
+// acquisition task goes stale even while control keeps cycling
+void relay_safety_set_temperature(double temp, uint64_t readingMs) {
+  bool valid = !isnan(temp) && !isinf(temp) && temp > -900.0 && temp < 999.0;
+  safetyPitTemp = valid ? (float)temp : NAN;
+  safetyPitTempTime = (uint32_t)readingMs;
+}
+
+void relay_safety_enforce(RelayOutputs* outputs) {
+  uint64_t now = clock_ms();
+  uint32_t tempAge = (uint32_t)now - safetyPitTempTime;
+  float pitTemp = (tempAge <= SAFETY_TEMP_STALE_MS) ? safetyPitTemp : NAN;
+
+  uint8_t previous = safetyState.tripMask;
+  RelayOutputs requested = *outputs;
+  uint8_t mask = relay_safety_evaluate(&safetyState, outputs, pitTemp, now);
+
+  uint8_t tripped = mask & ~previous;
+  for (int i = 0; i < SAFETY_RULE_COUNT; i++) {
+    if (tripped & (1 << i)) {
+      Serial.printf("🛑 SAFETY INTERLOCK: %s (pit %.0f°F, requested IGN=%d AUG=%d BLO=%d, auger duty %.0f%%)\n",
+                    SAFETY_RULES[i].name, pitTemp, requested.igniter, requested.auger,
+                    requested.blowerFan, relay_safety_auger_duty(&safetyState) * 100.0);
+    }
+  }
+  if (previous && !mask) {
+    Serial.println("✅ Safety interlocks clear");
+  }
+}
+
+uint8_t relay_safety_get_trip_mask() {
+  return safetyState.tripMask;
+}
+
+const char* relay_safety_rule_name(int rule) {
+  if (rule < 0 || rule >= SAFETY_RULE_COUNT) return "unknown";
+  return SAFETY_RULES[rule].name;
+}
+
+String relay_safety_get_json() {
+  String json = "{\"tripMask\":" + String(safetyState.tripMask) + ",";
+  json += "\"augerDuty\":" + String(relay_safety_auger_duty(&safetyState), 3) + ",";
+  json += "\"rules\":[";
+  for (int i = 0; i < SAFETY_RULE_COUNT; i++) {
+    if (i > 0) json += ",";
+    json += "{\"rule\":\"" + String(SAFETY_RULES[i].name) + "\",";
+    json += "\"active\":" + String((safetyState.tripMask & (1 << i)) ? "true" : "false") + ",";
+    json += "\"trips\":" + String(safetyState.tripCount[i]) + "}";
+  }
+  json += "]}";
+  return json;
+}
@@ -0,0 +1,71 @@
+// RelaySafety.h - Relay interlock rules enforced on every relay commit
+#ifndef RELAYSAFETY_H
+#define RELAYSAFETY_H
+
+#include <Arduino.h>
+
+// Interlock limits
+#define SAFETY_IGNITER_MAX_ON_MS   (20UL * 60 * 1000)  // Longest continuous igniter run (full ignition timeout)
+#define SAFETY_IGNITER_MAX_TEMP    300.0   // No igniter above this pit temperature
+#define SAFETY_LIT_TEMP            150.0   // Pit temperature that counts as a lit fire pot
+#define SAFETY_AUGER_WINDOW_MS     (10UL * 60 * 1000)  // Auger duty window
+#define SAFETY_AUGER_BUCKETS       10      // One bucket per minute of the window
+#define SAFETY_AUGER_MAX_DUTY      0.50    // Auger on-time ceiling within the window
+#define SAFETY_AUGER_RESUME_DUTY   0.40    // Duty at which a tripped auger may run again
+#define SAFETY_OVERTEMP_TRIP       600.0   // Cuts igniter and auger below EMERGENCY_TEMP
+#define SAFETY_OVERTEMP_RESET      550.0
+
+// Rules - bit index in the trip mask
+enum RelaySafetyRule {
+  SAFETY_RULE_OVERTEMP = 0,
+  SAFETY_RULE_IGNITER_TIMEOUT,
+  SAFETY_RULE_IGNITER_HOT,
+  SAFETY_RULE_AUGER_NO_BLOWER,
+  SAFETY_RULE_AUGER_DUTY,
+  SAFETY_RULE_COUNT
+};
+
+// Relay outputs as proposed by arbitration; rules may only turn outputs off
+struct RelayOutputs {
+  bool igniter;
+  bool auger;
+  bool hopperFan;
+  bool blowerFan;
+};
+
+// Interlock state - fixed size, no allocation
+struct RelaySafetyState {
+  bool started;
+  uint64_t lastEval;
+  bool igniterWasOn;
+  uint64_t igniterOnSince;
+  bool igniterLocked;         // Tripped on time; released when the igniter is requested off
+  bool overTempLatched;
+  bool pitHot;                // Last valid reading above SAFETY_IGNITER_MAX_TEMP - held while unknown
+  bool pitLit;                // Last valid reading at or above SAFETY_LIT_TEMP - held while unknown
+  bool augerDutyLatched;
+  uint32_t augerBucketMs[SAFETY_AUGER_BUCKETS];
+  uint8_t augerBucket;
+  uint64_t augerBucketStart;
+  bool augerWasOn;
+  uint8_t tripMask;           // Rules that changed the outputs on the last evaluation
+  uint32_t tripCount[SAFETY_RULE_COUNT];
+};
+
+// Engine
+void relay_safety_init();
+void relay_safety_set_temperature(double temp, uint64_t readingMs);  // Pit temperature (NaN = failed read) and when it was read
+void relay_safety_enforce(RelayOutputs* outputs);  // Called by relay_commit()
+
+// Core evaluation (pure - no hardware access), exposed for offline replay and fuzzing
+void relay_safety_reset(RelaySafetyState* state);
+uint8_t relay_safety_evaluate(RelaySafetyState* state, RelayOutputs* outputs,
+                              float pitTemp, uint64_t now);
+float relay_safety_auger_duty(const RelaySafetyState* state);
+
+// Status
+uint8_t relay_safety_get_trip_mask();
+const char* relay_safety_rule_name(int rule);
+String relay_safety_get_json();
+
+#endif // RELAYSAFETY_H
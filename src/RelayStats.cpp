@@ -0,0 +1,285 @@
+// RelayStats.cpp - Relay wear counters kept in RAM, flushed to NVS on a schedule
+//
+// The relay task records every commit; loop() owns the flash writes. Counters
+// are flushed to the "relaystats" namespace every RELAY_STATS_FLUSH_MS while
+// they change and when a cook ends - never per toggle.
+#include "RelayStats.h"
+#include "Globals.h"
+#include "Clock.h"
+#include "freertos/FreeRTOS.h"
+
+static RelayChannelStats channelStats[RELAY_CH_COUNT];
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;  // Relay task writes, loop/web read
+
+static uint8_t dutyBucket = 0;
+static uint64_t dutyBucketStart = 0;
+static uint64_t lastRecord = 0;
+static uint64_t statsStart = 0;
+
+static bool dirty = false;
+static uint64_t lastFlush = 0;
+static bool wasRunning = false;
+static uint8_t warnedMask = 0;
+
+static const char* CHANNEL_NAMES[RELAY_CH_COUNT] = {"igniter", "auger", "hopper", "blower"};
+static const char* CHANNEL_KEYS[RELAY_CH_COUNT] = {"ign", "aug", "hop", "blo"};
+
+// Copy the counters out with in-progress on-periods folded in
+static void relay_stats_snapshot(RelayChannelStats out[RELAY_CH_COUNT], unsigned long* windowMs) {
+  portENTER_CRITICAL(&statsMux);
+  uint64_t now = clock_ms();
+  for (int i = 0; i < RELAY_CH_COUNT; i++) {
+    out[i] = channelStats[i];
+    if (out[i].on) {
+      uint32_t current = (uint32_t)(now - out[i].onSince);
+      out[i].onTimeMs += current;
+      if (current > out[i].longestOnMs) out[i].longestOnMs = current;
+    }
+  }
+  uint64_t elapsed = now - statsStart;
+  *windowMs = (unsigned long)min(elapsed, (uint64_t)(RELAY_DUTY_BUCKETS * RELAY_DUTY_BUCKET_MS));
+  portEXIT_CRITICAL(&statsMux);
+}
+
+static float relay_stats_duty_of(const RelayChannelStats& stats, unsigned long windowMs) {
+  if (windowMs == 0) return 0.0;
+  uint32_t total = 0;
+  for (int b = 0; b < RELAY_DUTY_BUCKETS; b++) {
+    total += stats.dutyBucketMs[b];
+  }
+  return min((float)total / windowMs, 1.0f);
+}
+
+void relay_stats_init() {
+  char key[16];
+  uint64_t now = clock_ms();
+
+  preferences.begin("relaystats", true);
+  for (int i = 0; i < RELAY_CH_COUNT; i++) {
+    RelayChannelStats& stats = channelStats[i];
+    memset(&stats, 0, sizeof(stats));
+    snprintf(key, sizeof(key), "%s_sw", CHANNEL_KEYS[i]);
+    stats.switchCount = preferences.getULong(key, 0);
+    snprintf(key, sizeof(key), "%s_on", CHANNEL_KEYS[i]);
+    stats.onTimeMs = preferences.getULong64(key, 0);
+    snprintf(key, sizeof(key), "%s_max", CHANNEL_KEYS[i]);
+    stats.longestOnMs = preferences.getULong(key, 0);
+  }
+  preferences.end();
+
+  dutyBucket = 0;
+  dutyBucketStart = now;
+  lastRecord = now;
+  statsStart = now;
+  dirty = false;
+  lastFlush = now;
+  wasRunning = grillRunning;
+  warnedMask = 0;
+
+  Serial.printf("Relay stats loaded: igniter %.1f h / %lu starts\n",
+                channelStats[RELAY_CH_IGNITER].onTimeMs / 3600000.0,
+                (unsigned long)channelStats[RELAY_CH_IGNITER].switchCount);
+}
+
+void relay_stats_record(const bool states[RELAY_CH_COUNT]) {
+  portENTER_CRITICAL(&statsMux);
+  uint64_t now = clock_ms();
+  uint64_t elapsed = now - lastRecord;
+
+  // Charge elapsed on-time to the current duty bucket, then roll buckets forward
+  for (int i = 0; i < RELAY_CH_COUNT; i++) {
+    if (channelStats[i].on) {
+      channelStats[i].dutyBucketMs[dutyBucket] += elapsed;
+      dirty = true;
+    }
+  }
+  int rolled = 0;
+  while (now - dutyBucketStart >= RELAY_DUTY_BUCKET_MS && rolled < RELAY_DUTY_BUCKETS) {
+    dutyBucket = (dutyBucket + 1) % RELAY_DUTY_BUCKETS;
+    for (int i = 0; i < RELAY_CH_COUNT; i++) {
+      channelStats[i].dutyBucketMs[dutyBucket] = 0;
+    }
+    dutyBucketStart += RELAY_DUTY_BUCKET_MS;
+    rolled++;
+  }
+  if (now - dutyBucketStart >= RELAY_DUTY_BUCKET_MS) dutyBucketStart = now;  // Long gap - window cleared
+  lastRecord = now;
+
+  // Transitions
+  for (int i = 0; i < RELAY_CH_COUNT; i++) {
+    RelayChannelStats& stats = channelStats[i];
+    if (states[i] && !stats.on) {
+      stats.on = true;
+      stats.onSince = now;
+      stats.switchCount++;
+      dirty = true;
+    } else if (!states[i] && stats.on) {
+      uint32_t period = (uint32_t)(now - stats.onSince);
+      stats.on = false;
+      stats.onTimeMs += period;
+      if (period > stats.longestOnMs) stats.longestOnMs = period;
+      dirty = true;
+    }
+  }
+  portEXIT_CRITICAL(&statsMux);
+}
+
+void relay_stats_flush() {
+  char key[16];
+  RelayChannelStats snapshot[RELAY_CH_COUNT];
+  unsigned long windowMs;
+  relay_stats_snapshot(snapshot, &windowMs);
+
+  preferences.begin("relaystats", false);
+  for (int i = 0; i < RELAY_CH_COUNT; i++) {
+    snprintf(key, sizeof(key), "%s_sw", CHANNEL_KEYS[i]);
+    preferences.putULong(key, snapshot[i].switchCount);
+    snprintf(key, sizeof(key), "%s_on", CHANNEL_KEYS[i]);
+    preferences.putULong64(key, snapshot[i].onTimeMs);
+    snprintf(key, sizeof(key), "%s_max", CHANNEL_KEYS[i]);
+    preferences.putULong(key, snapshot[i].longestOnMs);
+  }
+  preferences.end();
+
+  dirty = false;
+  lastFlush = clock_ms();
+}
+
+void relay_stats_update() {
+  uint64_t now = clock_ms();
+
+  // End of a cook is a natural checkpoint
+  bool cookEnded = wasRunning && !grillRunning;
+  wasRunning = grillRunning;
+
+  if (dirty && (cookEnded || now - lastFlush >= RELAY_STATS_FLUSH_MS)) {
+    relay_stats_flush();
+  }
+
+  // Wear warnings, once per boot per relay
+  for (int i = 0; i < RELAY_CH_COUNT; i++) {
+    if (warnedMask & (1 << i)) continue;
+    uint32_t cycles = relay_stats_get_switch_count(i);
+    if (cycles >= RELAY_RATED_CYCLES * RELAY_WARN_FRACTION) {
+      warnedMask |= (1 << i);
+      Serial.printf("⚠️ RELAY WEAR: %s relay at %lu of %lu rated cycles\n",
+                    CHANNEL_NAMES[i], (unsigned long)cycles, (unsigned long)RELAY_RATED_CYCLES);
+    } else if (i == RELAY_CH_IGNITER &&
+               relay_stats_get_on_hours(i) >= IGNITER_RATED_HOURS * IGNITER_WARN_FRACTION) {
+      warnedMask |= (1 << i);
+      Serial.printf("⚠️ IGNITER WEAR: %.1f of %.0f rated hours - about %.1f hours left\n",
+                    relay_stats_get_on_hours(i), IGNITER_RATED_HOURS, relay_stats_get_igniter_hours_remaining());
+    }
+  }
+}
+
+void relay_stats_reset(int channel) {
+  if (channel < 0 || channel >= RELAY_CH_COUNT) return;
+
+  portENTER_CRITICAL(&statsMux);
+  RelayChannelStats& stats = channelStats[channel];
+  stats.switchCount = stats.on ? 1 : 0;
+  stats.onTimeMs = 0;
+  stats.longestOnMs = 0;
+  stats.onSince = clock_ms();
+  portEXIT_CRITICAL(&statsMux);
+
+  warnedMask &= ~(1 << channel);
+  relay_stats_flush();
+  Serial.printf("Relay stats reset for %s\n", CHANNEL_NAMES[channel]);
+}
+
+uint32_t relay_stats_get_switch_count(int channel) {
+  if (channel < 0 || channel >= RELAY_CH_COUNT) return 0;
+  portENTER_CRITICAL(&statsMux);
+  uint32_t count = channelStats[channel].switchCount;
+  portEXIT_CRITICAL(&statsMux);
+  return count;
+}
+
+float relay_stats_get_on_hours(int channel) {
+  if (channel < 0 || channel >= RELAY_CH_COUNT) return 0.0;
+  RelayChannelStats snapshot[RELAY_CH_COUNT];
+  unsigned long windowMs;
+  relay_stats_snapshot(snapshot, &windowMs);
+  return snapshot[channel].onTimeMs / 3600000.0;
+}
+
+float relay_stats_get_duty(int channel) {
+  if (channel < 0 || channel >= RELAY_CH_COUNT) return 0.0;
+  RelayChannelStats snapshot[RELAY_CH_COUNT];
+  unsigned long windowMs;
+  relay_stats_snapshot(snapshot, &windowMs);
+  return relay_stats_duty_of(snapshot[channel], windowMs);
+}
+
+float relay_stats_get_igniter_hours_remaining() {
+  return max(IGNITER_RATED_HOURS - relay_stats_get_on_hours(RELAY_CH_IGNITER), 0.0);
+}
+
+bool relay_stats_has_warning() {
+  return warnedMask != 0;
+}
+
+const char* relay_stats_channel_name(int channel) {
+  if (channel < 0 || channel >= RELAY_CH_COUNT) return "unknown";
+  return CHANNEL_NAMES[channel];
+}
+
+int relay_stats_find_channel(const String& name) {
+  for (int i = 0; i < RELAY_CH_COUNT; i++) {
+    if (name == CHANNEL_NAMES[i]) return i;
+  }
+  return -1;
+}
+
+void relay_stats_print() {
+  RelayChannelStats snapshot[RELAY_CH_COUNT];
+  unsigned long windowMs;
+  relay_stats_snapshot(snapshot, &windowMs);
+
+  Serial.println("--- Relay Wear ---");
+  for (int i = 0; i < RELAY_CH_COUNT; i++) {
+    Serial.printf("%-8s %7lu switches, %8.1f h on, longest %lu s, duty %.0f%%\n", CHANNEL_NAMES[i],
+                  (unsigned long)snapshot[i].switchCount, snapshot[i].onTimeMs / 3600000.0,
+                  (unsigned long)(snapshot[i].longestOnMs / 1000), relay_stats_duty_of(snapshot[i], windowMs) * 100.0);
+  }
+
+  // Igniter life, and how many more ignitions that buys at the current average
+  const RelayChannelStats& ign = snapshot[RELAY_CH_IGNITER];
+  float remaining = max(IGNITER_RATED_HOURS - ign.onTimeMs / 3600000.0, 0.0);
+  Serial.printf("Igniter: %.1f of %.0f rated hours left", remaining, IGNITER_RATED_HOURS);
+  if (ign.switchCount > 0) {
+    float avgHours = ign.onTimeMs / 3600000.0 / ign.switchCount;
+    if (avgHours > 0.0) Serial.printf(" (~%lu ignitions)", (unsigned long)(remaining / avgHours));
+  }
+  Serial.println();
+  if (dirty) Serial.printf("Unsaved changes - next flush in %lu s\n",
+                           (unsigned long)((RELAY_STATS_FLUSH_MS - min(clock_elapsed_ms(lastFlush), (uint64_t)RELAY_STATS_FLUSH_MS)) / 1000));
+}
+
+String relay_stats_get_json() {
+  RelayChannelStats snapshot[RELAY_CH_COUNT];
+  unsigned long windowMs;
+  relay_stats_snapshot(snapshot, &windowMs);
+
+  String json = "{\"relays\":[";
+  for (int i = 0; i < RELAY_CH_COUNT; i++) {
+    if (i > 0) json += ",";
+    json += "{\"relay\":\"" + String(CHANNEL_NAMES[i]) + "\",";
+    json += "\"switches\":" + String(snapshot[i].switchCount) + ",";
+    json += "\"onHours\":" + String(snapshot[i].onTimeMs / 3600000.0, 2) + ",";
+    json += "\"longestOnSec\":" + String(snapshot[i].longestOnMs / 1000) + ",";
+    json += "\"duty1h\":" + String(relay_stats_duty_of(snapshot[i], windowMs), 3) + ",";
+    json += "\"cycleLife\":" + String((float)snapshot[i].switchCount / RELAY_RATED_CYCLES, 3) + "}";
+  }
+  json += "],";
+
+  float ignHours = snapshot[RELAY_CH_IGNITER].onTimeMs / 3600000.0;
+  json += "\"igniterRatedHours\":" + String(IGNITER_RATED_HOURS, 0) + ",";
+  json += "\"igniterHoursLeft\":" + String(max(IGNITER_RATED_HOURS - ignHours, 0.0), 1) + ",";
+  json += "\"igniterWarning\":" + String(ignHours >= IGNITER_RATED_HOURS * IGNITER_WARN_FRACTION ? "true" : "false") + ",";
+  json += "\"unsaved\":" + String(dirty ? "true" : "false");
+  json += "}";
+  return json;
+}
@@ -0,0 +1,57 @@
+// RelayStats.h - Relay wear counters and duty-cycle telemetry
+#ifndef RELAYSTATS_H
+#define RELAYSTATS_H
+
+#include <Arduino.h>
+
+// Relay channels
+enum RelayChannel {
+  RELAY_CH_IGNITER = 0,
+  RELAY_CH_AUGER,
+  RELAY_CH_HOPPER_FAN,
+  RELAY_CH_BLOWER_FAN,
+  RELAY_CH_COUNT
+};
+
+// Rolling duty window - 12 x 5 minute buckets (1 hour)
+#define RELAY_DUTY_BUCKETS      12
+#define RELAY_DUTY_BUCKET_MS    (5UL * 60 * 1000)
+
+// Coalesced NVS flush interval while counters are changing
+#define RELAY_STATS_FLUSH_MS    (15UL * 60 * 1000)
+
+// Wear ratings
+#define IGNITER_RATED_HOURS     300.0    // Hot-rod igniter service life
+#define IGNITER_WARN_FRACTION   0.8      // Warn at 80% of rated hours
+#define RELAY_RATED_CYCLES      100000   // Mechanical relay electrical life
+#define RELAY_WARN_FRACTION     0.8
+
+// Per-relay counters
+struct RelayChannelStats {
+  uint32_t switchCount;      // OFF -> ON transitions
+  uint64_t onTimeMs;         // Cumulative on-time (completed periods)
+  uint32_t longestOnMs;      // Longest single on-period
+  bool on;
+  uint64_t onSince;
+  uint32_t dutyBucketMs[RELAY_DUTY_BUCKETS];
+};
+
+// Stats functions
+void relay_stats_init();
+void relay_stats_record(const bool states[RELAY_CH_COUNT]);  // Called by relay_commit()
+void relay_stats_update();                                  // Call from loop() - coalesced flush
+void relay_stats_flush();
+void relay_stats_reset(int channel);                        // After replacing a part - control task only
+
+// Status
+uint32_t relay_stats_get_switch_count(int channel);
+float relay_stats_get_on_hours(int channel);
+float relay_stats_get_duty(int channel);                    // Rolling 1 hour, 0.0-1.0
+float relay_stats_get_igniter_hours_remaining();
+bool relay_stats_has_warning();
+const char* relay_stats_channel_name(int channel);
+int relay_stats_find_channel(const String& name);
+void relay_stats_print();
+String relay_stats_get_json();
+
+#endif // RELAYSTATS_H
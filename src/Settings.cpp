@@ -1,6 +1,10 @@
 // Settings.cpp - Fixed version
 #include "Settings.h"
 #include "Globals.h"
+#include "PelletControl.h"
+#include "PelletAccounting.h"
+#include "FanControl.h"
+#include "ProbeAlarm.h"
 
 void load_settings() {
   // Use the global preferences object from Globals.h
@@ -29,4 +33,144 @@ void save_settings() {
   preferences.end();
   
   Serial.println("Settings saved");
-}
\ No newline at end of file
+}
+
+// ===== RUNTIME SETTINGS (/api/v2/settings) =====
+// Ordered by group so settings_write_json can open each object once
+static const SettingInfo SETTINGS[SETTING_COUNT] = {
+  {NULL,     "setpoint",         SETTING_TYPE_INT,   MIN_SETPOINT, MAX_SETPOINT, 0, "Grill target temperature (F)"},
+  {NULL,     "smokeMode",        SETTING_TYPE_BOOL,  0,     1,      0, "Low-airflow blower cycles at low setpoints"},
+  {NULL,     "keepWarm",         SETTING_TYPE_INT,   MIN_SETPOINT, MAX_SETPOINT, 0, "Setpoint used when a probe reaches target with keep-warm on (F)"},
+  {"pid",    "kp",               SETTING_TYPE_FLOAT, 0,     10,     3, "Proportional gain"},
+  {"pid",    "ki",               SETTING_TYPE_FLOAT, 0,     1,      4, "Integral gain"},
+  {"pid",    "kd",               SETTING_TYPE_FLOAT, 0,     5,      3, "Derivative gain"},
+  {"feed",   "initial",          SETTING_TYPE_INT,   10,    120,    0, "Initial ignition feed (s)"},
+  {"feed",   "lighting",         SETTING_TYPE_INT,   5,     60,     0, "Feed per lighting cycle (s)"},
+  {"feed",   "normal",           SETTING_TYPE_INT,   1,     30,     0, "Maximum feed per control cycle (s)"},
+  {"feed",   "interval",         SETTING_TYPE_INT,   30,    180,    0, "Time between lighting feeds (s)"},
+  {"pellet", "calibration",      SETTING_TYPE_FLOAT, 0.1,   50,     2, "Auger output (g/s)"},
+  {"pellet", "hopperCapacity",   SETTING_TYPE_FLOAT, 1,     100,    1, "Hopper capacity (lb)"},
+  {"pellet", "hopperLow",        SETTING_TYPE_FLOAT, 0,     100,    1, "Low-hopper alarm threshold (lb)"},
+};
+
+#define SETTINGS_PID_MASK    (SETTING_BIT(SETTING_PID_KP) | SETTING_BIT(SETTING_PID_KI) | SETTING_BIT(SETTING_PID_KD))
+#define SETTINGS_FEED_MASK   (SETTING_BIT(SETTING_FEED_INITIAL) | SETTING_BIT(SETTING_FEED_LIGHTING) | \
+                              SETTING_BIT(SETTING_FEED_NORMAL) | SETTING_BIT(SETTING_FEED_INTERVAL))
+#define SETTINGS_PELLET_MASK (SETTING_BIT(SETTING_PELLET_CALIBRATION) | SETTING_BIT(SETTING_HOPPER_CAPACITY) | \
+                              SETTING_BIT(SETTING_HOPPER_LOW))
+
+const SettingInfo* settings_get_info(int id) {
+  if (id < 0 || id >= SETTING_COUNT) return NULL;
+  return &SETTINGS[id];
+}
+
+int settings_find(const char* path) {
+  for (int i = 0; i < SETTING_COUNT; i++) {
+    const SettingInfo& info = SETTINGS[i];
+    const char* name = path;
+    if (info.group) {
+      size_t n = strlen(info.group);
+      if (strncmp(path, info.group, n) != 0 || path[n] != '.') continue;
+      name = path + n + 1;
+    }
+    if (strcmp(name, info.name) == 0) return i;
+  }
+  return -1;
+}
+
+float settings_get_value(int id) {
+  float kp, ki, kd;
+  switch (id) {
+    case SETTING_SETPOINT:           return setpoint;
+    case SETTING_SMOKE_MODE:         return fan_get_smoke_mode() ? 1 : 0;
+    case SETTING_KEEP_WARM:          return probe_alarm_get_keep_warm_setpoint();
+    case SETTING_PID_KP:             getPIDParameters(&kp, &ki, &kd); return kp;
+    case SETTING_PID_KI:             getPIDParameters(&kp, &ki, &kd); return ki;
+    case SETTING_PID_KD:             getPIDParameters(&kp, &ki, &kd); return kd;
+    case SETTING_FEED_INITIAL:       return pellet_get_initial_feed_duration() / 1000.0;
+    case SETTING_FEED_LIGHTING:      return pellet_get_lighting_feed_duration() / 1000.0;
+    case SETTING_FEED_NORMAL:        return pellet_get_normal_feed_duration() / 1000.0;
+    case SETTING_FEED_INTERVAL:      return pellet_get_lighting_feed_interval() / 1000.0;
+    case SETTING_PELLET_CALIBRATION: return pellet_get_calibration();
+    case SETTING_HOPPER_CAPACITY:    return pellet_get_hopper_capacity_lb();
+    case SETTING_HOPPER_LOW:         return pellet_get_hopper_low_lb();
+    default:                         return 0;
+  }
+}
+
+// Value the patch would leave in place - its own if set, else the current one
+static float settings_merged(const SettingsPatch& patch, int id) {
+  return (patch.mask & SETTING_BIT(id)) ? patch.values[id] : settings_get_value(id);
+}
+
+int settings_check_patch(const SettingsPatch& patch, const char** reason) {
+  if ((patch.mask & SETTINGS_PELLET_MASK) &&
+      settings_merged(patch, SETTING_HOPPER_LOW) > settings_merged(patch, SETTING_HOPPER_CAPACITY)) {
+    *reason = "Must not exceed pellet.hopperCapacity";
+    return SETTING_HOPPER_LOW;
+  }
+  return -1;
+}
+
+void settings_write_json(JsonWriter& json) {
+  const char* group = NULL;
+  for (int i = 0; i < SETTING_COUNT; i++) {
+    const SettingInfo& info = SETTINGS[i];
+    if (info.group != group) {
+      if (group) json.endObject();
+      if (info.group) json.beginObject(info.group);
+      group = info.group;
+    }
+
+    float value = settings_get_value(i);
+    switch (info.type) {
+      case SETTING_TYPE_BOOL:  json.field(info.name, value != 0); break;
+      case SETTING_TYPE_INT:   json.field(info.name, (long)lround(value)); break;
+      case SETTING_TYPE_FLOAT: json.field(info.name, value, info.decimals); break;
+    }
+  }
+  if (group) json.endObject();
+}
+
+// Each module persists its own namespace; grouped setters write it once for
+// the whole patch instead of once per field
+bool settings_apply_patch(const SettingsPatch& patch, const char** reason) {
+  uint16_t mask = patch.mask;
+
+  // Another command may have changed the other side of a cross-field rule
+  // since the handler checked it, so check again against current values
+  if (settings_check_patch(patch, reason) >= 0) return false;
+
+  if (mask & SETTING_BIT(SETTING_SETPOINT)) {
+    setpoint = patch.values[SETTING_SETPOINT];
+    save_setpoint();
+  }
+
+  if (mask & SETTING_BIT(SETTING_SMOKE_MODE)) {
+    fan_set_smoke_mode(patch.values[SETTING_SMOKE_MODE] != 0);
+  }
+
+  if (mask & SETTING_BIT(SETTING_KEEP_WARM)) {
+    probe_alarm_set_keep_warm_setpoint(patch.values[SETTING_KEEP_WARM]);
+  }
+
+  if (mask & SETTINGS_PID_MASK) {
+    setPIDParameters(settings_merged(patch, SETTING_PID_KP),
+                     settings_merged(patch, SETTING_PID_KI),
+                     settings_merged(patch, SETTING_PID_KD));
+  }
+
+  if (mask & SETTINGS_FEED_MASK) {
+    pellet_set_feed_parameters(lround(settings_merged(patch, SETTING_FEED_INITIAL) * 1000),
+                               lround(settings_merged(patch, SETTING_FEED_LIGHTING) * 1000),
+                               lround(settings_merged(patch, SETTING_FEED_NORMAL) * 1000),
+                               lround(settings_merged(patch, SETTING_FEED_INTERVAL) * 1000));
+  }
+
+  if (mask & SETTINGS_PELLET_MASK) {
+    pellet_set_accounting_config(settings_merged(patch, SETTING_PELLET_CALIBRATION),
+                                 settings_merged(patch, SETTING_HOPPER_CAPACITY),
+                                 settings_merged(patch, SETTING_HOPPER_LOW));
+  }
+  return true;
+}
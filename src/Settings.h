@@ -6,6 +6,7 @@
 #define SETTINGS_H
 
 #include <Arduino.h>
+#include "JsonWriter.h"
 
 extern char ssid[32];
 extern char password[64];
@@ -14,4 +15,54 @@ extern bool useDHCP;
 void load_settings();
 void setup_wifi_and_mdns();
 
+// ===== RUNTIME SETTINGS (/api/v2/settings) =====
+// Values are carried in API units - °F, seconds, g/s, lb - and converted when
+// applied. A patch holds only the fields whose bit is set in its mask.
+enum SettingId : uint8_t {
+  SETTING_SETPOINT = 0,
+  SETTING_SMOKE_MODE,
+  SETTING_KEEP_WARM,
+  SETTING_PID_KP,
+  SETTING_PID_KI,
+  SETTING_PID_KD,
+  SETTING_FEED_INITIAL,
+  SETTING_FEED_LIGHTING,
+  SETTING_FEED_NORMAL,
+  SETTING_FEED_INTERVAL,
+  SETTING_PELLET_CALIBRATION,
+  SETTING_HOPPER_CAPACITY,
+  SETTING_HOPPER_LOW,
+  SETTING_COUNT
+};
+
+enum SettingType : uint8_t {
+  SETTING_TYPE_BOOL = 0,
+  SETTING_TYPE_INT,
+  SETTING_TYPE_FLOAT
+};
+
+struct SettingInfo {
+  const char* group;        // JSON object it is nested in, NULL = top level
+  const char* name;
+  SettingType type;
+  float min, max;
+  uint8_t decimals;
+  const char* description;
+};
+
+struct SettingsPatch {
+  uint16_t mask;            // Bit per SettingId
+  float values[SETTING_COUNT];
+};
+
+#define SETTING_BIT(id) ((uint16_t)1 << (id))
+
+const SettingInfo* settings_get_info(int id);
+int settings_find(const char* path);                // "pid.kp" -> SettingId, -1 if unknown
+float settings_get_value(int id);
+int settings_check_patch(const SettingsPatch& patch, const char** reason);   // Cross-field; failing id or -1
+void settings_write_json(JsonWriter& json);
+bool settings_apply_patch(const SettingsPatch& patch,    // loop() only; one NVS write per namespace touched.
+                          const char** reason);          // Re-checks first - false (nothing applied) on conflict
+
 #endif // SETTINGS_H
@@ -0,0 +1,219 @@
+// StatusCache.cpp - /status_all built once per control cycle, with a change sequence
+//
+// Change detection hashes the field text (FNV-1a) rather than keeping a second
+// copy; "seq" is appended after the hash so it never counts as a change. The
+// sequence starts from a random value each boot, so an ETag or since= value
+// left over from before a restart cannot match by accident.
+#include "StatusCache.h"
+#include "Globals.h"
+#include "Utility.h"
+#include "TemperatureSensor.h"
+#include "Ignition.h"
+#include "RelayControl.h"
+#include "FanControl.h"
+#include "PelletAccounting.h"
+#include "ProbeAlarm.h"
+#include "ProbePredictor.h"
+#include "JsonWriter.h"
+#include "Clock.h"
+#include "freertos/FreeRTOS.h"
+#include <WiFi.h>
+#include <atomic>
+#include <memory>
+
+static char published[STATUS_JSON_BUFFER];
+static size_t publishedLength = 0;
+static uint32_t publishedSeq = 0;
+static portMUX_TYPE publishMux = portMUX_INITIALIZER_UNLOCKED;  // loop publishes, web task copies
+
+static std::atomic<uint32_t> sequence(0);
+static uint32_t lastHash = 0;
+static bool started = false;
+
+static std::atomic<int> parkedCount(0);
+
+static uint32_t status_hash(const char* text, size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= (uint8_t)text[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// Same fields as /status_all has always had
+static void status_cache_write_fields(JsonWriter& json) {
+  double grillTemp = readGrillTemperature();
+
+  json.field("grillTemp", grillTemp, 1);
+  json.field("ambientTemp", readAmbientTemperature(), 1);
+  json.field("meat1Temp", readProbeTemperature(1), 1);
+  json.field("meat2Temp", readProbeTemperature(2), 1);
+  json.field("meat3Temp", readProbeTemperature(3), 1);
+  json.field("meat4Temp", readProbeTemperature(4), 1);
+  json.field("ip", WiFi.localIP().toString().c_str());
+  json.field("setpoint", (int)setpoint);
+  json.field("status", getStatus(grillTemp).c_str());
+  json.field("grillRunning", grillRunning);
+  json.field("ignitionState", ignition_get_status_string().c_str());
+  json.field("ignOn", digitalRead(RELAY_IGNITER_PIN) == HIGH);
+  json.field("augerOn", digitalRead(RELAY_AUGER_PIN) == HIGH);
+  json.field("hopperOn", digitalRead(RELAY_HOPPER_FAN_PIN) == HIGH);
+  json.field("blowerOn", digitalRead(RELAY_BLOWER_FAN_PIN) == HIGH);
+  json.field("manualOverride", relay_get_manual_override_status());
+  json.field("smokeMode", fan_get_smoke_mode());
+  json.field("fanMode", fan_get_mode_string().c_str());
+  json.field("blowerDuty", relay_get_blower_duty());
+  json.field("hopperLb", pellet_get_hopper_remaining_lb(), 1);
+  json.field("hopperLow", pellet_is_hopper_low());
+  json.field("cookLb", pellet_get_cook_lb(), 2);
+  json.field("burnRate", pellet_get_burn_rate(), 2);
+  json.field("alarmSeq", probe_alarm_get_sequence());
+  json.field("alarmActive", probe_alarm_get_active_mask());
+  json.field("alarmText", probe_alarm_get_active_text().c_str());
+
+  // Finish-time estimates per probe (seconds, -1 = unknown)
+  json.beginArray("probeEta");
+  for (int i = 0; i < MAX_PROBES; i++) json.value(probe_predictor_get_eta(i));
+  json.endArray();
+  json.beginArray("probeStall");
+  for (int i = 0; i < MAX_PROBES; i++) json.value(probe_predictor_is_stalled(i));
+  json.endArray();
+}
+
+void status_cache_update() {
+  char buffer[STATUS_JSON_BUFFER];
+  JsonWriter json(buffer, sizeof(buffer));
+
+  json.beginObject();
+  status_cache_write_fields(json);
+
+  uint32_t hash = status_hash(json.c_str(), json.length());
+  if (started && hash == lastHash) return;
+
+  if (!started) {
+    sequence = (uint32_t)random(1, 0x7FFFFFFF);
+    started = true;
+  }
+  uint32_t seq = sequence.load() + 1;
+  json.field("seq", seq);
+  json.endObject();
+
+  if (json.overflowed()) {
+    Serial.println("⚠️ /status_all JSON exceeds STATUS_JSON_BUFFER - not published");
+    return;
+  }
+
+  portENTER_CRITICAL(&publishMux);
+  memcpy(published, json.c_str(), json.length());
+  publishedLength = json.length();
+  publishedSeq = seq;
+  portEXIT_CRITICAL(&publishMux);
+
+  lastHash = hash;
+  sequence.store(seq);   // After the copy, so a woken long-poll sees the new text
+}
+
+uint32_t status_cache_get_sequence() {
+  return sequence.load();
+}
+
+size_t status_cache_copy(char* out, size_t capacity, uint32_t* seq) {
+  portENTER_CRITICAL(&publishMux);
+  size_t length = publishedLength;
+  *seq = publishedSeq;
+  if (length > 0 && length <= capacity) {
+    memcpy(out, published, length);
+  } else {
+    length = 0;
+  }
+  portEXIT_CRITICAL(&publishMux);
+  return length;
+}
+
+static void status_send_etag(AsyncWebServerResponse *response, uint32_t seq) {
+  char etag[16];
+  snprintf(etag, sizeof(etag), "\"%lu\"", (unsigned long)seq);
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", "no-cache");   // Always revalidate - 304 is cheap
+}
+
+// Parked long-poll; released when the request is freed
+struct StatusWait {
+  uint32_t since;
+  uint64_t deadline;
+  char body[STATUS_JSON_BUFFER];
+  size_t length;
+  size_t pos;
+  bool ready;
+  ~StatusWait() { parkedCount--; }
+};
+
+static void status_park(AsyncWebServerRequest *req, uint32_t since, unsigned long waitMs) {
+  parkedCount++;
+  std::shared_ptr<StatusWait> wait(new StatusWait());
+  wait->since = since;
+  wait->deadline = clock_ms() + waitMs;
+  wait->length = 0;
+  wait->pos = 0;
+  wait->ready = false;
+
+  AsyncWebServerResponse *response = req->beginChunkedResponse("application/json",
+    [wait](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+      if (!wait->ready) {
+        // Unchanged and still inside the wait - AsyncTCP polls again shortly
+        if (status_cache_get_sequence() == wait->since && !clock_expired(wait->deadline)) {
+          return RESPONSE_TRY_AGAIN;
+        }
+        uint32_t seq;
+        wait->length = status_cache_copy(wait->body, sizeof(wait->body), &seq);
+        wait->ready = true;
+      }
+      size_t chunk = min(wait->length - wait->pos, maxLen);
+      memcpy(buffer, wait->body + wait->pos, chunk);
+      wait->pos += chunk;
+      return chunk;
+    });
+  response->addHeader("Cache-Control", "no-store");
+  req->send(response);
+}
+
+void status_cache_handle_request(AsyncWebServerRequest *req) {
+  uint32_t seq = status_cache_get_sequence();
+  if (seq == 0) {
+    AsyncWebServerResponse *response = req->beginResponse(503, "text/plain", "Starting up");
+    response->addHeader("Retry-After", "1");
+    req->send(response);
+    return;
+  }
+
+  // Long-poll: ?since=<seq>&wait=<ms> holds the reply until the sequence moves
+  if (req->hasParam("since") && req->hasParam("wait")) {
+    uint32_t since = strtoul(req->getParam("since")->value().c_str(), NULL, 10);
+    unsigned long waitMs = min((unsigned long)req->getParam("wait")->value().toInt(),
+                               (unsigned long)STATUS_MAX_WAIT_MS);
+    if (since == seq && waitMs > 0 && parkedCount.load() < STATUS_MAX_PARKED) {
+      status_park(req, since, waitMs);
+      return;
+    }
+  }
+
+  // Conditional GET
+  if (req->hasHeader("If-None-Match")) {
+    char etag[16];
+    snprintf(etag, sizeof(etag), "\"%lu\"", (unsigned long)seq);
+    if (req->getHeader("If-None-Match")->value() == etag) {
+      AsyncWebServerResponse *response = req->beginResponse(304);
+      status_send_etag(response, seq);
+      req->send(response);
+      return;
+    }
+  }
+
+  char buffer[STATUS_JSON_BUFFER];
+  size_t length = status_cache_copy(buffer, sizeof(buffer), &seq);   // ETag must match this copy
+  AsyncResponseStream *response = req->beginResponseStream("application/json", length);
+  response->write((const uint8_t *)buffer, length);
+  status_send_etag(response, seq);
+  req->send(response);
+}
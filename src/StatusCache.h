@@ -0,0 +1,25 @@
+// StatusCache.h - /status_all built once per control cycle, with a change sequence
+//
+// loop() formats the status JSON and bumps the sequence only when the text
+// differs from the last published copy. Handlers serve the cached copy with
+// the sequence as ETag, answer 304 to a matching If-None-Match, and can park
+// a ?since=<seq>&wait=<ms> request until the sequence moves on.
+#ifndef STATUSCACHE_H
+#define STATUSCACHE_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#define STATUS_JSON_BUFFER     1024
+#define STATUS_MAX_WAIT_MS     30000   // Longest long-poll a client may ask for
+#define STATUS_MAX_PARKED      4       // Parked long-polls; more are answered at once
+
+// Cache functions
+void status_cache_update();      // Call from loop() every control cycle
+uint32_t status_cache_get_sequence();
+size_t status_cache_copy(char* out, size_t capacity, uint32_t* seq);   // Length, 0 if too small
+
+// GET /status_all handler
+void status_cache_handle_request(AsyncWebServerRequest *req);
+
+#endif // STATUSCACHE_H
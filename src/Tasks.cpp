@@ -0,0 +1,265 @@
+// Tasks.cpp - FreeRTOS task layout, the queues between tasks and per-task CPU use
+#include "Tasks.h"
+#include "Metrics.h"
+#include "JsonWriter.h"
+#include "Clock.h"
+#include "freertos/queue.h"
+#include "esp_freertos_hooks.h"
+#include <atomic>
+#include <memory>
+
+struct SerialLine {
+  char text[TASK_SERIAL_LINE_MAX];
+};
+
+static TaskHandle_t controlTask = NULL;
+static QueueHandle_t sampleQueue = NULL;   // Length 1, overwritten - latest sample sequence
+static QueueHandle_t cycleQueue = NULL;    // Length 1, overwritten - latest ControlCycle
+static QueueHandle_t serialQueue = NULL;   // TASK_SERIAL_QUEUE_DEPTH complete lines
+
+static portMUX_TYPE snapshotMux = portMUX_INITIALIZER_UNLOCKED;
+static SensorSnapshot snapshot = {0, 0, 70.0, false, 0, -999.0, 0.0, {-999.0, -999.0, -999.0, -999.0}, {false, false, false, false}};
+
+static std::atomic<uint32_t> cycleCount(0);
+static std::atomic<uint32_t> serialDropped(0);
+
+#if !configGENERATE_RUN_TIME_STATS
+// The stock Arduino core ships FreeRTOS prebuilt without run-time counters, so
+// each core's tick hook samples the task it interrupted instead. Over a few
+// minutes the counts converge on each task's share of a core; work shorter than
+// a tick that starts just after one is under-counted.
+struct TaskCpuSamples {
+  TaskHandle_t task;
+  uint32_t ticks;
+};
+
+static portMUX_TYPE cpuMux = portMUX_INITIALIZER_UNLOCKED;
+static TaskCpuSamples cpuSamples[TASK_STATS_MAX];   // First come, never freed - only the boot task exits
+static uint32_t cpuTicks = 0;                         // Samples on all cores
+
+static void IRAM_ATTR tasks_cpu_tick() {
+  TaskHandle_t current = xTaskGetCurrentTaskHandle();
+  portENTER_CRITICAL_ISR(&cpuMux);
+  cpuTicks++;
+  for (int i = 0; i < TASK_STATS_MAX; i++) {
+    if (cpuSamples[i].task == current) {
+      cpuSamples[i].ticks++;
+      break;
+    }
+    if (cpuSamples[i].task == NULL) {
+      cpuSamples[i].task = current;
+      cpuSamples[i].ticks = 1;
+      break;
+    }
+  }
+  portEXIT_CRITICAL_ISR(&cpuMux);
+}
+
+static uint32_t tasks_cpu_samples(TaskHandle_t task, uint32_t* total) {
+  uint32_t ticks = 0;
+  portENTER_CRITICAL(&cpuMux);
+  *total = cpuTicks;
+  for (int i = 0; i < TASK_STATS_MAX && cpuSamples[i].task != NULL; i++) {
+    if (cpuSamples[i].task == task) {
+      ticks = cpuSamples[i].ticks;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&cpuMux);
+  return ticks;
+}
+#endif
+
+void tasks_init() {
+  sampleQueue = xQueueCreate(1, sizeof(uint32_t));
+  cycleQueue = xQueueCreate(1, sizeof(ControlCycle));
+  serialQueue = xQueueCreate(TASK_SERIAL_QUEUE_DEPTH, sizeof(SerialLine));
+
+  controlTask = xTaskGetCurrentTaskHandle();
+  vTaskPrioritySet(NULL, TASK_CONTROL_PRIORITY);
+
+#if !configGENERATE_RUN_TIME_STATS
+  for (int core = 0; core < portNUM_PROCESSORS; core++) {
+    if (esp_register_freertos_tick_hook_for_cpu(tasks_cpu_tick, core) != ESP_OK) {
+      Serial.printf("⚠️ CPU sampling unavailable on core %d\n", core);
+    }
+  }
+#endif
+}
+
+bool tasks_create(const TaskSpec& spec) {
+  TaskHandle_t handle;
+  if (xTaskCreatePinnedToCore(spec.function, spec.name, spec.stack, NULL, spec.priority,
+                              &handle, spec.core) != pdPASS) {
+    Serial.printf("❌ Task '%s' creation failed\n", spec.name);
+    return false;
+  }
+  metrics_register_task(spec.name, handle);
+  return true;
+}
+
+TaskHandle_t tasks_get_control_handle() {
+  return controlTask;
+}
+
+void tasks_publish_sample(SensorSnapshot& sample) {
+  portENTER_CRITICAL(&snapshotMux);
+  sample.sequence = snapshot.sequence + 1;
+  snapshot = sample;
+  portEXIT_CRITICAL(&snapshotMux);
+
+  xQueueOverwrite(sampleQueue, &sample.sequence);
+}
+
+bool tasks_wait_sample(TickType_t wait) {
+  uint32_t sequence;
+  return xQueueReceive(sampleQueue, &sequence, wait) == pdTRUE;
+}
+
+bool tasks_get_sample(SensorSnapshot* out) {
+  portENTER_CRITICAL(&snapshotMux);
+  *out = snapshot;
+  portEXIT_CRITICAL(&snapshotMux);
+  return out->sequence != 0;
+}
+
+void tasks_publish_cycle(const TelemetryFrame* frame) {
+  ControlCycle item;
+  item.cycle = cycleCount.fetch_add(1, std::memory_order_relaxed) + 1;
+  item.haveFrame = (frame != NULL);
+  if (frame) {
+    item.frame = *frame;
+  } else {
+    memset(&item.frame, 0, sizeof(item.frame));
+  }
+  xQueueOverwrite(cycleQueue, &item);
+}
+
+bool tasks_wait_cycle(ControlCycle* out, TickType_t wait) {
+  return xQueueReceive(cycleQueue, out, wait) == pdTRUE;
+}
+
+bool tasks_post_serial_line(const char* line) {
+  SerialLine item;
+  snprintf(item.text, sizeof(item.text), "%s", line);
+  if (xQueueSend(serialQueue, &item, 0) != pdTRUE) {
+    serialDropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+bool tasks_next_serial_line(char* line) {
+  SerialLine item;
+  if (xQueueReceive(serialQueue, &item, 0) != pdTRUE) return false;
+  memcpy(line, item.text, TASK_SERIAL_LINE_MAX);
+  return true;
+}
+
+#if configUSE_TRACE_FACILITY
+static const char* task_state_name(eTaskState state) {
+  switch (state) {
+    case eRunning:   return "running";
+    case eReady:     return "ready";
+    case eBlocked:   return "blocked";
+    case eSuspended: return "suspended";
+    case eDeleted:   return "deleted";
+    default:         return "unknown";
+  }
+}
+#endif
+
+String tasks_get_stats_json() {
+  SensorSnapshot sample;
+  bool haveSample = tasks_get_sample(&sample);
+
+  std::unique_ptr<char[]> buffer(new char[TASK_STATS_JSON_BUFFER]);   // Too big for the async_tcp stack
+  JsonWriter json(buffer.get(), TASK_STATS_JSON_BUFFER);
+
+  json.beginObject();
+  json.field("uptimeSec", (unsigned long)(clock_ms() / 1000));
+  json.field("sampleSequence", (unsigned long)sample.sequence);
+  if (haveSample) {
+    json.field("sampleAgeMs", (unsigned long)clock_elapsed_ms(sample.takenMs));
+  } else {
+    json.fieldNull("sampleAgeMs");
+  }
+  json.field("controlCycles", (unsigned long)cycleCount.load(std::memory_order_relaxed));
+  json.field("serialLinesDropped", (unsigned long)serialDropped.load(std::memory_order_relaxed));
+  json.field("runTimeStats", (bool)configGENERATE_RUN_TIME_STATS);
+  json.field("cpuSource", configGENERATE_RUN_TIME_STATS ? "runtime" : "tick-sampled");
+
+#if configUSE_TRACE_FACILITY
+  std::unique_ptr<TaskStatus_t[]> status(new TaskStatus_t[TASK_STATS_MAX]);
+  uint32_t totalRunTime = 0;
+  UBaseType_t count = uxTaskGetSystemState(status.get(), TASK_STATS_MAX, &totalRunTime);
+  if (count == 0 && uxTaskGetNumberOfTasks() > TASK_STATS_MAX) {
+    json.field("error", "more tasks than TASK_STATS_MAX");
+  }
+
+  json.beginArray("tasks");
+  for (UBaseType_t i = 0; i < count; i++) {
+    const TaskStatus_t& task = status[i];
+    json.beginObject();
+    json.field("name", task.pcTaskName);
+    json.field("priority", (unsigned long)task.uxCurrentPriority);
+    json.field("state", task_state_name(task.eCurrentState));
+    json.field("stackFree", (unsigned long)task.usStackHighWaterMark);
+#if configGENERATE_RUN_TIME_STATS
+    // Share of one core since boot - the same figure vTaskGetRunTimeStats prints
+    json.field("runTime", (unsigned long)task.ulRunTimeCounter);
+    if (totalRunTime > 0) {
+      json.field("cpuPercent", (float)(task.ulRunTimeCounter * 100.0 / totalRunTime), 1);
+    } else {
+      json.fieldNull("cpuPercent");
+    }
+#else
+    // Ticks sampled on either core; scaled to a share of one core like the above
+    uint32_t ticks = tasks_cpu_samples(task.xHandle, &totalRunTime);
+    json.field("runTime", (unsigned long)ticks);
+    if (totalRunTime > 0) {
+      json.field("cpuPercent", (float)(ticks * 100.0 * portNUM_PROCESSORS / totalRunTime), 1);
+    } else {
+      json.fieldNull("cpuPercent");
+    }
+#endif
+    json.endObject();
+  }
+  json.endArray();
+#else
+  json.field("error", "task listing needs configUSE_TRACE_FACILITY");
+#endif
+
+  json.endObject();
+  return String(json.c_str());
+}
+
+void tasks_send_runtime_stats(AsyncWebServerRequest *req) {
+#if configGENERATE_RUN_TIME_STATS && configUSE_STATS_FORMATTING_FUNCTIONS
+  // About 40 bytes per task; vTaskGetRunTimeStats does not bound its output
+  size_t capacity = (uxTaskGetNumberOfTasks() + 4) * 48;
+  std::unique_ptr<char[]> buffer(new char[capacity]);
+  buffer[0] = '\0';
+  vTaskGetRunTimeStats(buffer.get());
+  req->send(200, "text/plain", String("Task            Abs time        % time\n") + buffer.get());
+#elif !configGENERATE_RUN_TIME_STATS && configUSE_TRACE_FACILITY
+  // Same columns from the tick samples; "Abs time" is in ticks
+  std::unique_ptr<TaskStatus_t[]> status(new TaskStatus_t[TASK_STATS_MAX]);
+  UBaseType_t count = uxTaskGetSystemState(status.get(), TASK_STATS_MAX, NULL);
+  size_t capacity = (count + 4) * 48;
+  std::unique_ptr<char[]> buffer(new char[capacity]);
+  size_t length = snprintf(buffer.get(), capacity, "Task            Abs time        %% time\n");
+  for (UBaseType_t i = 0; i < count && length < capacity; i++) {
+    uint32_t total = 0;
+    uint32_t ticks = tasks_cpu_samples(status[i].xHandle, &total);
+    unsigned long percent = total > 0 ? (unsigned long)((uint64_t)ticks * 100 * portNUM_PROCESSORS / total) : 0;
+    length += snprintf(buffer.get() + length, capacity - length, "%-16s%-16lu%lu%%\n",
+                       status[i].pcTaskName, (unsigned long)ticks, percent);
+  }
+  req->send(200, "text/plain", buffer.get());
+#else
+  req->send(501, "text/plain",
+            "Run-time stats are not compiled in - build with CONFIG_FREERTOS_USE_TRACE_FACILITY, and with "
+            "CONFIG_FREERTOS_USE_STATS_FORMATTING_FUNCTIONS when run-time counters are on\n");
+#endif
+}
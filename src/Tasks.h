@@ -0,0 +1,107 @@
+// Tasks.h - FreeRTOS task layout, the queues between tasks and per-task CPU use
+//
+//   task          core  prio  runs                 work
+//   acquisition    1     5    every 1 s            MAX31865, ambient NTC, meat probes -> sensor snapshot
+//   control        1     4    sample or 100 ms     commands, buttons, relays; control cycle per sample
+//   ui             1     1    every 100 ms         OLED pages, serial line input, sensor tests
+//   network        0     2    cycle or 100 ms      WiFi manager; SSE, beacon, MQTT after each cycle
+//   logging        0     1    every 1 s            health checks, status print
+//
+// Control is the Arduino loop task, raised to its priority by tasks_init().
+// WiFi/lwIP and AsyncTCP (priority 3) also run on core 0, so nothing network
+// can delay a control cycle. Acquisition outranks control so a sample is
+// never half-written while control runs.
+//
+// Tasks hand over through bounded queues: acquisition wakes control with each
+// sample (latest wins), control wakes network after each cycle (latest wins),
+// and ui passes complete serial lines to control (dropped when full), apart
+// from the blocking sensor tests, which it runs itself. Sensor values are
+// read from the snapshot; control state reaches HTTP through the status cache
+// it rebuilds every cycle. The ADS1115 and the OLED share I2C between
+// acquisition and ui through Wire's bus lock.
+#ifndef TASKS_H
+#define TASKS_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "TemperatureSensor.h"
+#include "TelemetryCodec.h"
+
+#define TASK_ACQUISITION_CORE      1
+#define TASK_ACQUISITION_PRIORITY  5
+#define TASK_ACQUISITION_STACK     4096
+#define TASK_CONTROL_PRIORITY      4       // Arduino loop task, already on core 1
+#define TASK_UI_CORE               1
+#define TASK_UI_PRIORITY           1
+#define TASK_UI_STACK              4096
+#define TASK_NETWORK_CORE          0
+#define TASK_NETWORK_PRIORITY      2       // Below AsyncTCP, so web requests stay responsive
+#define TASK_NETWORK_STACK         6144    // MQTT and SSE payload formatting
+#define TASK_LOGGING_CORE          0
+#define TASK_LOGGING_PRIORITY      1
+#define TASK_LOGGING_STACK         4096
+
+#define TASK_UI_PERIOD_MS          100
+#define TASK_LOGGING_PERIOD_MS     1000
+#define TASK_SAMPLE_STALE_MS       2000    // Control cycles on time if no sample arrives for this long
+#define TASK_SERIAL_LINE_MAX       64
+#define TASK_SERIAL_QUEUE_DEPTH    4
+#define TASK_STATS_MAX             32      // Tasks listed by /task_stats
+#define TASK_STATS_JSON_BUFFER     3072
+
+struct TaskSpec {
+  const char* name;
+  TaskFunction_t function;
+  uint32_t stack;
+  UBaseType_t priority;
+  BaseType_t core;
+};
+
+// Latest sensor readings - written by acquisition, read from any task. Only
+// acquisition touches the MAX31865, the ambient ADC and the ADS1115.
+struct SensorSnapshot {
+  uint32_t sequence;        // 0 = no sample yet
+  uint64_t takenMs;
+  double grillF;            // Last valid MAX31865 reading
+  bool grillValid;          // This sample's MAX31865 read passed validation (else grillF is held)
+  uint64_t grillValidMs;    // clock_ms() of the last valid MAX31865 read, 0 = none yet
+  double ambientF;          // -999 when the thermistor reads open or shorted
+  float rtdOhms;            // MAX31865 resistance
+  float probeF[MAX_PROBES];         // Meat probes 1-4 (index 0-3); -999 when absent
+  bool probeValid[MAX_PROBES];      // This sample passed validation (else probeF is a recent fallback)
+};
+
+// One finished control cycle - a copy, so network never reads control's buffers
+struct ControlCycle {
+  uint32_t cycle;
+  bool haveFrame;           // False until history holds a sample
+  TelemetryFrame frame;     // This cycle's 1 s history sample, for the beacon
+};
+
+// Setup, from setup() on the loop task: queues, control priority
+void tasks_init();
+bool tasks_create(const TaskSpec& spec);   // Pinned, and registered for /metrics stack watermarks
+TaskHandle_t tasks_get_control_handle();
+
+// acquisition -> control
+void tasks_publish_sample(SensorSnapshot& sample);   // Assigns the sequence
+bool tasks_wait_sample(TickType_t wait);              // True when a new sample arrived
+bool tasks_get_sample(SensorSnapshot* out);           // False before the first sample
+
+// control -> network
+void tasks_publish_cycle(const TelemetryFrame* frame);   // NULL before the first history sample
+bool tasks_wait_cycle(ControlCycle* out, TickType_t wait);
+
+// ui -> control
+bool tasks_post_serial_line(const char* line);        // False (and counted) when the queue is full
+bool tasks_next_serial_line(char* line);              // TASK_SERIAL_LINE_MAX bytes
+
+// Per-task priority, stack and CPU use; GET /task_stats (JSON), /task_stats.txt (vTaskGetRunTimeStats
+// layout). CPU comes from FreeRTOS run-time counters when the core has them,
+// otherwise from tick-hook sampling (cpuSource in the JSON says which)
+String tasks_get_stats_json();
+void tasks_send_runtime_stats(AsyncWebServerRequest *req);
+
+#endif // TASKS_H
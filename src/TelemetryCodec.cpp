@@ -0,0 +1,110 @@
+// TelemetryCodec.cpp - Compact binary encoding for 1 s telemetry samples
+#include "TelemetryCodec.h"
+
+static size_t put_varint(uint32_t value, uint8_t* out) {
+  size_t n = 0;
+  while (value >= 0x80) {
+    out[n++] = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  out[n++] = (uint8_t)value;
+  return n;
+}
+
+static uint32_t zigzag(int32_t value) {
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+void telemetry_encoder_init(TelemetryEncoder* encoder, uint32_t keyframeEvery) {
+  for (int c = 0; c < TELEMETRY_CODEC_CHANNELS; c++) {
+    encoder->last[c] = 0;
+  }
+  encoder->hasReference = 0;
+  encoder->presence = 0;
+  encoder->frameIndex = 0;
+  encoder->keyframeEvery = keyframeEvery > 0 ? keyframeEvery : 1;
+}
+
+size_t telemetry_encode_header(const TelemetryEncoder* encoder, uint32_t periodSec, uint32_t startTime,
+                               uint32_t frameCount, uint8_t* out, size_t capacity) {
+  if (capacity < TELEMETRY_CODEC_MAX_HEADER) return 0;
+
+  size_t n = 0;
+  out[n++] = 'G';
+  out[n++] = 'T';
+  out[n++] = TELEMETRY_CODEC_VERSION;
+  out[n++] = TELEMETRY_CODEC_CHANNELS;
+  n += put_varint(periodSec, out + n);
+  n += put_varint(startTime, out + n);
+  n += put_varint(frameCount, out + n);
+  n += put_varint(encoder->keyframeEvery, out + n);
+  return n;
+}
+
+size_t telemetry_encode_frame(TelemetryEncoder* encoder, const TelemetryFrame* frame,
+                              uint8_t* out, size_t capacity) {
+  if (capacity < TELEMETRY_CODEC_MAX_FRAME) return 0;
+
+  bool keyframe = (encoder->frameIndex % encoder->keyframeEvery) == 0;
+  if (keyframe) encoder->hasReference = 0;
+
+  uint8_t presence = 0;
+  for (int c = 0; c < TELEMETRY_CODEC_CHANNELS; c++) {
+    if (frame->temp[c] != TELEMETRY_CODEC_NO_VALUE) presence |= (1 << c);
+  }
+
+  uint8_t flags = frame->relays & TELEMETRY_FLAG_RELAYS;
+  if (keyframe) flags |= TELEMETRY_FLAG_KEYFRAME;
+  if (keyframe || presence != encoder->presence) flags |= TELEMETRY_FLAG_PRESENCE;
+
+  size_t n = 0;
+  out[n++] = flags;
+  if (flags & TELEMETRY_FLAG_PRESENCE) out[n++] = presence;
+
+  for (int c = 0; c < TELEMETRY_CODEC_CHANNELS; c++) {
+    if (!(presence & (1 << c))) continue;
+
+    int32_t value = frame->temp[c];
+    if (encoder->hasReference & (1 << c)) {
+      n += put_varint(zigzag(value - encoder->last[c]), out + n);
+    } else {
+      n += put_varint(zigzag(value), out + n);
+      encoder->hasReference |= (1 << c);
+    }
+    encoder->last[c] = frame->temp[c];
+  }
+
+  encoder->presence = presence;
+  encoder->frameIndex++;
+  return n;
+}
+
+size_t telemetry_encode_beacon(const TelemetryBeacon* beacon, uint8_t* out, size_t capacity) {
+  if (capacity < TELEMETRY_BEACON_MAX) return 0;
+
+  size_t n = 0;
+  out[n++] = 'G';
+  out[n++] = 'B';
+  out[n++] = TELEMETRY_BEACON_VERSION;
+  for (int i = 0; i < 6; i++) out[n++] = beacon->deviceId[i];
+  n += put_varint(beacon->sequence, out + n);
+  n += put_varint(beacon->uptimeSec, out + n);
+  out[n++] = beacon->state;
+  out[n++] = beacon->ignition;
+  n += put_varint(beacon->setpoint, out + n);
+  n += put_varint(beacon->hopperTenthsLb, out + n);
+  out[n++] = beacon->blowerDuty;
+
+  size_t nameLength = 0;
+  if (beacon->name) {
+    while (nameLength < TELEMETRY_BEACON_NAME_MAX && beacon->name[nameLength]) nameLength++;
+  }
+  out[n++] = (uint8_t)nameLength;
+  for (size_t i = 0; i < nameLength; i++) out[n++] = (uint8_t)beacon->name[i];
+
+  // A fresh encoder makes the frame a keyframe with absolute values
+  TelemetryEncoder encoder;
+  telemetry_encoder_init(&encoder, 1);
+  n += telemetry_encode_frame(&encoder, &beacon->frame, out + n, capacity - n);
+  return n;
+}
@@ -0,0 +1,108 @@
+// TelemetryCodec.h - Compact binary encoding for 1 s telemetry samples
+//
+// Stream layout (all integers are unsigned LEB128 varints unless noted):
+//
+//   Header
+//     magic         2 bytes  'G' 'T'
+//     version       1 byte   TELEMETRY_CODEC_VERSION
+//     channels      1 byte   TELEMETRY_CODEC_CHANNELS (grill, ambient, probe 1-4)
+//     periodSec     varint   seconds between frames
+//     startTime     varint   seconds of uptime of the first frame
+//     frameCount    varint   frames that follow
+//     keyframeEvery varint   a keyframe starts every this many frames
+//
+//   Frame (one per period, gaps included)
+//     flags         1 byte   bits 0-3 relay states (igniter, auger, hopper fan,
+//                            blower fan), bit 4 keyframe, bit 5 presence byte follows
+//     presence      1 byte   bit n set = channel n has a reading; only sent on
+//                            keyframes and when it changes, otherwise unchanged
+//     values        one zigzag varint per present channel, in 0.1°F: the
+//                   absolute value on a keyframe or for a channel's first
+//                   reading after one, otherwise the change since that
+//                   channel's previous reading
+//
+// With temperatures moving a degree or less per second a frame is the flags
+// byte plus one byte per channel - 7 bytes against ~60 for a CSV row.
+// tools/decode_telemetry.py is the reference decoder.
+//
+// Beacon (one UDP multicast packet per control cycle, see Beacon.h). Each
+// packet stands alone, so a listener can join or drop packets at any time:
+//     magic         2 bytes  'G' 'B'
+//     version       1 byte   TELEMETRY_BEACON_VERSION
+//     deviceId      6 bytes  station MAC
+//     sequence      varint   beacons sent since boot
+//     uptimeSec     varint
+//     state         1 byte   TELEMETRY_BEACON_* bits
+//     ignition      1 byte   IgnitionState
+//     setpoint      varint   °F
+//     hopper        varint   0.1 lb of pellets left
+//     blowerDuty    1 byte   percent
+//     nameLength    1 byte   then that many bytes of hostname, not terminated
+//     frame         a keyframe in the stream frame format above
+// A typical beacon is about 40 bytes. tools/beacon_listen.py decodes them.
+#ifndef TELEMETRYCODEC_H
+#define TELEMETRYCODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define TELEMETRY_CODEC_VERSION      1
+#define TELEMETRY_CODEC_CHANNELS     6
+#define TELEMETRY_CODEC_KEYFRAME     60    // Frames between keyframes
+#define TELEMETRY_CODEC_NO_VALUE     INT16_MIN
+
+#define TELEMETRY_FLAG_RELAYS        0x0F
+#define TELEMETRY_FLAG_KEYFRAME      0x10
+#define TELEMETRY_FLAG_PRESENCE      0x20
+
+#define TELEMETRY_BEACON_VERSION     1
+#define TELEMETRY_BEACON_NAME_MAX    24
+
+#define TELEMETRY_BEACON_RUNNING     0x01
+#define TELEMETRY_BEACON_MANUAL      0x02
+#define TELEMETRY_BEACON_HOPPER_LOW  0x04
+#define TELEMETRY_BEACON_ALARM       0x08
+#define TELEMETRY_BEACON_SMOKE       0x10
+
+// Worst case sizes, for sizing output buffers
+#define TELEMETRY_CODEC_MAX_HEADER   24
+#define TELEMETRY_CODEC_MAX_FRAME    (2 + TELEMETRY_CODEC_CHANNELS * 3)
+
+struct TelemetryFrame {
+  int16_t temp[TELEMETRY_CODEC_CHANNELS];   // 0.1°F, TELEMETRY_CODEC_NO_VALUE if missing
+  uint8_t relays;                           // Bitmask, bit order as in the flags byte
+};
+
+struct TelemetryBeacon {
+  uint8_t deviceId[6];
+  uint32_t sequence;
+  uint32_t uptimeSec;
+  uint8_t state;
+  uint8_t ignition;
+  uint16_t setpoint;
+  uint16_t hopperTenthsLb;
+  uint8_t blowerDuty;
+  const char* name;                         // Truncated to TELEMETRY_BEACON_NAME_MAX
+  TelemetryFrame frame;
+};
+
+#define TELEMETRY_BEACON_MAX         (3 + 6 + 5 + 5 + 2 + 3 + 3 + 1 + 1 + TELEMETRY_BEACON_NAME_MAX + TELEMETRY_CODEC_MAX_FRAME)
+
+// Delta state carried between frames
+struct TelemetryEncoder {
+  int16_t last[TELEMETRY_CODEC_CHANNELS];
+  uint8_t hasReference;   // Channels with a reading since the last keyframe
+  uint8_t presence;       // Presence byte of the previous frame
+  uint32_t frameIndex;
+  uint32_t keyframeEvery;
+};
+
+// Codec functions - return bytes written, 0 if out is too small
+void telemetry_encoder_init(TelemetryEncoder* encoder, uint32_t keyframeEvery);
+size_t telemetry_encode_header(const TelemetryEncoder* encoder, uint32_t periodSec, uint32_t startTime,
+                               uint32_t frameCount, uint8_t* out, size_t capacity);
+size_t telemetry_encode_frame(TelemetryEncoder* encoder, const TelemetryFrame* frame,
+                              uint8_t* out, size_t capacity);
+size_t telemetry_encode_beacon(const TelemetryBeacon* beacon, uint8_t* out, size_t capacity);
+
+#endif // TELEMETRYCODEC_H
@@ -0,0 +1,210 @@
+// TelemetryPush.cpp - One telemetry snapshot per control cycle, pushed to every client
+//
+// The network task samples the field table once per control cycle and
+// broadcasts it on /events, so the sensors are read once no matter how many
+// browsers are open. A "snapshot" event carries every field; a "delta" event
+// carries only fields whose formatted value changed since the last send. A
+// snapshot goes out when a client connects and every TELEMETRY_KEYFRAME_MS.
+#include "TelemetryPush.h"
+#include "GrillWebServer.h"
+#include "Globals.h"
+#include "Utility.h"
+#include "TemperatureSensor.h"
+#include "RelayControl.h"
+#include "Ignition.h"
+#include "FanControl.h"
+#include "PelletAccounting.h"
+#include "ProbeAlarm.h"
+#include "ProbePredictor.h"
+#include "Clock.h"
+#include <WiFi.h>
+#include <atomic>
+
+typedef String (*TelemetryFieldReader)();
+
+static AsyncEventSource events("/events");
+static std::atomic<bool> snapshotRequested(false);  // Set from the AsyncTCP task on connect
+
+static uint32_t eventId = 0;
+static uint64_t lastKeyframe = 0;
+static uint32_t snapshotCount = 0;
+static uint32_t deltaCount = 0;
+static uint32_t totalBytes = 0;
+
+static uint64_t rateWindowStart = 0;
+static uint32_t rateWindowBytes = 0;
+static float bytesPerSec = 0.0;
+
+static String json_bool(bool value) {
+  return value ? "true" : "false";
+}
+
+static String json_string(const String& value) {
+  return "\"" + value + "\"";
+}
+
+// Field readers - each returns the JSON-encoded value. Sensor fields come from
+// the acquisition snapshot; this task never touches the SPI or I2C sensors.
+static String field_ip()             { return json_string(WiFi.localIP().toString()); }
+static String field_grill_temp()     { return String(readGrillTemperature(), 1); }
+static String field_ambient_temp()   { return String(readAmbientTemperature(), 1); }
+static String field_meat1_temp()     { return String(readProbeTemperature(1), 1); }
+static String field_meat2_temp()     { return String(readProbeTemperature(2), 1); }
+static String field_meat3_temp()     { return String(readProbeTemperature(3), 1); }
+static String field_meat4_temp()     { return String(readProbeTemperature(4), 1); }
+static String field_rtd_ohms()       { return String(readGrillResistance(), 2); }
+static String field_setpoint()       { return String((int)setpoint); }
+static String field_status()         { return json_string(getStatus(readGrillTemperature())); }
+static String field_grill_running()  { return json_bool(grillRunning); }
+static String field_ignition_state() { return json_string(ignition_get_status_string()); }
+static String field_ign_on()         { return json_bool(digitalRead(RELAY_IGNITER_PIN) == HIGH); }
+static String field_auger_on()       { return json_bool(digitalRead(RELAY_AUGER_PIN) == HIGH); }
+static String field_hopper_on()      { return json_bool(digitalRead(RELAY_HOPPER_FAN_PIN) == HIGH); }
+static String field_blower_on()      { return json_bool(digitalRead(RELAY_BLOWER_FAN_PIN) == HIGH); }
+static String field_manual()         { return json_bool(relay_get_manual_override_status()); }
+static String field_smoke_mode()     { return json_bool(fan_get_smoke_mode()); }
+static String field_fan_mode()       { return json_string(fan_get_mode_string()); }
+static String field_blower_duty()    { return String(relay_get_blower_duty()); }
+static String field_hopper_lb()      { return String(pellet_get_hopper_remaining_lb(), 1); }
+static String field_hopper_low()     { return json_bool(pellet_is_hopper_low()); }
+static String field_cook_lb()        { return String(pellet_get_cook_lb(), 2); }
+static String field_burn_rate()      { return String(pellet_get_burn_rate(), 2); }
+static String field_alarm_seq()      { return String(probe_alarm_get_sequence()); }
+static String field_alarm_active()   { return String(probe_alarm_get_active_mask()); }
+static String field_alarm_text()     { return json_string(probe_alarm_get_active_text()); }
+
+static String field_probe_eta() {
+  String value = "[";
+  for (int i = 0; i < MAX_PROBES; i++) {
+    if (i > 0) value += ",";
+    value += String(probe_predictor_get_eta(i));
+  }
+  return value + "]";
+}
+
+static String field_probe_stall() {
+  String value = "[";
+  for (int i = 0; i < MAX_PROBES; i++) {
+    if (i > 0) value += ",";
+    value += json_bool(probe_predictor_is_stalled(i));
+  }
+  return value + "]";
+}
+
+// Same field names as /status_all, plus rtdOhms for the /max31865 page
+static const struct {
+  const char* name;
+  TelemetryFieldReader read;
+} TELEMETRY_FIELDS[] = {
+  {"ip",             field_ip},
+  {"grillTemp",      field_grill_temp},
+  {"ambientTemp",    field_ambient_temp},
+  {"meat1Temp",      field_meat1_temp},
+  {"meat2Temp",      field_meat2_temp},
+  {"meat3Temp",      field_meat3_temp},
+  {"meat4Temp",      field_meat4_temp},
+  {"rtdOhms",        field_rtd_ohms},
+  {"setpoint",       field_setpoint},
+  {"status",         field_status},
+  {"grillRunning",   field_grill_running},
+  {"ignitionState",  field_ignition_state},
+  {"ignOn",          field_ign_on},
+  {"augerOn",        field_auger_on},
+  {"hopperOn",       field_hopper_on},
+  {"blowerOn",       field_blower_on},
+  {"manualOverride", field_manual},
+  {"smokeMode",      field_smoke_mode},
+  {"fanMode",        field_fan_mode},
+  {"blowerDuty",     field_blower_duty},
+  {"hopperLb",       field_hopper_lb},
+  {"hopperLow",      field_hopper_low},
+  {"cookLb",         field_cook_lb},
+  {"burnRate",       field_burn_rate},
+  {"alarmSeq",       field_alarm_seq},
+  {"alarmActive",    field_alarm_active},
+  {"alarmText",      field_alarm_text},
+  {"probeEta",       field_probe_eta},
+  {"probeStall",     field_probe_stall},
+};
+
+#define TELEMETRY_FIELD_COUNT (sizeof(TELEMETRY_FIELDS) / sizeof(TELEMETRY_FIELDS[0]))
+
+static String lastValues[TELEMETRY_FIELD_COUNT];
+
+void telemetry_push_init() {
+  events.onConnect([](AsyncEventSourceClient *client) {
+    // Answered by the network task on the next cycle; sending here would race the sampler
+    snapshotRequested = true;
+  });
+  server.addHandler(&events);
+
+  rateWindowStart = clock_ms();
+  Serial.printf("Telemetry stream on /events: %d fields\n", (int)TELEMETRY_FIELD_COUNT);
+}
+
+static void telemetry_update_rate(uint64_t now, size_t bytes) {
+  rateWindowBytes += bytes;
+  uint64_t elapsed = now - rateWindowStart;
+  if (elapsed >= TELEMETRY_RATE_WINDOW_MS) {
+    bytesPerSec = rateWindowBytes * 1000.0 / elapsed;
+    rateWindowBytes = 0;
+    rateWindowStart = now;
+  }
+}
+
+void telemetry_push_update() {
+  uint64_t now = clock_ms();
+
+  // Nobody listening - skip the sensor reads; a new client asks for a snapshot
+  if (events.count() == 0) {
+    telemetry_update_rate(now, 0);
+    return;
+  }
+
+  bool keyframe = snapshotRequested.exchange(false) || now - lastKeyframe >= TELEMETRY_KEYFRAME_MS;
+
+  String json = "{";
+  int changed = 0;
+  for (size_t i = 0; i < TELEMETRY_FIELD_COUNT; i++) {
+    String value = TELEMETRY_FIELDS[i].read();
+    if (!keyframe && value == lastValues[i]) continue;
+
+    if (changed++ > 0) json += ",";
+    json += "\"" + String(TELEMETRY_FIELDS[i].name) + "\":" + value;
+    lastValues[i] = value;
+  }
+  json += "}";
+
+  if (changed == 0) {
+    telemetry_update_rate(now, 0);
+    return;
+  }
+
+  eventId++;
+  events.send(json.c_str(), keyframe ? "snapshot" : "delta", eventId);
+
+  if (keyframe) {
+    snapshotCount++;
+    lastKeyframe = now;
+  } else {
+    deltaCount++;
+  }
+  totalBytes += json.length();
+  telemetry_update_rate(now, json.length());
+}
+
+int telemetry_push_get_client_count() {
+  return events.count();
+}
+
+String telemetry_push_get_stats_json() {
+  String json = "{";
+  json += "\"clients\":" + String(telemetry_push_get_client_count()) + ",";
+  json += "\"bytesPerSec\":" + String(bytesPerSec, 1) + ",";
+  json += "\"totalBytes\":" + String(totalBytes) + ",";
+  json += "\"snapshots\":" + String(snapshotCount) + ",";
+  json += "\"deltas\":" + String(deltaCount) + ",";
+  json += "\"lastEventId\":" + String(eventId);
+  json += "}";
+  return json;
+}
@@ -0,0 +1,20 @@
+// TelemetryPush.h - Server-sent event stream of live grill telemetry
+#ifndef TELEMETRYPUSH_H
+#define TELEMETRYPUSH_H
+
+#include <Arduino.h>
+
+// Full snapshot at least this often, so a client that missed a delta recovers
+#define TELEMETRY_KEYFRAME_MS      60000
+// Bytes/sec averaging window
+#define TELEMETRY_RATE_WINDOW_MS   10000
+
+// Stream functions
+void telemetry_push_init();      // Registers /events - call before server.begin()
+void telemetry_push_update();    // Call once per control cycle from the network task
+
+// Status
+int telemetry_push_get_client_count();
+String telemetry_push_get_stats_json();
+
+#endif // TELEMETRYPUSH_H
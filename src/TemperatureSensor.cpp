@@ -1,6 +1,8 @@
 // TemperatureSensor.cpp - Complete file with individual debug support
 #include "TemperatureSensor.h"
 #include "Utility.h"  // Include to access debug flags
+#include "Clock.h"
+#include "Metrics.h"
 #include <math.h>
 
 TemperatureSensor tempSensor;
@@ -17,6 +19,11 @@ TemperatureSensor::TemperatureSensor() : initialized(false) {
     probes[i].lastUpdate = 0;
     probes[i].lastValidTemp = 70.0;  // Room temperature default
     probes[i].isValid = false;
+    probes[i].targetTemp = 0.0;
+    probes[i].alarmHigh = 0.0;
+    probes[i].alarmLow = 0.0;
+    probes[i].alarmHysteresis = 2.0;
+    probes[i].keepWarmOnTarget = false;
   }
 }
 
@@ -173,13 +180,17 @@ float TemperatureSensor::readProbe(int probeIndex) {
   int16_t adcValue = -1;
   int retries = 3;
   
+  metrics_count(METRIC_PROBE_READS);
   for (int i = 0; i < retries; i++) {
+    uint64_t readStart = clock_us();
     adcValue = ads.readADC_SingleEnded(probeIndex);
+    metrics_observe(METRIC_I2C_READ_US, (uint32_t)(clock_us() - readStart));
     if (adcValue != -1) break;
     delay(10);
   }
   
   if (adcValue == -1) {
+    metrics_count(METRIC_PROBE_ERRORS);
     if (getMeatProbesDebug()) {
       Serial.printf("🔴 MEAT PROBE %d: Failed to read ADC\n", probeIndex);
     }
@@ -219,17 +230,18 @@ float TemperatureSensor::readProbe(int probeIndex) {
   if (validateTemperature(temp, probeIndex)) {
     probes[probeIndex].lastValidTemp = temp;
     probes[probeIndex].isValid = true;
-    probes[probeIndex].lastUpdate = millis();
+    probes[probeIndex].lastUpdate = clock_ms();
     return temp;
   } else {
     probes[probeIndex].isValid = false;
+    metrics_count(METRIC_PROBE_ERRORS);
     
     if (getMeatProbesDebug()) {
       Serial.printf("🔴 MEAT PROBE %d: Temperature %.1f°F failed validation\n", probeIndex, temp);
     }
     
     // Use last valid reading if recent (within 30 seconds)
-    if ((millis() - probes[probeIndex].lastUpdate) < 30000) {
+    if (clock_elapsed_ms(probes[probeIndex].lastUpdate) < 30000) {
       if (getMeatProbesDebug()) {
         Serial.printf("🔄 MEAT PROBE %d: Using last valid reading %.1f°F\n", 
                       probeIndex, probes[probeIndex].lastValidTemp);
@@ -266,19 +278,15 @@ ProbeType TemperatureSensor::getProbeType(int probeIndex) {
   return probes[probeIndex].type;
 }
 
-void TemperatureSensor::updateAll() {
-  if (!initialized) return;
-  
-  static unsigned long lastUpdate = 0;
-  
-  // Update all probes every 1 second
-  if (millis() - lastUpdate >= 1000) {
-    for (int i = 0; i < MAX_PROBES; i++) {
-      if (probes[i].enabled) {
-        readProbe(i);  // This updates the probe data
-      }
+void TemperatureSensor::updateAll(float* temps, bool* valid) {
+  // Once per sample - the acquisition task sets the pace (Tasks.h)
+  for (int i = 0; i < MAX_PROBES; i++) {
+    temps[i] = -999.0;
+    valid[i] = false;
+    if (initialized && probes[i].enabled) {
+      temps[i] = readProbe(i);  // This updates the probe data
+      valid[i] = probes[i].isValid;
     }
-    lastUpdate = millis();
   }
 }
 
@@ -295,39 +303,6 @@ void TemperatureSensor::calibrateProbe(int probeIndex, float actualTemp) {
   }
 }
 
-String TemperatureSensor::getProbeDataJSON() {
-  String json = "{\"probes\":[";
-  
-  for (int i = 0; i < MAX_PROBES; i++) {
-    if (i > 0) json += ",";
-    
-    json += "{";
-    json += "\"index\":" + String(i) + ",";
-    json += "\"name\":\"" + probes[i].name + "\",";
-    json += "\"enabled\":" + String(probes[i].enabled ? "true" : "false") + ",";
-    json += "\"type\":" + String((int)probes[i].type) + ",";
-    
-    if (probes[i].enabled) {
-      float temp = readProbe(i);
-      if (temp > -900.0) {
-        json += "\"temperature\":" + String(temp, 1) + ",";
-        json += "\"valid\":true";
-      } else {
-        json += "\"temperature\":null,";
-        json += "\"valid\":false";
-      }
-    } else {
-      json += "\"temperature\":null,";
-      json += "\"valid\":false";
-    }
-    
-    json += "}";
-  }
-  
-  json += "]}";
-  return json;
-}
-
 void TemperatureSensor::printDiagnostics() {
   Serial.println("\n=== ADS1115 TEMPERATURE SENSOR DIAGNOSTICS ===");
   Serial.printf("Initialized: %s\n", initialized ? "YES" : "NO");
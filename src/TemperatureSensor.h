@@ -27,9 +27,16 @@ struct ProbeConfig {
   float offset;         // Temperature offset calibration
   float minTemp;        // Minimum valid temperature
   float maxTemp;        // Maximum valid temperature
-  uint32_t lastUpdate;  // Last update timestamp
+  uint64_t lastUpdate;  // Last update timestamp (clock_ms)
   float lastValidTemp;  // Last valid reading
   bool isValid;         // Current reading validity
+  
+  // Cook target and alarm thresholds (0 = disabled), evaluated by ProbeAlarm
+  float targetTemp;       // Done temperature for this probe
+  float alarmHigh;        // Alarm when probe climbs to this temperature
+  float alarmLow;         // Alarm when probe falls back to this temperature
+  float alarmHysteresis;  // Degrees a reading must retreat before re-arming
+  bool keepWarmOnTarget;  // Drop grill to keep-warm setpoint when target reached
 };
 
 class TemperatureSensor {
@@ -55,7 +62,8 @@ public:
   void configureProbe(int probeIndex, ProbeType type, String name, float offset = 0.0);
   void disableProbe(int probeIndex);
   
-  // Temperature reading functions
+  // Live ADS1115 reads - acquisition task and diagnostics only; everything
+  // else reads the sensor snapshot (readProbeTemperature() in Utility.h)
   float readProbe(int probeIndex);
   float getFoodTemperature(int foodProbe);  // Returns food probe temp (1, 2, 3, or 4)
   
@@ -70,11 +78,8 @@ public:
   void testProbe(int probeIndex);           // Test specific probe
   void testBetaCoefficients(int probeIndex); // Try different beta values
   
-  // Update all probes (call regularly)
-  void updateAll();
-  
-  // Get probe data for web interface
-  String getProbeDataJSON();
+  // Read every probe into temps/valid (MAX_PROBES each) - acquisition task only
+  void updateAll(float* temps, bool* valid);
 };
 
 extern TemperatureSensor tempSensor;
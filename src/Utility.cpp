@@ -2,6 +2,9 @@
 #include "Utility.h" 
 #include "Globals.h"
 #include "MAX31865Sensor.h"
+#include "Clock.h"
+#include "Metrics.h"
+#include "Tasks.h"
 
 // Simple debug flags
 bool debugGrillSensor = false;
@@ -60,41 +63,46 @@ bool getRelayDebug() { return debugRelays; }
 bool getSystemDebug() { return debugSystem; }
 
 // SIMPLE GRILL TEMPERATURE READING from 100Ω resistor
-double readGrillTemperature() {
-  static unsigned long lastReading = 0;
-  static double cachedTemp = 70.0;
-  
-  // Only read every 500ms
-  if (millis() - lastReading < 500) {
-    return cachedTemp;
-  }
-  
-  // Read from MAX31865
+// One MAX31865 conversion - acquisition task only; may return an invalid reading
+double sampleGrillTemperature() {
+  uint64_t readStart = clock_us();
   double temp = grillSensor.readTemperatureF();
+  metrics_observe(METRIC_SPI_READ_US, (uint32_t)(clock_us() - readStart));
+  metrics_count(METRIC_GRILL_READS);
   
   if (debugGrillSensor) {
     float resistance = grillSensor.readRTD();
     Serial.printf("🔥 GRILL: %.1f°F (R: %.1fΩ)\n", temp, resistance);
   }
   
-  if (isValidTemperature(temp)) {
-    cachedTemp = temp;
-    lastReading = millis();
-    return temp;
+  if (!isValidTemperature(temp)) {
+    metrics_count(METRIC_GRILL_ERRORS);
+  }
+  return temp;
+}
+
+// Latest grill reading from the sensor snapshot (last valid value, 70°F until the first one)
+double readGrillTemperature() {
+  SensorSnapshot sample;
+  if (tasks_get_sample(&sample)) {
+    return sample.grillF;
   }
   
-  // Return cached value if current reading is bad
-  return cachedTemp;
+  // Before the first sample - only during setup()
+  double temp = sampleGrillTemperature();
+  return isValidTemperature(temp) ? temp : 70.0;
 }
 
-// Ambient temperature (unchanged)
-double readAmbientTemperature() {
+// Ambient NTC, averaged over 5 ADC reads - acquisition task only
+double sampleAmbientTemperature() {
   const float THERMISTOR_NOMINAL = 100000.0;    
   const float TEMPERATURE_NOMINAL = 25.0;       
   const float B_COEFFICIENT = 3950.0;           
   const float PULLDOWN_RESISTOR = 10000.0;      
   const float SUPPLY_VOLTAGE = 5.0;             
   
+  metrics_count(METRIC_AMBIENT_READS);
+  
   int totalADC = 0;
   for (int i = 0; i < 5; i++) {
     totalADC += analogRead(AMBIENT_TEMP_PIN);
@@ -106,10 +114,12 @@ double readAmbientTemperature() {
   double ntcResistance = PULLDOWN_RESISTOR * (SUPPLY_VOLTAGE - voltage) / voltage;
   
   if (voltage <= 0.1 || voltage >= (SUPPLY_VOLTAGE - 0.1)) {
+    metrics_count(METRIC_AMBIENT_ERRORS);
     return -999.0;
   }
   
   if (ntcResistance < 10000 || ntcResistance > 1000000) {
+    metrics_count(METRIC_AMBIENT_ERRORS);
     return -999.0;
   }
   
@@ -123,12 +133,38 @@ double readAmbientTemperature() {
   double tempF = steinhart * 9.0 / 5.0 + 32.0;
   
   if (!isValidTemperature(tempF) || tempF < -40.0 || tempF > 200.0) {
+    metrics_count(METRIC_AMBIENT_ERRORS);
     return -999.0;
   }
   
   return tempF;
 }
 
+// Latest ambient reading from the sensor snapshot
+double readAmbientTemperature() {
+  SensorSnapshot sample;
+  if (tasks_get_sample(&sample)) {
+    return sample.ambientF;
+  }
+  return sampleAmbientTemperature();
+}
+
+// Latest meat probe reading from the sensor snapshot
+double readProbeTemperature(int foodProbe) {
+  SensorSnapshot sample;
+  if (foodProbe < 1 || foodProbe > MAX_PROBES || !tasks_get_sample(&sample)) {
+    return -999.0;
+  }
+  return sample.probeF[foodProbe - 1];
+}
+
+// Resistance behind the latest grill reading (0 before the first sample)
+float readGrillResistance() {
+  SensorSnapshot sample;
+  tasks_get_sample(&sample);
+  return sample.rtdOhms;
+}
+
 // Main temperature function
 double readTemperature() {
   return readGrillTemperature();
@@ -15,6 +15,10 @@ extern bool debugSystem;
 double readTemperature();              
 double readGrillTemperature();         
 double readAmbientTemperature();       
+double readProbeTemperature(int foodProbe);   // Meat probe 1-4 from the snapshot, -999 when absent
+float readGrillResistance();           // MAX31865 ohms from the snapshot
+double sampleGrillTemperature();       // Direct sensor reads - acquisition task only (Tasks.h)
+double sampleAmbientTemperature();
 String getStatus(double temp);
 bool isValidTemperature(double temp);
 
@@ -0,0 +1,724 @@
+// WebAssets.h - Generated by tools/embed_web.py from web/ - do not edit
+#ifndef WEBASSETS_H
+#define WEBASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+  const char* path;
+  const char* contentType;
+  const uint8_t* data;      // gzip, in flash
+  size_t length;
+  const char* etag;         // Quoted strong ETag
+};
+
+// index.html: 15528 bytes, 4325 gzipped
+static const uint8_t WEB_INDEX_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x3b, 0xed, 0x72, 0xdb, 0x48,
+  0x72, 0xff, 0xf5, 0x14, 0x63, 0xbb, 0x6e, 0x41, 0xe6, 0x04, 0x7e, 0x8a, 0xb2, 0x2c, 0x89, 0x74,
+  0xc9, 0x16, 0xbd, 0xab, 0x9c, 0xbe, 0x4a, 0xe2, 0xde, 0x26, 0xb5, 0x75, 0xe5, 0x1a, 0x02, 0x03,
+  0x12, 0x2b, 0x10, 0xc0, 0x01, 0xa0, 0x68, 0xe5, 0xce, 0x79, 0x82, 0x54, 0xe5, 0xcf, 0xfd, 0xca,
+  0x9f, 0xbb, 0xc7, 0xc8, 0xaf, 0x3c, 0x4c, 0x5e, 0x20, 0x79, 0x84, 0x74, 0xf7, 0xcc, 0x00, 0x03,
+  0x10, 0x94, 0xa8, 0xb5, 0x5d, 0xb9, 0xab, 0xf2, 0x8a, 0x98, 0xe9, 0xef, 0xe9, 0xee, 0xe9, 0x6e,
+  0xe0, 0x8e, 0x5f, 0x9c, 0x5e, 0xbd, 0x9f, 0xfc, 0xf3, 0xf5, 0x98, 0xcd, 0xb3, 0x45, 0x30, 0xda,
+  0x39, 0xd6, 0x7f, 0x04, 0x77, 0xe1, 0xcf, 0x42, 0x64, 0x9c, 0x39, 0x73, 0x9e, 0xa4, 0x22, 0x1b,
+  0x5a, 0xcb, 0xcc, 0xb3, 0x0f, 0x2c, 0xbd, 0x1c, 0xf2, 0x85, 0x18, 0x5a, 0xf7, 0xbe, 0x58, 0xc5,
+  0x51, 0x92, 0x59, 0xcc, 0x89, 0xc2, 0x4c, 0x84, 0x00, 0xb6, 0xf2, 0xdd, 0x6c, 0x3e, 0x74, 0xc5,
+  0xbd, 0xef, 0x08, 0x9b, 0x1e, 0x76, 0x99, 0x1f, 0xfa, 0x99, 0xcf, 0x03, 0x3b, 0x75, 0x78, 0x20,
+  0x86, 0xdd, 0x5d, 0xb6, 0x4c, 0x45, 0x42, 0x4f, 0x7c, 0x0a, 0x0b, 0x61, 0x84, 0x64, 0x33, 0x3f,
+  0x0b, 0xc4, 0xe8, 0xfb, 0x44, 0x88, 0x90, 0x5d, 0x44, 0xcb, 0x30, 0xe3, 0x7e, 0xc8, 0xbe, 0x4f,
+  0xfc, 0x20, 0x60, 0xef, 0x81, 0x78, 0x12, 0x05, 0x81, 0x48, 0x8e, 0xdb, 0x12, 0x6c, 0xe7, 0x38,
+  0xcd, 0x1e, 0xf0, 0xef, 0x3f, 0xb0, 0x3f, 0xb1, 0x69, 0xf4, 0xc9, 0x4e, 0xfd, 0x7f, 0xf1, 0xc3,
+  0xd9, 0x21, 0xfc, 0x4e, 0x5c, 0xa0, 0x0d, 0x4b, 0x47, 0x6c, 0xc1, 0x93, 0x99, 0x1f, 0x1e, 0xb2,
+  0xce, 0x11, 0x8b, 0xb9, 0xeb, 0xd2, 0x3e, 0xfc, 0xfe, 0xbc, 0x33, 0x8d, 0xdc, 0x07, 0xc4, 0xe3,
+  0xce, 0xdd, 0x2c, 0x01, 0x56, 0xee, 0x21, 0x0b, 0xfc, 0x50, 0xf0, 0xc4, 0x9e, 0x25, 0xdc, 0xf5,
+  0x41, 0x8f, 0x46, 0xb7, 0x3f, 0x70, 0xc5, 0x6c, 0x97, 0xbd, 0xea, 0x8a, 0xbe, 0xf3, 0xba, 0x07,
+  0x3f, 0x7a, 0x7c, 0xd0, 0x7b, 0x73, 0xd0, 0x3c, 0x02, 0x55, 0x83, 0x28, 0x39, 0x64, 0xaf, 0x3c,
+  0xcf, 0x3b, 0x62, 0x1e, 0x88, 0x66, 0x7b, 0x7c, 0xe1, 0x07, 0x0f, 0x87, 0xec, 0x24, 0x01, 0x2d,
+  0x77, 0x59, 0xca, 0xc3, 0xd4, 0x06, 0x0d, 0x7d, 0xcf, 0x60, 0xdc, 0xed, 0xc4, 0x28, 0x92, 0x1f,
+  0xda, 0x73, 0xe1, 0xcf, 0xe6, 0x19, 0xae, 0x74, 0xee, 0xe7, 0x28, 0x4e, 0x0b, 0x8d, 0x07, 0xda,
+  0x8a, 0x04, 0x84, 0x5a, 0xf0, 0x4f, 0xd2, 0x6c, 0x87, 0xec, 0xa0, 0x23, 0x71, 0xb4, 0x1a, 0x8c,
+  0x2f, 0xb3, 0x88, 0x10, 0xf0, 0x80, 0x08, 0x3a, 0x13, 0x9f, 0x32, 0x9b, 0x07, 0xfe, 0x0c, 0xf6,
+  0x1d, 0x90, 0x5b, 0x24, 0x1a, 0x1e, 0x4c, 0x90, 0x65, 0xd1, 0xe2, 0x90, 0xf5, 0x88, 0x48, 0x81,
+  0x34, 0xef, 0x02, 0x1e, 0x89, 0x0d, 0x36, 0x13, 0xb0, 0x2f, 0x16, 0x6b, 0x38, 0x5d, 0x8d, 0x33,
+  0x43, 0xfb, 0xdb, 0x99, 0x58, 0xc4, 0x15, 0x7b, 0x25, 0xb3, 0x29, 0x6f, 0xf4, 0x06, 0x83, 0x5d,
+  0xfd, 0xaf, 0xd3, 0xea, 0x0e, 0xc0, 0x38, 0xca, 0xfe, 0x68, 0xc6, 0x65, 0x0a, 0x84, 0x06, 0x48,
+  0x28, 0x37, 0x42, 0xcf, 0x50, 0xa8, 0x22, 0x60, 0x9d, 0x26, 0x92, 0x18, 0x40, 0xc4, 0x9f, 0x58,
+  0x1a, 0x05, 0xbe, 0xcb, 0x5e, 0xed, 0x81, 0x0e, 0x07, 0x9d, 0x8a, 0x6c, 0xf6, 0x02, 0x7d, 0xa5,
+  0xa4, 0x55, 0x1f, 0xb5, 0xa2, 0xe7, 0x95, 0x32, 0xf7, 0x34, 0x0a, 0xdc, 0x6d, 0x14, 0x85, 0x93,
+  0xcb, 0xca, 0xb4, 0xba, 0xad, 0x47, 0x6d, 0x94, 0x66, 0x3c, 0x5b, 0xa6, 0x55, 0x94, 0x4d, 0x02,
+  0x54, 0x1c, 0xa2, 0x6a, 0x2f, 0x4d, 0x94, 0x24, 0x01, 0xa1, 0x5c, 0xa0, 0xeb, 0xfa, 0x69, 0x1c,
+  0x70, 0xf0, 0x2f, 0x7c, 0x3e, 0xa2, 0xff, 0x92, 0xa4, 0x01, 0xcf, 0x84, 0x0d, 0xde, 0xb8, 0x5c,
+  0x84, 0x80, 0x9a, 0x88, 0x58, 0xf0, 0xac, 0x81, 0x3e, 0x62, 0x7b, 0x7e, 0xb6, 0x8b, 0xbe, 0x06,
+  0xce, 0xd4, 0xe8, 0x1e, 0x00, 0xcd, 0x5d, 0xd6, 0xf5, 0x92, 0x26, 0x9c, 0xcf, 0x8c, 0xc7, 0xfa,
+  0x54, 0xb4, 0x5f, 0xa1, 0xfd, 0x65, 0x5c, 0x48, 0xae, 0x0e, 0x4f, 0xdc, 0x2d, 0x4e, 0xbb, 0x69,
+  0xea, 0x32, 0xd8, 0xa8, 0x4b, 0xdd, 0xb9, 0x9a, 0x9c, 0xa4, 0xe5, 0x29, 0x8a, 0x1f, 0x3b, 0xec,
+  0x02, 0x9e, 0x2f, 0xa6, 0x18, 0xa1, 0xf5, 0x18, 0xfb, 0x1d, 0x3e, 0xf0, 0x78, 0x05, 0x63, 0x01,
+  0x76, 0xa9, 0x07, 0xf7, 0x06, 0x6f, 0x44, 0x67, 0x5a, 0x51, 0x7d, 0xde, 0x2f, 0x9f, 0x65, 0xa7,
+  0xf5, 0xa6, 0xe6, 0xf8, 0x0f, 0x50, 0xb9, 0x28, 0xe6, 0x8e, 0x9f, 0x3d, 0x20, 0xcc, 0x41, 0x41,
+  0xe5, 0x9e, 0x07, 0x4b, 0x51, 0xf5, 0x87, 0x83, 0xed, 0x1c, 0x72, 0x60, 0x9e, 0x7f, 0xf6, 0x10,
+  0x8b, 0xaa, 0x2c, 0x44, 0xc7, 0xe0, 0xfb, 0xba, 0x00, 0xf7, 0x43, 0xe0, 0x4c, 0x1e, 0xa3, 0x53,
+  0x94, 0xf0, 0xf6, 0xe0, 0x7f, 0x05, 0x04, 0x66, 0xee, 0x2a, 0xbd, 0x81, 0xa1, 0x5c, 0x16, 0xc5,
+  0x4a, 0x84, 0x3c, 0xc9, 0x4d, 0xa7, 0x5e, 0x6f, 0xaf, 0x92, 0xb8, 0x10, 0x43, 0xa5, 0x2d, 0x48,
+  0xcb, 0xe9, 0xd6, 0x2e, 0x0a, 0x3e, 0xa8, 0xff, 0x69, 0x4f, 0xec, 0x6c, 0xf0, 0xc4, 0x69, 0x86,
+  0x01, 0x5d, 0x71, 0xb0, 0x92, 0x41, 0xbb, 0x1b, 0x0c, 0xaa, 0x8f, 0x39, 0x8c, 0x42, 0xb1, 0xc1,
+  0x27, 0x95, 0x72, 0xab, 0xb9, 0x9f, 0x01, 0x88, 0xb3, 0x4c, 0x52, 0x7c, 0x8c, 0x23, 0x5f, 0xba,
+  0x67, 0x9d, 0xcb, 0xd2, 0x9a, 0x2b, 0x9c, 0x28, 0xe1, 0x99, 0x1f, 0x85, 0x9a, 0x7c, 0xae, 0xf7,
+  0x34, 0x88, 0x9c, 0x3b, 0x2d, 0xf9, 0x21, 0x2c, 0xe3, 0xcd, 0x86, 0x47, 0x61, 0x1c, 0xd5, 0x7e,
+  0xc1, 0x2b, 0x8c, 0x90, 0x43, 0x10, 0xad, 0x84, 0xab, 0x91, 0xec, 0x38, 0xf1, 0xc1, 0x10, 0xd5,
+  0x8b, 0xe9, 0xd5, 0xfe, 0xfe, 0x6b, 0x21, 0x78, 0x0e, 0xe5, 0xf2, 0x70, 0x46, 0xa9, 0xbf, 0x04,
+  0xe4, 0x75, 0xde, 0xf4, 0xbd, 0x69, 0x0e, 0x94, 0x2e, 0x1d, 0x47, 0xa4, 0x69, 0x15, 0x6a, 0xcf,
+  0xe3, 0x8e, 0x27, 0x72, 0xa8, 0x15, 0x4f, 0x42, 0xb0, 0xee, 0x1a, 0x2d, 0x75, 0xe4, 0x86, 0x58,
+  0xa2, 0x0a, 0x73, 0x30, 0x1d, 0x38, 0xde, 0x7e, 0xe1, 0x58, 0x71, 0x22, 0x20, 0x6d, 0xa6, 0xcf,
+  0x4d, 0x56, 0x7d, 0x99, 0x97, 0x94, 0x33, 0x1c, 0x98, 0xbe, 0x80, 0x27, 0x6e, 0x66, 0x25, 0xc9,
+  0xa1, 0xe4, 0x13, 0x3d, 0x4a, 0x3a, 0x4f, 0xa7, 0xa9, 0x47, 0x3d, 0xe2, 0x60, 0x0b, 0x87, 0x00,
+  0x19, 0x12, 0x01, 0x4a, 0x3d, 0xdb, 0xd3, 0x9f, 0xf2, 0x72, 0xa2, 0x6a, 0x12, 0xf5, 0x02, 0x01,
+  0x90, 0xe4, 0x7b, 0x36, 0xc8, 0xb2, 0x48, 0x0b, 0x0f, 0xfc, 0xb5, 0x7a, 0xaf, 0xdf, 0x2d, 0xc4,
+  0xd5, 0x76, 0x23, 0xb4, 0xa6, 0x2a, 0x35, 0x24, 0xcd, 0x3c, 0xc0, 0x7b, 0x35, 0xe9, 0x7c, 0xd0,
+  0xf9, 0x4d, 0x9e, 0x27, 0x12, 0x5d, 0xc1, 0x50, 0x86, 0x4f, 0xa0, 0xde, 0xf1, 0x65, 0x54, 0x80,
+  0x4f, 0x83, 0xa3, 0xf7, 0x53, 0x26, 0x78, 0x2a, 0x0c, 0x66, 0x51, 0xb8, 0xe6, 0x8b, 0x2a, 0xb7,
+  0x53, 0xf1, 0x36, 0xe7, 0x6e, 0xb4, 0xc2, 0x0a, 0xa7, 0x43, 0x34, 0x4b, 0x99, 0x5f, 0x11, 0xf0,
+  0xbc, 0xb5, 0xc0, 0x98, 0xbe, 0xee, 0x29, 0x18, 0xa8, 0xde, 0xee, 0x6c, 0x99, 0x32, 0x72, 0x53,
+  0xfa, 0x21, 0xd6, 0x74, 0xb6, 0x0a, 0x4c, 0x6d, 0xfc, 0x72, 0x3d, 0x02, 0x87, 0xaf, 0xef, 0xae,
+  0xc7, 0xcd, 0xd9, 0x6b, 0x56, 0x9d, 0x64, 0x43, 0x42, 0xa8, 0x1a, 0xad, 0x54, 0x23, 0xb4, 0xe0,
+  0x58, 0xc1, 0x50, 0x35, 0x21, 0xe7, 0xed, 0x4f, 0xfb, 0x03, 0x13, 0x12, 0x8a, 0xb5, 0x7a, 0xc0,
+  0x37, 0x7c, 0xb0, 0x6f, 0x02, 0xf2, 0xac, 0xae, 0x3c, 0x7b, 0xb5, 0x27, 0x1c, 0xd7, 0xd9, 0x2b,
+  0xf1, 0x76, 0x03, 0xf1, 0xf4, 0xb5, 0x8e, 0x8a, 0x02, 0x0e, 0x54, 0xe6, 0xc9, 0xc2, 0x9e, 0xf2,
+  0x50, 0x16, 0xa5, 0xb9, 0x51, 0x95, 0x92, 0x26, 0x27, 0xd7, 0xe9, 0xed, 0xf7, 0xf6, 0xb7, 0x2b,
+  0x06, 0xb6, 0xae, 0xfc, 0xb6, 0x2a, 0xa5, 0x6a, 0xe2, 0xf4, 0xb8, 0xad, 0xfa, 0x82, 0xe3, 0xb6,
+  0x6a, 0x62, 0xb0, 0xd6, 0x87, 0x3f, 0xae, 0x7f, 0xcf, 0x9c, 0x80, 0xa7, 0xe9, 0xd0, 0xca, 0xab,
+  0x6d, 0xe8, 0x3a, 0x18, 0x33, 0x77, 0x64, 0x85, 0x4c, 0xcb, 0xb0, 0x31, 0xef, 0xd6, 0x76, 0x23,
+  0x40, 0xb9, 0xab, 0x20, 0x00, 0x75, 0x74, 0xca, 0x43, 0x5f, 0x04, 0xec, 0x5d, 0x04, 0x96, 0x31,
+  0x1a, 0x15, 0x66, 0xb3, 0x6b, 0xff, 0x83, 0x9f, 0x08, 0x76, 0xb2, 0x9c, 0x61, 0xdf, 0x82, 0xb0,
+  0x05, 0xd6, 0xd9, 0xf5, 0x21, 0x3b, 0x4e, 0x63, 0x1e, 0x32, 0xdf, 0x1d, 0x5a, 0x7e, 0x6c, 0x8d,
+  0x6c, 0x1b, 0x64, 0x87, 0x85, 0x51, 0x05, 0x94, 0x91, 0x42, 0x43, 0xab, 0x92, 0x17, 0x95, 0x90,
+  0x00, 0xc3, 0xd9, 0x3c, 0x11, 0xde, 0xd0, 0x6a, 0xaf, 0x7c, 0xcf, 0xb7, 0xb4, 0x2a, 0x3a, 0x22,
+  0xac, 0xd1, 0x4f, 0x20, 0x06, 0xbb, 0x15, 0x19, 0xba, 0x53, 0x7a, 0xdc, 0xe6, 0xeb, 0x88, 0x0b,
+  0x1e, 0x2e, 0x79, 0x50, 0x83, 0x7a, 0x41, 0x1b, 0x5a, 0xab, 0x5a, 0xdc, 0xd8, 0x77, 0x6b, 0x10,
+  0xaf, 0xcf, 0x4e, 0xd9, 0x64, 0x89, 0x97, 0x4b, 0x2d, 0x92, 0x2b, 0xa6, 0xcb, 0x59, 0x0d, 0xda,
+  0x29, 0xae, 0xd7, 0x62, 0x2c, 0x63, 0x17, 0xf2, 0x6b, 0x0d, 0xca, 0xd5, 0xe4, 0x84, 0xfd, 0x48,
+  0x9b, 0xb5, 0x78, 0x54, 0x5c, 0x7e, 0x7c, 0x94, 0x1f, 0x3b, 0x0b, 0xbd, 0x28, 0x47, 0xce, 0xad,
+  0xaf, 0x7e, 0xec, 0x6c, 0x38, 0x05, 0x95, 0xc3, 0x6b, 0x7c, 0x57, 0xbb, 0x0f, 0xf4, 0xb6, 0xe0,
+  0x17, 0x0a, 0x4f, 0x97, 0x53, 0xd3, 0xe9, 0xf4, 0x68, 0xbd, 0xb6, 0xb4, 0x46, 0x52, 0x05, 0x76,
+  0x1b, 0x0b, 0xe1, 0x1e, 0x6a, 0x2d, 0x52, 0x11, 0x08, 0x27, 0x23, 0x0f, 0x91, 0xfa, 0xd3, 0xb6,
+  0xc5, 0xa2, 0x10, 0x9a, 0x72, 0xa8, 0x02, 0x80, 0x2c, 0xfd, 0xfd, 0xb1, 0xd8, 0x6c, 0x34, 0x2d,
+  0xcd, 0xb2, 0x14, 0xa4, 0xfd, 0x7e, 0xbf, 0xd2, 0xb8, 0xea, 0x4b, 0xb1, 0x5b, 0x54, 0xc3, 0x83,
+  0xc1, 0x60, 0x2d, 0x6e, 0xfb, 0xe5, 0xfe, 0x0d, 0x9e, 0x72, 0xcf, 0x03, 0x09, 0xa3, 0x18, 0x73,
+  0x1f, 0xa3, 0x82, 0x77, 0x68, 0xd9, 0x5d, 0x60, 0x4e, 0x32, 0x0b, 0x77, 0x74, 0xee, 0xdf, 0x0b,
+  0xd6, 0x88, 0x97, 0xe9, 0xbc, 0x79, 0xdc, 0x96, 0x70, 0x1b, 0x11, 0xa1, 0x13, 0xee, 0x58, 0xa3,
+  0x0f, 0x3c, 0xcd, 0x58, 0xa3, 0x9b, 0x6e, 0x01, 0x3f, 0x40, 0xf8, 0xcb, 0x28, 0x59, 0x80, 0x77,
+  0x36, 0xba, 0xad, 0xc1, 0x16, 0x38, 0x7d, 0xe2, 0x71, 0x0b, 0x25, 0x17, 0x6b, 0xf4, 0xb7, 0x80,
+  0x1f, 0x10, 0xfc, 0xef, 0x05, 0x14, 0x64, 0x12, 0x69, 0x1b, 0x26, 0x80, 0x71, 0xcd, 0x97, 0xa9,
+  0x70, 0xab, 0x90, 0x10, 0xdb, 0x64, 0x18, 0xed, 0x64, 0xe4, 0x1c, 0x15, 0x37, 0x7b, 0x61, 0xdb,
+  0xec, 0x02, 0xd3, 0x8c, 0xec, 0x88, 0x30, 0xab, 0x0b, 0xb8, 0x5c, 0x96, 0x90, 0x43, 0x54, 0xfe,
+  0x65, 0xb6, 0x5d, 0x4d, 0x59, 0x45, 0xdf, 0x6a, 0x19, 0x39, 0x43, 0x6d, 0x16, 0xdd, 0x88, 0x45,
+  0x5e, 0x54, 0xe9, 0x98, 0x65, 0xd2, 0x29, 0x67, 0x9b, 0x35, 0xb2, 0xd8, 0x0e, 0x5b, 0xa3, 0x09,
+  0xf8, 0xbd, 0xc8, 0xcc, 0x9c, 0x05, 0xcb, 0x94, 0x77, 0x8d, 0xcc, 0xf5, 0x9d, 0x2b, 0x66, 0x47,
+  0x1f, 0x36, 0x50, 0x54, 0x5d, 0x32, 0xde, 0x42, 0x52, 0x18, 0xb9, 0x50, 0x92, 0xa1, 0x62, 0x8c,
+  0xeb, 0x24, 0x9a, 0x0a, 0x46, 0x57, 0x11, 0x53, 0x57, 0x51, 0xc3, 0x03, 0xb9, 0xa0, 0xae, 0x06,
+  0x2b, 0x4d, 0x1f, 0xa0, 0x8a, 0x0c, 0xc1, 0x57, 0x9b, 0x35, 0x66, 0x31, 0xef, 0x2f, 0xc9, 0xae,
+  0xbc, 0x02, 0x21, 0x14, 0xf8, 0xce, 0x1d, 0x2c, 0x3b, 0x77, 0x27, 0xb8, 0x93, 0x42, 0xe4, 0x8c,
+  0x2a, 0x31, 0x6f, 0x5a, 0x11, 0xeb, 0xbc, 0x4d, 0x16, 0xa6, 0xae, 0x91, 0x2c, 0x06, 0x24, 0xe6,
+  0xfd, 0xd1, 0xf7, 0x37, 0x67, 0xe7, 0xe7, 0x6c, 0x32, 0xbe, 0xb8, 0x1e, 0xdf, 0x9c, 0x4c, 0x7e,
+  0xbc, 0x19, 0xc3, 0x95, 0xd1, 0xcf, 0x3d, 0x61, 0xbb, 0xf3, 0x41, 0x9a, 0x95, 0xf3, 0xa9, 0xc1,
+  0xc5, 0x06, 0x11, 0xd2, 0xf4, 0xc9, 0x3f, 0xf5, 0xbb, 0x07, 0xfb, 0x03, 0x76, 0x33, 0x39, 0x35,
+  0xad, 0x5f, 0x7f, 0x10, 0x85, 0xc8, 0xaa, 0x93, 0x96, 0x42, 0x9f, 0x5c, 0xbc, 0x3b, 0x1b, 0x5f,
+  0x4e, 0xb6, 0x15, 0x55, 0xe1, 0x2a, 0xcf, 0xdb, 0x4e, 0xce, 0x6e, 0xe7, 0x77, 0xec, 0x72, 0xf2,
+  0xfe, 0x39, 0x22, 0x62, 0xeb, 0x2e, 0xe5, 0xbb, 0x18, 0x9f, 0x4c, 0xd8, 0xf5, 0xcd, 0xd5, 0xbb,
+  0x31, 0xeb, 0x6e, 0x2b, 0x24, 0x62, 0x77, 0x9f, 0x27, 0x62, 0x55, 0xc2, 0x1a, 0x48, 0x68, 0xa2,
+  0x4d, 0xf2, 0xf8, 0x38, 0xfa, 0x62, 0x9d, 0x7a, 0xcf, 0xd1, 0xa9, 0xf7, 0x6d, 0x75, 0xea, 0x7d,
+  0x25, 0x9d, 0xfa, 0xcf, 0xd1, 0xa9, 0xff, 0x6d, 0x75, 0xea, 0x7f, 0x25, 0x9d, 0xf6, 0x9e, 0xa3,
+  0xd3, 0xde, 0xb7, 0xd5, 0x69, 0x6f, 0xb3, 0x4e, 0x8f, 0x64, 0x32, 0xd5, 0xaa, 0xeb, 0x64, 0x36,
+  0x5d, 0x42, 0x2d, 0x1e, 0x6a, 0x08, 0xec, 0xa1, 0x0c, 0x28, 0x23, 0x51, 0xc2, 0xd3, 0x04, 0x36,
+  0x1a, 0xbd, 0xde, 0x00, 0x32, 0x25, 0xfc, 0x57, 0x66, 0x7b, 0x76, 0x1e, 0xad, 0x8e, 0xdb, 0x92,
+  0xc8, 0xaf, 0xa5, 0xf8, 0x9a, 0x28, 0xbe, 0xd6, 0x14, 0x2f, 0xf0, 0xfa, 0xfc, 0x22, 0x8a, 0x7d,
+  0x92, 0xb1, 0x9f, 0xcb, 0xf8, 0x03, 0x74, 0x0d, 0x5f, 0x2a, 0x64, 0xa7, 0x83, 0x42, 0x76, 0x3a,
+  0x8a, 0xe4, 0x4f, 0x70, 0x67, 0x7c, 0x29, 0xc9, 0x01, 0x91, 0x1c, 0x68, 0x92, 0xb7, 0x8b, 0xe8,
+  0x4e, 0x7c, 0xa9, 0xe6, 0x64, 0xcb, 0x7e, 0x6e, 0xcb, 0x5b, 0xc1, 0x13, 0x93, 0x64, 0xe5, 0x86,
+  0x55, 0x95, 0x3d, 0x93, 0x00, 0x69, 0xe5, 0x7a, 0x95, 0x45, 0xa7, 0x82, 0x79, 0x27, 0x41, 0xea,
+  0x2e, 0x5b, 0x3d, 0x07, 0x94, 0x9e, 0x99, 0x3f, 0x6d, 0xb8, 0x4e, 0xe5, 0x24, 0xa5, 0xe6, 0x2e,
+  0xa5, 0x0d, 0xc0, 0xaa, 0x2e, 0xd1, 0xa4, 0x22, 0x9f, 0x02, 0x48, 0x26, 0xd4, 0x48, 0x43, 0x99,
+  0x0a, 0x5b, 0x9a, 0x0f, 0x95, 0x26, 0xa3, 0x33, 0xb9, 0xb1, 0xa1, 0x97, 0xfa, 0x15, 0x9c, 0x38,
+  0xb6, 0x6f, 0xeb, 0x7c, 0x54, 0x57, 0xf7, 0xb5, 0xb8, 0xcc, 0xa3, 0x38, 0xae, 0x63, 0xf3, 0x03,
+  0xad, 0xb3, 0x0f, 0x3c, 0xfc, 0x7a, 0xbc, 0xa6, 0x38, 0x76, 0xac, 0xe1, 0xf5, 0x8e, 0xd6, 0xeb,
+  0x78, 0x3d, 0x72, 0x90, 0x92, 0x64, 0x2c, 0xc0, 0x6d, 0x32, 0x7b, 0x99, 0xf2, 0x99, 0xc8, 0xcf,
+  0x5d, 0x63, 0x1d, 0xa7, 0x4e, 0xe2, 0xc7, 0x50, 0xfa, 0x02, 0x88, 0xf2, 0xa9, 0x33, 0xec, 0x94,
+  0x20, 0x59, 0x1e, 0xd1, 0x5a, 0x1a, 0x2d, 0x13, 0x47, 0xb0, 0x21, 0x0b, 0x97, 0x81, 0x5e, 0xca,
+  0xb0, 0x1d, 0x32, 0x57, 0xfc, 0xf4, 0x1a, 0x88, 0xff, 0xde, 0x4f, 0xfd, 0x69, 0x80, 0x3b, 0x59,
+  0xb2, 0x14, 0x72, 0x47, 0x3b, 0xdc, 0xcd, 0x32, 0xa4, 0x71, 0xa6, 0xc6, 0xda, 0x71, 0x23, 0x67,
+  0xb9, 0x80, 0x22, 0xa5, 0x05, 0xed, 0xcb, 0xf8, 0x1e, 0x7e, 0x9c, 0xfb, 0x69, 0x26, 0xa0, 0xfe,
+  0x6b, 0x58, 0xf7, 0x48, 0xc7, 0x0f, 0xfc, 0xec, 0x41, 0xb6, 0x50, 0xd6, 0x2e, 0xf3, 0x96, 0xa1,
+  0x83, 0x25, 0x7b, 0xa3, 0xc9, 0xfe, 0x04, 0x9a, 0x56, 0xf9, 0xbd, 0xc8, 0xa9, 0xcd, 0x7d, 0xd7,
+  0x15, 0xe1, 0x11, 0xc2, 0x78, 0xac, 0x51, 0x82, 0x6b, 0xa2, 0xe0, 0x49, 0x76, 0x23, 0x78, 0x30,
+  0xf1, 0x17, 0xaa, 0x31, 0x83, 0xd2, 0xf2, 0x88, 0x89, 0x20, 0x15, 0xb0, 0x19, 0xc5, 0xeb, 0x7b,
+  0x3b, 0x9f, 0xe1, 0xdf, 0x4e, 0xbb, 0xcd, 0xb0, 0x65, 0x3a, 0x64, 0xd9, 0x5c, 0x68, 0x95, 0x70,
+  0x8e, 0x80, 0x1d, 0x94, 0x48, 0x19, 0x67, 0x69, 0xc8, 0xe3, 0x74, 0x0e, 0xc7, 0x89, 0xf9, 0x20,
+  0x82, 0x32, 0xd6, 0xc9, 0x76, 0x11, 0x38, 0x84, 0x85, 0xe0, 0x81, 0x49, 0x3d, 0x5c, 0xe6, 0xf9,
+  0x22, 0x70, 0xd3, 0x16, 0xd2, 0x9b, 0x00, 0xa5, 0x0c, 0x58, 0xb9, 0x4c, 0x36, 0x23, 0x29, 0x8b,
+  0x81, 0x26, 0x6b, 0xcb, 0xca, 0xfb, 0x23, 0x0f, 0x82, 0x5d, 0xc6, 0x43, 0xa8, 0x03, 0xa1, 0xc3,
+  0x40, 0xae, 0x1e, 0xac, 0x60, 0xd7, 0xc8, 0x56, 0x7e, 0x36, 0x8f, 0x96, 0x19, 0x23, 0xa3, 0xdd,
+  0xd2, 0xe9, 0xb4, 0x76, 0xb4, 0x7d, 0x36, 0xa8, 0x48, 0x46, 0x03, 0xb9, 0xa0, 0x87, 0x4b, 0xb1,
+  0x13, 0x05, 0x93, 0xc5, 0xf8, 0xe6, 0x18, 0x8e, 0xba, 0x91, 0x9b, 0x0e, 0x7a, 0x88, 0x71, 0x20,
+  0xf0, 0xe7, 0xbb, 0x87, 0x33, 0xb7, 0x51, 0x6a, 0x6b, 0x9b, 0x2d, 0xba, 0x3d, 0x9b, 0x68, 0xd8,
+  0x0d, 0x86, 0x92, 0x16, 0x57, 0xe4, 0x87, 0x43, 0xd6, 0x69, 0x82, 0x6f, 0x43, 0x83, 0x14, 0x96,
+  0xb7, 0x8e, 0x59, 0x87, 0x7d, 0xf7, 0x1d, 0x68, 0x11, 0xba, 0xd1, 0xaa, 0x65, 0x28, 0x21, 0x85,
+  0x64, 0xda, 0x7c, 0xb7, 0x59, 0x22, 0xf8, 0x42, 0x12, 0x66, 0x06, 0xa5, 0xcf, 0xf0, 0x4f, 0x4a,
+  0x36, 0x29, 0x7a, 0x30, 0x25, 0x40, 0xd9, 0x7f, 0x41, 0x49, 0xc8, 0xbc, 0xfa, 0xa9, 0xb1, 0x8e,
+  0xb4, 0xcb, 0x0a, 0x91, 0xde, 0x32, 0xec, 0x5b, 0xd9, 0xa1, 0x5c, 0xc2, 0x73, 0xdf, 0x31, 0x8d,
+  0x5a, 0xa3, 0xb1, 0x74, 0x44, 0xd0, 0xab, 0xcc, 0xb5, 0x89, 0x6f, 0x78, 0x02, 0xc8, 0xec, 0x15,
+  0xc6, 0xf9, 0xfe, 0xd1, 0xba, 0x98, 0x14, 0x12, 0xa4, 0x19, 0xd9, 0x49, 0x9b, 0x43, 0xc5, 0x5e,
+  0xcb, 0x09, 0xa2, 0x54, 0xa0, 0x9f, 0x96, 0x63, 0x11, 0x10, 0x4c, 0x21, 0x2b, 0x76, 0x23, 0xf1,
+  0x0a, 0x04, 0xb1, 0x32, 0x1d, 0xa6, 0x61, 0xb5, 0x05, 0x3e, 0xa5, 0x96, 0x3c, 0x51, 0xc9, 0x67,
+  0x3d, 0x12, 0xb5, 0x5b, 0x43, 0x04, 0x02, 0x95, 0x91, 0x3a, 0x21, 0x1d, 0xff, 0xff, 0x78, 0x7b,
+  0x75, 0xd9, 0x22, 0x3f, 0x6a, 0x88, 0x16, 0xa8, 0xc4, 0xf3, 0xc3, 0xc2, 0xce, 0xaf, 0x41, 0x60,
+  0xb4, 0xf4, 0xf9, 0x71, 0x2e, 0xae, 0x08, 0xa0, 0x54, 0x2a, 0xb1, 0x40, 0x3b, 0xbc, 0x90, 0x04,
+  0xf4, 0xd9, 0x33, 0x06, 0x51, 0xf3, 0x13, 0xf7, 0x33, 0xe6, 0x45, 0x89, 0x0c, 0x09, 0x3f, 0x41,
+  0x87, 0x56, 0x32, 0x12, 0xde, 0xd5, 0xf4, 0x17, 0xb0, 0x41, 0x0b, 0x52, 0x20, 0x5c, 0x42, 0x52,
+  0x82, 0xdd, 0x1a, 0x39, 0x1f, 0x13, 0xb4, 0x74, 0xf0, 0xf3, 0x68, 0x45, 0x57, 0xb7, 0x90, 0x81,
+  0xb1, 0xcb, 0xe8, 0x25, 0xde, 0x2e, 0x5d, 0xf4, 0xf8, 0xe9, 0x04, 0x3d, 0x4e, 0xc4, 0xa7, 0xac,
+  0x70, 0x07, 0x5a, 0xd2, 0xce, 0xac, 0xf0, 0x5a, 0x3e, 0x76, 0xb6, 0x3f, 0x4c, 0x2e, 0xce, 0x31,
+  0x39, 0x02, 0x6e, 0x2b, 0x8b, 0x3e, 0xf8, 0x9f, 0x84, 0xdb, 0xe8, 0x36, 0xd9, 0x6f, 0x99, 0x25,
+  0x0b, 0x02, 0xeb, 0xa8, 0x84, 0x43, 0x99, 0xfc, 0x92, 0x2f, 0xd0, 0xd4, 0x66, 0x05, 0x4b, 0x82,
+  0xca, 0x9c, 0xb5, 0x99, 0x89, 0x21, 0xda, 0x56, 0x54, 0x99, 0xf9, 0x92, 0x52, 0xb2, 0x28, 0x59,
+  0xa2, 0x2e, 0xe4, 0x72, 0x95, 0x5f, 0x54, 0xf2, 0x6c, 0x11, 0xad, 0x9e, 0xc8, 0x9c, 0x39, 0x78,
+  0x5b, 0x91, 0xd5, 0x20, 0x95, 0x60, 0x5e, 0x6c, 0x00, 0x85, 0x18, 0x12, 0x52, 0xf5, 0xcc, 0xf5,
+  0x72, 0x2b, 0xba, 0x6b, 0xc2, 0x21, 0x27, 0xd1, 0x4a, 0xfa, 0x6e, 0x92, 0x44, 0xe0, 0x29, 0x97,
+  0x22, 0x5b, 0x45, 0xc9, 0x1d, 0x13, 0xf8, 0x68, 0x95, 0x72, 0x03, 0xcb, 0x31, 0x7f, 0x49, 0xf1,
+  0x9e, 0x90, 0xc7, 0x29, 0x79, 0xe1, 0x99, 0xaf, 0xbb, 0x2f, 0xae, 0x96, 0xfc, 0x20, 0x77, 0x61,
+  0xc0, 0x73, 0x38, 0x0a, 0x0e, 0x7c, 0x10, 0x0f, 0x33, 0x67, 0x14, 0x88, 0x56, 0x10, 0xcd, 0x1a,
+  0x96, 0x9a, 0x06, 0x7a, 0xdc, 0x87, 0x62, 0xec, 0x10, 0xdd, 0x36, 0xc1, 0x97, 0xf7, 0x25, 0x6b,
+  0x99, 0x04, 0x65, 0x20, 0x6a, 0x47, 0xda, 0x98, 0x6d, 0xab, 0xe3, 0x9f, 0xe6, 0x2e, 0x09, 0x28,
+  0xdf, 0xc0, 0x23, 0x2a, 0x1b, 0xb1, 0x4e, 0x75, 0x6d, 0x97, 0x59, 0xe3, 0x9b, 0x9b, 0xab, 0x1b,
+  0x15, 0xc6, 0xcf, 0x61, 0x42, 0x33, 0x8c, 0x6f, 0xc2, 0xa4, 0x34, 0x7d, 0xd0, 0x1c, 0xd4, 0xa2,
+  0xe2, 0x61, 0xbf, 0xe9, 0x74, 0xd6, 0x37, 0x80, 0xd1, 0x65, 0xfb, 0x44, 0xb2, 0xf9, 0x59, 0x36,
+  0xf0, 0x60, 0x5e, 0xd9, 0xf5, 0xea, 0x1f, 0x7d, 0xfd, 0x63, 0xcf, 0xfa, 0x43, 0x0b, 0x12, 0xc1,
+  0x98, 0xc3, 0x31, 0x35, 0x62, 0x1c, 0x46, 0x61, 0x3c, 0xba, 0xe2, 0x53, 0xb3, 0x38, 0x69, 0x79,
+  0xe3, 0xd1, 0x1b, 0x18, 0x79, 0xdc, 0x3f, 0x13, 0x20, 0x46, 0x1c, 0xf2, 0xb3, 0xfe, 0x70, 0x64,
+  0x80, 0x41, 0xbb, 0xa6, 0xd4, 0x40, 0xe0, 0x0d, 0xca, 0xe5, 0xf8, 0xd4, 0xdd, 0x29, 0x07, 0x44,
+  0xc7, 0x35, 0xb0, 0xe1, 0x76, 0x23, 0xcd, 0x08, 0x76, 0xac, 0x3d, 0xa0, 0xc4, 0x48, 0x89, 0x93,
+  0x83, 0xfc, 0x4c, 0x92, 0x2b, 0x71, 0x18, 0xc3, 0xc2, 0x09, 0x87, 0xd7, 0x18, 0xa2, 0x96, 0x5e,
+  0x54, 0x5c, 0xf4, 0xdd, 0xaa, 0xf7, 0x4f, 0xaf, 0x2e, 0xc7, 0x39, 0x0c, 0x25, 0x05, 0x0d, 0x38,
+  0x32, 0xc1, 0xc6, 0x93, 0x13, 0x66, 0x81, 0xe0, 0x72, 0x67, 0xc8, 0xfa, 0xfb, 0x1d, 0xbc, 0xf4,
+  0x2e, 0x78, 0x36, 0x6f, 0x79, 0x41, 0x04, 0xc1, 0x85, 0x1b, 0x6d, 0x5a, 0xa7, 0x94, 0x34, 0x07,
+  0xf0, 0x43, 0x60, 0x8f, 0x0f, 0x04, 0xe5, 0x08, 0x3f, 0x68, 0x10, 0xd4, 0x6f, 0x14, 0x54, 0x9b,
+  0xed, 0x4b, 0xd8, 0x45, 0x49, 0xc8, 0x42, 0xb3, 0xdb, 0x0c, 0x02, 0x5e, 0xe9, 0xa6, 0x44, 0xf9,
+  0xed, 0x90, 0x35, 0xe8, 0xc7, 0x5b, 0xa0, 0x6f, 0x1b, 0x3c, 0xac, 0xdb, 0xc9, 0xc9, 0xf9, 0x79,
+  0xa1, 0x49, 0x6e, 0xcf, 0x16, 0x82, 0xbf, 0x97, 0x5f, 0xb0, 0x51, 0xf6, 0xd4, 0x19, 0xed, 0xb3,
+  0x8c, 0xe6, 0xa7, 0xfc, 0xb1, 0x38, 0x32, 0xed, 0x90, 0x99, 0xe9, 0x84, 0x59, 0xc5, 0xf1, 0xe4,
+  0x5d, 0xb5, 0xd1, 0xb9, 0xfd, 0x18, 0x13, 0x58, 0x49, 0x22, 0xd2, 0xd7, 0x8f, 0x1f, 0x45, 0xcb,
+  0x07, 0xb2, 0xb5, 0xc8, 0x7a, 0xf7, 0xa8, 0xa8, 0xd2, 0xe4, 0x40, 0x76, 0xf8, 0x08, 0x45, 0x39,
+  0xa1, 0x55, 0x15, 0x19, 0xbd, 0x44, 0xac, 0xa3, 0x4c, 0x3b, 0x06, 0x4c, 0x29, 0xfd, 0x2b, 0x2e,
+  0xe8, 0x17, 0x06, 0x34, 0xdc, 0x4d, 0xe7, 0xd8, 0x6c, 0xbc, 0xe7, 0x58, 0x75, 0xb4, 0x12, 0x11,
+  0x07, 0x1c, 0x4a, 0x86, 0x36, 0x6b, 0xcf, 0xc0, 0x50, 0xb6, 0x64, 0x29, 0xc5, 0x54, 0x9d, 0xde,
+  0x69, 0xf4, 0x58, 0xcc, 0x94, 0xfa, 0x41, 0x03, 0x99, 0x9a, 0xb7, 0x27, 0x50, 0x8b, 0x06, 0xcf,
+  0x40, 0x94, 0xfd, 0xd8, 0x13, 0x98, 0x46, 0xd3, 0x66, 0xa0, 0xca, 0xf6, 0xea, 0x09, 0x54, 0xa3,
+  0x07, 0xcb, 0xeb, 0xda, 0x42, 0xd3, 0xa6, 0xa1, 0x75, 0xd9, 0x9c, 0x45, 0x53, 0x47, 0x91, 0x26,
+  0xfd, 0x62, 0x16, 0x5e, 0x85, 0xe8, 0xec, 0xfa, 0x55, 0x3b, 0x79, 0x7c, 0xd1, 0xf4, 0xe5, 0x0c,
+  0xb4, 0x35, 0x9a, 0xb9, 0x5d, 0x9e, 0x26, 0x4e, 0x90, 0xdb, 0x91, 0xcf, 0x6d, 0xd6, 0x2c, 0xcc,
+  0xf7, 0x34, 0x03, 0x09, 0xba, 0x1d, 0x87, 0xdc, 0xb4, 0xcd, 0xc2, 0xca, 0x4f, 0x73, 0x90, 0xa0,
+  0x4f, 0x73, 0xa8, 0x1b, 0x77, 0x34, 0x8a, 0x7b, 0x4a, 0xb5, 0x97, 0x06, 0x28, 0xbd, 0x38, 0x78,
+  0x47, 0x6f, 0x14, 0x8a, 0x8b, 0x5d, 0x3a, 0x01, 0x75, 0xc2, 0x8f, 0x39, 0x40, 0xa9, 0x63, 0xce,
+  0x15, 0xa4, 0x47, 0x2c, 0xcb, 0xe9, 0x47, 0x25, 0xda, 0x4c, 0x7b, 0x41, 0xf4, 0xa0, 0x3a, 0xff,
+  0xfd, 0x1f, 0x7f, 0xfb, 0x9f, 0xff, 0xfc, 0x77, 0x76, 0x7e, 0xf5, 0x93, 0x4c, 0x73, 0xff, 0xfb,
+  0xd7, 0x7f, 0xfb, 0x2f, 0x26, 0x73, 0x9d, 0x9a, 0x1c, 0xfc, 0x6b, 0x1e, 0x79, 0x0a, 0x71, 0x5a,
+  0xa9, 0x0b, 0x59, 0x30, 0x65, 0x7f, 0x2e, 0xe2, 0x73, 0x0a, 0x75, 0xce, 0x0d, 0xe8, 0x96, 0x43,
+  0xf5, 0x34, 0x54, 0x7b, 0x9e, 0x00, 0xa0, 0x13, 0x45, 0x77, 0x05, 0x34, 0x3e, 0x19, 0x14, 0x73,
+  0x58, 0x4b, 0x75, 0x0e, 0x50, 0x4e, 0x5f, 0x61, 0x73, 0x9a, 0x88, 0xe9, 0xd2, 0x0f, 0x32, 0xb6,
+  0xc2, 0x76, 0x15, 0xeb, 0xea, 0x44, 0xf5, 0xea, 0xb2, 0x50, 0x92, 0xbd, 0x2b, 0x36, 0x4b, 0x11,
+  0x34, 0xba, 0x6a, 0xe6, 0xb5, 0xf0, 0x5d, 0x9b, 0xa6, 0x5b, 0xd0, 0x8a, 0xe3, 0xf7, 0x52, 0x4c,
+  0x65, 0x09, 0xb7, 0x5a, 0x31, 0x56, 0x4e, 0xac, 0x74, 0x58, 0x79, 0xfd, 0x68, 0xae, 0xd2, 0xfd,
+  0x56, 0x99, 0x1a, 0x98, 0x15, 0xe5, 0xfa, 0x40, 0xc1, 0xc4, 0x2e, 0x0e, 0x59, 0xc3, 0x9d, 0xfa,
+  0xf7, 0x8f, 0x1d, 0x75, 0x3e, 0x10, 0xcb, 0x8f, 0x79, 0x5d, 0x44, 0x66, 0x12, 0x2b, 0x55, 0xd9,
+  0x56, 0x79, 0x06, 0xf8, 0x12, 0x67, 0x80, 0xc5, 0x77, 0x60, 0x2f, 0xf3, 0x11, 0xe0, 0x4b, 0xec,
+  0x20, 0xe9, 0x03, 0x85, 0x46, 0xf3, 0xe5, 0xe8, 0x76, 0x72, 0x75, 0xad, 0x3f, 0x57, 0x50, 0xd3,
+  0xbf, 0x0d, 0x74, 0xd4, 0x57, 0x67, 0x06, 0x21, 0xee, 0xfe, 0xb2, 0x4c, 0xe5, 0x38, 0x11, 0x28,
+  0x9d, 0xd0, 0x13, 0xc3, 0xc7, 0x6d, 0x48, 0x89, 0x97, 0x4c, 0x7f, 0xfc, 0x36, 0xba, 0xbe, 0x39,
+  0xbb, 0x18, 0xb3, 0x86, 0xfc, 0x86, 0x5b, 0xab, 0x9b, 0x13, 0x59, 0x6f, 0x32, 0x9e, 0x6b, 0x02,
+  0xf5, 0x95, 0x5b, 0xc9, 0x06, 0x3c, 0xc9, 0x0c, 0x23, 0x9c, 0xdc, 0x4c, 0xfe, 0xbf, 0xac, 0x90,
+  0x13, 0xa2, 0x67, 0x1a, 0x17, 0x22, 0x21, 0x8a, 0x50, 0x65, 0x98, 0x7e, 0x27, 0xad, 0x9a, 0x03,
+  0x83, 0x06, 0x4b, 0x33, 0x20, 0x99, 0x51, 0x7a, 0xb9, 0x15, 0x7f, 0x04, 0x0b, 0x74, 0x8e, 0xaa,
+  0x4e, 0xbf, 0x96, 0x7b, 0x8c, 0xf9, 0x8b, 0x7a, 0x57, 0xfa, 0xd8, 0x9d, 0x67, 0xbe, 0x0c, 0xcd,
+  0xdd, 0x52, 0x26, 0x7c, 0xdc, 0x3a, 0x01, 0x56, 0xf7, 0xf9, 0xb8, 0x44, 0xc2, 0x55, 0xb2, 0x11,
+  0xe4, 0x9a, 0xbf, 0xfc, 0xa5, 0xc8, 0x04, 0x84, 0x36, 0xa1, 0xf2, 0x0b, 0x16, 0x1b, 0x19, 0x8f,
+  0x59, 0x06, 0xc1, 0xec, 0xdc, 0x85, 0xd1, 0x0a, 0x7c, 0x01, 0xb2, 0x9a, 0xaa, 0xbb, 0x14, 0x31,
+  0xfa, 0x48, 0xa1, 0xa5, 0xdf, 0x6b, 0x03, 0x39, 0xfa, 0x4e, 0x6b, 0xdd, 0x27, 0x36, 0x81, 0xe3,
+  0x87, 0x48, 0x96, 0x1e, 0xd6, 0x94, 0x85, 0x47, 0x93, 0x8d, 0x4a, 0x16, 0x6c, 0x96, 0x8a, 0x75,
+  0xea, 0xe9, 0xcf, 0x23, 0x8e, 0x23, 0xaa, 0x46, 0xd9, 0xd0, 0x54, 0xf7, 0x4a, 0x39, 0x75, 0x5b,
+  0x49, 0xb5, 0xdd, 0x47, 0x22, 0x9c, 0xbe, 0x4d, 0xfd, 0xd0, 0x11, 0x43, 0x54, 0xba, 0x44, 0x5e,
+  0xb5, 0x9b, 0xd8, 0x15, 0x24, 0xaa, 0x37, 0x54, 0x6b, 0x46, 0x4f, 0xc8, 0x18, 0x6f, 0xc9, 0x89,
+  0x48, 0xde, 0x54, 0x08, 0x73, 0x97, 0x95, 0x7b, 0x40, 0xf9, 0xf2, 0x1b, 0x59, 0x89, 0x56, 0x5e,
+  0x5f, 0xaa, 0x67, 0xfa, 0x2e, 0x18, 0x1f, 0x79, 0xa6, 0x57, 0xb0, 0xde, 0x84, 0x95, 0x0f, 0xba,
+  0x61, 0xc8, 0xbb, 0xdd, 0x42, 0x5b, 0x68, 0x1a, 0x14, 0xea, 0x0b, 0xd0, 0xd3, 0x7a, 0x7f, 0x3e,
+  0x3e, 0xb9, 0x19, 0x9f, 0xc2, 0x6d, 0xc1, 0x03, 0x91, 0x64, 0x1b, 0x38, 0x1e, 0x3e, 0x87, 0xe5,
+  0x67, 0xf5, 0x4b, 0xff, 0xad, 0x78, 0x71, 0xe9, 0x88, 0xd6, 0xfb, 0x7f, 0xe3, 0x55, 0x3c, 0x19,
+  0xa5, 0xe6, 0x04, 0x3e, 0x02, 0x8c, 0xee, 0xee, 0x1b, 0xb2, 0x0b, 0xdb, 0xd6, 0xc9, 0x37, 0xb9,
+  0xd0, 0xda, 0x40, 0xa6, 0xe6, 0x9b, 0x1a, 0x9c, 0x93, 0xd5, 0x4e, 0x24, 0x37, 0x8e, 0x7b, 0x4b,
+  0x13, 0x1e, 0xf5, 0x6e, 0x06, 0x0d, 0x26, 0x35, 0x7b, 0x7e, 0x0d, 0x8f, 0xb8, 0xa5, 0x61, 0x87,
+  0xc8, 0x3e, 0xe2, 0xda, 0x5b, 0xfc, 0x0f, 0x39, 0x24, 0x51, 0x5f, 0x9f, 0x7b, 0xe4, 0x23, 0x0b,
+  0xa4, 0x97, 0xbb, 0x65, 0x79, 0x5a, 0x51, 0xf2, 0x3b, 0x63, 0xfe, 0x82, 0x92, 0x5b, 0x6b, 0xd3,
+  0x8a, 0x88, 0xfc, 0x5c, 0xf9, 0x0c, 0x0d, 0x4d, 0x10, 0x8e, 0x3e, 0x56, 0x34, 0x3e, 0x59, 0xb1,
+  0x9a, 0x6b, 0x03, 0xce, 0x22, 0x35, 0x9b, 0xb9, 0x4a, 0xe6, 0xd0, 0x21, 0xa3, 0xd0, 0x68, 0x65,
+  0xf4, 0x9d, 0x09, 0xb2, 0x94, 0x1b, 0xad, 0xfc, 0x4b, 0x6a, 0x3d, 0xf1, 0xcf, 0x77, 0x2a, 0xe9,
+  0xe8, 0x16, 0xe9, 0x83, 0x10, 0xad, 0x56, 0xcb, 0xaa, 0x8c, 0x85, 0x92, 0xec, 0x8b, 0x26, 0x42,
+  0x3f, 0x4c, 0x26, 0xd7, 0xe4, 0xf3, 0x39, 0x98, 0x6c, 0x62, 0x36, 0xcc, 0x86, 0xa4, 0xa1, 0x37,
+  0xcf, 0x86, 0x94, 0xe5, 0xe4, 0xad, 0x48, 0x52, 0x0b, 0xf7, 0x30, 0x4f, 0xa4, 0x8a, 0xe8, 0xa6,
+  0xf1, 0xf3, 0xfa, 0x41, 0x94, 0x88, 0xaa, 0xe3, 0x50, 0xa6, 0x90, 0x65, 0x8b, 0x8a, 0x60, 0xdc,
+  0x69, 0x2d, 0xe0, 0xba, 0xc4, 0x0a, 0x53, 0xa5, 0xe2, 0x35, 0x13, 0x7b, 0x1c, 0x32, 0x6f, 0x69,
+  0xb3, 0x6a, 0xe5, 0xe2, 0x4a, 0xb5, 0x6a, 0xa7, 0x99, 0x45, 0x11, 0x52, 0x8c, 0xee, 0xe0, 0xa4,
+  0x21, 0x0b, 0x2d, 0x1a, 0x70, 0x46, 0x51, 0x4c, 0xe5, 0x1f, 0x09, 0xf6, 0x16, 0x7c, 0xa4, 0x5c,
+  0x75, 0x7d, 0x5d, 0x7f, 0x80, 0x7a, 0xb7, 0xd6, 0x1f, 0xa2, 0xf8, 0xef, 0xd8, 0x1d, 0xb0, 0x48,
+  0xff, 0xea, 0xee, 0x20, 0x2d, 0xf1, 0x4d, 0xdc, 0x41, 0x97, 0x99, 0xb5, 0xde, 0x60, 0xd6, 0x50,
+  0x46, 0xcc, 0x3b, 0xcb, 0x24, 0xd1, 0x83, 0xba, 0xe1, 0x73, 0x93, 0x61, 0xe1, 0x2a, 0x70, 0x26,
+  0x8a, 0x04, 0xdc, 0x10, 0x8b, 0x18, 0xf5, 0xc5, 0xf7, 0x1d, 0x4c, 0xfa, 0x4c, 0xe9, 0xfb, 0xb9,
+  0x46, 0x77, 0xd0, 0xb1, 0x07, 0x9d, 0xce, 0x87, 0x26, 0x4e, 0x53, 0x0d, 0xfe, 0x79, 0xed, 0xa3,
+  0x89, 0xc1, 0x25, 0xf9, 0xc2, 0x87, 0x76, 0xf2, 0x52, 0xaf, 0x34, 0x9b, 0x75, 0x93, 0xbe, 0xfc,
+  0xd5, 0x96, 0x86, 0x2a, 0xc6, 0x74, 0x72, 0xf4, 0x33, 0xc4, 0x97, 0x3d, 0x48, 0x8d, 0x1e, 0x8f,
+  0x87, 0x6c, 0x80, 0xe3, 0x2c, 0x7d, 0xd7, 0x97, 0xae, 0x04, 0x75, 0x67, 0x9a, 0x55, 0x4f, 0x7e,
+  0x82, 0x66, 0x36, 0x5e, 0x60, 0x05, 0x0a, 0xb7, 0xf2, 0x54, 0x64, 0x2b, 0xfc, 0x2c, 0x19, 0x18,
+  0x7c, 0xa0, 0xf7, 0x77, 0xa8, 0x98, 0xbe, 0x84, 0x3f, 0xaf, 0x5d, 0xab, 0x66, 0xfd, 0x59, 0x13,
+  0x93, 0x50, 0x97, 0xb3, 0x7e, 0xc7, 0x4e, 0x05, 0xac, 0xb8, 0xfa, 0x9b, 0x65, 0xea, 0xfa, 0x25,
+  0x26, 0x96, 0x71, 0xf8, 0x55, 0x00, 0xc3, 0xce, 0x90, 0xc5, 0x51, 0xf6, 0x6d, 0xc3, 0x16, 0x4b,
+  0xe3, 0xb3, 0xcb, 0xef, 0x21, 0x6a, 0x65, 0x7d, 0x5c, 0x8a, 0x5d, 0x12, 0xe8, 0x23, 0x09, 0xf7,
+  0x77, 0x18, 0xc2, 0xd7, 0x64, 0xae, 0xf7, 0xe0, 0x8a, 0x50, 0xc1, 0x8b, 0xaf, 0x1b, 0xc3, 0xa8,
+  0x39, 0x86, 0x30, 0xe9, 0xbe, 0x29, 0x84, 0x81, 0x92, 0xe7, 0x87, 0x3c, 0x08, 0x1e, 0x74, 0x71,
+  0xf4, 0x6b, 0xe3, 0xba, 0xda, 0xa5, 0x98, 0xd1, 0xfd, 0xc8, 0x5b, 0xf5, 0xd3, 0xab, 0x0b, 0x45,
+  0x04, 0x0b, 0x4e, 0xe1, 0xae, 0xbf, 0x55, 0xdf, 0x50, 0x2f, 0xd1, 0x2b, 0xf0, 0xe3, 0xb6, 0xfe,
+  0x50, 0x00, 0x9a, 0x22, 0xf9, 0xd5, 0x7e, 0x5b, 0xfe, 0x1f, 0x92, 0xff, 0x0f, 0x14, 0x32, 0xdb,
+  0xd5, 0xa8, 0x3c, 0x00, 0x00,
+};
+
+// manual.html: 3251 bytes, 1129 gzipped
+static const uint8_t WEB_MANUAL_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x57, 0xed, 0x6e, 0xdb, 0x36,
+  0x14, 0xfd, 0xef, 0xa7, 0xb8, 0xcb, 0xb0, 0xc9, 0xc6, 0x2c, 0x5b, 0x76, 0x6b, 0xaf, 0x71, 0x6c,
+  0x17, 0xf9, 0xec, 0x02, 0xb4, 0xc9, 0x50, 0x04, 0x18, 0x86, 0xa2, 0x18, 0x28, 0x91, 0xb2, 0xb8,
+  0x48, 0xa4, 0x41, 0x52, 0x4e, 0x8c, 0x20, 0xcf, 0xd0, 0xff, 0xfb, 0xb5, 0xc7, 0xd8, 0xf3, 0xec,
+  0x05, 0xf6, 0x0a, 0xbb, 0xa4, 0x3e, 0x6c, 0x39, 0xcb, 0x56, 0x20, 0xc8, 0x50, 0x04, 0x81, 0x28,
+  0xea, 0xf0, 0xdc, 0xc3, 0xc3, 0x7b, 0x49, 0x7a, 0xfa, 0xd5, 0xc9, 0xe5, 0xf1, 0xd5, 0xcf, 0x3f,
+  0x9e, 0x42, 0x62, 0xb2, 0x74, 0xde, 0x9a, 0x56, 0x0f, 0x46, 0x28, 0x3e, 0x32, 0x66, 0x08, 0x44,
+  0x09, 0x51, 0x9a, 0x99, 0x99, 0x97, 0x9b, 0xd8, 0x7f, 0xe5, 0x55, 0xdd, 0x82, 0x64, 0x6c, 0xe6,
+  0xad, 0x38, 0xbb, 0x59, 0x4a, 0x65, 0x3c, 0x88, 0xa4, 0x30, 0x4c, 0x20, 0xec, 0x86, 0x53, 0x93,
+  0xcc, 0x28, 0x5b, 0xf1, 0x88, 0xf9, 0xee, 0xa5, 0x0b, 0x5c, 0x70, 0xc3, 0x49, 0xea, 0xeb, 0x88,
+  0xa4, 0x6c, 0x36, 0xb0, 0x24, 0x86, 0x9b, 0x94, 0xcd, 0xdf, 0x11, 0x91, 0x93, 0x14, 0x8e, 0x71,
+  0xb0, 0x92, 0x29, 0xf8, 0xf0, 0x46, 0xf1, 0xb4, 0x7e, 0x4f, 0x99, 0x9a, 0xf6, 0x0b, 0x60, 0x6b,
+  0xaa, 0xcd, 0xda, 0x3e, 0x43, 0x49, 0xd7, 0x70, 0x07, 0x21, 0x89, 0xae, 0x17, 0x4a, 0xe6, 0x82,
+  0x4e, 0xe0, 0xeb, 0x01, 0xb1, 0x7f, 0x07, 0xa8, 0x21, 0x95, 0x0a, 0xdf, 0xe3, 0x38, 0x3e, 0x80,
+  0x18, 0x39, 0xfc, 0x98, 0x64, 0x3c, 0x5d, 0x4f, 0xe0, 0x50, 0x61, 0xf8, 0x2e, 0x68, 0x22, 0xb4,
+  0xaf, 0x99, 0xe2, 0xf8, 0x7d, 0x49, 0x28, 0xe5, 0x62, 0x31, 0x81, 0x61, 0xb0, 0xbc, 0x3d, 0x80,
+  0xfb, 0x56, 0xcf, 0x4e, 0x81, 0x70, 0xc1, 0x14, 0xf2, 0x67, 0xe4, 0xb6, 0x10, 0x3f, 0x81, 0x71,
+  0xe0, 0x00, 0x19, 0x51, 0x0b, 0x2e, 0x26, 0x10, 0x00, 0xc9, 0x8d, 0xb4, 0x03, 0x92, 0x01, 0x02,
+  0xab, 0x98, 0xe3, 0x80, 0x8c, 0x62, 0xd4, 0x60, 0xd8, 0xad, 0xf1, 0x49, 0xca, 0x17, 0x08, 0x8d,
+  0xd0, 0x10, 0xa6, 0xaa, 0xa1, 0x7e, 0x28, 0x8d, 0x91, 0xd9, 0x04, 0x5e, 0x54, 0x01, 0x15, 0x4b,
+  0xc9, 0xda, 0x8f, 0xca, 0xc9, 0x37, 0x27, 0xa5, 0x16, 0x21, 0x69, 0x0f, 0x47, 0xa3, 0x6e, 0xf5,
+  0x1f, 0xf4, 0x06, 0x9d, 0x07, 0xaa, 0x2b, 0x51, 0x83, 0xd1, 0xf2, 0x16, 0x82, 0x03, 0x08, 0xa5,
+  0xa2, 0x4c, 0xf9, 0x8a, 0x50, 0x9e, 0x6b, 0xec, 0x6e, 0x46, 0xd2, 0x86, 0x98, 0x5c, 0x63, 0x20,
+  0xca, 0xf5, 0x12, 0x3b, 0x26, 0x10, 0xa7, 0x0c, 0x01, 0x4e, 0xae, 0xcf, 0x0d, 0xcb, 0xf4, 0xa3,
+  0xa2, 0x6d, 0x04, 0x47, 0x55, 0x90, 0xf8, 0x54, 0x1a, 0x24, 0x2a, 0x2d, 0x2a, 0xc4, 0x24, 0x8c,
+  0x2f, 0x12, 0x53, 0xbd, 0xed, 0x48, 0x19, 0x05, 0xdf, 0xd4, 0x9c, 0xaa, 0xc0, 0xed, 0x52, 0x4a,
+  0xb1, 0xbb, 0xb0, 0x2f, 0x09, 0x65, 0xaf, 0x82, 0x06, 0x26, 0x8e, 0x77, 0x41, 0xe3, 0xf0, 0xfb,
+  0x61, 0x09, 0x0a, 0x8d, 0xa5, 0xa8, 0x3d, 0xb2, 0xd3, 0xdf, 0x31, 0xca, 0x85, 0x6c, 0x0c, 0x0f,
+  0x46, 0xfb, 0xe3, 0xf1, 0x7e, 0x9d, 0x3c, 0x37, 0x09, 0xfa, 0x50, 0xa9, 0x9f, 0x80, 0x90, 0x82,
+  0x3d, 0x9c, 0x8b, 0x25, 0x89, 0x72, 0xa5, 0xed, 0x80, 0xa5, 0xe4, 0x85, 0x61, 0x45, 0x7c, 0x9f,
+  0x12, 0xb1, 0x70, 0x29, 0xd4, 0x88, 0x42, 0xa3, 0xe1, 0x78, 0x38, 0xae, 0x41, 0x37, 0x44, 0x09,
+  0x94, 0xb8, 0x8b, 0x8a, 0x47, 0xfb, 0x2c, 0x08, 0x1d, 0xea, 0x31, 0x44, 0x18, 0xc6, 0xc3, 0x97,
+  0x9b, 0x54, 0x0f, 0x82, 0x60, 0x2b, 0x29, 0x0a, 0x47, 0xff, 0x49, 0x6d, 0x35, 0x7f, 0xeb, 0x06,
+  0x38, 0xb3, 0xa6, 0xfd, 0xb2, 0xa2, 0xa6, 0xfd, 0xb2, 0xdc, 0x6d, 0x69, 0xe1, 0x83, 0xf2, 0x15,
+  0x44, 0x29, 0xd1, 0x7a, 0xe6, 0xd5, 0x15, 0x81, 0x15, 0x0b, 0x30, 0x4d, 0x06, 0x55, 0xc1, 0xbe,
+  0xb7, 0xf9, 0x54, 0x95, 0x29, 0x12, 0x0c, 0xe6, 0x2d, 0x0b, 0xd8, 0x1a, 0x5a, 0xea, 0x77, 0x03,
+  0x01, 0xfe, 0xfc, 0xed, 0xf7, 0xbf, 0xfe, 0xf8, 0x04, 0x58, 0xc4, 0x4a, 0x8a, 0xc5, 0xfc, 0xa7,
+  0xc3, 0xf7, 0x17, 0xe7, 0x17, 0x6f, 0x26, 0x56, 0x83, 0xeb, 0x80, 0x92, 0xb7, 0xaa, 0x05, 0xb9,
+  0x62, 0x4a, 0x71, 0xca, 0xb4, 0x2b, 0xb6, 0x8c, 0x18, 0x1e, 0x61, 0xf1, 0xc6, 0xcc, 0xac, 0x41,
+  0xaf, 0xb5, 0x4d, 0xd4, 0x9e, 0x8d, 0xd7, 0xc7, 0x80, 0x0f, 0x22, 0x37, 0xaa, 0xaa, 0x8c, 0xff,
+  0xf0, 0x7b, 0x91, 0x4f, 0xde, 0x7c, 0xfb, 0xcb, 0x56, 0x6a, 0x6f, 0xd2, 0xcd, 0x03, 0x4e, 0x67,
+  0x1e, 0x16, 0xc8, 0xa5, 0x40, 0xb4, 0x8b, 0x38, 0x4d, 0x5e, 0xcc, 0xcf, 0x17, 0xb8, 0xa7, 0xd9,
+  0xfd, 0x09, 0xdb, 0xa5, 0x0e, 0x17, 0x28, 0xcc, 0xb1, 0x5e, 0x44, 0xc5, 0x88, 0x6b, 0xed, 0x81,
+  0x14, 0x51, 0xca, 0xa3, 0xeb, 0xc2, 0x4e, 0xd4, 0xe4, 0xcc, 0x6b, 0xef, 0x71, 0xc7, 0xb0, 0xd7,
+  0x85, 0x3d, 0x29, 0xf6, 0x3a, 0xde, 0xfc, 0x2a, 0x57, 0x02, 0x2e, 0x2f, 0xa6, 0xfd, 0x82, 0xe2,
+  0x31, 0x3e, 0xd8, 0x24, 0xd9, 0xe7, 0x50, 0xc7, 0xf1, 0x86, 0xfb, 0xec, 0x6c, 0x9b, 0xfc, 0x7f,
+  0x74, 0x8f, 0xe4, 0xa8, 0xb6, 0xe9, 0xdf, 0xa1, 0xed, 0x7a, 0x82, 0x7b, 0x8e, 0xf2, 0x59, 0xcc,
+  0xdb, 0x30, 0x7f, 0x11, 0xde, 0x25, 0x72, 0xb9, 0xdc, 0x35, 0xef, 0x07, 0xd7, 0x07, 0x67, 0x44,
+  0x3c, 0xc1, 0xc1, 0x82, 0xf8, 0x59, 0x2c, 0xdc, 0xa2, 0xfe, 0x22, 0x3c, 0x0c, 0x53, 0x79, 0xb3,
+  0xeb, 0xe1, 0x91, 0xeb, 0x7b, 0xa2, 0x87, 0x05, 0xf1, 0xb3, 0x78, 0xb8, 0x45, 0xfd, 0x59, 0x1e,
+  0x12, 0x48, 0x14, 0x8b, 0x67, 0x5e, 0xdf, 0x6b, 0x08, 0x77, 0x9b, 0xfc, 0xcc, 0xab, 0x4f, 0x7c,
+  0xa4, 0x8d, 0xae, 0xff, 0xed, 0x9a, 0xb2, 0x39, 0x23, 0x1c, 0x86, 0xb2, 0x48, 0x2a, 0xdc, 0x7f,
+  0xa5, 0x28, 0x0f, 0x43, 0x6f, 0x7e, 0x84, 0x07, 0x12, 0x18, 0x09, 0x27, 0x44, 0x27, 0xa1, 0x24,
+  0x8a, 0x4e, 0xfb, 0xc4, 0x1e, 0x23, 0x85, 0x94, 0xa9, 0x8e, 0x14, 0x5f, 0x9a, 0x79, 0x2b, 0xce,
+  0x45, 0x64, 0xc7, 0x01, 0xca, 0x52, 0x4c, 0x27, 0x6e, 0x5e, 0xba, 0xdd, 0x81, 0x3b, 0x94, 0x8b,
+  0x5b, 0x79, 0x94, 0xb4, 0xbd, 0x7e, 0xb1, 0x52, 0xbf, 0x90, 0x34, 0xf5, 0x3a, 0xce, 0xac, 0x9e,
+  0x49, 0x98, 0x68, 0x23, 0x7e, 0x29, 0x85, 0x66, 0x30, 0x9b, 0x43, 0xd5, 0xee, 0xfd, 0xaa, 0xa5,
+  0x68, 0x77, 0xb6, 0x61, 0x94, 0xe0, 0x4d, 0x14, 0x21, 0x77, 0xae, 0x0f, 0xe0, 0x43, 0xb9, 0x4f,
+  0x77, 0xa1, 0xde, 0x72, 0xb0, 0x59, 0x57, 0x10, 0xb6, 0xeb, 0x4c, 0xf8, 0xd8, 0x8b, 0xa5, 0x3a,
+  0x25, 0x28, 0xe2, 0x9a, 0xad, 0xb7, 0x39, 0x00, 0xa8, 0x8c, 0xf2, 0x0c, 0x3d, 0xe9, 0x2d, 0x98,
+  0x39, 0x4d, 0x99, 0x6d, 0x1e, 0xad, 0xcf, 0xa9, 0x05, 0x76, 0x7a, 0xce, 0xdb, 0x0b, 0xbc, 0xfc,
+  0xc2, 0x0c, 0xb6, 0x53, 0xce, 0x83, 0xef, 0xc0, 0xe9, 0xf9, 0x80, 0xb0, 0x8f, 0xf0, 0xba, 0xfe,
+  0x28, 0x71, 0x11, 0x26, 0x9b, 0x37, 0x4c, 0xc9, 0xce, 0x41, 0x19, 0xea, 0xbe, 0x6c, 0xd9, 0xe7,
+  0x7d, 0x6b, 0x63, 0x58, 0x23, 0x11, 0x5c, 0xc2, 0x77, 0x5d, 0x4a, 0xb3, 0xa6, 0x77, 0x25, 0xec,
+  0xb5, 0x43, 0xcc, 0xac, 0x00, 0xd7, 0xc2, 0xa7, 0xf7, 0xad, 0x83, 0xbb, 0xbe, 0x62, 0xe0, 0x7f,
+  0x79, 0x6b, 0xd7, 0xfa, 0x11, 0x6f, 0xf1, 0x7a, 0xc8, 0x94, 0x71, 0xef, 0x78, 0x01, 0xc5, 0x9f,
+  0x02, 0x57, 0x3c, 0x63, 0x32, 0x37, 0xed, 0xc6, 0xba, 0x76, 0xf1, 0xb6, 0x15, 0x04, 0x08, 0x28,
+  0x27, 0x53, 0x9b, 0x88, 0x77, 0x93, 0xd3, 0x15, 0x36, 0xde, 0x72, 0x3c, 0xb7, 0xf1, 0x2a, 0xd1,
+  0xf6, 0x4e, 0x2e, 0xdf, 0x1d, 0x17, 0xbf, 0x16, 0xde, 0x4a, 0xbc, 0xe0, 0x51, 0x5c, 0x97, 0x06,
+  0x15, 0x12, 0xe0, 0xc5, 0xa0, 0xcc, 0x22, 0xcc, 0xf6, 0xe2, 0x5a, 0xd2, 0x2f, 0x7e, 0x9b, 0xfc,
+  0x0d, 0x07, 0xbd, 0x23, 0xd9, 0xb3, 0x0c, 0x00, 0x00,
+};
+
+// pid.html: 8300 bytes, 2369 gzipped
+static const uint8_t WEB_PID_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x5a, 0xcd, 0x6e, 0x1b, 0xc9,
+  0x11, 0xbe, 0xeb, 0x29, 0x3a, 0xd8, 0x40, 0x43, 0x62, 0x45, 0x72, 0x48, 0x89, 0xb2, 0x44, 0x91,
+  0x14, 0xbc, 0xfa, 0x31, 0x88, 0xb5, 0x25, 0xc1, 0x56, 0x12, 0x2c, 0x0c, 0xc3, 0xdb, 0x64, 0xf7,
+  0x88, 0xbd, 0x9a, 0x3f, 0x74, 0xf7, 0x48, 0x56, 0x0c, 0xde, 0x82, 0x1c, 0x82, 0xc5, 0x26, 0x48,
+  0x72, 0x4a, 0x0e, 0x9b, 0x4b, 0xee, 0x39, 0xe6, 0xb4, 0x87, 0x3c, 0x4a, 0x5e, 0x20, 0xfb, 0x08,
+  0xa9, 0xee, 0xe9, 0x99, 0xe9, 0x21, 0x87, 0x14, 0x25, 0xcb, 0x30, 0x68, 0x0e, 0x67, 0xaa, 0xaa,
+  0xab, 0xbe, 0xfa, 0xaa, 0xaa, 0x7b, 0xec, 0xfe, 0x2f, 0x8e, 0xcf, 0x8f, 0x2e, 0xbf, 0xb9, 0x38,
+  0x41, 0x53, 0x19, 0xf8, 0xc3, 0x8d, 0x7e, 0xf6, 0x45, 0x31, 0x81, 0xaf, 0x80, 0x4a, 0x8c, 0x26,
+  0x53, 0xcc, 0x05, 0x95, 0x03, 0x27, 0x91, 0x5e, 0x63, 0xcf, 0xc9, 0x6e, 0x87, 0x38, 0xa0, 0x03,
+  0xe7, 0x86, 0xd1, 0xdb, 0x38, 0xe2, 0xd2, 0x41, 0x93, 0x28, 0x94, 0x34, 0x04, 0xb1, 0x5b, 0x46,
+  0xe4, 0x74, 0x40, 0xe8, 0x0d, 0x9b, 0xd0, 0x86, 0xfe, 0xb1, 0x85, 0x58, 0xc8, 0x24, 0xc3, 0x7e,
+  0x43, 0x4c, 0xb0, 0x4f, 0x07, 0x6d, 0x65, 0x44, 0x32, 0xe9, 0xd3, 0xe1, 0xc5, 0xe8, 0x18, 0x5d,
+  0x26, 0x21, 0x0b, 0xaf, 0xd0, 0x26, 0xba, 0xa0, 0xbe, 0x4f, 0x25, 0x3a, 0x02, 0x4b, 0x3c, 0xf2,
+  0xfb, 0xad, 0x54, 0x64, 0xa3, 0x2f, 0xe4, 0x9d, 0xfa, 0x1e, 0x47, 0xe4, 0x0e, 0x7d, 0x44, 0x63,
+  0x3c, 0xb9, 0xbe, 0xe2, 0x51, 0x12, 0x92, 0x1e, 0xfa, 0xa2, 0x8d, 0xd5, 0x9f, 0x03, 0x58, 0xdd,
+  0x8f, 0x38, 0xfc, 0xf6, 0x3c, 0xef, 0x00, 0x79, 0x60, 0xa0, 0xe1, 0xe1, 0x80, 0xf9, 0x77, 0x3d,
+  0xf4, 0x9c, 0xc3, 0xc2, 0x5b, 0x48, 0xe0, 0x50, 0x34, 0x04, 0xe5, 0x0c, 0x9e, 0xc7, 0x98, 0x10,
+  0x58, 0xb1, 0x87, 0x3a, 0x6e, 0xfc, 0xe1, 0x00, 0xcd, 0x36, 0x9a, 0xca, 0x79, 0xcc, 0x42, 0xca,
+  0xc1, 0x7e, 0x80, 0x3f, 0xa4, 0x6e, 0xf7, 0xd0, 0x9e, 0xab, 0x05, 0x02, 0xcc, 0xaf, 0x58, 0xd8,
+  0x43, 0x2e, 0xc2, 0x89, 0x8c, 0x94, 0xc2, 0xb4, 0x0d, 0x82, 0xd9, 0x9a, 0xbb, 0x2e, 0xee, 0x7a,
+  0xe0, 0x83, 0xa4, 0x1f, 0x64, 0x03, 0xfb, 0xec, 0x0a, 0x44, 0x27, 0x00, 0x05, 0xe5, 0x99, 0x6a,
+  0x63, 0x1c, 0x49, 0x19, 0x05, 0x3d, 0xb4, 0x6d, 0x16, 0x9c, 0x76, 0x2c, 0x7d, 0x6f, 0x3c, 0xf6,
+  0x3a, 0x3b, 0xc5, 0x32, 0x4a, 0x08, 0xd6, 0x6a, 0x77, 0xd5, 0xd7, 0x01, 0x1a, 0x47, 0x9c, 0x50,
+  0x9e, 0x9b, 0xe8, 0xc0, 0x5d, 0x11, 0xf9, 0x8c, 0x14, 0x8a, 0x26, 0x9e, 0x5c, 0xa4, 0x6b, 0xa2,
+  0x12, 0x74, 0x22, 0x59, 0x14, 0xce, 0x61, 0xc6, 0xaf, 0xc6, 0xb8, 0xd6, 0xe9, 0x76, 0xb7, 0xb2,
+  0x8f, 0xdb, 0x6c, 0xd7, 0x17, 0x40, 0xc9, 0x9c, 0xe9, 0xb8, 0x25, 0x2f, 0x38, 0x26, 0x2c, 0x11,
+  0x3d, 0xd4, 0xce, 0x90, 0xf3, 0x22, 0x1e, 0x34, 0x94, 0xe9, 0x58, 0x43, 0x97, 0x2a, 0x65, 0xae,
+  0x13, 0x26, 0x62, 0x1f, 0x43, 0x12, 0x3c, 0x9f, 0x82, 0xb8, 0xc6, 0xa6, 0xc1, 0x24, 0x0d, 0x44,
+  0x81, 0xd0, 0x6c, 0xc3, 0xc7, 0x63, 0xea, 0x83, 0x76, 0x2e, 0x3d, 0xf6, 0xa3, 0xc9, 0xf5, 0x02,
+  0x76, 0x3a, 0x2a, 0x9d, 0xda, 0x5b, 0xca, 0xae, 0xa6, 0x12, 0xe4, 0x22, 0x9f, 0x80, 0x18, 0xc8,
+  0x98, 0x7c, 0x75, 0x5c, 0xe3, 0x16, 0x0b, 0xe3, 0x44, 0x42, 0xd2, 0xa9, 0x0f, 0x10, 0x80, 0xe9,
+  0x3c, 0xb8, 0xbd, 0xdc, 0x88, 0x60, 0xbf, 0xa5, 0xe0, 0x29, 0x0d, 0x16, 0x62, 0xd3, 0x0b, 0xa5,
+  0xf7, 0x40, 0xa0, 0x80, 0xbb, 0xdb, 0xed, 0x1e, 0x94, 0xd9, 0xb7, 0xbd, 0xbd, 0x3d, 0x47, 0x3d,
+  0xe3, 0xb3, 0x4f, 0x3d, 0x59, 0x80, 0xa4, 0xbd, 0x79, 0x2b, 0xef, 0x62, 0x28, 0x98, 0x30, 0x09,
+  0xc6, 0x94, 0x3b, 0xef, 0xc0, 0x29, 0xe3, 0x74, 0x3b, 0x67, 0xe1, 0x58, 0x86, 0xb6, 0xaf, 0x6d,
+  0x95, 0xea, 0x4e, 0xea, 0x8d, 0xbd, 0xaa, 0xdb, 0xdd, 0xdf, 0xdd, 0xdd, 0xcf, 0x17, 0xbe, 0x9d,
+  0x02, 0xa2, 0x85, 0xc3, 0x61, 0x14, 0xd2, 0xea, 0x90, 0xe6, 0xc3, 0x9e, 0x24, 0x5c, 0x28, 0x03,
+  0x71, 0xc4, 0x6c, 0xb2, 0xa6, 0x7e, 0xe7, 0x24, 0x02, 0xa7, 0x7a, 0xd3, 0xe8, 0x46, 0x97, 0x46,
+  0xd9, 0x8d, 0x9d, 0x67, 0x7b, 0xdd, 0x67, 0x99, 0x4c, 0xe3, 0x16, 0x73, 0x5d, 0xc6, 0x73, 0x52,
+  0x5e, 0x77, 0x9f, 0xba, 0xe3, 0x79, 0xa9, 0x6a, 0x8b, 0x64, 0xff, 0xd9, 0x33, 0x77, 0x37, 0x2d,
+  0xc8, 0x84, 0x73, 0x20, 0x48, 0xe3, 0x06, 0xfb, 0x09, 0xb5, 0x6a, 0x65, 0x07, 0x13, 0xba, 0xe7,
+  0x56, 0xf2, 0x00, 0xb4, 0x08, 0x15, 0x13, 0xce, 0x62, 0x43, 0x7a, 0x2b, 0x5e, 0xb7, 0xb9, 0xaf,
+  0x23, 0x36, 0x56, 0xc6, 0xe3, 0x71, 0x9e, 0x2a, 0x19, 0xc5, 0x45, 0xc5, 0x2c, 0x0b, 0xc2, 0x14,
+  0x5a, 0xa6, 0xef, 0xba, 0xae, 0x55, 0x30, 0x6d, 0x8b, 0x30, 0x65, 0xc4, 0xe7, 0xeb, 0x61, 0xb6,
+  0xd1, 0x6f, 0x99, 0x66, 0xd6, 0x6f, 0x99, 0x1e, 0xab, 0xba, 0x1a, 0x7c, 0x11, 0x76, 0x83, 0x26,
+  0x3e, 0x16, 0x62, 0xe0, 0xe4, 0xcd, 0x08, 0xda, 0x24, 0x42, 0xfd, 0x69, 0x7b, 0xf8, 0xf3, 0x8f,
+  0x3f, 0xfc, 0xfd, 0x7f, 0xff, 0xfe, 0x23, 0x5a, 0xd9, 0x2d, 0x41, 0x6e, 0x43, 0xc9, 0x5b, 0x96,
+  0x4c, 0x03, 0xd0, 0x76, 0x94, 0xa5, 0x8e, 0xee, 0xb7, 0x17, 0x98, 0x43, 0xef, 0x86, 0x8c, 0x0b,
+  0x50, 0xea, 0x98, 0x67, 0x96, 0x96, 0x01, 0xc1, 0x19, 0xfe, 0xf7, 0x6f, 0xff, 0x50, 0xab, 0x42,
+  0xff, 0xe5, 0x51, 0x78, 0x35, 0xfc, 0xcd, 0xf3, 0xd7, 0x67, 0xa3, 0xb3, 0x17, 0x3d, 0x15, 0x83,
+  0xbe, 0x81, 0x46, 0xe1, 0x24, 0x82, 0x3c, 0x41, 0x89, 0x29, 0xbb, 0x3a, 0x57, 0x02, 0x4d, 0x70,
+  0x08, 0x9f, 0x44, 0x50, 0x68, 0x88, 0x41, 0x4c, 0x39, 0x96, 0x09, 0xa7, 0x30, 0x01, 0x84, 0xc4,
+  0x63, 0xe6, 0x33, 0x79, 0x87, 0x22, 0x0e, 0x9c, 0x53, 0x7f, 0x51, 0xae, 0xda, 0x07, 0x0e, 0x27,
+  0xb4, 0xd9, 0x6f, 0x81, 0x07, 0xc6, 0x17, 0x75, 0x13, 0x45, 0xa1, 0x48, 0xc6, 0x01, 0x83, 0x81,
+  0x22, 0xf0, 0x0d, 0x05, 0xfb, 0x35, 0x7a, 0x03, 0x8c, 0xa8, 0x9b, 0x60, 0xca, 0x2e, 0x17, 0x5d,
+  0x28, 0x7f, 0x0c, 0x02, 0xba, 0xb1, 0x0c, 0x2f, 0x78, 0xa4, 0x26, 0x14, 0xe0, 0x80, 0x7d, 0x54,
+  0xfb, 0x3a, 0xae, 0x43, 0x00, 0xe9, 0x93, 0x42, 0x52, 0x57, 0x28, 0x2a, 0x55, 0x28, 0x62, 0x64,
+  0xe0, 0x5c, 0xc7, 0x0e, 0x12, 0x92, 0xc6, 0x03, 0x07, 0x9a, 0xa4, 0xa3, 0x5a, 0x0d, 0x5c, 0x39,
+  0x6a, 0x44, 0x0c, 0x9c, 0xb6, 0x6b, 0xaf, 0x65, 0x39, 0x63, 0xb1, 0xd0, 0x19, 0x1e, 0xa5, 0x44,
+  0xee, 0x01, 0x8a, 0xb1, 0x02, 0xc6, 0xa4, 0xd8, 0xa6, 0x77, 0xb6, 0x54, 0xc3, 0xdc, 0x75, 0x86,
+  0x8d, 0x06, 0x60, 0x0c, 0xe2, 0x43, 0xd4, 0xc8, 0xf2, 0x2b, 0x10, 0x0b, 0x02, 0x4a, 0x18, 0x96,
+  0x14, 0x71, 0x2a, 0x62, 0x80, 0x07, 0x00, 0x8e, 0x4a, 0x18, 0x53, 0xce, 0x23, 0x6e, 0x01, 0x09,
+  0x6e, 0x95, 0x7e, 0xac, 0x09, 0xd8, 0x08, 0xba, 0xc1, 0x15, 0xd7, 0x60, 0xb1, 0x07, 0x81, 0xc5,
+  0x0a, 0xb0, 0x5c, 0x77, 0x01, 0xae, 0xa7, 0x45, 0x8b, 0x55, 0xa3, 0x75, 0xe2, 0x33, 0x58, 0x15,
+  0x40, 0x12, 0xca, 0x15, 0x4c, 0xee, 0x1a, 0x40, 0x3b, 0x69, 0xa0, 0x41, 0xba, 0xe9, 0x48, 0x16,
+  0xd0, 0x4f, 0x07, 0xe9, 0x18, 0xb6, 0x12, 0x37, 0x58, 0xb2, 0x1b, 0x0a, 0x30, 0x91, 0x07, 0xc1,
+  0x44, 0x96, 0x73, 0xaa, 0xfb, 0xb4, 0x20, 0x91, 0x6a, 0x90, 0x2e, 0xb8, 0x2e, 0x25, 0xa1, 0xf1,
+  0x10, 0xd3, 0x28, 0x92, 0x08, 0x87, 0x04, 0x45, 0x62, 0xc2, 0x7c, 0x1f, 0xab, 0x45, 0x56, 0xe0,
+  0x33, 0x4e, 0x60, 0x1c, 0x87, 0x26, 0xae, 0xb4, 0x44, 0x9d, 0xcc, 0x07, 0xe8, 0xf0, 0x0e, 0x34,
+  0xab, 0x3f, 0xff, 0x84, 0xde, 0x40, 0xcd, 0xa2, 0xf9, 0x66, 0x93, 0xaa, 0x56, 0x5b, 0x4a, 0x7f,
+  0xd8, 0x96, 0x90, 0x35, 0x2f, 0x1c, 0x68, 0x07, 0x13, 0x9f, 0x4d, 0xae, 0x07, 0x0e, 0x90, 0x9f,
+  0x4a, 0xb0, 0x7c, 0x4c, 0x3d, 0x9c, 0xf8, 0x52, 0xd4, 0xea, 0x6a, 0xc9, 0xbf, 0xfe, 0x0e, 0xbd,
+  0x56, 0x0f, 0x54, 0x49, 0x64, 0x4f, 0xca, 0x0b, 0xf6, 0x5b, 0x2a, 0x9d, 0xba, 0xa3, 0xa6, 0xf1,
+  0xdc, 0xdb, 0x2b, 0x7f, 0xfe, 0xf1, 0xfb, 0x9f, 0xb2, 0x2e, 0x7b, 0x4a, 0x29, 0x59, 0xbf, 0x71,
+  0x82, 0x3f, 0xff, 0xcc, 0xdb, 0xe6, 0xe8, 0xc5, 0xd9, 0xe8, 0x72, 0x74, 0x7e, 0x86, 0x2e, 0x7f,
+  0x35, 0xd7, 0x3e, 0x9f, 0x93, 0xef, 0x12, 0x01, 0x2e, 0x4f, 0xc1, 0xf3, 0xac, 0x7b, 0x82, 0xff,
+  0x2c, 0x88, 0x39, 0x64, 0x06, 0xc1, 0x66, 0x89, 0xe9, 0x51, 0x66, 0xf7, 0x49, 0xf4, 0x2a, 0x82,
+  0x4a, 0x8f, 0xb5, 0x57, 0x02, 0x0d, 0xd0, 0x98, 0x4a, 0x70, 0xa8, 0x90, 0x85, 0x90, 0x51, 0xa0,
+  0x44, 0x44, 0x10, 0x5d, 0xdf, 0xdf, 0x56, 0xb5, 0x1d, 0x1d, 0x97, 0x78, 0x6c, 0x7f, 0x1d, 0xa5,
+  0x7b, 0xfb, 0x14, 0xa2, 0xe3, 0x84, 0x6b, 0x02, 0x3d, 0xa0, 0x1e, 0xcc, 0xd9, 0x40, 0xa9, 0x9b,
+  0x6a, 0x68, 0xe7, 0x3d, 0xa3, 0x03, 0x3d, 0x16, 0x76, 0x71, 0x30, 0x11, 0x89, 0x78, 0xc2, 0xc2,
+  0xb0, 0x96, 0xac, 0xae, 0x90, 0x53, 0xc6, 0x21, 0x31, 0x29, 0xca, 0xc8, 0x53, 0x81, 0xdd, 0x4e,
+  0x69, 0x58, 0xa0, 0x0c, 0x4d, 0x85, 0x03, 0xfc, 0xb5, 0xb6, 0xdb, 0x00, 0x1f, 0x45, 0xfd, 0xd3,
+  0xfb, 0xc9, 0x4b, 0xb5, 0x95, 0x51, 0x83, 0xfd, 0xb1, 0x30, 0xfa, 0xc6, 0x80, 0x85, 0x63, 0xd7,
+  0xc0, 0xb8, 0xfb, 0x79, 0x50, 0xb4, 0x57, 0x5c, 0xd2, 0x68, 0x2c, 0x00, 0x49, 0xc2, 0x55, 0x78,
+  0x99, 0x12, 0x8a, 0xa7, 0x18, 0x58, 0x5f, 0xeb, 0x36, 0x76, 0x9f, 0x04, 0xbf, 0x33, 0x55, 0x20,
+  0x8f, 0x27, 0x61, 0xa8, 0xd5, 0x6d, 0x0e, 0x1a, 0xec, 0xb6, 0x3f, 0x0f, 0x76, 0xc5, 0x7a, 0xd5,
+  0xc8, 0x99, 0x70, 0x22, 0x3d, 0xdb, 0x15, 0xe3, 0x34, 0x86, 0x6a, 0x74, 0x01, 0xe9, 0x1a, 0xdb,
+  0x9f, 0x81, 0x72, 0x6a, 0xea, 0x73, 0xf0, 0xf0, 0x11, 0x94, 0xcb, 0x54, 0x0d, 0x74, 0xdb, 0x79,
+  0xf9, 0xee, 0x7d, 0x5e, 0xe2, 0x65, 0xeb, 0x56, 0x43, 0x78, 0xa9, 0xc0, 0x82, 0xf6, 0x78, 0x4b,
+  0xa1, 0x72, 0x73, 0xda, 0x29, 0x1c, 0xa1, 0x70, 0xb7, 0xa1, 0x70, 0xf7, 0x56, 0xa3, 0xb8, 0xc6,
+  0xa0, 0xfb, 0x3e, 0x1b, 0x74, 0x29, 0xcf, 0x3f, 0xd3, 0xac, 0xd3, 0xc6, 0x97, 0x8c, 0x3b, 0xb3,
+  0xf2, 0xd3, 0x8d, 0xbc, 0xbf, 0xfc, 0x01, 0x99, 0x3c, 0xa0, 0x37, 0xb0, 0x73, 0x4a, 0xe6, 0x47,
+  0x9d, 0xc2, 0x5f, 0xe8, 0x07, 0x0d, 0x73, 0x5e, 0x2f, 0x06, 0x46, 0x3c, 0xcc, 0x66, 0xde, 0x0b,
+  0x0e, 0x3b, 0x09, 0xf4, 0x3a, 0x09, 0xf5, 0x61, 0xaf, 0x98, 0x78, 0x69, 0x66, 0x95, 0x8d, 0x2b,
+  0x25, 0x61, 0x04, 0xac, 0xbc, 0xf5, 0x5b, 0x71, 0x85, 0xb9, 0x4b, 0x38, 0x47, 0x41, 0x94, 0x97,
+  0xc5, 0x5e, 0xb7, 0xd2, 0x26, 0x00, 0xa2, 0xcf, 0xb2, 0x96, 0xbd, 0xff, 0xfc, 0xeb, 0xb4, 0xda,
+  0x64, 0x16, 0xe4, 0x7d, 0x36, 0xb5, 0x9f, 0x4a, 0x68, 0x1d, 0xa3, 0xaf, 0x70, 0x98, 0x40, 0xd5,
+  0x9e, 0xc3, 0xb6, 0x8a, 0x33, 0x52, 0x6d, 0x30, 0xd0, 0x32, 0x99, 0x48, 0x55, 0xe8, 0xf6, 0xcc,
+  0x36, 0xbc, 0xb1, 0x68, 0x67, 0xb3, 0xc3, 0x03, 0x82, 0x4c, 0xd3, 0x34, 0x59, 0xbc, 0xd0, 0x77,
+  0xf3, 0xec, 0x15, 0x84, 0xb0, 0x48, 0x80, 0xd1, 0x14, 0xb4, 0x07, 0x4e, 0xab, 0xc4, 0x68, 0xa4,
+  0xcf, 0xa6, 0x50, 0x95, 0x73, 0x2f, 0x62, 0x96, 0xbf, 0xd8, 0xca, 0x5e, 0x56, 0x19, 0x19, 0x02,
+  0xa5, 0x6e, 0x5a, 0x6f, 0xfa, 0x1e, 0x02, 0xce, 0x90, 0xbf, 0xff, 0x13, 0xfa, 0x0a, 0xce, 0xd2,
+  0x7a, 0x63, 0x86, 0xc5, 0x74, 0x1c, 0x61, 0x4e, 0xfa, 0x2d, 0xac, 0x4e, 0xc0, 0xa9, 0x3b, 0xfd,
+  0xb4, 0x05, 0x0c, 0x37, 0xa0, 0x4d, 0xc0, 0xd0, 0x3d, 0x3d, 0x39, 0x39, 0x7e, 0x7f, 0x3a, 0x3a,
+  0x79, 0x79, 0xfc, 0x06, 0xb6, 0x37, 0x6f, 0x4b, 0xdb, 0x83, 0x2d, 0x54, 0x1e, 0x73, 0xf0, 0xdb,
+  0x6a, 0xdc, 0xd6, 0xd3, 0xbc, 0x23, 0xbd, 0x3b, 0xd8, 0xd8, 0xf0, 0x92, 0x30, 0x7d, 0x0f, 0xe6,
+  0x47, 0x98, 0x98, 0xbd, 0x4e, 0x1d, 0x7d, 0x04, 0x1c, 0x3c, 0x2a, 0x27, 0xd3, 0x9a, 0xd3, 0x8a,
+  0x19, 0x79, 0x1f, 0xeb, 0x07, 0x4e, 0x5d, 0xe3, 0xde, 0x84, 0x3d, 0x59, 0x58, 0xcb, 0xcf, 0x59,
+  0x83, 0x61, 0x7e, 0xe6, 0x6a, 0x7e, 0x27, 0xa2, 0xb0, 0x56, 0xb7, 0xc5, 0x62, 0xf5, 0xfc, 0xa3,
+  0x61, 0x03, 0x89, 0x26, 0x49, 0x00, 0x18, 0x35, 0x81, 0xb0, 0x27, 0x3e, 0x55, 0x97, 0x5f, 0xdd,
+  0x8d, 0x48, 0x4d, 0x1d, 0x25, 0xeb, 0xcd, 0xf4, 0x75, 0xc6, 0x00, 0xc5, 0xcd, 0xeb, 0xb8, 0x29,
+  0xa3, 0x53, 0xf6, 0x81, 0x92, 0x5a, 0xa7, 0x7e, 0x70, 0xaf, 0x32, 0x2b, 0x2b, 0xb3, 0x5c, 0x79,
+  0x67, 0x0d, 0x65, 0x52, 0x56, 0x26, 0x0f, 0x5a, 0xb9, 0x38, 0x96, 0xd6, 0x9b, 0x2a, 0xc9, 0x47,
+  0xe9, 0x7b, 0xde, 0xf9, 0x20, 0xb6, 0xd7, 0x09, 0x62, 0x95, 0xa9, 0x07, 0x86, 0xb4, 0xca, 0x14,
+  0xa9, 0xf0, 0xca, 0xa2, 0x95, 0x7a, 0x67, 0x79, 0x82, 0x21, 0xf1, 0x9e, 0x9d, 0x38, 0x84, 0x52,
+  0xfe, 0x99, 0x71, 0x05, 0x96, 0x5e, 0x61, 0x39, 0x6d, 0x7a, 0x7e, 0x14, 0xf1, 0x5a, 0xfc, 0xd6,
+  0x7b, 0x87, 0x5a, 0xa8, 0xed, 0xba, 0x6e, 0x6e, 0x71, 0xb9, 0x7b, 0x5e, 0x01, 0xb7, 0xb1, 0xb6,
+  0x86, 0x0e, 0xfa, 0x12, 0x39, 0x4b, 0x83, 0xca, 0x9c, 0x02, 0x19, 0xe1, 0x64, 0xc6, 0x66, 0xc6,
+  0x15, 0xf5, 0x3d, 0xb3, 0x68, 0x3e, 0xd7, 0x17, 0x4a, 0x4c, 0x4f, 0x5b, 0xf7, 0x7b, 0xec, 0xfb,
+  0x8f, 0x61, 0x3a, 0xc1, 0x12, 0xaf, 0x45, 0xf6, 0x52, 0x77, 0x9f, 0x0f, 0x46, 0x59, 0x69, 0xda,
+  0x12, 0xe8, 0x10, 0x39, 0xdf, 0x9c, 0xbc, 0x71, 0x50, 0x0f, 0x39, 0x67, 0xe7, 0xce, 0xbd, 0xd9,
+  0xcf, 0xfb, 0x7c, 0xa5, 0xe5, 0xec, 0xe9, 0xc1, 0x5a, 0x4e, 0xea, 0xd6, 0xbe, 0xdc, 0x43, 0xf5,
+  0x38, 0x67, 0x53, 0xfb, 0x7e, 0x62, 0xce, 0x75, 0xf7, 0x4a, 0xc3, 0x65, 0x19, 0x15, 0xfc, 0xf3,
+  0xa3, 0xcb, 0xd1, 0xaf, 0x4f, 0x74, 0xfc, 0xa3, 0x33, 0xf3, 0xa3, 0x3a, 0xb7, 0xe5, 0x77, 0x61,
+  0x3a, 0x11, 0xfa, 0xb2, 0x19, 0xa7, 0x67, 0x7a, 0xb3, 0x11, 0xa8, 0x69, 0x4f, 0x53, 0x42, 0x5f,
+  0xc7, 0x6a, 0xe1, 0xfb, 0xdb, 0x92, 0xa5, 0xc1, 0x56, 0x6a, 0xb0, 0x0a, 0x0d, 0xb2, 0x52, 0x83,
+  0xd8, 0x1a, 0x29, 0x15, 0xbf, 0x6d, 0x41, 0x9e, 0xde, 0x43, 0xe3, 0x3d, 0xbc, 0x8e, 0x07, 0xbf,
+  0xfc, 0x78, 0x1d, 0xcf, 0x36, 0xaf, 0x99, 0xba, 0x60, 0x70, 0x41, 0xd4, 0x05, 0x99, 0x7d, 0x7b,
+  0x2f, 0x45, 0x15, 0xba, 0xab, 0x29, 0x8a, 0x7d, 0xca, 0x65, 0xcd, 0x29, 0xbf, 0x8a, 0xd0, 0xbb,
+  0x36, 0x02, 0x68, 0x43, 0x41, 0x29, 0x85, 0x3c, 0xaf, 0xf6, 0x84, 0x58, 0x91, 0x80, 0xc5, 0x53,
+  0xf3, 0x5a, 0x99, 0xb0, 0x46, 0xd9, 0x2a, 0xb8, 0xec, 0x89, 0xb7, 0x80, 0xb4, 0x3d, 0xff, 0x56,
+  0x19, 0x29, 0xcd, 0xc9, 0x05, 0x2b, 0xc5, 0xd4, 0x5c, 0x65, 0xc3, 0x9a, 0xad, 0x4b, 0xfd, 0xc8,
+  0x26, 0xed, 0x3a, 0xbe, 0xe4, 0x53, 0x79, 0x19, 0x1b, 0x34, 0xae, 0x66, 0x12, 0x1f, 0x1a, 0x18,
+  0x80, 0x0a, 0x16, 0x20, 0xb3, 0xcd, 0xcc, 0x18, 0xdc, 0xb7, 0x63, 0x9c, 0x6d, 0xa6, 0xde, 0xc2,
+  0xed, 0xc2, 0xed, 0xd9, 0x26, 0x33, 0x4b, 0x5a, 0xd2, 0x99, 0x17, 0x4f, 0x4a, 0xaf, 0xf9, 0x03,
+  0xc0, 0x27, 0x30, 0x6c, 0xf1, 0x05, 0x97, 0x5e, 0x8d, 0x79, 0xa8, 0x06, 0xd0, 0x7b, 0x8c, 0x07,
+  0x35, 0xc7, 0x6c, 0xfe, 0x81, 0xd4, 0xb0, 0xad, 0x22, 0xa9, 0xa0, 0x79, 0x83, 0x74, 0xa8, 0xde,
+  0x71, 0x0f, 0xda, 0xcd, 0xee, 0x16, 0xfa, 0x9a, 0x0d, 0xdc, 0xa6, 0xdb, 0x86, 0x0b, 0x02, 0x17,
+  0xdd, 0xba, 0x53, 0xaf, 0x1b, 0xc7, 0xf3, 0x71, 0x50, 0xd4, 0x20, 0x68, 0xa8, 0x0a, 0x54, 0x0a,
+  0xaa, 0x00, 0x41, 0xde, 0x4c, 0x88, 0xb5, 0x11, 0x5a, 0x86, 0x51, 0xa9, 0x08, 0x17, 0xde, 0xd2,
+  0x39, 0xd6, 0x40, 0x5d, 0x04, 0x27, 0x9b, 0x72, 0xb3, 0x0a, 0x88, 0xe6, 0xce, 0x45, 0xcb, 0x50,
+  0x32, 0x6f, 0x71, 0xe2, 0x22, 0x37, 0x05, 0x66, 0xe2, 0x70, 0x09, 0x26, 0x95, 0x4c, 0xdc, 0xe9,
+  0x16, 0xec, 0xeb, 0xb8, 0x19, 0xe1, 0xba, 0x05, 0xc9, 0x76, 0xdd, 0xa7, 0xc7, 0x6c, 0x81, 0x59,
+  0x9f, 0x82, 0x60, 0x5e, 0xa2, 0x98, 0x90, 0x13, 0xd5, 0xa5, 0x5e, 0x32, 0x01, 0xa3, 0x89, 0xf2,
+  0x9a, 0x73, 0x7c, 0xfe, 0xca, 0xcc, 0xa9, 0x97, 0x60, 0x43, 0x6f, 0xa7, 0x33, 0xbc, 0x0d, 0xb6,
+  0xf3, 0xb6, 0xe7, 0xf6, 0x19, 0xc0, 0x62, 0xf8, 0xc0, 0x61, 0xc6, 0x6c, 0xe7, 0xe1, 0xe8, 0x91,
+  0xfe, 0xd3, 0x56, 0x2b, 0xfd, 0x4f, 0x05, 0xff, 0x07, 0xb3, 0x1f, 0x12, 0x0e, 0x6c, 0x20, 0x00,
+  0x00,
+};
+
+// debug.html: 858 bytes, 499 gzipped
+static const uint8_t WEB_DEBUG_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x93, 0xc1, 0x8e, 0xd3, 0x30,
+  0x10, 0x86, 0xef, 0x79, 0x8a, 0x61, 0x91, 0x48, 0x2b, 0x68, 0xd3, 0x80, 0x5a, 0xb1, 0x69, 0x12,
+  0x04, 0x2d, 0xe2, 0x84, 0xe0, 0xb0, 0x17, 0x4e, 0xab, 0x49, 0xec, 0x24, 0xd6, 0x3a, 0x76, 0x64,
+  0x4f, 0xd8, 0x56, 0xab, 0x7d, 0x77, 0x26, 0x49, 0x5b, 0xba, 0x12, 0x17, 0x94, 0xc3, 0x78, 0xec,
+  0x7f, 0xbe, 0x8c, 0x7f, 0xdb, 0xe9, 0xab, 0xfd, 0x8f, 0xdd, 0xdd, 0xaf, 0x9f, 0x5f, 0xa1, 0xa1,
+  0x56, 0xe7, 0x41, 0x7a, 0x0e, 0x12, 0x05, 0x87, 0x56, 0x12, 0x42, 0xd9, 0xa0, 0xf3, 0x92, 0xb2,
+  0xb0, 0xa7, 0x6a, 0xf1, 0x31, 0xe4, 0x69, 0x52, 0xa4, 0x65, 0xbe, 0x97, 0x45, 0x5f, 0xc3, 0xce,
+  0x1a, 0x72, 0x56, 0xa7, 0xd1, 0x34, 0x19, 0xa4, 0x9e, 0x8e, 0x43, 0x2c, 0xac, 0x38, 0xc2, 0x13,
+  0x14, 0x58, 0x3e, 0xd4, 0xce, 0xf6, 0x46, 0x24, 0xf0, 0x3a, 0xc6, 0xe1, 0xdb, 0x42, 0x69, 0xb5,
+  0x75, 0x9c, 0x57, 0x55, 0xb5, 0x85, 0x8a, 0x01, 0x8b, 0x0a, 0x5b, 0xa5, 0x8f, 0x09, 0x7c, 0x76,
+  0x0a, 0xf5, 0x3b, 0xf0, 0x68, 0xfc, 0xc2, 0x4b, 0xa7, 0x78, 0xbd, 0x43, 0x21, 0x94, 0xa9, 0x13,
+  0x78, 0xbf, 0xea, 0x0e, 0x5b, 0x78, 0x0e, 0x96, 0x25, 0x57, 0xa0, 0x32, 0xd2, 0x31, 0xbf, 0xc5,
+  0xc3, 0xe2, 0x51, 0x09, 0x6a, 0x12, 0xd8, 0xac, 0x46, 0x41, 0x8b, 0xae, 0x56, 0x26, 0x81, 0x15,
+  0x60, 0x4f, 0x76, 0x2c, 0x28, 0xc8, 0xb0, 0xf4, 0x02, 0x8a, 0xd7, 0xdd, 0x01, 0x3e, 0x8c, 0xe2,
+  0x17, 0xed, 0xad, 0xd6, 0xb7, 0x9b, 0xcd, 0xed, 0xa5, 0xbd, 0xc7, 0x46, 0x91, 0x64, 0x89, 0x75,
+  0x42, 0x72, 0x6a, 0xac, 0xb9, 0x64, 0x0b, 0x87, 0x42, 0xf5, 0x3e, 0x81, 0xf5, 0x00, 0x29, 0x7b,
+  0xe7, 0x87, 0x82, 0xce, 0x2a, 0x43, 0xd2, 0xfd, 0x6d, 0x21, 0x3e, 0x75, 0x9c, 0x46, 0x27, 0x53,
+  0xd2, 0xe8, 0x64, 0xec, 0xe0, 0x0e, 0x07, 0xa1, 0x7e, 0x43, 0xa9, 0xd1, 0xfb, 0x2c, 0xbc, 0x6c,
+  0x8a, 0x0d, 0x06, 0x48, 0x9b, 0xf8, 0xa5, 0xbf, 0xb0, 0x93, 0x03, 0x9b, 0x01, 0xf1, 0xb8, 0x5e,
+  0xf4, 0x44, 0xd6, 0x9c, 0x8b, 0x79, 0x83, 0x21, 0x58, 0x53, 0x6a, 0x55, 0x3e, 0x64, 0x21, 0xd9,
+  0xba, 0xd6, 0x72, 0x2c, 0x9f, 0xdd, 0xd4, 0x4e, 0x69, 0x7d, 0x33, 0x0f, 0xf3, 0xbb, 0x71, 0x16,
+  0xbe, 0x0d, 0x39, 0x8c, 0x8b, 0x69, 0x34, 0x51, 0xfe, 0x0f, 0xd8, 0x4a, 0xa4, 0x2b, 0xde, 0x77,
+  0x4e, 0xff, 0x81, 0x43, 0x68, 0x9c, 0xac, 0xb2, 0x30, 0x0a, 0xaf, 0x91, 0xf9, 0x17, 0xf6, 0x1b,
+  0xc8, 0xc2, 0x1e, 0x7d, 0x53, 0x58, 0x74, 0x22, 0x8d, 0x70, 0xb0, 0x85, 0x8d, 0xc8, 0x03, 0xbe,
+  0x3b, 0xa5, 0x53, 0x1d, 0xe5, 0x41, 0xd5, 0x9b, 0x92, 0x14, 0xb7, 0x73, 0xfd, 0x67, 0x2f, 0x0d,
+  0xdb, 0x3c, 0x87, 0x27, 0xe6, 0x57, 0x92, 0xca, 0x66, 0x16, 0x46, 0x7c, 0x2f, 0xef, 0x95, 0xe1,
+  0x6a, 0x25, 0x7a, 0xd4, 0xf7, 0x62, 0x10, 0x7e, 0x9a, 0x84, 0x59, 0x08, 0x6f, 0x61, 0x1a, 0xf2,
+  0x20, 0x7c, 0x23, 0x0d, 0x16, 0x5a, 0x8a, 0x2c, 0x0e, 0xe7, 0x0c, 0x00, 0x58, 0x52, 0x23, 0xcd,
+  0xcc, 0x49, 0xdf, 0x59, 0xe3, 0x25, 0x64, 0x39, 0x9c, 0xc7, 0x4b, 0x92, 0x07, 0x9a, 0xcd, 0xaf,
+  0x65, 0x02, 0xf9, 0x21, 0xb0, 0x04, 0xb5, 0x74, 0x34, 0x66, 0xf3, 0xf9, 0x36, 0x18, 0x4f, 0xf6,
+  0xd4, 0x32, 0xef, 0x7e, 0x3a, 0xd3, 0x68, 0x7a, 0x42, 0x7f, 0x00, 0xca, 0x74, 0x56, 0x13, 0x5a,
+  0x03, 0x00, 0x00,
+};
+
+// wifi.html: 8123 bytes, 2481 gzipped
+static const uint8_t WEB_WIFI_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x59, 0xeb, 0x6e, 0xe3, 0xb8,
+  0x15, 0xfe, 0x9f, 0xa7, 0x60, 0xb1, 0xe8, 0x4a, 0xc2, 0xc6, 0xb2, 0x9d, 0xd4, 0xd9, 0x89, 0x6f,
+  0x83, 0x4c, 0x92, 0x76, 0x02, 0x24, 0x33, 0xe9, 0xc6, 0x8b, 0xa2, 0xc0, 0x00, 0x05, 0x2d, 0xd1,
+  0x16, 0x1b, 0x89, 0xd2, 0x4a, 0x94, 0x9d, 0x74, 0x90, 0x97, 0x58, 0xec, 0xff, 0xbe, 0x62, 0x1f,
+  0xa1, 0xe7, 0x90, 0xd4, 0xd5, 0x76, 0xc6, 0x31, 0xda, 0xcd, 0x60, 0x62, 0x4b, 0x3c, 0xf7, 0xcb,
+  0xc7, 0x43, 0x66, 0xfc, 0x87, 0xab, 0xcf, 0x97, 0xb3, 0xbf, 0xdf, 0x5f, 0x93, 0x40, 0x46, 0xe1,
+  0xf4, 0x68, 0x5c, 0x7c, 0x30, 0xea, 0xc3, 0x47, 0xc4, 0x24, 0x25, 0x5e, 0x40, 0xd3, 0x8c, 0xc9,
+  0x89, 0x95, 0xcb, 0x45, 0xe7, 0x9d, 0x55, 0xbc, 0x16, 0x34, 0x62, 0x13, 0x6b, 0xc5, 0xd9, 0x3a,
+  0x89, 0x53, 0x69, 0x11, 0x2f, 0x16, 0x92, 0x09, 0x20, 0x5b, 0x73, 0x5f, 0x06, 0x13, 0x9f, 0xad,
+  0xb8, 0xc7, 0x3a, 0xea, 0xe1, 0x98, 0x70, 0xc1, 0x25, 0xa7, 0x61, 0x27, 0xf3, 0x68, 0xc8, 0x26,
+  0x7d, 0x14, 0x22, 0xb9, 0x0c, 0xd9, 0xf4, 0x6f, 0xfc, 0xcf, 0x9c, 0x5c, 0xc6, 0x62, 0xc1, 0x97,
+  0x79, 0x4a, 0x25, 0x8f, 0xc5, 0xb8, 0xab, 0x57, 0x8e, 0xc6, 0x99, 0x7c, 0xc6, 0xcf, 0x79, 0xec,
+  0x3f, 0x93, 0xaf, 0x64, 0x4e, 0xbd, 0xc7, 0x65, 0x1a, 0xe7, 0xc2, 0x1f, 0x92, 0xef, 0xfa, 0x14,
+  0xff, 0x8d, 0x40, 0x69, 0x18, 0xa7, 0xf0, 0xbc, 0x58, 0x2c, 0x46, 0x64, 0x01, 0x16, 0x74, 0x16,
+  0x34, 0xe2, 0xe1, 0xf3, 0x90, 0x5c, 0xa4, 0xa0, 0xef, 0x98, 0x64, 0x54, 0x64, 0x9d, 0x8c, 0xa5,
+  0x1c, 0xd6, 0x13, 0xea, 0xfb, 0x5c, 0x2c, 0x87, 0xe4, 0xa4, 0x97, 0x3c, 0x8d, 0xc8, 0xcb, 0x91,
+  0x8b, 0x36, 0x53, 0x2e, 0x58, 0x0a, 0xf2, 0x23, 0xfa, 0xa4, 0xad, 0x1d, 0x92, 0xb3, 0x9e, 0x22,
+  0x88, 0x68, 0xba, 0xe4, 0x62, 0x48, 0x7a, 0x84, 0xe6, 0x32, 0x46, 0x86, 0xa0, 0x0f, 0x84, 0x85,
+  0xce, 0xb3, 0x1e, 0x1d, 0x2c, 0xc0, 0x06, 0xc9, 0x9e, 0x64, 0x87, 0x86, 0x7c, 0x09, 0xa4, 0x1e,
+  0x44, 0x80, 0xa5, 0x05, 0x6b, 0x67, 0x1e, 0x4b, 0x19, 0x47, 0x43, 0x72, 0x5a, 0x28, 0x5c, 0xc4,
+  0x69, 0xd4, 0x41, 0x2f, 0x12, 0xa5, 0x51, 0xcb, 0x47, 0x73, 0x48, 0x0f, 0xd7, 0x43, 0x3a, 0x67,
+  0x21, 0xac, 0xf8, 0x3c, 0x4b, 0x42, 0x0a, 0x5e, 0xcc, 0xc3, 0xd8, 0x7b, 0xdc, 0x10, 0x37, 0x40,
+  0x69, 0xca, 0xdb, 0x35, 0xe3, 0xcb, 0x40, 0x02, 0x5d, 0x1c, 0xfa, 0x28, 0x80, 0x8b, 0x24, 0x97,
+  0xe0, 0x35, 0x0b, 0x99, 0x27, 0x41, 0x90, 0x71, 0xa8, 0xdf, 0xeb, 0xfd, 0xb1, 0xe6, 0x7f, 0xbf,
+  0x57, 0x0a, 0xc8, 0xf8, 0xbf, 0x18, 0xbc, 0x60, 0xd1, 0x08, 0x64, 0xa4, 0x3e, 0x4b, 0x3b, 0x29,
+  0xf5, 0x79, 0x9e, 0x19, 0x25, 0xfa, 0x1d, 0x10, 0x80, 0x85, 0x59, 0x1c, 0x72, 0x9f, 0x7c, 0x37,
+  0x18, 0x0c, 0x46, 0xcd, 0x64, 0x9c, 0x9e, 0x9e, 0xb6, 0x32, 0x01, 0x9e, 0xce, 0xa5, 0x00, 0xfd,
+  0x95, 0x4a, 0x10, 0x67, 0xc2, 0xd0, 0xe0, 0xed, 0x0d, 0xce, 0xcf, 0xce, 0xce, 0x4b, 0xf6, 0x75,
+  0xc0, 0x25, 0xab, 0xd4, 0x8a, 0x58, 0xb0, 0xed, 0x86, 0xd5, 0x8d, 0x77, 0x95, 0xf9, 0x5e, 0x9e,
+  0x66, 0x28, 0x22, 0x89, 0x79, 0x3d, 0x07, 0xda, 0x5b, 0xcd, 0xa4, 0xcd, 0x1a, 0x06, 0xf1, 0x4a,
+  0x65, 0xbc, 0x69, 0xc8, 0x9f, 0x7e, 0x7c, 0x37, 0xf8, 0xb1, 0xa0, 0xe9, 0xf8, 0x54, 0x2c, 0x37,
+  0x89, 0x7c, 0xef, 0xe4, 0xec, 0xe4, 0xac, 0x45, 0xb4, 0x5d, 0xde, 0xfc, 0xbc, 0xef, 0xf5, 0x3d,
+  0x45, 0x9a, 0x49, 0x2a, 0xf3, 0xac, 0x1d, 0x8d, 0xd1, 0x46, 0xfe, 0xb7, 0xf9, 0x59, 0xb2, 0x77,
+  0xa0, 0x56, 0x05, 0x24, 0x95, 0xf9, 0x1b, 0x96, 0x9b, 0x10, 0x56, 0xa4, 0x34, 0x69, 0xd3, 0x2c,
+  0x06, 0xe7, 0xac, 0x37, 0xaf, 0xd3, 0x40, 0x89, 0xed, 0x94, 0x58, 0x73, 0x53, 0x30, 0xb9, 0x8e,
+  0xd3, 0xc7, 0x4e, 0xc8, 0x33, 0xd9, 0x22, 0x4b, 0x97, 0x73, 0x6a, 0x9f, 0x0c, 0x06, 0xc7, 0xc5,
+  0xff, 0x9e, 0xdb, 0x77, 0x46, 0x6d, 0x27, 0xb7, 0x39, 0x55, 0x66, 0x66, 0x50, 0x14, 0x7e, 0xa9,
+  0x07, 0xd2, 0x1f, 0x35, 0x22, 0xd5, 0xe8, 0x44, 0x43, 0xbf, 0x87, 0x15, 0xdb, 0xd4, 0x6e, 0x54,
+  0x48, 0x4b, 0xef, 0xd6, 0x44, 0x6e, 0x91, 0x7f, 0xe2, 0x20, 0xeb, 0xb8, 0x6b, 0xf0, 0x69, 0xdc,
+  0x35, 0x68, 0x89, 0x40, 0x05, 0x1f, 0x3e, 0x5f, 0x11, 0x2f, 0xa4, 0x59, 0x36, 0xb1, 0x4a, 0x7c,
+  0x01, 0xc0, 0x23, 0x64, 0x1c, 0xf4, 0xb7, 0xe2, 0x1d, 0xbc, 0x3e, 0xc2, 0xe5, 0x1a, 0xa3, 0x29,
+  0x99, 0x2d, 0xb9, 0xb2, 0x08, 0xf7, 0x11, 0x63, 0x17, 0xbc, 0xa3, 0x57, 0xad, 0xe9, 0x6d, 0x4c,
+  0x31, 0x58, 0xae, 0xeb, 0x8e, 0xbb, 0x20, 0x63, 0x43, 0x58, 0x3d, 0x87, 0xca, 0x10, 0x34, 0xe5,
+  0x74, 0x7a, 0xb1, 0xa2, 0x1c, 0x00, 0x27, 0x64, 0xe4, 0x93, 0x26, 0xc8, 0x86, 0x60, 0xcb, 0xa9,
+  0x21, 0x40, 0x7e, 0xd4, 0x64, 0x98, 0xb7, 0xa9, 0x51, 0x74, 0xf3, 0x1c, 0x30, 0x49, 0x14, 0xaa,
+  0xa0, 0x2b, 0x2c, 0x12, 0x0b, 0x2f, 0xe4, 0xde, 0x23, 0x78, 0xe1, 0x51, 0x51, 0xc8, 0xb6, 0x65,
+  0x9a, 0x33, 0xc7, 0x9a, 0x3e, 0xc0, 0xbb, 0x52, 0xe1, 0xb8, 0xab, 0xd9, 0x55, 0x74, 0x2a, 0xdb,
+  0x11, 0x25, 0x41, 0x4a, 0x96, 0xcf, 0x23, 0x0e, 0x1b, 0x4a, 0x46, 0x57, 0x0c, 0xe3, 0x66, 0xb3,
+  0x15, 0xc0, 0xab, 0x63, 0xd5, 0x2c, 0x34, 0x6a, 0x2b, 0x58, 0x35, 0x8b, 0xb0, 0xac, 0xb0, 0x74,
+  0x6a, 0x34, 0x91, 0x4f, 0xb0, 0x5b, 0x11, 0xfb, 0xe1, 0xe1, 0xe6, 0xca, 0x01, 0x2f, 0xf5, 0x5a,
+  0x41, 0xa9, 0x40, 0x93, 0xc8, 0xe7, 0x04, 0xf6, 0x33, 0x04, 0x73, 0x1d, 0xe2, 0x2c, 0xe3, 0x10,
+  0x6c, 0xbd, 0xcb, 0xe9, 0xef, 0x29, 0xfb, 0x25, 0xe7, 0x29, 0xf3, 0x8d, 0xfe, 0x5a, 0x10, 0xf6,
+  0x32, 0xe5, 0x1e, 0xd6, 0xc1, 0x16, 0xff, 0x55, 0xfd, 0x89, 0x21, 0xd2, 0x36, 0x54, 0x4f, 0xda,
+  0x8e, 0xea, 0x19, 0xb6, 0x07, 0x8f, 0x05, 0x80, 0xfa, 0x2c, 0x9d, 0x58, 0xd7, 0x58, 0xce, 0x44,
+  0x95, 0x56, 0x49, 0x71, 0xa0, 0x91, 0x1f, 0xe3, 0x4c, 0xa2, 0xae, 0x3d, 0x83, 0x14, 0x18, 0xf2,
+  0xc2, 0xc0, 0xf2, 0x79, 0x53, 0xbd, 0x29, 0x14, 0x2d, 0x41, 0xa7, 0xd6, 0xaa, 0x97, 0xcd, 0xf4,
+  0x01, 0xd2, 0x4c, 0xbe, 0xc7, 0xe6, 0xc0, 0x4a, 0xaf, 0x97, 0x46, 0x9b, 0x5b, 0x3f, 0xd4, 0xb9,
+  0x49, 0x05, 0xc7, 0xb5, 0xfa, 0x4b, 0x19, 0xcc, 0x2d, 0xaa, 0x72, 0xa0, 0x68, 0x7e, 0xc2, 0x07,
+  0x1d, 0xa4, 0x07, 0x26, 0x25, 0x54, 0x72, 0xab, 0xfc, 0x30, 0x28, 0xba, 0xfe, 0xa0, 0x21, 0xef,
+  0xfe, 0x3a, 0x9b, 0x1d, 0xd4, 0x99, 0xd1, 0x2f, 0x52, 0xbe, 0xde, 0x99, 0x5b, 0xaa, 0xfb, 0x0e,
+  0x98, 0x0e, 0xa9, 0xee, 0x46, 0x56, 0xbc, 0x80, 0x79, 0x8f, 0xf3, 0xf8, 0xa9, 0x66, 0x07, 0x13,
+  0xd8, 0xdf, 0x60, 0x99, 0x82, 0x2a, 0x33, 0x9a, 0x0d, 0xf5, 0x38, 0x63, 0x4d, 0xc9, 0x7d, 0x3e,
+  0x07, 0x4c, 0x08, 0x88, 0x8c, 0x09, 0xfa, 0x4b, 0xe6, 0x69, 0xfc, 0x08, 0x85, 0x64, 0x7f, 0x8c,
+  0xa1, 0x59, 0x2e, 0xa0, 0xe8, 0xc1, 0x0f, 0x21, 0x89, 0x72, 0x12, 0x90, 0xf1, 0xd9, 0x69, 0x14,
+  0xc5, 0x9b, 0x6b, 0xeb, 0x83, 0x16, 0x8f, 0x25, 0xb6, 0x67, 0x79, 0x29, 0x27, 0xb0, 0xa6, 0x5a,
+  0x05, 0xcf, 0xdc, 0xa5, 0x4b, 0xfa, 0xe7, 0x27, 0x6e, 0xff, 0xec, 0x9d, 0x0b, 0xfb, 0x7f, 0xef,
+  0xd0, 0x72, 0xbf, 0x87, 0xd1, 0xf5, 0x55, 0x5b, 0x44, 0x1e, 0xcd, 0xb1, 0xa6, 0x4a, 0x6b, 0xf4,
+  0xb0, 0x1b, 0x71, 0x31, 0xb1, 0xfa, 0x16, 0x0e, 0x8d, 0x13, 0xeb, 0x6c, 0x30, 0x38, 0x1d, 0x1c,
+  0x6a, 0xc1, 0xcf, 0x30, 0x9c, 0xbe, 0xa1, 0xe1, 0x94, 0x0d, 0x79, 0x66, 0x76, 0x94, 0xdf, 0x07,
+  0x85, 0xb4, 0xdf, 0xdb, 0xa1, 0xe7, 0x96, 0x61, 0xd7, 0xce, 0x43, 0x2a, 0x1e, 0xb1, 0x8c, 0x1e,
+  0x19, 0x4b, 0x70, 0x9f, 0x4d, 0xa1, 0x94, 0x0f, 0xb5, 0xf0, 0x03, 0xcd, 0x18, 0x99, 0xc5, 0x09,
+  0xf7, 0xde, 0x12, 0x93, 0x39, 0x70, 0x1d, 0x8c, 0x3a, 0xaa, 0xfa, 0xbf, 0x85, 0x0a, 0x94, 0x04,
+  0x29, 0x5b, 0x4c, 0xac, 0x6e, 0x43, 0x40, 0xd1, 0x5a, 0xed, 0x91, 0x7d, 0xf7, 0xa9, 0xa0, 0x1a,
+  0xf8, 0x14, 0x8d, 0xcf, 0xbc, 0x58, 0x4f, 0x02, 0x66, 0xde, 0xb5, 0x20, 0x02, 0x9e, 0x8a, 0xe6,
+  0x5f, 0x52, 0x1e, 0x86, 0x08, 0x88, 0x32, 0x8d, 0xc3, 0x71, 0x97, 0xe2, 0xac, 0xa1, 0x61, 0x64,
+  0x9c, 0x79, 0x29, 0x4f, 0xe4, 0xf4, 0x68, 0x91, 0x0b, 0x0f, 0x79, 0x49, 0x08, 0x50, 0xa3, 0xe7,
+  0x0a, 0xdb, 0x21, 0x5f, 0xc1, 0xde, 0x05, 0x93, 0x5e, 0x60, 0x5b, 0x5d, 0x1c, 0x15, 0xfe, 0xe1,
+  0xa9, 0x15, 0xcb, 0x51, 0x41, 0x71, 0x65, 0xc0, 0x84, 0x0d, 0xe0, 0x98, 0x00, 0x0a, 0x31, 0x32,
+  0x99, 0x92, 0xe2, 0xbb, 0xfb, 0xcf, 0x2c, 0x16, 0xb6, 0x53, 0x27, 0xf3, 0x70, 0xfd, 0xab, 0x49,
+  0x00, 0x88, 0x81, 0x31, 0xd0, 0x40, 0xe0, 0x84, 0xf8, 0xb1, 0x97, 0x47, 0xe0, 0x9b, 0xbb, 0x64,
+  0xf2, 0x3a, 0x64, 0xf8, 0xf5, 0xc3, 0xf3, 0x8d, 0x6f, 0x37, 0xc6, 0x13, 0x67, 0x64, 0x98, 0xf9,
+  0x82, 0xd8, 0x9e, 0x5b, 0xc2, 0xa5, 0x53, 0x4a, 0x25, 0x46, 0xa2, 0xab, 0xc2, 0xaa, 0x76, 0xea,
+  0x09, 0x69, 0x01, 0x6d, 0x85, 0xb2, 0xa3, 0x36, 0x17, 0x87, 0x95, 0x74, 0x06, 0xa1, 0x44, 0xae,
+  0xcb, 0x72, 0xa6, 0x95, 0xf1, 0x90, 0x58, 0xe4, 0x07, 0xe2, 0xb9, 0xb8, 0x7b, 0xc3, 0x17, 0xeb,
+  0x8b, 0xb8, 0xb9, 0x27, 0x17, 0xbe, 0x0f, 0xde, 0x66, 0xc5, 0x1a, 0x4f, 0x0a, 0x79, 0x2f, 0x84,
+  0x85, 0x10, 0x0d, 0x6d, 0x25, 0x4d, 0xee, 0x62, 0x9f, 0xbd, 0xcd, 0x44, 0x9a, 0x7c, 0xc3, 0xb6,
+  0x8b, 0x7b, 0x82, 0x52, 0xc9, 0x05, 0x64, 0x6c, 0xc5, 0xbe, 0x08, 0x63, 0x6b, 0xcd, 0x52, 0x9a,
+  0xe0, 0x84, 0xa2, 0x6d, 0x05, 0xea, 0x9b, 0xfb, 0x6a, 0xe1, 0xe6, 0xbe, 0x65, 0xe8, 0x5b, 0x4c,
+  0x6b, 0x6c, 0x53, 0xaf, 0x1b, 0x79, 0xb5, 0x8d, 0xf4, 0xc5, 0x7c, 0xee, 0x4c, 0xb8, 0x1a, 0x90,
+  0x1c, 0x77, 0x45, 0xc3, 0x1c, 0xd5, 0xab, 0x34, 0x43, 0xc1, 0x3d, 0xc0, 0xeb, 0xd1, 0xb7, 0x78,
+  0xcb, 0x99, 0xa1, 0xce, 0x5f, 0xbc, 0xd4, 0xdc, 0x2f, 0x50, 0x44, 0x2f, 0x47, 0x55, 0xb1, 0xb7,
+  0x26, 0x42, 0x15, 0x0b, 0xf5, 0xd5, 0x4d, 0x52, 0xf5, 0x79, 0xc5, 0x16, 0x34, 0x0f, 0xa5, 0xad,
+  0x8a, 0xcf, 0x54, 0x2d, 0x56, 0xc1, 0x64, 0x3f, 0x17, 0x2a, 0xae, 0x02, 0xf6, 0x5e, 0xe3, 0x2c,
+  0xa1, 0x71, 0x83, 0xbb, 0xf0, 0xe2, 0x35, 0xee, 0xb6, 0xfb, 0xa3, 0x76, 0xef, 0xa2, 0xb3, 0xd6,
+  0xb1, 0xc9, 0x77, 0xc4, 0x64, 0x10, 0xc3, 0xb1, 0xc4, 0xba, 0xff, 0xfc, 0x30, 0xb3, 0x8e, 0xd5,
+  0x3b, 0x3c, 0x7e, 0xb0, 0x14, 0x4a, 0xfa, 0x2b, 0x96, 0x3f, 0x5e, 0xc2, 0x74, 0x66, 0x80, 0x77,
+  0x16, 0x50, 0xd1, 0x24, 0x81, 0x51, 0x48, 0xa1, 0x4b, 0xf7, 0xa9, 0xb3, 0x5e, 0xaf, 0x3b, 0x0a,
+  0x77, 0xf3, 0x34, 0x64, 0xc2, 0x83, 0x5a, 0xf4, 0xad, 0x17, 0x2d, 0x03, 0xcf, 0x2e, 0x40, 0x8f,
+  0x41, 0x98, 0x60, 0xc9, 0xe9, 0xe5, 0x9f, 0x7f, 0xba, 0xb9, 0x8c, 0x23, 0x80, 0x06, 0x90, 0x69,
+  0xe3, 0x9a, 0x83, 0xb5, 0xf9, 0x7d, 0xe1, 0xf0, 0x2e, 0xca, 0x62, 0x5d, 0x53, 0x17, 0x0e, 0xee,
+  0xa2, 0x2e, 0xd6, 0x11, 0x75, 0x5e, 0xf0, 0xd7, 0x2b, 0xf8, 0x84, 0x88, 0xa9, 0xf1, 0x49, 0x13,
+  0xf9, 0x54, 0xd2, 0x0a, 0xa0, 0x68, 0xc8, 0x52, 0xa9, 0xde, 0x19, 0xd0, 0x81, 0x89, 0x6f, 0xc6,
+  0x23, 0x16, 0xe7, 0xd2, 0xae, 0xf0, 0xf1, 0x18, 0xf0, 0xb7, 0xd7, 0x53, 0x14, 0xed, 0xba, 0xaa,
+  0x0d, 0x8c, 0x4a, 0xa4, 0x02, 0x03, 0x64, 0x4a, 0x23, 0xdb, 0xd2, 0x03, 0x24, 0x05, 0x44, 0x56,
+  0x43, 0x64, 0x66, 0xb6, 0x8b, 0xf7, 0x64, 0x16, 0xf0, 0x8c, 0xac, 0x11, 0xaa, 0x81, 0x5f, 0xd2,
+  0x14, 0x3a, 0x3a, 0x60, 0x44, 0x5f, 0x80, 0x11, 0x2e, 0x08, 0x74, 0x72, 0x04, 0x4e, 0xbb, 0x96,
+  0x53, 0x00, 0x4a, 0x23, 0xbf, 0x4a, 0x29, 0x26, 0xb8, 0x99, 0xdb, 0x17, 0xc7, 0x34, 0xce, 0x5e,
+  0xe1, 0xa8, 0x08, 0x9b, 0x21, 0xd9, 0x1a, 0x96, 0x56, 0x68, 0xc0, 0x59, 0xa0, 0x87, 0x6d, 0x4b,
+  0xd5, 0x89, 0x9b, 0x32, 0x8c, 0x95, 0xed, 0xd4, 0xe2, 0x54, 0xf4, 0x20, 0x22, 0x41, 0xa3, 0x0f,
+  0xd5, 0x3d, 0x93, 0x39, 0x63, 0x99, 0x02, 0x41, 0xbd, 0xfb, 0xe2, 0x44, 0xa6, 0xf0, 0xa1, 0x21,
+  0x31, 0x88, 0xd7, 0xe5, 0x91, 0x11, 0xcf, 0x8f, 0x5a, 0xa0, 0x6e, 0x27, 0x75, 0x09, 0xf1, 0x4a,
+  0x2b, 0x95, 0x67, 0x55, 0x65, 0x2a, 0x52, 0x6b, 0x6c, 0xfb, 0x38, 0xbb, 0xbb, 0x45, 0x6c, 0x53,
+  0x78, 0x86, 0x42, 0x8b, 0x63, 0x7f, 0x86, 0x17, 0x72, 0xd7, 0x14, 0x72, 0x21, 0xaa, 0x90, 0x69,
+  0x5d, 0xea, 0x22, 0xa2, 0xa6, 0xcb, 0x4b, 0x19, 0x95, 0xcc, 0xa8, 0xb3, 0x61, 0xbb, 0x5f, 0x15,
+  0x3b, 0x1b, 0x52, 0x36, 0xc1, 0xb7, 0x7e, 0xa9, 0x60, 0xd5, 0x88, 0x30, 0x5d, 0xa6, 0x43, 0x81,
+  0x4c, 0x94, 0x1b, 0x13, 0xb1, 0xb1, 0x35, 0x20, 0xf2, 0xf0, 0x42, 0x3d, 0xfb, 0x1f, 0xa2, 0x63,
+  0xe2, 0x05, 0x44, 0xbf, 0xf6, 0x02, 0x0a, 0x5e, 0x84, 0xb8, 0xe2, 0xe0, 0x1b, 0x1b, 0x38, 0x19,
+  0x0c, 0x59, 0x8c, 0xbc, 0x07, 0x8a, 0xff, 0xfc, 0xfb, 0xb7, 0x5f, 0x2d, 0x02, 0x55, 0x63, 0x41,
+  0xbb, 0x95, 0xe9, 0x6d, 0xfd, 0x00, 0x0b, 0x5d, 0xb2, 0x07, 0xe6, 0x91, 0x29, 0x39, 0xeb, 0x29,
+  0xbe, 0x0e, 0x64, 0x8f, 0x09, 0xa5, 0xe2, 0x8e, 0xca, 0xc0, 0x55, 0xf7, 0x1d, 0x15, 0x5d, 0x17,
+  0xe8, 0x54, 0xff, 0xe2, 0xac, 0x4b, 0xe8, 0x32, 0x36, 0x3a, 0x6a, 0xee, 0x98, 0x73, 0x16, 0xb8,
+  0xa2, 0x2b, 0xa8, 0x59, 0x0d, 0xda, 0x3d, 0x43, 0xaf, 0x72, 0x01, 0x60, 0xc4, 0x84, 0x7f, 0x19,
+  0xf0, 0xd0, 0xb7, 0x51, 0x40, 0xd9, 0x82, 0xba, 0xd1, 0x9a, 0x89, 0x01, 0x80, 0x5a, 0xca, 0x80,
+  0x4c, 0x26, 0x04, 0xcc, 0x50, 0xec, 0xcd, 0xe8, 0x29, 0x6a, 0xfc, 0x25, 0xa0, 0x09, 0xd1, 0xa1,
+  0x07, 0xf3, 0x1d, 0x0e, 0x5b, 0xca, 0xd4, 0x4f, 0x31, 0x29, 0x84, 0x91, 0x05, 0xfa, 0xa6, 0x32,
+  0x51, 0xee, 0xf1, 0x0d, 0x7e, 0x67, 0xd3, 0xc0, 0x56, 0xe2, 0x71, 0x7b, 0xfc, 0x04, 0x4d, 0x6c,
+  0x97, 0x7a, 0x40, 0x68, 0x0a, 0x7d, 0x9d, 0x32, 0x54, 0xe8, 0x68, 0x20, 0xe9, 0x76, 0x09, 0x2e,
+  0x67, 0x24, 0xcd, 0x05, 0x76, 0x3e, 0xe2, 0x40, 0x75, 0x99, 0x34, 0x52, 0xcf, 0x1e, 0x94, 0x1b,
+  0x8c, 0x27, 0xaa, 0x96, 0xb1, 0xda, 0x33, 0x42, 0x25, 0x1e, 0x59, 0x19, 0xa1, 0xc2, 0x87, 0xd6,
+  0x5e, 0x40, 0x77, 0x07, 0x2c, 0x23, 0xb9, 0x90, 0x3c, 0x54, 0x1c, 0x68, 0x25, 0x01, 0x88, 0xf1,
+  0x01, 0x2f, 0x6b, 0x9d, 0x52, 0xbf, 0x5c, 0x31, 0x6c, 0x5b, 0x26, 0x3f, 0x24, 0x53, 0x45, 0x63,
+  0x48, 0x30, 0x54, 0xef, 0xcd, 0xf7, 0x49, 0xdf, 0x24, 0xf5, 0x80, 0xb9, 0x50, 0x19, 0x55, 0x83,
+  0x99, 0xcd, 0xc6, 0xad, 0xcf, 0x7d, 0xad, 0x68, 0x6f, 0x80, 0x4f, 0xc3, 0x99, 0x05, 0x85, 0x24,
+  0x01, 0xfc, 0xf4, 0x2b, 0xf8, 0x69, 0x03, 0x35, 0x22, 0x94, 0x3a, 0x34, 0x37, 0x3d, 0xc6, 0x93,
+  0xc0, 0xff, 0x6a, 0xd6, 0xdd, 0x89, 0x32, 0x8d, 0x93, 0xb5, 0xe3, 0xaa, 0x63, 0x37, 0xf3, 0xd5,
+  0xd4, 0x62, 0xde, 0x8e, 0xf6, 0x12, 0xa1, 0xce, 0xb5, 0xed, 0x99, 0x67, 0x3f, 0x56, 0x75, 0x08,
+  0xad, 0xb3, 0xe2, 0x8b, 0xfd, 0x58, 0xd5, 0xd9, 0xb1, 0xce, 0x8a, 0x2f, 0xf6, 0x63, 0x55, 0x47,
+  0xac, 0x3a, 0x2b, 0xbe, 0x50, 0x07, 0xb5, 0x2a, 0x49, 0xad, 0x5c, 0xe0, 0x84, 0x99, 0x1d, 0x92,
+  0x8a, 0xec, 0x90, 0x63, 0x47, 0xfd, 0xee, 0xa5, 0x2c, 0xbf, 0x57, 0xa6, 0x63, 0xd5, 0x17, 0x99,
+  0xba, 0x11, 0x67, 0x88, 0x34, 0x56, 0xed, 0x2e, 0xe7, 0x7d, 0x41, 0x55, 0x3b, 0x7a, 0x90, 0xe1,
+  0x2e, 0x7c, 0x6d, 0xfd, 0xd4, 0x65, 0xc2, 0xec, 0x6d, 0x2e, 0x61, 0x2a, 0x91, 0xcd, 0x6b, 0xa3,
+  0x61, 0xf9, 0x1e, 0x8e, 0x10, 0x6d, 0xbb, 0x1b, 0xc3, 0x39, 0x9e, 0x53, 0xf5, 0x91, 0xa0, 0xd0,
+  0xa0, 0x1c, 0x00, 0xd7, 0x64, 0x35, 0xb7, 0xa3, 0x9e, 0x2f, 0xe2, 0x16, 0xde, 0x91, 0x4a, 0x4f,
+  0xc1, 0xd5, 0x22, 0xad, 0x41, 0xfa, 0xb6, 0x19, 0xbb, 0x76, 0x2f, 0xb5, 0xd7, 0x8c, 0xbd, 0xe0,
+  0x2c, 0xc4, 0x4e, 0xc0, 0x49, 0x7b, 0xba, 0x6d, 0xd6, 0xdb, 0x95, 0x3a, 0xd8, 0x28, 0x74, 0x5d,
+  0xe9, 0x9d, 0x1b, 0xe6, 0x2c, 0xf5, 0x57, 0x3f, 0x70, 0xd9, 0xb4, 0x94, 0x1a, 0x1e, 0xed, 0xb7,
+  0xf6, 0x24, 0x44, 0x42, 0x43, 0x5c, 0x6f, 0x73, 0x73, 0xd4, 0x83, 0xa9, 0x92, 0xab, 0xcc, 0x6e,
+  0x74, 0xa5, 0x1e, 0x73, 0xa1, 0xa9, 0x36, 0xd6, 0x75, 0xeb, 0x6d, 0x0a, 0xc3, 0x36, 0xda, 0x20,
+  0xd6, 0xcd, 0xa6, 0x84, 0x61, 0xaf, 0x6c, 0xac, 0xeb, 0x8e, 0x2a, 0x36, 0xc0, 0x6f, 0xf4, 0x7c,
+  0xeb, 0x94, 0xe1, 0xe8, 0x10, 0xfd, 0x30, 0x69, 0x0f, 0xe4, 0x0d, 0x6b, 0x4b, 0xa6, 0xd1, 0x0e,
+  0x98, 0xfc, 0x7d, 0x0e, 0x16, 0xf8, 0xfb, 0xff, 0x3e, 0xde, 0x63, 0xb5, 0x1e, 0x93, 0xd3, 0xd6,
+  0x70, 0x5f, 0x46, 0x95, 0xfa, 0xfe, 0x35, 0xd6, 0xed, 0x2d, 0xec, 0xbc, 0x0c, 0x9a, 0xca, 0xb6,
+  0xae, 0x3e, 0xdf, 0x19, 0xbf, 0xf0, 0xa2, 0x16, 0x6c, 0x3e, 0xae, 0x5d, 0xa3, 0x00, 0xf7, 0xdb,
+  0x59, 0xd1, 0x84, 0x37, 0x33, 0xee, 0xdc, 0x02, 0x41, 0xd2, 0xb8, 0x5b, 0xdc, 0xf4, 0x8c, 0xbb,
+  0xe6, 0xef, 0x4b, 0x5d, 0xfd, 0x37, 0xfa, 0xff, 0x02, 0x3d, 0xbe, 0x85, 0x27, 0xbb, 0x1f, 0x00,
+  0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+  {"/", "text/html", WEB_INDEX_HTML_GZ, sizeof(WEB_INDEX_HTML_GZ), "\"c4fc2030a0e09e6d\""},
+  {"/manual", "text/html", WEB_MANUAL_HTML_GZ, sizeof(WEB_MANUAL_HTML_GZ), "\"9445ffd4494a254b\""},
+  {"/pid", "text/html", WEB_PID_HTML_GZ, sizeof(WEB_PID_HTML_GZ), "\"da7467bfce594bc9\""},
+  {"/debug", "text/html", WEB_DEBUG_HTML_GZ, sizeof(WEB_DEBUG_HTML_GZ), "\"2e9ca967665890d1\""},
+  {"/wifi", "text/html", WEB_WIFI_HTML_GZ, sizeof(WEB_WIFI_HTML_GZ), "\"5509e0172e02b1b6\""},
+};
+
+#define WEB_ASSET_COUNT (sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]))
+
+#endif // WEBASSETS_H
@@ -1,16 +1,63 @@
 // WiFiManager.cpp - Fixed Implementation
 #include "WiFiManager.h"
 #include "Globals.h"
+#include "Clock.h"
+#include "CommandQueue.h"
+#include "WiFiScan.h"
+#include "CaptivePortal.h"
+#include "Metrics.h"
+#include "JsonWriter.h"
+#include <ESPmDNS.h>
+#include <atomic>
 
 GrillWiFiManager wifiManager;
 
+// WiFi events arrive on the WiFi/event task; loop() consumes them
+static std::atomic<bool> gotIpEvent(false);
+static std::atomic<bool> disconnectedEvent(false);
+static std::atomic<uint8_t> disconnectReasonEvent(0);
+
+static void wifi_on_got_ip(WiFiEvent_t event, WiFiEventInfo_t info) {
+  gotIpEvent = true;
+}
+
+static void wifi_on_disconnected(WiFiEvent_t event, WiFiEventInfo_t info) {
+  disconnectReasonEvent = info.wifi_sta_disconnected.reason;
+  disconnectedEvent = true;
+}
+
 GrillWiFiManager::GrillWiFiManager() {
   currentStatus = GRILL_WIFI_DISCONNECTED;
-  lastConnectionAttempt = 0;
-  connectionTimeout = 30000; // 30 seconds
-  connectionAttempts = 0;
   apModeEnabled = false;
   
+  phase = GRILL_WIFI_PHASE_IDLE;
+  phaseSince = 0;
+  retryAt = 0;
+  backoffMs = WIFI_BACKOFF_MIN_MS;
+  failedRounds = 0;
+  scanGeneration = 0;
+  candidateCount = 0;
+  candidateIndex = 0;
+  
+  pendingMux = portMUX_INITIALIZER_UNLOCKED;
+  pendingReset = false;
+  pendingSave = false;
+  pendingAt = 0;
+  publishedSsid[0] = '\0';
+  snprintf(publishedHostname, sizeof(publishedHostname), "GrillController");
+  publishedCount = 0;
+  
+  attemptCount = 0;
+  failureCount = 0;
+  connectCount = 0;
+  disconnectCount = 0;
+  lastConnectMs = 0;
+  minConnectMs = 0;
+  maxConnectMs = 0;
+  totalConnectMs = 0;
+  lastDisconnectReason = 0;
+  connectedSince = 0;
+  
   // Default AP settings - use MAC address for unique ID
   uint8_t mac[6];
   WiFi.macAddress(mac);
@@ -19,6 +66,7 @@ GrillWiFiManager::GrillWiFiManager() {
   apIP = IPAddress(192, 168, 4, 1);
   
   // Default STA settings
+  config.networkCount = 0;
   config.hostname = "GrillController";
   config.useStaticIP = false;
 }
@@ -29,84 +77,104 @@ void GrillWiFiManager::begin() {
   // Load saved configuration
   loadConfig();
   
-  WiFi.mode(WIFI_AP_STA); // Enable both modes initially
+  WiFi.mode(WIFI_STA);
   WiFi.setHostname(config.hostname.c_str());
+  WiFi.setAutoReconnect(false);   // Reconnects are ours, with backoff
+  WiFi.onEvent(wifi_on_got_ip, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  WiFi.onEvent(wifi_on_disconnected, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
   
-  // Debug: Show what we loaded
-  Serial.printf("Loaded WiFi Config - SSID: '%s', Hostname: '%s'\n", 
-                config.ssid.c_str(), config.hostname.c_str());
+  Serial.printf("Loaded WiFi Config - %d saved network(s), Hostname: '%s'\n",
+                config.networkCount, config.hostname.c_str());
   
-  // Try to connect if we have credentials
-  if (config.ssid.length() > 0) {
-    Serial.printf("Attempting to connect to: %s\n", config.ssid.c_str());
-    reconnect();
-    
-    // Wait up to 15 seconds for connection
-    unsigned long startTime = millis();
-    while (WiFi.status() != WL_CONNECTED && millis() - startTime < 15000) {
-      delay(500);
-      Serial.print(".");
-    }
-    
-    if (WiFi.status() == WL_CONNECTED) {
-      Serial.println("\nWiFi connected successfully!");
-      currentStatus = GRILL_WIFI_CONNECTED;
-    } else {
-      Serial.println("\nWiFi connection failed, starting AP mode");
-      startAPMode();
-    }
-  } else {
-    Serial.println("No WiFi credentials found, starting AP mode");
-    startAPMode();
-  }
+  // DNS responder for the setup AP; idle until startAPMode()
+  captive_portal_init();
+  
+  // First round starts now; loop() carries it on while setup continues
+  startRound();
   
   // Setup web configuration interface
   setupWebServer();
 }
 
+// The responder follows the interfaces as they come up, so this need not wait for a connection
+void GrillWiFiManager::beginMDNS() {
+  if (!MDNS.begin(config.hostname.c_str())) {
+    Serial.println("⚠️ mDNS responder failed to start");
+    return;
+  }
+  MDNS.addService("http", "tcp", 80);
+  Serial.printf("mDNS: http://%s.local\n", config.hostname.c_str());
+}
+
 void GrillWiFiManager::loop() {
-  static unsigned long lastCheck = 0;
-  unsigned long now = millis();
+  applyPendingReset();
+  applyPendingSave();
+  
+  wifi_scan_update(phase != GRILL_WIFI_PHASE_CONNECTING, apModeEnabled);
   
-  // Check WiFi status every 5 seconds
-  if (now - lastCheck < 5000) return;
-  lastCheck = now;
+  bool gotIp = gotIpEvent.exchange(false);
+  bool dropped = disconnectedEvent.exchange(false);
+  uint8_t reason = disconnectReasonEvent;
+  
+  switch (phase) {
+    case GRILL_WIFI_PHASE_SCANNING:
+      if (wifi_scan_generation() == scanGeneration && clock_elapsed_ms(phaseSince) < WIFI_SCAN_TIMEOUT_MS) break;
+      rankCandidates();
+      startAttempt(0);
+      break;
+    
+    case GRILL_WIFI_PHASE_CONNECTING:
+      if (gotIp) {
+        onConnected();
+      } else if (dropped && reason != WIFI_REASON_ASSOC_LEAVE) {   // ASSOC_LEAVE is our own disconnect
+        lastDisconnectReason = reason;
+        failAttempt("disconnected");
+      } else if (clock_elapsed_ms(phaseSince) >= WIFI_CONNECT_TIMEOUT_MS) {
+        failAttempt("timed out");
+      }
+      break;
+    
+    case GRILL_WIFI_PHASE_CONNECTED:
+      if (dropped) {
+        disconnectCount++;
+        lastDisconnectReason = reason;
+        metrics_count(METRIC_WIFI_DISCONNECTS);
+        Serial.printf("WiFi connection lost (reason %u) after %lu s, reconnecting\n", reason,
+                      (unsigned long)(clock_elapsed_ms(connectedSince) / 1000));
+        startRound();
+      }
+      break;
+    
+    case GRILL_WIFI_PHASE_BACKOFF:
+      if (clock_expired(retryAt)) startRound();
+      break;
+    
+    default:
+      break;
+  }
   
+  updateStatus();
+}
+
+void GrillWiFiManager::setPhase(GrillWiFiPhase next) {
+  phase = next;
+  phaseSince = clock_ms();
+}
+
+// Status as shown to the rest of the firmware, from the phase and AP state
+void GrillWiFiManager::updateStatus() {
   GrillWiFiStatus oldStatus = currentStatus;
   
-  // Update current status
-  if (WiFi.status() == WL_CONNECTED) {
+  if (phase == GRILL_WIFI_PHASE_CONNECTED) {
     currentStatus = GRILL_WIFI_CONNECTED;
-    connectionAttempts = 0;
-    
-    // Disable AP mode if we're connected and it's enabled
-    if (WiFi.getMode() != WIFI_STA && apModeEnabled) {
-      Serial.println("WiFi connected, disabling AP mode");
-      WiFi.mode(WIFI_STA);
-      apModeEnabled = false;
-    }
+  } else if (apModeEnabled) {
+    currentStatus = GRILL_WIFI_AP_MODE;
+  } else if (phase == GRILL_WIFI_PHASE_SCANNING || phase == GRILL_WIFI_PHASE_CONNECTING) {
+    currentStatus = GRILL_WIFI_CONNECTING;
+  } else if (failedRounds > 0) {
+    currentStatus = GRILL_WIFI_FAILED;
   } else {
-    // Not connected
-    if (currentStatus == GRILL_WIFI_CONNECTING) {
-      // Check timeout
-      if (now - lastConnectionAttempt > connectionTimeout) {
-        Serial.println("WiFi connection timeout");
-        connectionAttempts++;
-        
-        if (connectionAttempts >= 3) {
-          Serial.println("Multiple connection failures, starting AP mode");
-          startAPMode();
-        } else {
-          Serial.printf("Retrying connection (attempt %d/3)\n", connectionAttempts + 1);
-          reconnect();
-        }
-      }
-    } else if (currentStatus == GRILL_WIFI_CONNECTED) {
-      // Lost connection
-      Serial.println("WiFi connection lost, attempting reconnect");
-      currentStatus = GRILL_WIFI_DISCONNECTED;
-      reconnect();
-    }
+    currentStatus = GRILL_WIFI_DISCONNECTED;
   }
   
   // Status change notification
@@ -117,228 +185,314 @@ void GrillWiFiManager::loop() {
   }
 }
 
+// One pass over the saved networks; rescans first when there is a choice to make
+// and the shared scan results are stale
+void GrillWiFiManager::startRound() {
+  if (config.networkCount == 0) {
+    Serial.println("No WiFi credentials found, starting AP mode");
+    if (!apModeEnabled) startAPMode();
+    setPhase(GRILL_WIFI_PHASE_IDLE);
+    return;
+  }
+  
+  if (config.networkCount == 1 || wifi_scan_fresh()) {
+    rankCandidates();
+    startAttempt(0);
+    return;
+  }
+  
+  scanGeneration = wifi_scan_generation();
+  wifi_scan_request();
+  setPhase(GRILL_WIFI_PHASE_SCANNING);
+}
+
+// Saved networks seen in the scan, strongest first, then the rest in saved order
+void GrillWiFiManager::rankCandidates() {
+  int32_t rssi[WIFI_MAX_NETWORKS];
+  for (int n = 0; n < config.networkCount; n++) {
+    rssi[n] = wifi_scan_best_rssi(config.networks[n].ssid.c_str());
+  }
+  
+  candidateCount = 0;
+  for (int n = 0; n < config.networkCount; n++) {
+    int pos = candidateCount++;
+    while (pos > 0 && rssi[candidates[pos - 1]] < rssi[n]) {
+      candidates[pos] = candidates[pos - 1];
+      pos--;
+    }
+    candidates[pos] = n;
+  }
+}
+
+void GrillWiFiManager::startAttempt(int index) {
+  candidateIndex = index;
+  const GrillWiFiNetwork& network = config.networks[candidates[index]];
+  Serial.printf("Connecting to WiFi: %s (%d/%d)\n", network.ssid.c_str(), index + 1, candidateCount);
+  
+  disconnectedEvent = false;
+  gotIpEvent = false;
+  WiFi.begin(network.ssid.c_str(), network.password.c_str());
+  attemptCount++;
+  setPhase(GRILL_WIFI_PHASE_CONNECTING);
+}
+
+void GrillWiFiManager::failAttempt(const char* why) {
+  failureCount++;
+  metrics_count(METRIC_WIFI_FAILURES);
+  Serial.printf("WiFi connection to %s %s\n", config.networks[candidates[candidateIndex]].ssid.c_str(), why);
+  WiFi.disconnect();
+  
+  if (candidateIndex + 1 < candidateCount) {
+    startAttempt(candidateIndex + 1);
+    return;
+  }
+  
+  failedRounds++;
+  if (failedRounds >= WIFI_AP_AFTER_ROUNDS && !apModeEnabled) {
+    Serial.println("Multiple connection failures, starting AP mode");
+    startAPMode();
+  }
+  enterBackoff();
+}
+
+void GrillWiFiManager::enterBackoff() {
+  retryAt = clock_ms() + backoffMs + random(backoffMs / 4);   // Jitter so devices on one AP do not retry in step
+  Serial.printf("WiFi retry in %lu ms\n", (unsigned long)(retryAt - clock_ms()));
+  backoffMs = min(backoffMs * 2, (uint32_t)WIFI_BACKOFF_MAX_MS);
+  setPhase(GRILL_WIFI_PHASE_BACKOFF);
+}
+
+void GrillWiFiManager::onConnected() {
+  uint32_t elapsed = (uint32_t)clock_elapsed_ms(phaseSince);
+  connectCount++;
+  lastConnectMs = elapsed;
+  minConnectMs = connectCount == 1 ? elapsed : min(minConnectMs, elapsed);
+  maxConnectMs = max(maxConnectMs, elapsed);
+  totalConnectMs += elapsed;
+  metrics_count(METRIC_WIFI_CONNECTS);
+  
+  backoffMs = WIFI_BACKOFF_MIN_MS;
+  failedRounds = 0;
+  connectedSince = clock_ms();
+  setPhase(GRILL_WIFI_PHASE_CONNECTED);
+  Serial.printf("WiFi connected to %s in %lu ms, IP %s\n", WiFi.SSID().c_str(),
+                (unsigned long)elapsed, WiFi.localIP().toString().c_str());
+  
+  // Disable AP mode if we're connected and it's enabled
+  if (apModeEnabled) {
+    Serial.println("WiFi connected, disabling AP mode");
+    WiFi.mode(WIFI_STA);
+    apModeEnabled = false;
+    captive_portal_stop();
+  }
+}
+
 void GrillWiFiManager::startAPMode() {
   Serial.printf("Starting AP mode: %s\n", apSSID.c_str());
   
   // Configure AP
+  WiFi.mode(WIFI_AP_STA);
   WiFi.softAPConfig(apIP, apIP, IPAddress(255, 255, 255, 0));
   WiFi.softAP(apSSID.c_str(), apPassword.c_str());
   
-  currentStatus = GRILL_WIFI_AP_MODE;
   apModeEnabled = true;
+  captive_portal_start(apIP);
   
   Serial.printf("AP started - SSID: %s, Password: %s\n", apSSID.c_str(), apPassword.c_str());
   Serial.printf("AP IP address: %s\n", WiFi.softAPIP().toString().c_str());
-  Serial.println("Connect to the AP and go to http://192.168.4.1 to configure WiFi");
+  Serial.println("Connect to the AP - the WiFi page opens as a sign-in page (or go to http://192.168.4.1/wifi)");
 }
 
 void GrillWiFiManager::reconnect() {
-  if (config.ssid.length() == 0) {
-    Serial.println("No SSID configured");
-    startAPMode();
-    return;
-  }
+  backoffMs = WIFI_BACKOFF_MIN_MS;
+  failedRounds = 0;
+  startRound();
+}
+
+// Credentials from /wifi_save - staged here, saved and used by loop()
+void GrillWiFiManager::setCredentials(String ssid, String password) {
+  portENTER_CRITICAL(&pendingMux);
+  snprintf(pendingSsid, sizeof(pendingSsid), "%s", ssid.c_str());
+  snprintf(pendingPassword, sizeof(pendingPassword), "%s", password.c_str());
+  pendingHostname[0] = '\0';
+  pendingAt = clock_ms();
+  pendingSave = true;
+  portEXIT_CRITICAL(&pendingMux);
+}
+
+void GrillWiFiManager::applyPendingSave() {
+  if (!pendingSave) return;
   
-  Serial.printf("Connecting to WiFi: %s\n", config.ssid.c_str());
+  portENTER_CRITICAL(&pendingMux);
+  bool ready = pendingSave && clock_elapsed_ms(pendingAt) >= WIFI_APPLY_DELAY_MS;
+  char ssidCopy[sizeof(pendingSsid)], passwordCopy[sizeof(pendingPassword)], hostnameCopy[sizeof(pendingHostname)];
+  if (ready) {
+    memcpy(ssidCopy, pendingSsid, sizeof(ssidCopy));
+    memcpy(passwordCopy, pendingPassword, sizeof(passwordCopy));
+    memcpy(hostnameCopy, pendingHostname, sizeof(hostnameCopy));
+    pendingSave = false;
+  }
+  portEXIT_CRITICAL(&pendingMux);
+  if (!ready) return;
   
-  WiFi.begin(config.ssid.c_str(), config.password.c_str());
+  if (hostnameCopy[0]) {
+    config.hostname = hostnameCopy;
+    WiFi.setHostname(hostnameCopy);
+    MDNS.end();
+    beginMDNS();
+  }
+  rememberNetwork(ssidCopy, passwordCopy);
+  saveConfig();
   
-  currentStatus = GRILL_WIFI_CONNECTING;
-  lastConnectionAttempt = millis();
+  // Try the new network first, now
+  if (phase == GRILL_WIFI_PHASE_CONNECTING || phase == GRILL_WIFI_PHASE_CONNECTED) WiFi.disconnect();
+  backoffMs = WIFI_BACKOFF_MIN_MS;
+  failedRounds = 0;
+  rankCandidates();
+  startAttempt(0);
 }
 
-void GrillWiFiManager::setCredentials(String ssid, String password) {
-  config.ssid = ssid;
-  config.password = password;
-  saveConfig();
+// Move (or add) a network to the front of the saved list
+void GrillWiFiManager::rememberNetwork(const String& ssid, const String& password) {
+  int existing = config.networkCount < WIFI_MAX_NETWORKS ? config.networkCount : WIFI_MAX_NETWORKS - 1;
+  for (int n = 0; n < config.networkCount; n++) {
+    if (config.networks[n].ssid == ssid) {
+      existing = n;
+      break;
+    }
+  }
+  if (existing == config.networkCount) config.networkCount++;
+  
+  for (int n = existing; n > 0; n--) config.networks[n] = config.networks[n - 1];
+  config.networks[0].ssid = ssid;
+  config.networks[0].password = password;
 }
 
 void GrillWiFiManager::saveConfig() {
-  preferences.begin("wifi", false);
-  preferences.putString("ssid", config.ssid);
-  preferences.putString("password", config.password);
-  preferences.putString("hostname", config.hostname);
-  preferences.end();
+  prefs.begin("wifi", false);
+  prefs.putUChar("count", config.networkCount);
+  for (int n = 0; n < WIFI_MAX_NETWORKS; n++) {
+    char ssidKey[8], passKey[8];
+    snprintf(ssidKey, sizeof(ssidKey), "ssid%d", n);
+    snprintf(passKey, sizeof(passKey), "pass%d", n);
+    if (n < config.networkCount) {
+      prefs.putString(ssidKey, config.networks[n].ssid);
+      prefs.putString(passKey, config.networks[n].password);
+    } else {
+      prefs.remove(ssidKey);
+      prefs.remove(passKey);
+    }
+  }
+  prefs.putString("hostname", config.hostname);
+  prefs.remove("ssid");       // Single-network keys from older firmware
+  prefs.remove("password");
+  prefs.end();
+  publishConfig();
   Serial.println("WiFi configuration saved");
 }
 
 void GrillWiFiManager::loadConfig() {
-  preferences.begin("wifi", true);
-  config.ssid = preferences.getString("ssid", "");
-  config.password = preferences.getString("password", "");
-  config.hostname = preferences.getString("hostname", "GrillController");
-  preferences.end();
+  prefs.begin("wifi", true);
+  config.networkCount = min((int)prefs.getUChar("count", 0), WIFI_MAX_NETWORKS);
+  for (int n = 0; n < config.networkCount; n++) {
+    char ssidKey[8], passKey[8];
+    snprintf(ssidKey, sizeof(ssidKey), "ssid%d", n);
+    snprintf(passKey, sizeof(passKey), "pass%d", n);
+    config.networks[n].ssid = prefs.getString(ssidKey, "");
+    config.networks[n].password = prefs.getString(passKey, "");
+  }
   
-  Serial.printf("WiFi configuration loaded - SSID: %s\n", config.ssid.c_str());
+  // Older firmware kept one network under "ssid"/"password"
+  if (config.networkCount == 0) {
+    String ssid = prefs.getString("ssid", "");
+    if (ssid.length() > 0) {
+      config.networks[0].ssid = ssid;
+      config.networks[0].password = prefs.getString("password", "");
+      config.networkCount = 1;
+    }
+  }
+  config.hostname = prefs.getString("hostname", "GrillController");
+  prefs.end();
+  publishConfig();
+  
+  for (int n = 0; n < config.networkCount; n++) {
+    Serial.printf("WiFi configuration loaded - SSID %d: %s\n", n + 1, config.networks[n].ssid.c_str());
+  }
+}
+
+// config is the network task's; web handlers read this char copy instead of its Strings
+void GrillWiFiManager::publishConfig() {
+  portENTER_CRITICAL(&pendingMux);
+  snprintf(publishedSsid, sizeof(publishedSsid), "%s", config.networkCount > 0 ? config.networks[0].ssid.c_str() : "");
+  snprintf(publishedHostname, sizeof(publishedHostname), "%s", config.hostname.c_str());
+  publishedCount = config.networkCount;
+  portEXIT_CRITICAL(&pendingMux);
 }
 
 void GrillWiFiManager::setupWebServer() {
-  // WiFi configuration page
-  server.on("/wifi", HTTP_GET, [](AsyncWebServerRequest *req) {
-    String html = "<!DOCTYPE html><html><head>";
-    html += "<meta charset='utf-8'>";
-    html += "<meta name='viewport' content='width=device-width, initial-scale=1'>";
-    html += "<title>WiFi Configuration</title>";
-    html += "<style>";
-    html += "body { background: #1a1a1a; color: #fff; font-family: Arial, sans-serif; padding: 20px; }";
-    html += ".container { max-width: 600px; margin: 0 auto; }";
-    html += "h1 { color: #60a5fa; text-align: center; margin-bottom: 30px; }";
-    html += ".form-group { margin: 20px 0; }";
-    html += "label { display: block; margin-bottom: 5px; font-weight: bold; }";
-    html += "input, select { width: 100%; padding: 10px; font-size: 1em; border-radius: 5px; border: 1px solid #555; background: #333; color: #fff; }";
-    html += ".btn { padding: 15px 30px; background: #059669; color: white; border: none; border-radius: 5px; font-size: 1.1em; cursor: pointer; margin: 10px 5px; }";
-    html += ".btn:hover { background: #047857; }";
-    html += ".btn-danger { background: #dc2626; }";
-    html += ".btn-danger:hover { background: #b91c1c; }";
-    html += ".status { padding: 15px; margin: 20px 0; border-radius: 5px; }";
-    html += ".status-connected { background: #059669; }";
-    html += ".status-ap { background: #f59e0b; }";
-    html += ".status-disconnected { background: #dc2626; }";
-    html += ".network-list { background: rgba(255,255,255,0.1); padding: 15px; border-radius: 5px; margin: 15px 0; }";
-    html += ".network-item { padding: 10px; margin: 5px 0; background: rgba(255,255,255,0.1); border-radius: 5px; cursor: pointer; }";
-    html += ".network-item:hover { background: rgba(255,255,255,0.2); }";
-    html += "</style></head><body>";
-    
-    html += "<div class='container'>";
-    html += "<h1>WiFi Configuration</h1>";
-    
-    // Current status
-    html += "<div class='status ";
-    if (wifiManager.isConnected()) {
-      html += "status-connected'>Connected to: " + wifiManager.getSSID();
-      html += "<br>IP Address: " + wifiManager.getIP().toString();
-    } else if (wifiManager.getStatus() == GRILL_WIFI_AP_MODE) {
-      html += "status-ap'>AP Mode Active<br>Connect to: " + wifiManager.apSSID;
-      html += "<br>AP IP: " + WiFi.softAPIP().toString();
-    } else {
-      html += "status-disconnected'>Disconnected";
-    }
-    html += "</div>";
-    
-    // Available networks (scan results)
-    html += "<div class='network-list'>";
-    html += "<h3>Available Networks:</h3>";
-    html += "<div id='networks'>Click Scan to find networks</div>";
-    html += "<button class='btn' onclick='scanNetworks()'>Scan Networks</button>";
-    html += "</div>";
-    
-    // Configuration form
-    html += "<form onsubmit='saveWiFi(event)'>";
-    html += "<div class='form-group'>";
-    html += "<label>Network Name (SSID):</label>";
-    html += "<input type='text' id='ssid' name='ssid' value='" + wifiManager.config.ssid + "' required>";
-    html += "</div>";
-    
-    html += "<div class='form-group'>";
-    html += "<label>Password:</label>";
-    html += "<input type='password' id='password' name='password' placeholder='Enter WiFi password'>";
-    html += "</div>";
-    
-    html += "<div class='form-group'>";
-    html += "<label>Hostname:</label>";
-    html += "<input type='text' id='hostname' name='hostname' value='" + wifiManager.config.hostname + "'>";
-    html += "</div>";
-    
-    html += "<button type='submit' class='btn'>Save & Connect</button>";
-    html += "<button type='button' class='btn btn-danger' onclick='resetWiFi()'>Reset WiFi Settings</button>";
-    html += "</form>";
-    
-    html += "<a href='/' class='btn' style='display: block; text-align: center; margin: 20px 0; text-decoration: none;'>Back to Grill Control</a>";
-    html += "</div>";
-
-    // JavaScript (rest of the code continues...)
-    html += "<script>";
-    html += "function saveWiFi(event) {";
-    html += "  event.preventDefault();";
-    html += "  const ssid = document.getElementById('ssid').value;";
-    html += "  const password = document.getElementById('password').value;";
-    html += "  const hostname = document.getElementById('hostname').value;";
-    html += "  ";
-    html += "  fetch('/wifi_save', {";
-    html += "    method: 'POST',";
-    html += "    headers: {'Content-Type': 'application/x-www-form-urlencoded'},";
-    html += "    body: 'ssid=' + encodeURIComponent(ssid) + '&password=' + encodeURIComponent(password) + '&hostname=' + encodeURIComponent(hostname)";
-    html += "  })";
-    html += "  .then(response => response.text())";
-    html += "  .then(data => {";
-    html += "    alert(data);";
-    html += "    setTimeout(() => location.reload(), 2000);";
-    html += "  });";
-    html += "}";
-    
-    html += "function resetWiFi() {";
-    html += "  if (confirm('Reset all WiFi settings? This will restart the device in AP mode.')) {";
-    html += "    fetch('/wifi_reset', {method: 'POST'})";
-    html += "      .then(response => response.text())";
-    html += "      .then(data => {";
-    html += "        alert(data);";
-    html += "        setTimeout(() => location.reload(), 2000);";
-    html += "      });";
-    html += "  }";
-    html += "}";
-    
-    html += "function selectNetwork(ssid) {";
-    html += "  document.getElementById('ssid').value = ssid;";
-    html += "}";
-    
-    html += "function scanNetworks() {";
-    html += "  document.getElementById('networks').innerHTML = 'Scanning...';";
-    html += "  fetch('/wifi_scan')";
-    html += "    .then(response => response.text())";
-    html += "    .then(data => {";
-    html += "      document.getElementById('networks').innerHTML = data;";
-    html += "    });";
-    html += "}";
-    
-    html += "</script></body></html>";
-    
-    req->send(200, "text/html", html);
+  // WiFi status and saved configuration for the /wifi page (served by GrillWebServer)
+  server.on("/wifi_config", HTTP_GET, [](AsyncWebServerRequest *req) {
+    String ssid = wifiManager.getSSID();
+    char ssidCopy[sizeof(wifiManager.publishedSsid)], hostnameCopy[sizeof(wifiManager.publishedHostname)];
+    portENTER_CRITICAL(&wifiManager.pendingMux);
+    memcpy(ssidCopy, wifiManager.publishedSsid, sizeof(ssidCopy));
+    memcpy(hostnameCopy, wifiManager.publishedHostname, sizeof(hostnameCopy));
+    int saved = wifiManager.publishedCount;
+    portEXIT_CRITICAL(&wifiManager.pendingMux);
+    String configSsid = ssidCopy;
+    String hostname = hostnameCopy;
+    ssid.replace("\"", "\\\"");
+    configSsid.replace("\"", "\\\"");
+    hostname.replace("\"", "\\\"");
+
+    String json = "{";
+    json += "\"status\":\"" + wifiManager.getStatusString() + "\",";
+    json += "\"connected\":" + String(wifiManager.isConnected() ? "true" : "false") + ",";
+    json += "\"ssid\":\"" + ssid + "\",";
+    json += "\"ip\":\"" + wifiManager.getIP().toString() + "\",";
+    json += "\"apMode\":" + String(wifiManager.getStatus() == GRILL_WIFI_AP_MODE ? "true" : "false") + ",";
+    json += "\"apSSID\":\"" + wifiManager.apSSID + "\",";
+    json += "\"apIP\":\"" + WiFi.softAPIP().toString() + "\",";
+    json += "\"configSsid\":\"" + configSsid + "\",";
+    json += "\"hostname\":\"" + hostname + "\",";
+    json += "\"saved\":" + String(saved);
+    json += "}";
+    req->send(200, "application/json", json);
   });
 
-  // Save WiFi settings
+  // Save WiFi settings - loop() saves them and connects once this reply is out
   server.on("/wifi_save", HTTP_POST, [](AsyncWebServerRequest *req) {
+    if (!req->hasParam("ssid", true) || req->getParam("ssid", true)->value().length() == 0) {
+      req->send(400, "text/plain", "Missing ssid");
+      return;
+    }
     String ssid = req->getParam("ssid", true)->value();
-    String password = req->getParam("password", true)->value();
-    String hostname = req->getParam("hostname", true)->value();
+    String password = req->hasParam("password", true) ? req->getParam("password", true)->value() : String("");
+    String hostname = req->hasParam("hostname", true) ? req->getParam("hostname", true)->value() : String("");
+    if (ssid.length() > 32 || password.length() > 64 || hostname.length() > 32) {
+      req->send(400, "text/plain", "SSID, password or hostname too long");
+      return;
+    }
     
     wifiManager.setCredentials(ssid, password);
-    wifiManager.setHostname(hostname);
+    if (hostname.length() > 0) wifiManager.setHostname(hostname);
     
     req->send(200, "text/plain", "WiFi settings saved. Attempting to connect...");
-    
-    // Attempt connection after a short delay
-    delay(1000);
-    wifiManager.reconnect();
+  });
+
+  server.on("/wifi_stats", HTTP_GET, [](AsyncWebServerRequest *req) {
+    req->send(200, "application/json", wifiManager.getStatsJson());
   });
 
   // Reset WiFi settings
   server.on("/wifi_reset", HTTP_POST, [](AsyncWebServerRequest *req) {
-    wifiManager.resetSettings();
-    req->send(200, "text/plain", "WiFi settings reset. Restarting in AP mode...");
-    delay(1000);
-    ESP.restart();
+    Command command;
+    command_init(&command, CMD_WIFI_RESET);
+    command_submit(req, command);
   });
 
-  // Scan for networks - simplified without JSON
-  server.on("/wifi_scan", HTTP_GET, [](AsyncWebServerRequest *req) {
-    int n = WiFi.scanNetworks();
-    String html = "";
-    
-    if (n == 0) {
-      html = "No networks found";
-    } else {
-      for (int i = 0; i < n; i++) {
-        html += "<div class='network-item' onclick='selectNetwork(\"" + WiFi.SSID(i) + "\")'>";
-        html += WiFi.SSID(i) + " (" + String(WiFi.RSSI(i)) + " dBm)";
-        if (WiFi.encryptionType(i) != WIFI_AUTH_OPEN) {
-          html += " 🔒";
-        }
-        html += "</div>";
-      }
-    }
-    
-    req->send(200, "text/html", html);
-  });
+  // Scan results from the cache; a stale cache or ?refresh=1 starts a background scan
+  server.on("/wifi_scan", HTTP_GET, wifi_scan_handle_request);
 
   // WiFi debug endpoint - Fixed hostname concatenation
   server.on("/wifi_debug", HTTP_GET, [](AsyncWebServerRequest *req) {
@@ -404,20 +558,51 @@ String GrillWiFiManager::getSSID() {
   return WiFi.SSID();
 }
 
+// Staged with the credentials from /wifi_save; applied by loop()
 void GrillWiFiManager::setHostname(String hostname) {
-  config.hostname = hostname;
-  WiFi.setHostname(hostname.c_str());
+  portENTER_CRITICAL(&pendingMux);
+  snprintf(pendingHostname, sizeof(pendingHostname), "%s", hostname.c_str());
+  portEXIT_CRITICAL(&pendingMux);
+}
+
+// From CMD_WIFI_RESET on control - prefs and config belong to this task, so loop() clears them
+void GrillWiFiManager::requestReset() {
+  portENTER_CRITICAL(&pendingMux);
+  pendingReset = true;
+  portEXIT_CRITICAL(&pendingMux);
+}
+
+// The reboot is posted only once NVS is clear, so the device cannot restart on the old networks
+void GrillWiFiManager::applyPendingReset() {
+  if (!pendingReset) return;
+  
+  // A /wifi_save staged before the reset would only bring the old network back
+  portENTER_CRITICAL(&pendingMux);
+  pendingSave = false;
+  portEXIT_CRITICAL(&pendingMux);
+  resetSettings();
+  
+  Command reboot;
+  command_init(&reboot, CMD_REBOOT);
+  if (!command_post(reboot)) {
+    Serial.println("⚠️ WiFi reset: command queue full, retrying reboot");
+    return;
+  }
+  
+  portENTER_CRITICAL(&pendingMux);
+  pendingReset = false;
+  portEXIT_CRITICAL(&pendingMux);
 }
 
 void GrillWiFiManager::resetSettings() {
-  preferences.begin("wifi", false);
-  preferences.clear();
-  preferences.end();
+  prefs.begin("wifi", false);
+  prefs.clear();
+  prefs.end();
   
-  config.ssid = "";
-  config.password = "";
+  config.networkCount = 0;
   config.hostname = "GrillController";
   config.useStaticIP = false;
+  publishConfig();
   
   Serial.println("WiFi settings reset");
 }
@@ -428,6 +613,7 @@ void GrillWiFiManager::enableAPMode(bool enable) {
   } else if (!enable && apModeEnabled) {
     WiFi.mode(WIFI_STA);
     apModeEnabled = false;
+    captive_portal_stop();
     Serial.println("AP mode disabled");
   }
 }
@@ -438,7 +624,37 @@ void GrillWiFiManager::setAPCredentials(String ssid, String password) {
 }
 
 void GrillWiFiManager::disconnect() {
+  setPhase(GRILL_WIFI_PHASE_IDLE);
   WiFi.disconnect();
-  currentStatus = GRILL_WIFI_DISCONNECTED;
+  updateStatus();
   Serial.println("WiFi disconnected");
+}
+
+String GrillWiFiManager::getStatsJson() {
+  static const char* const PHASE_NAMES[] = {"idle", "scanning", "connecting", "connected", "backoff"};
+  char buffer[384];
+  JsonWriter json(buffer, sizeof(buffer));
+  
+  json.beginObject();
+  json.field("phase", PHASE_NAMES[phase]);
+  json.field("phaseMs", (unsigned long)clock_elapsed_ms(phaseSince));
+  json.field("savedNetworks", config.networkCount);
+  json.field("attempts", attemptCount);
+  json.field("failures", failureCount);
+  json.field("connects", connectCount);
+  json.field("disconnects", disconnectCount);
+  json.field("lastDisconnectReason", (unsigned int)lastDisconnectReason);
+  json.field("failedRounds", failedRounds);
+  json.field("backoffMs", backoffMs);
+  json.field("lastConnectMs", lastConnectMs);
+  json.field("minConnectMs", minConnectMs);
+  json.field("maxConnectMs", maxConnectMs);
+  json.field("avgConnectMs", connectCount > 0 ? (unsigned long)(totalConnectMs / connectCount) : 0UL);
+  if (phase == GRILL_WIFI_PHASE_CONNECTED) {
+    json.field("connectedSec", (unsigned long)(clock_elapsed_ms(connectedSince) / 1000));
+    json.field("rssi", (int)WiFi.RSSI());
+  }
+  json.endObject();
+  
+  return String(json.c_str());
 }
\ No newline at end of file
@@ -1,4 +1,12 @@
 // WiFiManager.h - Fixed WiFi Management System
+//
+// Connection is a state machine advanced by loop() and fed by WiFi events; no
+// call blocks. Up to WIFI_MAX_NETWORKS networks are remembered. Each round
+// takes the shared scan results (WiFiScan.h, rescanning if they are stale),
+// tries the remembered networks that are in range, strongest first, then any
+// that were not seen (hidden SSIDs). A failed round
+// waits with exponential backoff and jitter; after WIFI_AP_AFTER_ROUNDS failed
+// rounds the setup AP comes up alongside the retries.
 #ifndef WIFIMANAGER_H
 #define WIFIMANAGER_H
 
@@ -6,6 +14,13 @@
 #include <WiFi.h>
 #include <Preferences.h>
 
+#define WIFI_MAX_NETWORKS          4
+#define WIFI_CONNECT_TIMEOUT_MS    20000   // Per network attempt
+#define WIFI_BACKOFF_MIN_MS        2000
+#define WIFI_BACKOFF_MAX_MS        300000
+#define WIFI_AP_AFTER_ROUNDS       3       // Failed rounds before the setup AP starts
+#define WIFI_APPLY_DELAY_MS        1000    // Lets the /wifi_save reply out before switching
+
 // Custom WiFi modes to avoid conflicts
 enum GrillWiFiMode {
   GRILL_WIFI_STA,    // Station mode (connect to existing network)
@@ -22,10 +37,24 @@ enum GrillWiFiStatus {
   GRILL_WIFI_FAILED
 };
 
-// WiFi configuration structure
-struct GrillWiFiConfig {
+// Connection phases driven by loop()
+enum GrillWiFiPhase {
+  GRILL_WIFI_PHASE_IDLE,         // No networks saved, or disconnected on request
+  GRILL_WIFI_PHASE_SCANNING,
+  GRILL_WIFI_PHASE_CONNECTING,
+  GRILL_WIFI_PHASE_CONNECTED,
+  GRILL_WIFI_PHASE_BACKOFF
+};
+
+struct GrillWiFiNetwork {
   String ssid;
   String password;
+};
+
+// WiFi configuration structure
+struct GrillWiFiConfig {
+  GrillWiFiNetwork networks[WIFI_MAX_NETWORKS];   // Most recently saved first
+  int networkCount;
   String hostname;
   bool useStaticIP;
   IPAddress staticIP;
@@ -40,26 +69,76 @@ class GrillWiFiManager {
 private:
   GrillWiFiConfig config;
   GrillWiFiStatus currentStatus;
-  unsigned long lastConnectionAttempt;
-  unsigned long connectionTimeout;
-  int connectionAttempts;
   bool apModeEnabled;
   
+  // Connection state machine
+  GrillWiFiPhase phase;
+  uint64_t phaseSince;
+  uint64_t retryAt;
+  uint32_t backoffMs;
+  int failedRounds;
+  uint32_t scanGeneration;                 // Scan this round is waiting for
+  int8_t candidates[WIFI_MAX_NETWORKS];   // Network indexes in the order this round tries them
+  int candidateCount;
+  int candidateIndex;
+  
+  // Credentials from /wifi_save and the /wifi_reset request, applied by loop()
+  portMUX_TYPE pendingMux;
+  bool pendingReset;
+  bool pendingSave;
+  uint64_t pendingAt;
+  char pendingSsid[33];
+  char pendingPassword[65];
+  char pendingHostname[33];
+  
+  // Copy of config for the /wifi_config handler (AsyncTCP task), also under pendingMux
+  char publishedSsid[33];
+  char publishedHostname[33];
+  int publishedCount;
+  
+  // Connection metrics
+  uint32_t attemptCount;
+  uint32_t failureCount;
+  uint32_t connectCount;
+  uint32_t disconnectCount;
+  uint32_t lastConnectMs;
+  uint32_t minConnectMs;
+  uint32_t maxConnectMs;
+  uint64_t totalConnectMs;
+  uint8_t lastDisconnectReason;
+  uint64_t connectedSince;
+  
   // AP Mode settings
   String apSSID;
   String apPassword;
   IPAddress apIP;
   
+  Preferences prefs;   // Own NVS handle - runs on the network task, not control
+  
   void startAPMode();
   void saveConfig();
   void loadConfig();
+  void publishConfig();
   void setupWebServer();
+  void rememberNetwork(const String& ssid, const String& password);
+  void applyPendingReset();
+  void applyPendingSave();
+  void resetSettings();
+  void setPhase(GrillWiFiPhase next);
+  void startRound();
+  void rankCandidates();
+  void startAttempt(int index);
+  void failAttempt(const char* why);
+  void enterBackoff();
+  void onConnected();
+  void updateStatus();
   
 public:
   GrillWiFiManager();
   
   // Initialization and management
   void begin();
+  void beginMDNS();    // <hostname>.local and the http service; after begin()
   void loop();
   
   // Configuration
@@ -80,8 +159,11 @@ public:
   
   // Reset and reconnect
   void disconnect();
-  void reconnect();
-  void resetSettings();
+  void reconnect();          // New round now, backoff reset
+  void requestReset();       // Clears the saved networks from loop(), then reboots
+  
+  // Connection metrics for /wifi_stats
+  String getStatsJson();
 };
 
 extern GrillWiFiManager wifiManager;
@@ -0,0 +1,213 @@
+// WiFiScan.cpp - Background WiFi scans with a cached, deduplicated result list
+#include "WiFiScan.h"
+#include "JsonWriter.h"
+#include "Clock.h"
+#include <WiFi.h>
+#include <atomic>
+#include <memory>
+
+struct WiFiScanEntry {
+  char ssid[33];
+  int8_t rssi;
+  uint8_t channel;
+  bool secure;
+  uint32_t seenIn;      // Generation of the last scan that saw it
+  uint64_t seenAt;
+};
+
+// The cache is written by the network task and read by web handlers
+static portMUX_TYPE scanMux = portMUX_INITIALIZER_UNLOCKED;
+static WiFiScanEntry cache[WIFI_SCAN_MAX_RESULTS];
+static int cacheCount = 0;
+static uint64_t lastScanAt = 0;       // 0 = no scan has finished yet
+
+static std::atomic<bool> requested(false);
+static std::atomic<bool> scanning(false);
+static std::atomic<uint32_t> generation(0);
+
+// Loop task only
+static uint64_t startedAt = 0;
+static bool everStarted = false;
+static uint32_t scanCount = 0;
+static uint32_t failedCount = 0;
+static uint32_t lastScanMs = 0;
+
+void wifi_scan_request() {
+  requested = true;
+}
+
+bool wifi_scan_running() {
+  return scanning;
+}
+
+bool wifi_scan_fresh() {
+  portENTER_CRITICAL(&scanMux);
+  bool fresh = lastScanAt != 0 && clock_elapsed_ms(lastScanAt) < WIFI_SCAN_FRESH_MS;
+  portEXIT_CRITICAL(&scanMux);
+  return fresh;
+}
+
+uint32_t wifi_scan_generation() {
+  return generation;
+}
+
+int32_t wifi_scan_best_rssi(const char* ssid) {
+  int32_t rssi = INT32_MIN;
+  uint32_t current = generation;
+  portENTER_CRITICAL(&scanMux);
+  for (int i = 0; i < cacheCount; i++) {
+    if (cache[i].seenIn == current && strcmp(cache[i].ssid, ssid) == 0) {
+      rssi = cache[i].rssi;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&scanMux);
+  return rssi;
+}
+
+// Slot for a network not in the cache: a free one, else the stalest entry the
+// current scan has not seen, else the weakest if the newcomer is stronger
+static int wifi_scan_slot_for(int8_t rssi, uint32_t scanGen) {
+  if (cacheCount < WIFI_SCAN_MAX_RESULTS) return cacheCount++;
+
+  int victim = -1;
+  for (int i = 0; i < cacheCount; i++) {
+    if (cache[i].seenIn != scanGen && (victim < 0 || cache[i].seenAt < cache[victim].seenAt)) victim = i;
+  }
+  if (victim >= 0) return victim;
+
+  for (int i = 0; i < cacheCount; i++) {
+    if (victim < 0 || cache[i].rssi < cache[victim].rssi) victim = i;
+  }
+  return cache[victim].rssi < rssi ? victim : -1;
+}
+
+static void wifi_scan_merge(int found, uint32_t scanGen) {
+  uint64_t now = clock_ms();
+
+  for (int n = 0; n < found; n++) {
+    String ssid = WiFi.SSID(n);
+    if (ssid.length() == 0 || ssid.length() >= sizeof(cache[0].ssid)) continue;   // Hidden network
+    int8_t rssi = (int8_t)WiFi.RSSI(n);
+    uint8_t channel = (uint8_t)WiFi.channel(n);
+    bool secure = WiFi.encryptionType(n) != WIFI_AUTH_OPEN;
+
+    portENTER_CRITICAL(&scanMux);
+    int slot = -1;
+    for (int i = 0; i < cacheCount; i++) {
+      if (strcmp(cache[i].ssid, ssid.c_str()) == 0) {
+        slot = i;
+        break;
+      }
+    }
+    // Several access points share an SSID - keep the strongest from this scan
+    if (slot >= 0 && cache[slot].seenIn == scanGen && cache[slot].rssi >= rssi) {
+      slot = -1;
+    } else if (slot < 0) {
+      slot = wifi_scan_slot_for(rssi, scanGen);
+      if (slot >= 0) memcpy(cache[slot].ssid, ssid.c_str(), ssid.length() + 1);
+    }
+    if (slot >= 0) {
+      cache[slot].rssi = rssi;
+      cache[slot].channel = channel;
+      cache[slot].secure = secure;
+      cache[slot].seenIn = scanGen;
+      cache[slot].seenAt = now;
+    }
+    portEXIT_CRITICAL(&scanMux);
+  }
+
+  // Drop networks gone for a while, then order strongest first
+  portENTER_CRITICAL(&scanMux);
+  int kept = 0;
+  for (int i = 0; i < cacheCount; i++) {
+    if (now - cache[i].seenAt >= WIFI_SCAN_EXPIRE_MS) continue;
+    WiFiScanEntry entry = cache[i];
+    int pos = kept++;
+    while (pos > 0 && cache[pos - 1].rssi < entry.rssi) {
+      cache[pos] = cache[pos - 1];
+      pos--;
+    }
+    cache[pos] = entry;
+  }
+  cacheCount = kept;
+  lastScanAt = now;
+  portEXIT_CRITICAL(&scanMux);
+}
+
+void wifi_scan_update(bool allowed, bool periodic) {
+  if (scanning) {
+    int found = WiFi.scanComplete();
+    if (found == WIFI_SCAN_RUNNING) {
+      if (clock_elapsed_ms(startedAt) < WIFI_SCAN_TIMEOUT_MS) return;
+      Serial.println("⚠️ WiFi scan timed out");
+    }
+
+    lastScanMs = (uint32_t)clock_elapsed_ms(startedAt);
+    if (found >= 0) {
+      wifi_scan_merge(found, generation + 1);
+      scanCount++;
+      Serial.printf("📶 WiFi scan: %d networks in %lu ms, %d cached\n", found, (unsigned long)lastScanMs, cacheCount);
+    } else {
+      failedCount++;
+    }
+    WiFi.scanDelete();
+    scanning = false;
+    generation++;
+    return;
+  }
+
+  bool due = requested || (periodic && (!everStarted || clock_elapsed_ms(startedAt) >= WIFI_SCAN_AP_INTERVAL_MS));
+  if (!due || !allowed) return;
+
+  requested = false;
+  everStarted = true;
+  startedAt = clock_ms();
+  if (WiFi.scanNetworks(true) != WIFI_SCAN_FAILED) {
+    scanning = true;
+    return;
+  }
+  failedCount++;
+  generation++;   // Waiters go ahead without results
+}
+
+void wifi_scan_handle_request(AsyncWebServerRequest *req) {
+  bool refresh = req->hasParam("refresh") && req->getParam("refresh")->value() == "1";
+  if (refresh || !wifi_scan_fresh()) wifi_scan_request();
+
+  // Copy out under the lock, format outside it; both too big for the async_tcp stack
+  std::unique_ptr<WiFiScanEntry[]> entries(new WiFiScanEntry[WIFI_SCAN_MAX_RESULTS]);
+  std::unique_ptr<char[]> buffer(new char[WIFI_SCAN_JSON_BUFFER]);
+  portENTER_CRITICAL(&scanMux);
+  int count = cacheCount;
+  uint64_t scannedAt = lastScanAt;
+  memcpy(entries.get(), cache, count * sizeof(WiFiScanEntry));
+  portEXIT_CRITICAL(&scanMux);
+
+  JsonWriter json(buffer.get(), WIFI_SCAN_JSON_BUFFER);
+  json.beginObject();
+  json.field("scanning", wifi_scan_running() || (bool)requested);
+  if (scannedAt != 0) json.field("scanAgeSec", (unsigned long)(clock_elapsed_ms(scannedAt) / 1000));
+  else json.fieldNull("scanAgeSec");
+  json.field("scans", scanCount);
+  json.field("failedScans", failedCount);
+  json.field("lastScanMs", lastScanMs);
+  json.beginArray("networks");
+  for (int i = 0; i < count; i++) {
+    json.beginObject();
+    json.field("ssid", entries[i].ssid);
+    json.field("rssi", (int)entries[i].rssi);
+    json.field("channel", (unsigned int)entries[i].channel);
+    json.field("secure", entries[i].secure);
+    json.field("ageSec", (unsigned long)(clock_elapsed_ms(entries[i].seenAt) / 1000));
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
+
+  if (json.overflowed()) {
+    req->send(500, "text/plain", "Scan results too large");
+    return;
+  }
+  req->send(200, "application/json", json.c_str());
+}
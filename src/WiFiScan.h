@@ -0,0 +1,38 @@
+// WiFiScan.h - Background WiFi scans with a cached, deduplicated result list
+//
+// The only caller of WiFi.scanNetworks(): scans run asynchronously, started
+// and collected by wifi_scan_update() on the network task, so neither the web
+// server nor the connection manager waits on the radio. Results are merged
+// into a cache keyed by SSID (best RSSI of the scan wins; hidden SSIDs are
+// skipped), each entry stamped with when it was last seen. /wifi_scan serves
+// the cache as JSON and asks for a new scan when it is stale or ?refresh=1.
+#ifndef WIFISCAN_H
+#define WIFISCAN_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#define WIFI_SCAN_MAX_RESULTS      20
+#define WIFI_SCAN_TIMEOUT_MS       10000   // A scan still running after this is abandoned
+#define WIFI_SCAN_FRESH_MS         30000   // Younger results are served without rescanning
+#define WIFI_SCAN_AP_INTERVAL_MS   60000   // Background rescan while the setup AP is up
+#define WIFI_SCAN_EXPIRE_MS        300000  // Networks unseen for this long leave the cache
+#define WIFI_SCAN_JSON_BUFFER      2560
+
+// Any task - the scan starts on the next wifi_scan_update() that allows it
+void wifi_scan_request();
+
+// Call from WiFiManager::loop(). allowed is false while a connection attempt
+// owns the radio; periodic rescans every WIFI_SCAN_AP_INTERVAL_MS.
+void wifi_scan_update(bool allowed, bool periodic);
+
+// Results
+bool wifi_scan_running();
+bool wifi_scan_fresh();                        // Last scan finished within WIFI_SCAN_FRESH_MS
+uint32_t wifi_scan_generation();               // Bumped when a scan finishes or fails
+int32_t wifi_scan_best_rssi(const char* ssid); // INT32_MIN if not seen by the last scan
+
+// GET /wifi_scan handler
+void wifi_scan_handle_request(AsyncWebServerRequest *req);
+
+#endif // WIFISCAN_H
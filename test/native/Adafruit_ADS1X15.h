@@ -0,0 +1,19 @@
+// Adafruit_ADS1X15.h - Host stand-in for the ADS1115 driver, for the native test env
+#ifndef NATIVE_ADAFRUIT_ADS1X15_H
+#define NATIVE_ADAFRUIT_ADS1X15_H
+
+#include <Wire.h>
+
+typedef enum { GAIN_TWOTHIRDS, GAIN_ONE } adsGain_t;
+#define RATE_ADS1115_860SPS 0x00E0
+
+class Adafruit_ADS1115 {
+public:
+  bool begin(uint8_t address = 0x48, TwoWire* wire = &Wire) { (void)address; (void)wire; return true; }
+  void setGain(adsGain_t gain) { (void)gain; }
+  void setDataRate(uint16_t rate) { (void)rate; }
+  int16_t readADC_SingleEnded(uint8_t channel) { (void)channel; return 0; }
+  float computeVolts(int16_t counts) { return counts * 6.144f / 32768.0f; }
+};
+
+#endif // NATIVE_ADAFRUIT_ADS1X15_H
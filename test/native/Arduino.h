@@ -0,0 +1,176 @@
+// Arduino.h - Host stand-in for the Arduino core, for the native test env
+//
+// Just enough of the ESP32 core for modules under test to compile and run on
+// the build machine: String on std::string, a Serial that discards output,
+// and a settable millis(). Tests include the module .cpp they exercise and
+// fake its other collaborators themselves.
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define DEC 10
+#define HEX 16
+#define IRAM_ATTR
+#define PROGMEM
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+using std::min;
+using std::max;
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+class String {
+public:
+  String() {}
+  String(const char* text) : s(text ? text : "") {}
+  String(const std::string& text) : s(text) {}
+  String(char c) : s(1, c) {}
+  String(int v, unsigned char base = DEC)                { format(base == HEX ? "%x" : "%d", v); }
+  String(unsigned int v, unsigned char base = DEC)       { format(base == HEX ? "%x" : "%u", v); }
+  String(long v, unsigned char base = DEC)               { format(base == HEX ? "%lx" : "%ld", v); }
+  String(unsigned long v, unsigned char base = DEC)      { format(base == HEX ? "%lx" : "%lu", v); }
+  String(long long v, unsigned char base = DEC)          { format("%lld", v); (void)base; }
+  String(unsigned long long v, unsigned char base = DEC) { format("%llu", v); (void)base; }
+  String(float v, unsigned int decimals = 2)             { format("%.*f", (int)decimals, (double)v); }
+  String(double v, unsigned int decimals = 2)            { format("%.*f", (int)decimals, v); }
+
+  const char* c_str() const { return s.c_str(); }
+  unsigned int length() const { return s.size(); }
+  bool isEmpty() const { return s.empty(); }
+  void reserve(unsigned int size) { s.reserve(size); }
+  char operator[](unsigned int i) const { return i < s.size() ? s[i] : 0; }
+  char charAt(unsigned int i) const { return (*this)[i]; }
+
+  String& operator+=(const String& other) { s += other.s; return *this; }
+  String& operator+=(const char* other) { s += other; return *this; }
+  String& operator+=(char other) { s += other; return *this; }
+  String& operator+=(int other) { return *this += String(other); }
+  String& operator+=(unsigned int other) { return *this += String(other); }
+  String& operator+=(long other) { return *this += String(other); }
+  String& operator+=(unsigned long other) { return *this += String(other); }
+  String& operator+=(double other) { return *this += String(other); }
+  bool concat(const char* text, unsigned int length) { s.append(text, length); return true; }
+
+  bool operator==(const String& other) const { return s == other.s; }
+  bool operator==(const char* other) const { return s == other; }
+  bool operator!=(const String& other) const { return s != other.s; }
+  bool operator!=(const char* other) const { return s != other; }
+  bool equals(const String& other) const { return s == other.s; }
+  bool equalsIgnoreCase(const String& other) const {
+    return s.size() == other.s.size() && strncasecmp(s.c_str(), other.s.c_str(), s.size()) == 0;
+  }
+  bool startsWith(const String& prefix) const { return s.compare(0, prefix.s.size(), prefix.s) == 0; }
+  bool endsWith(const String& suffix) const {
+    return s.size() >= suffix.s.size() && s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+  }
+
+  int indexOf(char c, unsigned int from = 0) const { size_t at = s.find(c, from); return at == std::string::npos ? -1 : (int)at; }
+  int indexOf(const String& text, unsigned int from = 0) const { size_t at = s.find(text.s, from); return at == std::string::npos ? -1 : (int)at; }
+  String substring(unsigned int from) const { return from < s.size() ? String(s.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const {
+    return from < s.size() && to > from ? String(s.substr(from, to - from)) : String();
+  }
+  long toInt() const { return atol(s.c_str()); }
+  float toFloat() const { return atof(s.c_str()); }
+  void trim() {
+    size_t first = s.find_first_not_of(" \t\r\n");
+    size_t last = s.find_last_not_of(" \t\r\n");
+    s = (first == std::string::npos) ? std::string() : s.substr(first, last - first + 1);
+  }
+  void toLowerCase() { for (char& c : s) c = tolower((unsigned char)c); }
+  void toUpperCase() { for (char& c : s) c = toupper((unsigned char)c); }
+
+  friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+  friend String operator+(const String& a, const char* b) { return String(a.s + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b.s); }
+  friend String operator+(const String& a, char b) { return String(a.s + b); }
+
+private:
+  std::string s;
+
+  template <typename T>
+  void format(const char* spec, T v) {
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), spec, v);
+    s = buffer;
+  }
+  template <typename T>
+  void format(const char* spec, int decimals, T v) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), spec, decimals, v);
+    s = buffer;
+  }
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) { (void)c; return 1; }
+  virtual size_t write(const uint8_t* data, size_t length) { (void)data; return length; }
+  size_t write(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+
+  size_t print(const String& text) { return write(text.c_str()); }
+  size_t print(const char* text) { return write(text); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int base = DEC) { return print(String(v, base)); }
+  size_t print(unsigned int v, int base = DEC) { return print(String(v, base)); }
+  size_t print(long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(unsigned long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(double v, int decimals = 2) { return print(String(v, decimals)); }
+  template <typename T> size_t println(T v) { return print(v) + println(); }
+  template <typename T> size_t println(T v, int format) { return print(v, format) + println(); }
+  size_t println() { return write("\r\n"); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    return length > 0 ? write(buffer) : 0;
+  }
+};
+
+class Stream : public Print {
+public:
+  int available() { return 0; }
+  int read() { return -1; }
+};
+
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  operator bool() { return true; }
+};
+
+inline HardwareSerial Serial;
+
+// Time is whatever the test says it is
+inline unsigned long nativeMillis = 0;
+inline unsigned long millis() { return nativeMillis; }
+inline unsigned long micros() { return nativeMillis * 1000UL; }
+inline void delay(unsigned long ms) { nativeMillis += ms; }
+inline void yield() {}
+
+// Pins read back what was written
+inline uint8_t nativePins[64];
+inline void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+inline void digitalWrite(uint8_t pin, uint8_t value) { nativePins[pin & 63] = value; }
+inline int digitalRead(uint8_t pin) { return nativePins[pin & 63]; }
+
+#endif // NATIVE_ARDUINO_H
@@ -0,0 +1,173 @@
+// ESPAsyncWebServer.h - Host stand-in for ESPAsyncWebServer, for the native test env
+//
+// Routes registered with on() are kept, and serve() runs one request through
+// them the way AsyncTCP would: body chunks first, then the request handler.
+// Whatever the handler sends is recorded on the request for the test to check.
+#ifndef NATIVE_ESPASYNCWEBSERVER_H
+#define NATIVE_ESPASYNCWEBSERVER_H
+
+#include <Arduino.h>
+#include <functional>
+#include <memory>
+#include <vector>
+
+typedef enum {
+  HTTP_GET = 0b00000001,
+  HTTP_POST = 0b00000010,
+  HTTP_DELETE = 0b00000100,
+  HTTP_PUT = 0b00001000,
+  HTTP_PATCH = 0b00010000,
+  HTTP_HEAD = 0b00100000,
+  HTTP_OPTIONS = 0b01000000,
+  HTTP_ANY = 0b01111111
+} WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+#define RESPONSE_TRY_AGAIN 0xFFFFFFFF
+typedef std::function<size_t(uint8_t*, size_t, size_t)> AwsResponseFiller;
+
+class AsyncWebParameter {
+public:
+  AsyncWebParameter(const String& name, const String& value) : _name(name), _value(value) {}
+  const String& name() const { return _name; }
+  const String& value() const { return _value; }
+private:
+  String _name;
+  String _value;
+};
+
+class AsyncWebServerResponse {
+public:
+  virtual ~AsyncWebServerResponse() {}
+  void addHeader(const String& name, const String& value) { (void)name; (void)value; }
+  void setCode(int code) { _code = code; }
+
+  int _code = 200;
+  String _contentType;
+  String _content;
+  AwsResponseFiller _filler;
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+public:
+  size_t write(uint8_t c) override { _content += (char)c; return 1; }
+  size_t write(const uint8_t* data, size_t length) override { _content.concat((const char*)data, length); return length; }
+  using Print::write;
+};
+
+class AsyncWebServerRequest {
+public:
+  AsyncWebServerRequest(WebRequestMethodComposite method, const String& url) : _tempObject(NULL), _method(method), _url(url) {}
+  ~AsyncWebServerRequest() { free(_tempObject); }
+
+  // Request side, filled in by the test
+  void addParam(const String& name, const String& value) { _params.emplace_back(name, value); }
+  void setBody(const String& contentType, const String& body) { _contentType = contentType; _body = body; }
+
+  WebRequestMethodComposite method() const { return _method; }
+  const String& url() const { return _url; }
+  const String& contentType() const { return _contentType; }
+  size_t contentLength() const { return _body.length(); }
+  bool hasParam(const String& name, bool post = false, bool file = false) const { (void)post; (void)file; return getParam(name) != NULL; }
+  AsyncWebParameter* getParam(const String& name, bool post = false, bool file = false) const {
+    (void)post; (void)file;
+    for (const AsyncWebParameter& param : _params) {
+      if (param.name() == name) return const_cast<AsyncWebParameter*>(&param);
+    }
+    return NULL;
+  }
+
+  // Response side, recorded for the test
+  void send(int code, const String& contentType = String(), const String& content = String()) {
+    _sentCode = code;
+    _sentType = contentType;
+    _sent = content;
+  }
+  void send(AsyncWebServerResponse* response) {
+    std::unique_ptr<AsyncWebServerResponse> owned(response);
+    if (response->_filler) {
+      uint8_t buffer[1460];
+      size_t length = response->_filler(buffer, sizeof(buffer), 0);
+      if (length != RESPONSE_TRY_AGAIN) response->_content.concat((const char*)buffer, length);
+    }
+    send(response->_code, response->_contentType, response->_content);
+  }
+  AsyncWebServerResponse* beginResponse(int code, const String& contentType = String(), const String& content = String()) {
+    AsyncWebServerResponse* response = new AsyncWebServerResponse();
+    response->_code = code;
+    response->_contentType = contentType;
+    response->_content = content;
+    return response;
+  }
+  AsyncWebServerResponse* beginChunkedResponse(const String& contentType, AwsResponseFiller filler) {
+    AsyncWebServerResponse* response = beginResponse(200, contentType);
+    response->_filler = filler;
+    return response;
+  }
+  AsyncResponseStream* beginResponseStream(const String& contentType, size_t bufferSize = 1460) {
+    (void)bufferSize;
+    AsyncResponseStream* response = new AsyncResponseStream();
+    response->_contentType = contentType;
+    return response;
+  }
+
+  void* _tempObject;
+  int _sentCode = 0;
+  String _sentType;
+  String _sent;
+  String _body;
+
+private:
+  WebRequestMethodComposite _method;
+  String _url;
+  String _contentType;
+  std::vector<AsyncWebParameter> _params;
+};
+
+typedef std::function<void(AsyncWebServerRequest*)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, const String&, size_t, uint8_t*, size_t, bool)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, uint8_t*, size_t, size_t, size_t)> ArBodyHandlerFunction;
+
+class AsyncCallbackWebHandler {
+public:
+  String uri;
+  WebRequestMethodComposite methods;
+  ArRequestHandlerFunction onRequest;
+  ArBodyHandlerFunction onBody;
+};
+
+class AsyncWebServer {
+public:
+  AsyncWebServer(uint16_t port) { (void)port; }
+  void begin() {}
+
+  AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite methods, ArRequestHandlerFunction onRequest,
+                              ArUploadHandlerFunction onUpload = nullptr, ArBodyHandlerFunction onBody = nullptr) {
+    (void)onUpload;
+    _handlers.push_back(std::unique_ptr<AsyncCallbackWebHandler>(new AsyncCallbackWebHandler{uri, methods, onRequest, onBody}));
+    return *_handlers.back();
+  }
+
+  // Test hook: runs a request through the first matching route, body in chunkSize pieces;
+  // false if nothing matched
+  bool serve(AsyncWebServerRequest* req, size_t chunkSize = 64) {
+    for (const auto& handler : _handlers) {
+      if (handler->uri != req->url() || !(handler->methods & req->method())) continue;
+      size_t total = req->_body.length();
+      if (handler->onBody) {
+        for (size_t index = 0; index < total; index += chunkSize) {
+          size_t length = min(chunkSize, total - index);
+          handler->onBody(req, (uint8_t*)req->_body.c_str() + index, length, index, total);
+        }
+      }
+      handler->onRequest(req);
+      return true;
+    }
+    return false;
+  }
+
+private:
+  std::vector<std::unique_ptr<AsyncCallbackWebHandler>> _handlers;
+};
+
+#endif // NATIVE_ESPASYNCWEBSERVER_H
@@ -0,0 +1,50 @@
+// Preferences.h - Host stand-in for the ESP32 NVS wrapper, for the native test env
+//
+// Every instance shares one in-memory store, like the flash partition, and
+// counts the namespaces opened for writing so tests can check NVS traffic.
+#ifndef NATIVE_PREFERENCES_H
+#define NATIVE_PREFERENCES_H
+
+#include <Arduino.h>
+#include <map>
+
+inline std::map<std::string, double> nativeNvs;
+inline std::map<std::string, int> nativeNvsWrites;   // Namespace -> begin(name, false) count
+
+class Preferences {
+public:
+  bool begin(const char* name, bool readOnly = false) {
+    _name = name;
+    if (!readOnly) nativeNvsWrites[_name]++;
+    return true;
+  }
+  void end() {}
+  bool clear() { return true; }
+  bool remove(const char* key) { return nativeNvs.erase(path(key)) > 0; }
+
+  size_t putBool(const char* key, bool value) { return put(key, value); }
+  size_t putUChar(const char* key, uint8_t value) { return put(key, value); }
+  size_t putUShort(const char* key, uint16_t value) { return put(key, value); }
+  size_t putULong(const char* key, uint32_t value) { return put(key, value); }
+  size_t putULong64(const char* key, uint64_t value) { return put(key, (double)value); }
+  size_t putFloat(const char* key, float value) { return put(key, value); }
+
+  bool getBool(const char* key, bool fallback = false) { return get(key, fallback) != 0; }
+  uint8_t getUChar(const char* key, uint8_t fallback = 0) { return (uint8_t)get(key, fallback); }
+  uint16_t getUShort(const char* key, uint16_t fallback = 0) { return (uint16_t)get(key, fallback); }
+  uint32_t getULong(const char* key, uint32_t fallback = 0) { return (uint32_t)get(key, fallback); }
+  uint64_t getULong64(const char* key, uint64_t fallback = 0) { return (uint64_t)get(key, (double)fallback); }
+  float getFloat(const char* key, float fallback = NAN) { return (float)get(key, fallback); }
+
+private:
+  std::string _name;
+
+  std::string path(const char* key) const { return _name + "/" + key; }
+  size_t put(const char* key, double value) { nativeNvs[path(key)] = value; return sizeof(value); }
+  double get(const char* key, double fallback) const {
+    auto it = nativeNvs.find(path(key));
+    return it == nativeNvs.end() ? fallback : it->second;
+  }
+};
+
+#endif // NATIVE_PREFERENCES_H
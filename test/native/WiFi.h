@@ -0,0 +1,9 @@
+// WiFi.h - Host stand-in for the ESP32 WiFi driver, for the native test env
+//
+// Nothing under test touches the radio; Globals.h just includes it.
+#ifndef NATIVE_WIFI_H
+#define NATIVE_WIFI_H
+
+#include <Arduino.h>
+
+#endif // NATIVE_WIFI_H
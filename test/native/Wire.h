@@ -0,0 +1,15 @@
+// Wire.h - Host stand-in for the ESP32 I2C driver, for the native test env
+#ifndef NATIVE_WIRE_H
+#define NATIVE_WIRE_H
+
+#include <Arduino.h>
+
+class TwoWire {
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) { (void)sda; (void)scl; (void)frequency; return true; }
+  void setClock(uint32_t frequency) { (void)frequency; }
+};
+
+inline TwoWire Wire;
+
+#endif // NATIVE_WIRE_H
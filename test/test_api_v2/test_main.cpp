@@ -0,0 +1,340 @@
+// test_main.cpp - /api/v2 settings and commands through the real routes
+//
+// ApiV2, Settings and the JSON reader/writer run as built; the modules that
+// own each setting are faked below so a test can see what was applied and how
+// many times each namespace was written.
+#include <unity.h>
+#include "../../src/JsonReader.cpp"
+#include "../../src/JsonWriter.cpp"
+#include "../../src/Settings.cpp"
+#include "../../src/ApiV2.cpp"
+
+// ===== FAKES =====
+AsyncWebServer server(80);
+Preferences preferences;
+bool grillRunning = false;
+double setpoint = 225.0;
+void save_setpoint() {}
+
+static bool smokeMode = false;
+static double keepWarm = KEEP_WARM_SETPOINT_DEFAULT;
+static float pid[3] = {2.0, 0.01, 0.5};
+static unsigned long feed[4] = {45000, 20000, 5000, 60000};
+static float pellet[3] = {8.0, 20.0, 5.0};   // g/s, capacity lb, low lb
+static int pidWrites, feedWrites, pelletWrites;
+
+bool fan_get_smoke_mode() { return smokeMode; }
+void fan_set_smoke_mode(bool enabled) { smokeMode = enabled; }
+double probe_alarm_get_keep_warm_setpoint() { return keepWarm; }
+void probe_alarm_set_keep_warm_setpoint(double temp) { keepWarm = temp; }
+void getPIDParameters(float* kp, float* ki, float* kd) { *kp = pid[0]; *ki = pid[1]; *kd = pid[2]; }
+void setPIDParameters(float kp, float ki, float kd) { pid[0] = kp; pid[1] = ki; pid[2] = kd; pidWrites++; }
+unsigned long pellet_get_initial_feed_duration() { return feed[0]; }
+unsigned long pellet_get_lighting_feed_duration() { return feed[1]; }
+unsigned long pellet_get_normal_feed_duration() { return feed[2]; }
+unsigned long pellet_get_lighting_feed_interval() { return feed[3]; }
+void pellet_set_feed_parameters(unsigned long initial, unsigned long lighting, unsigned long normal, unsigned long interval) {
+  feed[0] = initial; feed[1] = lighting; feed[2] = normal; feed[3] = interval;
+  feedWrites++;
+}
+float pellet_get_calibration() { return pellet[0]; }
+float pellet_get_hopper_capacity_lb() { return pellet[1]; }
+float pellet_get_hopper_low_lb() { return pellet[2]; }
+void pellet_set_accounting_config(float gramsPerSecond, float capacityLb, float lowAlarm) {
+  pellet[0] = gramsPerSecond; pellet[1] = capacityLb; pellet[2] = lowAlarm;
+  pelletWrites++;
+}
+
+static double grillTemp = 225.0;
+static int emergencyStops;
+double readGrillTemperature() { return grillTemp; }
+bool isValidTemperature(double temp) { return temp > -100.0 && temp < 1000.0; }
+void relay_emergency_stop() { emergencyStops++; }
+void status_cache_handle_request(AsyncWebServerRequest *req) { req->send(200, "application/json", "{}"); }
+
+// The command queue: remember what was submitted, answer as loop() would
+static Command submitted;
+static int submitCount;
+
+void command_init(Command* command, CommandType type) {
+  memset(command, 0, sizeof(*command));
+  command->type = type;
+  command->ticket = -1;
+}
+
+bool command_post(const Command& command) {
+  submitted = command;
+  submitCount++;
+  return true;
+}
+
+bool command_submit(AsyncWebServerRequest *req, Command& command, CommandReplyFormat format) {
+  command_post(command);
+  req->send(200, format == COMMAND_REPLY_JSON ? "application/json" : "text/plain", "{\"ok\":true}");
+  return true;
+}
+
+// ===== HELPERS =====
+static AsyncWebServerRequest* request;
+
+static void send(WebRequestMethodComposite method, const char* url, const char* contentType, const String& body) {
+  delete request;
+  request = new AsyncWebServerRequest(method, url);
+  request->setBody(contentType, body);
+  TEST_ASSERT_TRUE(server.serve(request));
+}
+
+static void patch_settings(const String& body) {
+  send(HTTP_PATCH, "/api/v2/settings", "application/json", body);
+}
+
+static bool reply_contains(const char* text) {
+  return strstr(request->_sent.c_str(), text) != NULL;
+}
+
+void setUp() {
+  setpoint = 225.0;
+  smokeMode = false;
+  keepWarm = KEEP_WARM_SETPOINT_DEFAULT;
+  pid[0] = 2.0; pid[1] = 0.01; pid[2] = 0.5;
+  feed[0] = 45000; feed[1] = 20000; feed[2] = 5000; feed[3] = 60000;
+  pellet[0] = 8.0; pellet[1] = 20.0; pellet[2] = 5.0;
+  pidWrites = feedWrites = pelletWrites = 0;
+  submitCount = 0;
+  emergencyStops = 0;
+  grillTemp = 225.0;
+}
+
+void tearDown() {
+  delete request;
+  request = NULL;
+}
+
+// ===== LEAF VALIDATION =====
+void test_valid_patch_is_submitted_as_one_command() {
+  patch_settings("{\"setpoint\":250,\"smokeMode\":true,\"pid\":{\"kp\":3.5}}");
+  TEST_ASSERT_EQUAL(200, request->_sentCode);
+  TEST_ASSERT_EQUAL(1, submitCount);
+  TEST_ASSERT_EQUAL(CMD_APPLY_SETTINGS, submitted.type);
+  TEST_ASSERT_EQUAL(SETTING_BIT(SETTING_SETPOINT) | SETTING_BIT(SETTING_SMOKE_MODE) | SETTING_BIT(SETTING_PID_KP),
+                    submitted.settings.mask);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 250.0, submitted.settings.values[SETTING_SETPOINT]);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 1.0, submitted.settings.values[SETTING_SMOKE_MODE]);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 3.5, submitted.settings.values[SETTING_PID_KP]);
+}
+
+void test_unknown_field_is_rejected() {
+  patch_settings("{\"pid\":{\"kx\":1}}");
+  TEST_ASSERT_EQUAL(422, request->_sentCode);
+  TEST_ASSERT_TRUE(reply_contains("\"validation_failed\""));
+  TEST_ASSERT_TRUE(reply_contains("\"field\":\"pid.kx\",\"code\":\"unknown_field\""));
+  TEST_ASSERT_EQUAL(0, submitCount);
+}
+
+void test_wrong_types_are_rejected() {
+  patch_settings("{\"smokeMode\":1,\"setpoint\":true,\"feed\":{\"initial\":30.5},\"pid\":{\"kp\":\"2\"}}");
+  TEST_ASSERT_EQUAL(422, request->_sentCode);
+  TEST_ASSERT_TRUE(reply_contains("\"field\":\"smokeMode\",\"code\":\"wrong_type\""));
+  TEST_ASSERT_TRUE(reply_contains("\"field\":\"setpoint\",\"code\":\"wrong_type\""));
+  TEST_ASSERT_TRUE(reply_contains("\"field\":\"feed.initial\",\"code\":\"wrong_type\""));
+  TEST_ASSERT_TRUE(reply_contains("\"field\":\"pid.kp\",\"code\":\"wrong_type\""));
+  TEST_ASSERT_EQUAL(0, submitCount);
+}
+
+void test_out_of_range_is_rejected_and_nothing_applies() {
+  // One bad field refuses the whole patch, good fields included
+  patch_settings("{\"setpoint\":250,\"feed\":{\"normal\":31}}");
+  TEST_ASSERT_EQUAL(422, request->_sentCode);
+  TEST_ASSERT_TRUE(reply_contains("\"field\":\"feed.normal\",\"code\":\"out_of_range\""));
+  TEST_ASSERT_TRUE(reply_contains("Must be 1 to 30"));
+  TEST_ASSERT_EQUAL(0, submitCount);
+}
+
+void test_error_list_is_capped() {
+  String body = "{";
+  for (int i = 0; i < API_V2_MAX_ERRORS + 3; i++) {
+    if (i > 0) body += ",";
+    body += "\"x" + String(i) + "\":1";
+  }
+  body += "}";
+  patch_settings(body);
+  TEST_ASSERT_EQUAL(422, request->_sentCode);
+  TEST_ASSERT_TRUE(reply_contains("\"omitted\":3"));
+}
+
+// ===== REQUEST ERRORS =====
+void test_body_too_large_is_413() {
+  String body = "{\"setpoint\":250";
+  while (body.length() <= API_V2_MAX_BODY) body += "          ";
+  body += "}";
+  patch_settings(body);
+  TEST_ASSERT_EQUAL(413, request->_sentCode);
+  TEST_ASSERT_TRUE(reply_contains("\"body_too_large\""));
+  TEST_ASSERT_EQUAL(0, submitCount);
+}
+
+void test_wrong_content_type_is_415() {
+  send(HTTP_PATCH, "/api/v2/settings", "text/plain", "{\"setpoint\":250}");
+  TEST_ASSERT_EQUAL(415, request->_sentCode);
+  TEST_ASSERT_TRUE(reply_contains("\"unsupported_media_type\""));
+
+  // Parameters after the media type are fine
+  send(HTTP_PATCH, "/api/v2/settings", "application/json; charset=utf-8", "{\"setpoint\":250}");
+  TEST_ASSERT_EQUAL(200, request->_sentCode);
+}
+
+void test_empty_and_malformed_bodies_are_400() {
+  patch_settings("");
+  TEST_ASSERT_EQUAL(400, request->_sentCode);
+  TEST_ASSERT_TRUE(reply_contains("\"empty_body\""));
+
+  patch_settings("{\"setpoint\":}");
+  TEST_ASSERT_EQUAL(400, request->_sentCode);
+  TEST_ASSERT_TRUE(reply_contains("\"invalid_json\""));
+
+  patch_settings("{}");
+  TEST_ASSERT_EQUAL(400, request->_sentCode);
+  TEST_ASSERT_TRUE(reply_contains("\"empty_patch\""));
+  TEST_ASSERT_EQUAL(0, submitCount);
+}
+
+void test_body_split_across_chunks() {
+  delete request;
+  request = new AsyncWebServerRequest(HTTP_POST, "/api/v2/settings");
+  request->setBody("application/json", "{\"pid\":{\"kp\":1.25,\"ki\":0.02,\"kd\":0.75}}");
+  TEST_ASSERT_TRUE(server.serve(request, 5));
+  TEST_ASSERT_EQUAL(200, request->_sentCode);
+  TEST_ASSERT_FLOAT_WITHIN(0.0001, 0.02, submitted.settings.values[SETTING_PID_KI]);
+}
+
+// ===== CROSS-FIELD RULES =====
+void test_hopper_low_above_capacity_conflicts() {
+  patch_settings("{\"pellet\":{\"hopperLow\":25}}");   // Capacity is 20
+  TEST_ASSERT_EQUAL(422, request->_sentCode);
+  TEST_ASSERT_TRUE(reply_contains("\"field\":\"pellet.hopperLow\",\"code\":\"conflict\""));
+  TEST_ASSERT_EQUAL(0, submitCount);
+
+  patch_settings("{\"pellet\":{\"hopperCapacity\":4}}");    // Below the current low of 5
+  TEST_ASSERT_EQUAL(422, request->_sentCode);
+  patch_settings("{\"pellet\":{\"hopperCapacity\":10}}");
+  TEST_ASSERT_EQUAL(200, request->_sentCode);
+  patch_settings("{\"pellet\":{\"hopperCapacity\":30,\"hopperLow\":25}}");
+  TEST_ASSERT_EQUAL(200, request->_sentCode);
+}
+
+void test_apply_rechecks_against_current_values() {
+  patch_settings("{\"pellet\":{\"hopperLow\":15}}");
+  TEST_ASSERT_EQUAL(200, request->_sentCode);
+  Command queued = submitted;
+
+  // Capacity drops before loop() gets to the queued patch
+  pellet[1] = 10.0;
+  const char* reason = NULL;
+  TEST_ASSERT_FALSE(settings_apply_patch(queued.settings, &reason));
+  TEST_ASSERT_NOT_NULL(reason);
+  TEST_ASSERT_EQUAL(0, pelletWrites);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 5.0, pellet[2]);
+}
+
+// ===== APPLY =====
+void test_apply_writes_each_namespace_once() {
+  patch_settings("{\"setpoint\":275,\"keepWarm\":170,"
+                 "\"pid\":{\"kp\":3,\"ki\":0.05},"
+                 "\"feed\":{\"initial\":60,\"lighting\":25,\"normal\":8,\"interval\":90},"
+                 "\"pellet\":{\"calibration\":9.5,\"hopperCapacity\":40}}");
+  TEST_ASSERT_EQUAL(200, request->_sentCode);
+
+  const char* reason = NULL;
+  TEST_ASSERT_TRUE(settings_apply_patch(submitted.settings, &reason));
+  TEST_ASSERT_EQUAL(1, pidWrites);
+  TEST_ASSERT_EQUAL(1, feedWrites);
+  TEST_ASSERT_EQUAL(1, pelletWrites);
+
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 275.0, setpoint);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 170.0, keepWarm);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 3.0, pid[0]);
+  TEST_ASSERT_FLOAT_WITHIN(0.0001, 0.05, pid[1]);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 0.5, pid[2]);        // Untouched, carried through
+  TEST_ASSERT_EQUAL(60000, feed[0]);
+  TEST_ASSERT_EQUAL(90000, feed[3]);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 9.5, pellet[0]);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 40.0, pellet[1]);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 5.0, pellet[2]);      // Untouched, carried through
+}
+
+void test_apply_skips_untouched_namespaces() {
+  Command command;
+  command_init(&command, CMD_APPLY_SETTINGS);
+  command.settings.mask = SETTING_BIT(SETTING_SMOKE_MODE);
+  command.settings.values[SETTING_SMOKE_MODE] = 1;
+
+  const char* reason = NULL;
+  TEST_ASSERT_TRUE(settings_apply_patch(command.settings, &reason));
+  TEST_ASSERT_TRUE(smokeMode);
+  TEST_ASSERT_EQUAL(0, pidWrites + feedWrites + pelletWrites);
+}
+
+void test_get_settings_reports_current_values() {
+  send(HTTP_GET, "/api/v2/settings", "", "");
+  TEST_ASSERT_EQUAL(200, request->_sentCode);
+  TEST_ASSERT_TRUE(reply_contains("\"setpoint\":225"));
+  TEST_ASSERT_TRUE(reply_contains("\"feed\":{\"initial\":45,\"lighting\":20,\"normal\":5,\"interval\":60}"));
+  TEST_ASSERT_TRUE(reply_contains("\"hopperCapacity\":20.0"));
+}
+
+// ===== COMMANDS =====
+void test_commands() {
+  send(HTTP_POST, "/api/v2/commands", "application/json", "{\"action\":\"stop\"}");
+  TEST_ASSERT_EQUAL(200, request->_sentCode);
+  TEST_ASSERT_EQUAL(CMD_STOP, submitted.type);
+
+  send(HTTP_POST, "/api/v2/commands", "application/json", "{\"action\":\"melt\"}");
+  TEST_ASSERT_EQUAL(422, request->_sentCode);
+  TEST_ASSERT_TRUE(reply_contains("\"unknown_action\""));
+
+  send(HTTP_POST, "/api/v2/commands", "application/json", "{\"other\":1}");
+  TEST_ASSERT_EQUAL(422, request->_sentCode);
+
+  send(HTTP_POST, "/api/v2/commands", "application/json", "{\"action\":null}");
+  TEST_ASSERT_EQUAL(422, request->_sentCode);
+
+  send(HTTP_POST, "/api/v2/commands", "application/json", "{}");
+  TEST_ASSERT_EQUAL(400, request->_sentCode);
+  TEST_ASSERT_TRUE(reply_contains("\"missing_action\""));
+  TEST_ASSERT_EQUAL(1, submitCount);
+}
+
+void test_start_needs_a_valid_sensor_and_stops_drop_relays() {
+  grillTemp = -999.0;
+  send(HTTP_POST, "/api/v2/commands", "application/json", "{\"action\":\"start\"}");
+  TEST_ASSERT_EQUAL(409, request->_sentCode);
+  TEST_ASSERT_EQUAL(0, submitCount);
+
+  send(HTTP_POST, "/api/v2/commands", "application/json", "{\"action\":\"emergency_stop\"}");
+  TEST_ASSERT_EQUAL(200, request->_sentCode);
+  TEST_ASSERT_EQUAL(1, emergencyStops);
+  TEST_ASSERT_EQUAL(CMD_EMERGENCY_STOP, submitted.type);
+}
+
+int main() {
+  api_v2_setup_routes();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_valid_patch_is_submitted_as_one_command);
+  RUN_TEST(test_unknown_field_is_rejected);
+  RUN_TEST(test_wrong_types_are_rejected);
+  RUN_TEST(test_out_of_range_is_rejected_and_nothing_applies);
+  RUN_TEST(test_error_list_is_capped);
+  RUN_TEST(test_body_too_large_is_413);
+  RUN_TEST(test_wrong_content_type_is_415);
+  RUN_TEST(test_empty_and_malformed_bodies_are_400);
+  RUN_TEST(test_body_split_across_chunks);
+  RUN_TEST(test_hopper_low_above_capacity_conflicts);
+  RUN_TEST(test_apply_rechecks_against_current_values);
+  RUN_TEST(test_apply_writes_each_namespace_once);
+  RUN_TEST(test_apply_skips_untouched_namespaces);
+  RUN_TEST(test_get_settings_reports_current_values);
+  RUN_TEST(test_commands);
+  RUN_TEST(test_start_needs_a_valid_sensor_and_stops_drop_relays);
+  return UNITY_END();
+}
@@ -0,0 +1,195 @@
+// test_main.cpp - Host benchmark: String concatenation vs JsonWriter
+//
+// Builds the same /status_all-shaped document both ways, checks they are
+// byte-identical, then times each and counts heap allocations through a
+// replaced operator new. The native String is std::string-backed, so short
+// temporaries hit the small-string buffer and the allocation count is a floor
+// for what Arduino's String does on the ESP32, not a match for it.
+#include <unity.h>
+#include <chrono>
+#include <new>
+#include <stdlib.h>
+#include "../../src/JsonWriter.cpp"
+
+static const int BENCH_ITERATIONS = 20000;
+static const size_t BENCH_BUFFER = 1024;
+
+static volatile unsigned long heapAllocations = 0;
+
+void* operator new(size_t size) {
+  heapAllocations++;
+  void* p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+// One control cycle's worth of status - values vary per iteration so nothing
+// folds, and stay off exact binary ties (x.x5), which printf rounds to even
+// and JsonWriter rounds half up
+struct BenchStatus {
+  float grill, ambient, meat[4];
+  int setpoint;
+  bool running, ign, auger, hopper, blower, manual, smoke;
+  unsigned long blowerDuty;
+  float hopperLb, cookLb, burnRate;
+  unsigned long alarmSeq, seq;
+  float eta[4];
+};
+
+static void bench_fill(BenchStatus* s, int i) {
+  s->grill = 225.0 + (i % 50) * 0.371;
+  s->ambient = 68.0 + (i % 7) * 0.1;
+  for (int p = 0; p < 4; p++) s->meat[p] = 120.0 + p * 11.3 + (i % 13) * 0.1;
+  s->setpoint = 225 + (i % 5) * 25;
+  s->running = i & 1;
+  s->ign = i & 2;
+  s->auger = i & 4;
+  s->hopper = i & 8;
+  s->blower = true;
+  s->manual = false;
+  s->smoke = i & 16;
+  s->blowerDuty = 40 + i % 60;
+  s->hopperLb = 18.0 - (i % 100) * 0.029;
+  s->cookLb = (i % 100) * 0.031;
+  s->burnRate = 1.8 + (i % 9) * 0.01;
+  s->alarmSeq = i / 100;
+  s->seq = i;
+  for (int p = 0; p < 4; p++) s->eta[p] = 3600 + p * 600 + i % 60;
+}
+
+static String bool_text(bool b) {
+  return b ? "true" : "false";
+}
+
+// The pre-JsonWriter style: one String grown by concatenation
+static String bench_string(const BenchStatus& s) {
+  String json = "{";
+  json += "\"grillTemp\":" + String(s.grill, 1) + ",";
+  json += "\"ambientTemp\":" + String(s.ambient, 1) + ",";
+  for (int p = 0; p < 4; p++) {
+    json += "\"meat" + String(p + 1) + "Temp\":" + String(s.meat[p], 1) + ",";
+  }
+  json += "\"ip\":\"192.168.1.50\",";
+  json += "\"setpoint\":" + String(s.setpoint) + ",";
+  json += "\"status\":\"" + String(s.running ? "Heating" : "Idle") + "\",";
+  json += "\"grillRunning\":" + bool_text(s.running) + ",";
+  json += "\"ignitionState\":\"Running\",";
+  json += "\"ignOn\":" + bool_text(s.ign) + ",";
+  json += "\"augerOn\":" + bool_text(s.auger) + ",";
+  json += "\"hopperOn\":" + bool_text(s.hopper) + ",";
+  json += "\"blowerOn\":" + bool_text(s.blower) + ",";
+  json += "\"manualOverride\":" + bool_text(s.manual) + ",";
+  json += "\"smokeMode\":" + bool_text(s.smoke) + ",";
+  json += "\"fanMode\":\"Cook\",";
+  json += "\"blowerDuty\":" + String(s.blowerDuty) + ",";
+  json += "\"hopperLb\":" + String(s.hopperLb, 1) + ",";
+  json += "\"cookLb\":" + String(s.cookLb, 2) + ",";
+  json += "\"burnRate\":" + String(s.burnRate, 2) + ",";
+  json += "\"alarmSeq\":" + String(s.alarmSeq) + ",";
+  json += "\"probeEta\":[";
+  for (int p = 0; p < 4; p++) {
+    if (p > 0) json += ",";
+    json += String(s.eta[p], 0);
+  }
+  json += "],";
+  json += "\"seq\":" + String(s.seq);
+  json += "}";
+  return json;
+}
+
+static size_t bench_writer(const BenchStatus& s, char* buffer, size_t capacity) {
+  JsonWriter json(buffer, capacity);
+  char name[12];
+  json.beginObject();
+  json.field("grillTemp", s.grill, 1);
+  json.field("ambientTemp", s.ambient, 1);
+  for (int p = 0; p < 4; p++) {
+    snprintf(name, sizeof name, "meat%dTemp", p + 1);
+    json.field(name, s.meat[p], 1);
+  }
+  json.field("ip", "192.168.1.50");
+  json.field("setpoint", s.setpoint);
+  json.field("status", s.running ? "Heating" : "Idle");
+  json.field("grillRunning", s.running);
+  json.field("ignitionState", "Running");
+  json.field("ignOn", s.ign);
+  json.field("augerOn", s.auger);
+  json.field("hopperOn", s.hopper);
+  json.field("blowerOn", s.blower);
+  json.field("manualOverride", s.manual);
+  json.field("smokeMode", s.smoke);
+  json.field("fanMode", "Cook");
+  json.field("blowerDuty", s.blowerDuty);
+  json.field("hopperLb", s.hopperLb, 1);
+  json.field("cookLb", s.cookLb, 2);
+  json.field("burnRate", s.burnRate, 2);
+  json.field("alarmSeq", s.alarmSeq);
+  json.beginArray("probeEta");
+  for (int p = 0; p < 4; p++) json.value(s.eta[p], 0);
+  json.endArray();
+  json.field("seq", s.seq);
+  json.endObject();
+  return json.overflowed() ? 0 : json.length();
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_both_builders_produce_the_same_document() {
+  char buffer[BENCH_BUFFER];
+  BenchStatus status;
+  for (int i = 0; i < 500; i++) {
+    bench_fill(&status, i);
+    String expected = bench_string(status);
+    size_t length = bench_writer(status, buffer, sizeof buffer);
+    TEST_ASSERT_EQUAL(expected.length(), length);
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), buffer);
+  }
+}
+
+void test_writer_is_faster_and_allocation_free() {
+  char buffer[BENCH_BUFFER];
+  BenchStatus status;
+  size_t stringBytes = 0, writerBytes = 0;
+
+  unsigned long before = heapAllocations;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < BENCH_ITERATIONS; i++) {
+    bench_fill(&status, i);
+    String json = bench_string(status);
+    stringBytes += json.length();
+  }
+  auto stringTime = std::chrono::steady_clock::now() - start;
+  unsigned long stringAllocations = heapAllocations - before;
+
+  before = heapAllocations;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < BENCH_ITERATIONS; i++) {
+    bench_fill(&status, i);
+    writerBytes += bench_writer(status, buffer, sizeof buffer);
+  }
+  auto writerTime = std::chrono::steady_clock::now() - start;
+  unsigned long writerAllocations = heapAllocations - before;
+
+  double stringUs = std::chrono::duration<double, std::micro>(stringTime).count();
+  double writerUs = std::chrono::duration<double, std::micro>(writerTime).count();
+  printf("String concatenation: %7.1f MB/s, %5.1f heap allocations per document\n",
+         stringBytes / stringUs, (double)stringAllocations / BENCH_ITERATIONS);
+  printf("JsonWriter:           %7.1f MB/s, %5.1f heap allocations per document\n",
+         writerBytes / writerUs, (double)writerAllocations / BENCH_ITERATIONS);
+
+  TEST_ASSERT_EQUAL(stringBytes, writerBytes);
+  TEST_ASSERT_EQUAL(0, writerAllocations);
+  TEST_ASSERT_TRUE(stringAllocations > 0);
+  // Loose on purpose - shared CI hosts are noisy; the printed figures are the benchmark
+  TEST_ASSERT_TRUE_MESSAGE(writerUs < stringUs, "JsonWriter slower than String concatenation");
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_both_builders_produce_the_same_document);
+  RUN_TEST(test_writer_is_faster_and_allocation_free);
+  return UNITY_END();
+}
@@ -0,0 +1,187 @@
+// test_main.cpp - Replays cook traces through probe_predictor_step()
+//
+// The brisket trace is a Newton-cooling cook at a 250°F pit with a four hour
+// evaporative stall at 155°F, sampled once a second like the control cycle.
+// Probe readings are quantized to 0.1°F and the pit swings ±4°F on a ten
+// minute period, roughly what the MAX31865 and ADS1115 report on a real cook.
+#include <unity.h>
+#include "../../src/ProbePredictor.cpp"
+
+// ProbePredictor reads cook targets from the global sensor object
+TemperatureSensor::TemperatureSensor() : initialized(false) {}
+TemperatureSensor tempSensor;
+
+static const float TRACE_PIT = 250.0;
+static const float TRACE_START = 40.0;
+static const float TRACE_K = 0.35;              // 1/hr, Newton cooling coefficient
+static const float TRACE_STALL_TEMP = 155.0;
+static const float TRACE_STALL_RATE = 1.0;      // °F/hr through the stall
+static const float TRACE_STALL_HOURS = 4.0;
+static const float TRACE_TARGET = 203.0;
+static const int TRACE_DT = 1;                  // Seconds per sample
+
+struct CookTrace {
+  float probe;
+  float exactProbe;
+  float pit;
+  long stallStart;     // Seconds, -1 until the stall begins
+  long stallEnd;
+  long doneAt;         // First second at or above target, -1 until then
+};
+
+// Advances the synthetic cook one sample; t is seconds since the meat went on
+static void trace_step(CookTrace* trace, long t) {
+  float hours = TRACE_DT / 3600.0;
+  bool stalling = trace->stallStart >= 0 && trace->stallEnd < 0;
+
+  if (stalling) {
+    trace->exactProbe += TRACE_STALL_RATE * hours;
+    if (t - trace->stallStart >= (long)(TRACE_STALL_HOURS * 3600)) trace->stallEnd = t;
+  } else {
+    trace->exactProbe += TRACE_K * (TRACE_PIT - trace->exactProbe) * hours;
+    if (trace->stallStart < 0 && trace->exactProbe >= TRACE_STALL_TEMP) trace->stallStart = t;
+  }
+  if (trace->doneAt < 0 && trace->exactProbe >= TRACE_TARGET) trace->doneAt = t;
+
+  trace->probe = roundf(trace->exactProbe * 10.0) / 10.0;
+  trace->pit = TRACE_PIT + 4.0 * sinf(2.0 * M_PI * t / 600.0);
+}
+
+static void trace_begin(CookTrace* trace) {
+  trace->exactProbe = TRACE_START;
+  trace->probe = TRACE_START;
+  trace->pit = TRACE_PIT;
+  trace->stallStart = -1;
+  trace->stallEnd = -1;
+  trace->doneAt = -1;
+}
+
+// Closed-form time left on the trace once the stall is over
+static long trace_remaining(const CookTrace& trace) {
+  return (long)(logf((TRACE_PIT - trace.exactProbe) / (TRACE_PIT - TRACE_TARGET)) / TRACE_K * 3600.0);
+}
+
+static ProbePredictorState state;
+
+void setUp() {
+  memset(&state, 0, sizeof(state));
+  state.etaSeconds = -1;
+}
+
+void tearDown() {}
+
+void test_stall_flag_follows_the_stall() {
+  CookTrace trace;
+  trace_begin(&trace);
+
+  long stallFlagged = -1;
+  long stallCleared = -1;
+  for (long t = 0; trace.doneAt < 0; t += TRACE_DT) {
+    trace_step(&trace, t);
+    probe_predictor_step(&state, trace.probe, trace.pit, TRACE_TARGET, TRACE_DT);
+
+    if (state.stalled && stallFlagged < 0) stallFlagged = t;
+    if (!state.stalled && stallFlagged >= 0 && stallCleared < 0) stallCleared = t;
+
+    // Never a stall while the probe is still climbing toward it
+    if (trace.stallStart < 0) TEST_ASSERT_FALSE_MESSAGE(state.stalled, "stall flagged before the stall");
+  }
+
+  TEST_ASSERT_TRUE(stallFlagged >= 0);
+  TEST_ASSERT_TRUE(stallCleared >= 0);
+
+  // Flagged within 10 minutes of the plateau, cleared within 10 minutes of it ending
+  TEST_ASSERT_GREATER_OR_EQUAL(trace.stallStart, stallFlagged);
+  TEST_ASSERT_LESS_OR_EQUAL(trace.stallStart + 10 * 60, stallFlagged);
+  TEST_ASSERT_GREATER_OR_EQUAL(trace.stallEnd, stallCleared);
+  TEST_ASSERT_LESS_OR_EQUAL(trace.stallEnd + 10 * 60, stallCleared);
+}
+
+void test_eta_tracks_the_finish_after_the_stall() {
+  CookTrace trace;
+  trace_begin(&trace);
+
+  int checked = 0;
+  for (long t = 0; trace.doneAt < 0; t += TRACE_DT) {
+    trace_step(&trace, t);
+    probe_predictor_step(&state, trace.probe, trace.pit, TRACE_TARGET, TRACE_DT);
+
+    // Once the fit has re-learned the post-stall climb (30 minutes), check every 10 minutes
+    if (trace.stallEnd < 0 || t < trace.stallEnd + 30 * 60 || t % 600 != 0) continue;
+
+    long actual = trace_remaining(trace);
+    if (actual < 15 * 60) continue;   // Last few minutes are inside the smoothing lag
+
+    TEST_ASSERT_TRUE_MESSAGE(state.etaSeconds > 0, "no ETA after the stall");
+    long allowed = max(5L * 60, actual / 10);   // 10% or 5 minutes
+    TEST_ASSERT_INT_WITHIN_MESSAGE(allowed, actual, state.etaSeconds, "ETA error");
+    checked++;
+  }
+  TEST_ASSERT_GREATER_THAN(3, checked);
+}
+
+void test_eta_reads_done_at_target() {
+  CookTrace trace;
+  trace_begin(&trace);
+
+  long t = 0;
+  for (; trace.doneAt < 0; t += TRACE_DT) {
+    trace_step(&trace, t);
+    probe_predictor_step(&state, trace.probe, trace.pit, TRACE_TARGET, TRACE_DT);
+  }
+
+  // Smoothing lags the trace by well under ten minutes
+  for (long end = t + 10 * 60; t < end && state.etaSeconds != 0; t += TRACE_DT) {
+    trace_step(&trace, t);
+    probe_predictor_step(&state, trace.probe, trace.pit, TRACE_TARGET, TRACE_DT);
+  }
+  TEST_ASSERT_EQUAL(0, state.etaSeconds);
+  String text = probe_predictor_format_eta(state.etaSeconds);
+  TEST_ASSERT_EQUAL_STRING("DONE", text.c_str());
+}
+
+void test_no_eta_without_target_or_when_pit_is_too_cool() {
+  CookTrace trace;
+  trace_begin(&trace);
+  for (long t = 0; t < 3600; t += TRACE_DT) {
+    trace_step(&trace, t);
+    probe_predictor_step(&state, trace.probe, trace.pit, 0.0, TRACE_DT);
+  }
+  TEST_ASSERT_EQUAL(-1, state.etaSeconds);
+
+  // Pit below target can never finish the cook
+  setUp();
+  trace_begin(&trace);
+  for (long t = 0; t < 3600; t += TRACE_DT) {
+    trace_step(&trace, t);
+    probe_predictor_step(&state, trace.probe, trace.pit, TRACE_PIT + 10.0, TRACE_DT);
+  }
+  TEST_ASSERT_EQUAL(-1, state.etaSeconds);
+}
+
+void test_dropped_probe_restarts_the_fit() {
+  float temps[MAX_PROBES] = {120.0, -999.0, -999.0, -999.0};
+  bool valid[MAX_PROBES] = {true, false, false, false};
+
+  probe_predictor_init();
+  for (int i = 0; i < 600; i++) {
+    temps[0] += 0.01;
+    probe_predictor_update(TRACE_PIT, temps, valid, 1.0);
+  }
+  TEST_ASSERT_TRUE(probe_predictor_get_rate(0) > 0.0);
+
+  valid[0] = false;
+  probe_predictor_update(TRACE_PIT, temps, valid, 1.0);
+  TEST_ASSERT_EQUAL(-1, probe_predictor_get_eta(0));
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 0.0, probe_predictor_get_rate(0));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_stall_flag_follows_the_stall);
+  RUN_TEST(test_eta_tracks_the_finish_after_the_stall);
+  RUN_TEST(test_eta_reads_done_at_target);
+  RUN_TEST(test_no_eta_without_target_or_when_pit_is_too_cool);
+  RUN_TEST(test_dropped_probe_restarts_the_fit);
+  return UNITY_END();
+}
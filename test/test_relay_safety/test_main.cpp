@@ -0,0 +1,312 @@
+// test_main.cpp - Fuzzes relay_safety_evaluate() against the interlock invariants
+//
+// Each run drives the pure evaluator with random relay requests, a pit
+// temperature that wanders, spikes and drops out (NaN), and uneven time steps
+// like the control loop's between a sample cycle and a manual override. An
+// independent model of what actually went out checks every rule after every
+// step, so a rule change that lets an output through fails here first.
+#include <unity.h>
+#include "../../src/Clock.cpp"
+#include "../../src/RelaySafety.cpp"
+
+static const int FUZZ_RUNS = 200;
+static const int FUZZ_STEPS = 20000;
+static const uint64_t FUZZ_MAX_STEP_MS = 5000;
+
+static uint32_t fuzzSeed;
+
+// xorshift32 - deterministic across hosts, unlike rand()
+static uint32_t fuzz_next() {
+  fuzzSeed ^= fuzzSeed << 13;
+  fuzzSeed ^= fuzzSeed >> 17;
+  fuzzSeed ^= fuzzSeed << 5;
+  return fuzzSeed;
+}
+
+static bool fuzz_chance(uint32_t percent) {
+  return fuzz_next() % 100 < percent;
+}
+
+static float fuzz_range(float low, float high) {
+  return low + (high - low) * (fuzz_next() % 10001) / 10000.0;
+}
+
+// Actual auger on-time per millisecond-exact interval, for the duty check
+struct AugerInterval {
+  uint64_t start;
+  uint64_t end;
+};
+
+static const int MAX_INTERVALS = FUZZ_STEPS;
+static AugerInterval augerIntervals[MAX_INTERVALS];
+
+// Auger on-time that went out within (now - window, now]
+static uint64_t auger_on_within(int count, uint64_t now, uint64_t window) {
+  uint64_t from = now > window ? now - window : 0;
+  uint64_t total = 0;
+  for (int i = count - 1; i >= 0; i--) {
+    if (augerIntervals[i].end <= from) break;
+    uint64_t start = max(augerIntervals[i].start, from);
+    total += augerIntervals[i].end - start;
+  }
+  return total;
+}
+
+static RelaySafetyState state;
+
+void setUp() {
+  relay_safety_reset(&state);
+}
+
+void tearDown() {}
+
+void test_rules_hold_under_random_requests() {
+  char message[160];
+
+  for (int run = 0; run < FUZZ_RUNS; run++) {
+    fuzzSeed = 0x9E3779B9u ^ (run * 2654435761u);
+    relay_safety_reset(&state);
+
+    uint64_t now = 1000 + fuzz_next() % 100000;
+    float pit = fuzz_range(40.0, 650.0);
+    RelayOutputs request = {false, false, false, false};
+
+    bool igniterOut = false;
+    uint64_t igniterOutSince = 0;
+    bool augerOut = false;
+    bool latched = false;
+    bool hot = false;
+    bool lit = false;
+    int intervals = 0;
+
+    for (int step = 0; step < FUZZ_STEPS; step++) {
+      // Requests change now and then, like ignition phases and the auger cycle
+      if (fuzz_chance(10)) request.igniter = !request.igniter;
+      if (fuzz_chance(30)) request.auger = !request.auger;
+      if (fuzz_chance(5)) request.blowerFan = !request.blowerFan;
+      if (fuzz_chance(5)) request.hopperFan = !request.hopperFan;
+
+      // Pit wanders, occasionally jumps across a threshold, sometimes unreadable
+      pit += fuzz_range(-8.0, 8.0);
+      if (fuzz_chance(1)) pit = fuzz_range(40.0, 700.0);
+      pit = constrain(pit, 0.0, 800.0);
+      float reading = fuzz_chance(5) ? NAN : pit;
+
+      // Mostly control-cycle sized steps; long quiet gaps only while the auger
+      // is off, since a gap with it running is time no rule was asked about
+      uint64_t dt = (!augerOut && fuzz_chance(2)) ? fuzz_next() % (2 * SAFETY_AUGER_WINDOW_MS)
+                                                  : fuzz_next() % FUZZ_MAX_STEP_MS;
+      uint64_t previous = now;
+      now += dt;
+
+      // What went out over the interval that just ended
+      if (augerOut && intervals < MAX_INTERVALS) {
+        if (intervals > 0 && augerIntervals[intervals - 1].end == previous) {
+          augerIntervals[intervals - 1].end = now;
+        } else {
+          augerIntervals[intervals++] = {previous, now};
+        }
+      }
+
+      RelayOutputs outputs = request;
+      uint8_t mask = relay_safety_evaluate(&state, &outputs, reading, now);
+      snprintf(message, sizeof message, "run %d step %d pit %.1f mask 0x%02X", run, step, reading, mask);
+
+      // Rules only ever switch outputs off, and never touch the fans
+      TEST_ASSERT_FALSE_MESSAGE(outputs.igniter && !request.igniter, message);
+      TEST_ASSERT_FALSE_MESSAGE(outputs.auger && !request.auger, message);
+      TEST_ASSERT_EQUAL_MESSAGE(request.hopperFan, outputs.hopperFan, message);
+      TEST_ASSERT_EQUAL_MESSAGE(request.blowerFan, outputs.blowerFan, message);
+      if (mask == 0) {
+        TEST_ASSERT_EQUAL_MESSAGE(request.igniter, outputs.igniter, message);
+        TEST_ASSERT_EQUAL_MESSAGE(request.auger, outputs.auger, message);
+      }
+
+      // Over-temperature latches on a reading at the trip point, clears only on a cool one
+      if (!isnan(reading)) {
+        if (reading >= SAFETY_OVERTEMP_TRIP) latched = true;
+        else if (reading < SAFETY_OVERTEMP_RESET) latched = false;
+      }
+      TEST_ASSERT_EQUAL_MESSAGE(latched, state.overTempLatched, message);
+      if (latched) {
+        TEST_ASSERT_FALSE_MESSAGE(outputs.igniter, message);
+        TEST_ASSERT_FALSE_MESSAGE(outputs.auger, message);
+      }
+
+      // The last valid reading stands while the pit is unreadable
+      if (!isnan(reading)) {
+        hot = reading > SAFETY_IGNITER_MAX_TEMP;
+        lit = reading >= SAFETY_LIT_TEMP;
+      }
+
+      // Igniter never runs in a hot pit, or one last seen hot
+      if (hot) {
+        TEST_ASSERT_FALSE_MESSAGE(outputs.igniter, message);
+      }
+
+      // No feeding a pot last seen lit without combustion air
+      if (lit && !outputs.blowerFan) {
+        TEST_ASSERT_FALSE_MESSAGE(outputs.auger, message);
+      }
+
+      // ...and neither rule trips on a pit that is, or was last seen, cool
+      if (!hot) TEST_ASSERT_FALSE_MESSAGE(mask & (1 << SAFETY_RULE_IGNITER_HOT), message);
+      if (!lit) TEST_ASSERT_FALSE_MESSAGE(mask & (1 << SAFETY_RULE_AUGER_NO_BLOWER), message);
+
+      // Igniter continuous on-time is capped; the step that crosses it is the last one
+      if (outputs.igniter && !igniterOut) igniterOutSince = now;
+      if (outputs.igniter && igniterOut) {
+        TEST_ASSERT_TRUE_MESSAGE(previous - igniterOutSince < SAFETY_IGNITER_MAX_ON_MS, message);
+      }
+      igniterOut = outputs.igniter;
+
+      // Auger duty over any true window: the ceiling, plus one bucket the
+      // rotation forgets and the step that was running when it latched
+      if (outputs.auger) {
+        uint64_t onTime = auger_on_within(intervals, now, SAFETY_AUGER_WINDOW_MS);
+        uint64_t limit = (uint64_t)(SAFETY_AUGER_MAX_DUTY * SAFETY_AUGER_WINDOW_MS) +
+                         SAFETY_AUGER_WINDOW_MS / SAFETY_AUGER_BUCKETS + FUZZ_MAX_STEP_MS;
+        TEST_ASSERT_TRUE_MESSAGE(onTime <= limit, message);
+      }
+      augerOut = outputs.auger;
+    }
+  }
+}
+
+void test_nan_keeps_the_over_temperature_latch() {
+  RelayOutputs outputs = {true, true, false, true};
+  relay_safety_evaluate(&state, &outputs, 620.0, 1000);
+  TEST_ASSERT_TRUE(state.overTempLatched);
+
+  // A dead sensor must not read as "cooled down"
+  for (uint64_t t = 2000; t < 60000; t += 1000) {
+    outputs = {true, true, false, true};
+    relay_safety_evaluate(&state, &outputs, NAN, t);
+    TEST_ASSERT_FALSE(outputs.igniter);
+    TEST_ASSERT_FALSE(outputs.auger);
+  }
+
+  outputs = {false, true, false, true};
+  relay_safety_evaluate(&state, &outputs, 500.0, 60000);
+  TEST_ASSERT_FALSE(state.overTempLatched);
+  TEST_ASSERT_TRUE(outputs.auger);
+}
+
+void test_auger_duty_latches_and_resumes() {
+  RelayOutputs outputs;
+  uint64_t t = 1000;
+
+  // Auger on solid until the duty rule stops it
+  for (int i = 0; i < 600; i++, t += 1000) {
+    outputs = {false, true, false, true};
+    relay_safety_evaluate(&state, &outputs, 220.0, t);
+    if (!outputs.auger) break;
+  }
+  TEST_ASSERT_TRUE(state.augerDutyLatched);
+  TEST_ASSERT_FLOAT_WITHIN(0.01, SAFETY_AUGER_MAX_DUTY, relay_safety_auger_duty(&state));
+
+  // Stays off until the window has drained to the resume duty
+  while (state.augerDutyLatched) {
+    TEST_ASSERT_TRUE(relay_safety_auger_duty(&state) > SAFETY_AUGER_RESUME_DUTY - 0.01);
+    t += 1000;
+    outputs = {false, true, false, true};
+    relay_safety_evaluate(&state, &outputs, 220.0, t);
+  }
+  TEST_ASSERT_TRUE(outputs.auger);
+  TEST_ASSERT_TRUE(relay_safety_auger_duty(&state) <= SAFETY_AUGER_RESUME_DUTY);
+}
+
+void test_igniter_lock_needs_an_off_request() {
+  RelayOutputs outputs;
+  uint64_t t = 1000;
+  for (; t <= 1000 + SAFETY_IGNITER_MAX_ON_MS; t += 1000) {
+    outputs = {true, false, false, true};
+    relay_safety_evaluate(&state, &outputs, 120.0, t);
+  }
+  TEST_ASSERT_FALSE(outputs.igniter);
+
+  // Still asked for - stays locked
+  outputs = {true, false, false, true};
+  relay_safety_evaluate(&state, &outputs, 120.0, t += 1000);
+  TEST_ASSERT_FALSE(outputs.igniter);
+
+  // One off request releases it
+  outputs = {false, false, false, true};
+  relay_safety_evaluate(&state, &outputs, 120.0, t += 1000);
+  outputs = {true, false, false, true};
+  relay_safety_evaluate(&state, &outputs, 120.0, t += 1000);
+  TEST_ASSERT_TRUE(outputs.igniter);
+}
+
+void test_unknown_temperature_holds_the_hot_and_lit_verdicts() {
+  RelayOutputs outputs = {true, true, false, false};
+  relay_safety_evaluate(&state, &outputs, 400.0, 1000);
+  TEST_ASSERT_FALSE(outputs.igniter);
+  TEST_ASSERT_FALSE(outputs.auger);
+
+  // Sensor fails in a hot pit: still no igniter, still no feeding without the blower
+  for (uint64_t t = 2000; t < 60000; t += 1000) {
+    outputs = {true, true, false, false};
+    relay_safety_evaluate(&state, &outputs, NAN, t);
+    TEST_ASSERT_FALSE(outputs.igniter);
+    TEST_ASSERT_FALSE(outputs.auger);
+  }
+
+  // Blower on is enough to feed a lit pot
+  outputs = {false, true, false, true};
+  relay_safety_evaluate(&state, &outputs, NAN, 60000);
+  TEST_ASSERT_TRUE(outputs.auger);
+
+  // Only a valid cool reading releases both
+  outputs = {true, true, false, false};
+  relay_safety_evaluate(&state, &outputs, 90.0, 61000);
+  TEST_ASSERT_TRUE(outputs.igniter);
+  TEST_ASSERT_TRUE(outputs.auger);
+
+  // And an unknown temperature after a cool one stays permissive - a cold start
+  outputs = {true, true, false, false};
+  relay_safety_evaluate(&state, &outputs, NAN, 62000);
+  TEST_ASSERT_TRUE(outputs.igniter);
+  TEST_ASSERT_TRUE(outputs.auger);
+}
+
+void test_enforce_holds_the_last_valid_reading_when_stale_or_failed() {
+  clock_manual_set_us(100000ULL * 1000);
+  relay_safety_init();
+
+  // A valid hot reading stops the igniter
+  relay_safety_set_temperature(400.0, clock_ms());
+  RelayOutputs outputs = {true, false, false, true};
+  relay_safety_enforce(&outputs);
+  TEST_ASSERT_FALSE(outputs.igniter);
+
+  // Held past the stale limit the reading is unknown - the pit was last seen hot
+  clock_manual_advance_ms(SAFETY_TEMP_STALE_MS + 1000);
+  relay_safety_set_temperature(400.0, clock_ms() - SAFETY_TEMP_STALE_MS - 1000);
+  outputs = {true, false, false, true};
+  relay_safety_enforce(&outputs);
+  TEST_ASSERT_FALSE(outputs.igniter);
+
+  // A failed read as well
+  relay_safety_set_temperature(NAN, clock_ms());
+  outputs = {true, false, false, true};
+  relay_safety_enforce(&outputs);
+  TEST_ASSERT_FALSE(outputs.igniter);
+
+  // A fresh cool reading lets it run again
+  relay_safety_set_temperature(120.0, clock_ms());
+  outputs = {true, false, false, true};
+  relay_safety_enforce(&outputs);
+  TEST_ASSERT_TRUE(outputs.igniter);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_rules_hold_under_random_requests);
+  RUN_TEST(test_nan_keeps_the_over_temperature_latch);
+  RUN_TEST(test_auger_duty_latches_and_resumes);
+  RUN_TEST(test_igniter_lock_needs_an_off_request);
+  RUN_TEST(test_unknown_temperature_holds_the_hot_and_lit_verdicts);
+  RUN_TEST(test_enforce_holds_the_last_valid_reading_when_stale_or_failed);
+  return UNITY_END();
+}
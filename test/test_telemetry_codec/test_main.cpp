@@ -0,0 +1,304 @@
+// test_main.cpp - Round-trips telemetry_encode_frame() through a reference decoder
+//
+// decode_stream() follows tools/decode_telemetry.py step for step, so a
+// format change that is not mirrored there fails here. The golden stream is
+// shared with tools/test_decode_telemetry.py, which decodes the same bytes.
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include "../../src/TelemetryCodec.cpp"
+
+#define NO_VALUE TELEMETRY_CODEC_NO_VALUE
+
+static const int MAX_FRAMES = 512;
+static const size_t MAX_STREAM = TELEMETRY_CODEC_MAX_HEADER + MAX_FRAMES * TELEMETRY_CODEC_MAX_FRAME;
+
+struct DecodedStream {
+  uint32_t periodSec, startTime, frameCount, keyframeEvery;
+  TelemetryFrame frames[MAX_FRAMES];
+  uint8_t flags[MAX_FRAMES];
+};
+
+static uint8_t stream[MAX_STREAM];
+static TelemetryFrame input[MAX_FRAMES];
+static DecodedStream decoded;
+
+// Keyframe at frame 0 and 3; presence changes at 1 and 2; INT16 extremes and
+// the largest possible deltas between them at 2-4
+static const uint8_t GOLDEN_STREAM[] = {
+  0x47, 0x54, 0x01, 0x06, 0x01, 0x64, 0x05, 0x03,
+  0x35, 0x03, 0x94, 0x23, 0xF8, 0x0A,
+  0x20, 0x07, 0x02, 0x00, 0xB8, 0x17,
+  0x2F, 0x03, 0xE8, 0xDC, 0x03, 0xF5, 0x8A, 0x04,
+  0x30, 0x03, 0xFE, 0xFF, 0x03, 0xFD, 0xFF, 0x03,
+  0x00, 0xFB, 0xFF, 0x07, 0xFC, 0xFF, 0x07,
+};
+
+static const TelemetryFrame GOLDEN_FRAMES[] = {
+  {{2250, 700, NO_VALUE, NO_VALUE, NO_VALUE, NO_VALUE}, 0x05},
+  {{2251, 700, 1500, NO_VALUE, NO_VALUE, NO_VALUE}, 0x00},
+  {{INT16_MAX, INT16_MIN + 1, NO_VALUE, NO_VALUE, NO_VALUE, NO_VALUE}, 0x0F},
+  {{INT16_MAX, INT16_MIN + 1, NO_VALUE, NO_VALUE, NO_VALUE, NO_VALUE}, 0x00},
+  {{INT16_MIN + 1, INT16_MAX, NO_VALUE, NO_VALUE, NO_VALUE, NO_VALUE}, 0x00},
+};
+
+struct StreamReader {
+  const uint8_t* data;
+  size_t length;
+  size_t pos;
+  bool error;
+};
+
+static uint8_t read_byte(StreamReader& r) {
+  if (r.pos >= r.length) {
+    r.error = true;
+    return 0;
+  }
+  return r.data[r.pos++];
+}
+
+static uint32_t read_varint(StreamReader& r) {
+  uint32_t value = 0;
+  for (int shift = 0; shift <= 28; shift += 7) {
+    uint8_t b = read_byte(r);
+    value |= (uint32_t)(b & 0x7F) << shift;
+    if (!(b & 0x80)) return value;
+  }
+  r.error = true;
+  return 0;
+}
+
+static int32_t read_zigzag(StreamReader& r) {
+  uint32_t value = read_varint(r);
+  return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+// False on a malformed or truncated stream, or trailing bytes
+static bool decode_stream(const uint8_t* data, size_t length, DecodedStream* out) {
+  StreamReader r = {data, length, 0, false};
+  if (read_byte(r) != 'G' || read_byte(r) != 'T') return false;
+  if (read_byte(r) != TELEMETRY_CODEC_VERSION) return false;
+  if (read_byte(r) != TELEMETRY_CODEC_CHANNELS) return false;
+  out->periodSec = read_varint(r);
+  out->startTime = read_varint(r);
+  out->frameCount = read_varint(r);
+  out->keyframeEvery = read_varint(r);
+  if (r.error || out->frameCount > (uint32_t)MAX_FRAMES) return false;
+
+  int32_t last[TELEMETRY_CODEC_CHANNELS] = {0};
+  uint8_t hasReference = 0;
+  uint8_t presence = 0;
+  for (uint32_t i = 0; i < out->frameCount; i++) {
+    uint8_t flags = read_byte(r);
+    if (flags & TELEMETRY_FLAG_KEYFRAME) hasReference = 0;
+    if (flags & TELEMETRY_FLAG_PRESENCE) presence = read_byte(r);
+
+    TelemetryFrame& frame = out->frames[i];
+    for (int c = 0; c < TELEMETRY_CODEC_CHANNELS; c++) {
+      frame.temp[c] = NO_VALUE;
+      if (!(presence & (1 << c))) continue;
+      if (hasReference & (1 << c)) {
+        last[c] += read_zigzag(r);
+      } else {
+        last[c] = read_zigzag(r);
+        hasReference |= (1 << c);
+      }
+      frame.temp[c] = (int16_t)last[c];
+    }
+    frame.relays = flags & TELEMETRY_FLAG_RELAYS;
+    out->flags[i] = flags;
+  }
+  return !r.error && r.pos == length;
+}
+
+// Header plus frames into stream[]; 0 if any frame overran TELEMETRY_CODEC_MAX_FRAME
+static size_t encode_stream(const TelemetryFrame* frames, int count, uint32_t keyframeEvery) {
+  TelemetryEncoder encoder;
+  telemetry_encoder_init(&encoder, keyframeEvery);
+  size_t n = telemetry_encode_header(&encoder, 1, 100, count, stream, sizeof(stream));
+  for (int i = 0; i < count; i++) {
+    size_t written = telemetry_encode_frame(&encoder, &frames[i], stream + n, sizeof(stream) - n);
+    if (written == 0 || written > TELEMETRY_CODEC_MAX_FRAME) return 0;
+    n += written;
+  }
+  return n;
+}
+
+static void assert_frames_equal(const TelemetryFrame* expected, const TelemetryFrame* actual, int count) {
+  char message[48];
+  for (int i = 0; i < count; i++) {
+    snprintf(message, sizeof message, "frame %d", i);
+    TEST_ASSERT_EQUAL_INT16_ARRAY_MESSAGE(expected[i].temp, actual[i].temp, TELEMETRY_CODEC_CHANNELS, message);
+    TEST_ASSERT_EQUAL_MESSAGE(expected[i].relays, actual[i].relays, message);
+  }
+}
+
+static uint32_t seed;
+
+static int32_t clamp_temp(int32_t value) {
+  if (value < INT16_MIN + 1) return INT16_MIN + 1;
+  if (value > INT16_MAX) return INT16_MAX;
+  return value;
+}
+
+static uint32_t next_random() {
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}
+
+void setUp() {
+  memset(&decoded, 0, sizeof(decoded));
+}
+
+void tearDown() {}
+
+void test_golden_stream() {
+  int count = sizeof(GOLDEN_FRAMES) / sizeof(GOLDEN_FRAMES[0]);
+  size_t length = encode_stream(GOLDEN_FRAMES, count, 3);
+  TEST_ASSERT_EQUAL(sizeof(GOLDEN_STREAM), length);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(GOLDEN_STREAM, stream, length);
+
+  TEST_ASSERT_TRUE(decode_stream(GOLDEN_STREAM, sizeof(GOLDEN_STREAM), &decoded));
+  TEST_ASSERT_EQUAL(1, decoded.periodSec);
+  TEST_ASSERT_EQUAL(100, decoded.startTime);
+  TEST_ASSERT_EQUAL(count, decoded.frameCount);
+  TEST_ASSERT_EQUAL(3, decoded.keyframeEvery);
+  assert_frames_equal(GOLDEN_FRAMES, decoded.frames, count);
+}
+
+void test_keyframes_carry_absolute_values_and_presence() {
+  for (int i = 0; i < 130; i++) {
+    for (int c = 0; c < TELEMETRY_CODEC_CHANNELS; c++) input[i].temp[c] = 2000 + c * 10 + i;
+    input[i].relays = i & TELEMETRY_FLAG_RELAYS;
+  }
+  size_t length = encode_stream(input, 130, TELEMETRY_CODEC_KEYFRAME);
+  TEST_ASSERT_TRUE(decode_stream(stream, length, &decoded));
+  assert_frames_equal(input, decoded.frames, 130);
+
+  for (int i = 0; i < 130; i++) {
+    bool keyframe = i % TELEMETRY_CODEC_KEYFRAME == 0;
+    TEST_ASSERT_EQUAL(keyframe, (bool)(decoded.flags[i] & TELEMETRY_FLAG_KEYFRAME));
+    // Presence is only resent on keyframes when it has not changed
+    TEST_ASSERT_EQUAL(keyframe, (bool)(decoded.flags[i] & TELEMETRY_FLAG_PRESENCE));
+  }
+}
+
+void test_stream_decodes_from_any_keyframe() {
+  for (int i = 0; i < 10; i++) {
+    for (int c = 0; c < TELEMETRY_CODEC_CHANNELS; c++) input[i].temp[c] = (c & 1) ? NO_VALUE : 1000 + 7 * i;
+    input[i].relays = 0;
+  }
+  // Frames from a keyframe on encode the same whatever came before them
+  uint8_t full[MAX_STREAM];
+  TelemetryEncoder encoder;
+  telemetry_encoder_init(&encoder, 4);
+  size_t offsets[11];
+  size_t n = telemetry_encode_header(&encoder, 1, 100, 10, full, sizeof(full));
+  for (int i = 0; i < 10; i++) {
+    offsets[i] = n;
+    n += telemetry_encode_frame(&encoder, &input[i], full + n, sizeof(full) - n);
+  }
+  offsets[10] = n;
+
+  size_t tail = encode_stream(input + 4, 6, 4);
+  size_t header = tail - (offsets[10] - offsets[4]);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(full + offsets[4], stream + header, offsets[10] - offsets[4]);
+}
+
+void test_presence_changes_between_keyframes() {
+  // A probe plugged in, pulled, plugged back in at another temperature
+  for (int i = 0; i < 12; i++) {
+    for (int c = 0; c < TELEMETRY_CODEC_CHANNELS; c++) input[i].temp[c] = NO_VALUE;
+    input[i].temp[0] = 2250 + i;
+    input[i].relays = 0;
+  }
+  for (int i = 2; i < 5; i++) input[i].temp[2] = 400 + i;
+  for (int i = 8; i < 12; i++) input[i].temp[2] = 1600 - i;
+  // All channels missing for a frame
+  input[6].temp[0] = NO_VALUE;
+
+  size_t length = encode_stream(input, 12, TELEMETRY_CODEC_KEYFRAME);
+  TEST_ASSERT_TRUE(decode_stream(stream, length, &decoded));
+  assert_frames_equal(input, decoded.frames, 12);
+
+  const bool presenceSent[12] = {true, false, true, false, false, true, true, true, true, false, false, false};
+  for (int i = 0; i < 12; i++) {
+    TEST_ASSERT_EQUAL(presenceSent[i], (bool)(decoded.flags[i] & TELEMETRY_FLAG_PRESENCE));
+  }
+}
+
+void test_int16_extremes_fit_the_worst_case_frame() {
+  const int16_t extremes[] = {INT16_MAX, INT16_MIN + 1, 0, -1, 1, INT16_MAX - 1};
+  int count = 0;
+  for (size_t a = 0; a < sizeof(extremes) / sizeof(extremes[0]); a++) {
+    for (size_t b = 0; b < sizeof(extremes) / sizeof(extremes[0]); b++) {
+      for (int c = 0; c < TELEMETRY_CODEC_CHANNELS; c++) {
+        input[count].temp[c] = (c & 1) ? extremes[b] : extremes[a];
+      }
+      input[count].relays = TELEMETRY_FLAG_RELAYS;
+      count++;
+    }
+  }
+  size_t length = encode_stream(input, count, 5);
+  TEST_ASSERT_TRUE(decode_stream(stream, length, &decoded));
+  assert_frames_equal(input, decoded.frames, count);
+
+  // Every channel swinging end to end at once is the largest frame there is
+  TelemetryEncoder encoder;
+  telemetry_encoder_init(&encoder, TELEMETRY_CODEC_KEYFRAME);
+  TelemetryFrame low = {{INT16_MIN + 1, INT16_MIN + 1, INT16_MIN + 1, INT16_MIN + 1, INT16_MIN + 1, INT16_MIN + 1}, 0};
+  TelemetryFrame high = {{INT16_MAX, INT16_MAX, INT16_MAX, INT16_MAX, INT16_MAX, INT16_MAX}, 0x0F};
+  uint8_t frame[TELEMETRY_CODEC_MAX_FRAME];
+  TEST_ASSERT_TRUE(telemetry_encode_frame(&encoder, &low, frame, sizeof(frame)) > 0);
+  TEST_ASSERT_EQUAL(1 + TELEMETRY_CODEC_CHANNELS * 3, telemetry_encode_frame(&encoder, &high, frame, sizeof(frame)));
+}
+
+void test_random_streams_round_trip() {
+  for (int run = 0; run < 200; run++) {
+    seed = 0x2545F491u ^ (run * 2654435761u);
+    int count = 1 + next_random() % MAX_FRAMES;
+    uint32_t keyframeEvery = 1 + next_random() % 80;
+
+    int16_t value[TELEMETRY_CODEC_CHANNELS];
+    for (int c = 0; c < TELEMETRY_CODEC_CHANNELS; c++) value[c] = 700 + next_random() % 2000;
+    for (int i = 0; i < count; i++) {
+      for (int c = 0; c < TELEMETRY_CODEC_CHANNELS; c++) {
+        uint32_t roll = next_random() % 100;
+        if (roll < 2) value[c] = (int16_t)(next_random() % 65535 - 32767);   // Anywhere, extremes included
+        else value[c] = (int16_t)clamp_temp(value[c] + (int)(next_random() % 21) - 10);
+        input[i].temp[c] = (next_random() % 100 < 5) ? NO_VALUE : value[c];
+      }
+      input[i].relays = next_random() & TELEMETRY_FLAG_RELAYS;
+    }
+
+    size_t length = encode_stream(input, count, keyframeEvery);
+    TEST_ASSERT_TRUE(decode_stream(stream, length, &decoded));
+    TEST_ASSERT_EQUAL(count, decoded.frameCount);
+    assert_frames_equal(input, decoded.frames, count);
+  }
+}
+
+void test_short_buffers_are_refused() {
+  TelemetryEncoder encoder;
+  telemetry_encoder_init(&encoder, TELEMETRY_CODEC_KEYFRAME);
+  TEST_ASSERT_EQUAL(0, telemetry_encode_header(&encoder, 1, 0, 0, stream, TELEMETRY_CODEC_MAX_HEADER - 1));
+  TEST_ASSERT_EQUAL(0, telemetry_encode_frame(&encoder, &GOLDEN_FRAMES[0], stream, TELEMETRY_CODEC_MAX_FRAME - 1));
+
+  // A refused frame leaves the encoder where it was
+  TEST_ASSERT_EQUAL(0, encoder.frameIndex);
+  TEST_ASSERT_FALSE(decode_stream(GOLDEN_STREAM, sizeof(GOLDEN_STREAM) - 1, &decoded));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_golden_stream);
+  RUN_TEST(test_keyframes_carry_absolute_values_and_presence);
+  RUN_TEST(test_stream_decodes_from_any_keyframe);
+  RUN_TEST(test_presence_changes_between_keyframes);
+  RUN_TEST(test_int16_extremes_fit_the_worst_case_frame);
+  RUN_TEST(test_random_streams_round_trip);
+  RUN_TEST(test_short_buffers_are_refused);
+  return UNITY_END();
+}
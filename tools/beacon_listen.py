@@ -0,0 +1,250 @@
+#!/usr/bin/env python3
+# beacon_listen.py - Listen for grill telemetry beacons and show every controller
+#
+# Controllers with the beacon enabled (/set_beacon?enabled=1) multicast one
+# packet per control cycle; the format is documented in src/TelemetryCodec.h.
+#   python tools/beacon_listen.py                    # live table, refreshed every 2 s
+#   python tools/beacon_listen.py --log site.csv     # also append one CSV row per beacon
+#
+# Simulated controllers, for trying the listener without hardware:
+#   python tools/beacon_listen.py --group 127.0.0.1 &
+#   python tools/beacon_listen.py simulate --count 5 --group 127.0.0.1
+# A unicast --group (such as loopback) skips the multicast join.
+import argparse
+import ipaddress
+import random
+import socket
+import struct
+import sys
+import time
+
+from decode_telemetry import CHANNELS, RELAYS, FLAG_RELAYS, FLAG_KEYFRAME, FLAG_PRESENCE, DecodeError, Reader
+
+GROUP = "239.255.71.71"
+PORT = 47171
+VERSION = 1
+NAME_MAX = 24
+STALE_SEC = 10   # Rows marked STALE after this long without a beacon
+
+STATE_BITS = [(0x01, "running"), (0x02, "manual"), (0x04, "hopperLow"), (0x08, "alarm"), (0x10, "smoke")]
+IGNITION = ["off", "preheat", "initialFeed", "lighting", "flameDetect", "stabilize", "complete", "failed"]
+
+
+def decode_beacon(data):
+    """Return a dict for one beacon packet."""
+    r = Reader(data)
+    if r.byte() != ord("G") or r.byte() != ord("B"):
+        raise DecodeError("bad magic")
+    version = r.byte()
+    if version != VERSION:
+        raise DecodeError("unsupported version %d" % version)
+
+    beacon = {"id": ":".join("%02x" % r.byte() for _ in range(6))}
+    beacon["sequence"] = r.varint()
+    beacon["uptime"] = r.varint()
+    state = r.byte()
+    beacon["state"] = [name for bit, name in STATE_BITS if state & bit]
+    ignition = r.byte()
+    beacon["ignition"] = IGNITION[ignition] if ignition < len(IGNITION) else str(ignition)
+    beacon["setpoint"] = r.varint()
+    beacon["hopperLb"] = r.varint() / 10.0
+    beacon["blowerDuty"] = r.byte()
+    beacon["name"] = bytes(r.byte() for _ in range(r.byte())).decode("utf-8", "replace")
+
+    # One keyframe: absolute values for the channels present
+    flags = r.byte()
+    presence = r.byte() if flags & FLAG_PRESENCE else 0
+    temps = [None] * len(CHANNELS)
+    for c in range(len(CHANNELS)):
+        if presence & (1 << c):
+            temps[c] = r.zigzag() / 10.0
+    beacon["temps"] = temps
+    beacon["relays"] = [(flags & FLAG_RELAYS) >> b & 1 for b in range(len(RELAYS))]
+
+    if r.pos != len(data):
+        raise DecodeError("%d trailing bytes" % (len(data) - r.pos))
+    return beacon
+
+
+def is_multicast(address):
+    return ipaddress.ip_address(address).is_multicast
+
+
+def open_listener(group, port, interface):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    if is_multicast(group):
+        sock.bind(("", port))
+        membership = struct.pack("4s4s", socket.inet_aton(group), socket.inet_aton(interface))
+        sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, membership)
+    else:
+        sock.bind((group, port))
+    sock.settimeout(0.5)
+    return sock
+
+
+def format_temp(value):
+    return "   -  " if value is None else "%6.1f" % value
+
+
+def print_table(devices):
+    now = time.time()
+    lines = ["%-17s %-16s %5s %6s %6s %6s %6s %-12s %6s %4s %s" % (
+        "device", "name", "set", "grill", "probe1", "probe2", "hopper", "ignition", "lost", "age", "state")]
+    for device_id in sorted(devices):
+        d = devices[device_id]
+        b = d["beacon"]
+        age = now - d["seen"]
+        lines.append("%-17s %-16s %5d %s %s %s %6.1f %-12s %6d %4d %s" % (
+            device_id, b["name"][:16], b["setpoint"], format_temp(b["temps"][0]),
+            format_temp(b["temps"][2]), format_temp(b["temps"][3]), b["hopperLb"], b["ignition"],
+            d["lost"], age, "STALE" if age > STALE_SEC else ",".join(b["state"])))
+    print("\033[2J\033[H" + "\n".join(lines) + "\n\n%d controller(s)" % len(devices), flush=True)
+
+
+def listen(args):
+    sock = open_listener(args.group, args.port, args.interface)
+    devices = {}
+    log = None
+    if args.log:
+        log = open(args.log, "a")
+        if log.tell() == 0:
+            log.write(",".join(["time", "device", "name", "sequence", "uptime", "setpoint", "ignition",
+                                "hopperLb", "blowerDuty", "state"] + CHANNELS + RELAYS) + "\n")
+    errors = 0
+    last_print = 0
+
+    while True:
+        try:
+            data, sender = sock.recvfrom(512)
+        except socket.timeout:
+            data = None
+
+        if data:
+            try:
+                b = decode_beacon(data)
+            except DecodeError as e:
+                errors += 1
+                print("bad packet from %s: %s" % (sender[0], e), file=sys.stderr)
+                continue
+
+            d = devices.setdefault(b["id"], {"lost": 0, "beacon": None})
+            previous = d["beacon"]
+            if previous is not None and b["sequence"] > previous["sequence"]:
+                d["lost"] += b["sequence"] - previous["sequence"] - 1
+            d["beacon"] = b   # A lower sequence means the controller rebooted
+            d["seen"] = time.time()
+            d["address"] = sender[0]
+
+            if log:
+                cells = [str(int(d["seen"])), b["id"], b["name"], str(b["sequence"]), str(b["uptime"]),
+                         str(b["setpoint"]), b["ignition"], "%.1f" % b["hopperLb"], str(b["blowerDuty"]),
+                         "|".join(b["state"])]
+                cells += ["" if t is None else "%.1f" % t for t in b["temps"]]
+                cells += [str(r) for r in b["relays"]]
+                log.write(",".join(cells) + "\n")
+                log.flush()
+
+        if not args.quiet and time.time() - last_print >= args.interval:
+            print_table(devices)
+            last_print = time.time()
+
+
+# ===== Simulated controllers =====
+
+def put_varint(value):
+    out = bytearray()
+    while value >= 0x80:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+    return out
+
+
+def zigzag(value):
+    return (value << 1) ^ (value >> 31)
+
+
+def encode_beacon(device_id, sequence, uptime, state, ignition, setpoint, hopper, duty, name, temps, relays):
+    out = bytearray(b"GB") + bytes([VERSION]) + device_id
+    out += put_varint(sequence) + put_varint(uptime) + bytes([state, ignition])
+    out += put_varint(setpoint) + put_varint(int(round(hopper * 10))) + bytes([duty])
+    encoded_name = name.encode()[:NAME_MAX]
+    out += bytes([len(encoded_name)]) + encoded_name
+
+    presence = 0
+    values = bytearray()
+    for c, t in enumerate(temps):
+        if t is not None:
+            presence |= 1 << c
+            values += put_varint(zigzag(int(round(t * 10))))
+    out += bytes([(relays & FLAG_RELAYS) | FLAG_KEYFRAME | FLAG_PRESENCE, presence]) + values
+    return bytes(out)
+
+
+def simulate(args):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    if is_multicast(args.group):
+        sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_TTL, 1)
+        sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_LOOP, 1)
+
+    grills = []
+    for i in range(args.count):
+        grills.append({
+            "id": bytes([0x02, 0x00, 0x00, 0x00, 0x00, i + 1]),
+            "name": "SimGrill-%d" % (i + 1),
+            "setpoint": random.choice([225, 250, 275, 350]),
+            "grill": 70.0,
+            "probes": [40.0 + random.random() * 5, 40.0 + random.random() * 5],
+            "hopper": 20.0,
+        })
+
+    start = time.time()
+    sequence = 0
+    while True:
+        uptime = int(time.time() - start)
+        for g in grills:
+            g["grill"] += (g["setpoint"] - g["grill"]) * 0.05 + random.uniform(-1, 1)
+            g["probes"] = [p + max(0.0, (g["grill"] - p) * 0.002) for p in g["probes"]]
+            g["hopper"] = max(0.0, g["hopper"] - 0.002)
+            temps = [g["grill"], 72.0] + g["probes"] + [None, None]
+            packet = encode_beacon(g["id"], sequence, uptime, 0x01, 6, g["setpoint"], g["hopper"],
+                                   random.randint(30, 70), g["name"], temps, random.choice([0x08, 0x0A]))
+            if random.random() >= args.loss:
+                sock.sendto(packet, (args.group, args.port))
+        sequence += 1
+        time.sleep(args.period)
+
+
+def main():
+    def address_args(p, default):
+        p.add_argument("--group", default=default(GROUP), help="multicast group, or a unicast address such as 127.0.0.1")
+        p.add_argument("--port", type=int, default=default(PORT))
+
+    parser = argparse.ArgumentParser()
+    address_args(parser, lambda value: value)
+    sub = parser.add_subparsers(dest="command")
+
+    parser.add_argument("--interface", default="0.0.0.0", help="local address to join the group on")
+    parser.add_argument("--interval", type=float, default=2.0, help="seconds between table refreshes")
+    parser.add_argument("--log", help="append one CSV row per beacon to this file")
+    parser.add_argument("--quiet", action="store_true", help="no table, only --log")
+
+    sim = sub.add_parser("simulate", help="send beacons from simulated controllers")
+    address_args(sim, lambda value: argparse.SUPPRESS)   # Accepted after "simulate" too
+    sim.add_argument("--count", type=int, default=3)
+    sim.add_argument("--period", type=float, default=1.0)
+    sim.add_argument("--loss", type=float, default=0.0, help="fraction of beacons to drop")
+
+    args = parser.parse_args()
+    try:
+        if args.command == "simulate":
+            simulate(args)
+        else:
+            listen(args)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
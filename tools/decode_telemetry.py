@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+# decode_telemetry.py - Decode the binary history stream from /history.bin
+#
+# Reads a file, stdin ("-") or an http:// URL and prints one CSV row per frame:
+#   python tools/decode_telemetry.py http://grill.local/history.bin > cook.csv
+#   python tools/decode_telemetry.py saved.bin
+#
+# The format is documented in src/TelemetryCodec.h; this is its reference
+# decoder and must be kept in step with telemetry_encode_frame().
+import sys
+import urllib.request
+
+VERSION = 1
+FLAG_RELAYS = 0x0F
+FLAG_KEYFRAME = 0x10
+FLAG_PRESENCE = 0x20
+
+CHANNELS = ["grill", "ambient", "probe1", "probe2", "probe3", "probe4"]
+RELAYS = ["igniter", "auger", "hopperFan", "blowerFan"]
+
+
+class DecodeError(Exception):
+    pass
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def byte(self):
+        if self.pos >= len(self.data):
+            raise DecodeError("truncated stream at byte %d" % self.pos)
+        value = self.data[self.pos]
+        self.pos += 1
+        return value
+
+    def varint(self):
+        value = 0
+        shift = 0
+        while True:
+            b = self.byte()
+            value |= (b & 0x7F) << shift
+            if not b & 0x80:
+                return value
+            shift += 7
+            if shift > 35:
+                raise DecodeError("varint too long at byte %d" % self.pos)
+
+    def zigzag(self):
+        value = self.varint()
+        return (value >> 1) ^ -(value & 1)
+
+
+def decode(data):
+    """Return (header dict, list of (time, temps, relays)); temps in °F or None."""
+    r = Reader(data)
+    if r.byte() != ord("G") or r.byte() != ord("T"):
+        raise DecodeError("bad magic")
+    version = r.byte()
+    if version != VERSION:
+        raise DecodeError("unsupported version %d" % version)
+    channels = r.byte()
+    if channels != len(CHANNELS):
+        raise DecodeError("expected %d channels, got %d" % (len(CHANNELS), channels))
+
+    header = {
+        "periodSec": r.varint(),
+        "startTime": r.varint(),
+        "frameCount": r.varint(),
+        "keyframeEvery": r.varint(),
+    }
+
+    last = [0] * channels
+    has_reference = 0
+    presence = 0
+    frames = []
+    for i in range(header["frameCount"]):
+        flags = r.byte()
+        if flags & FLAG_KEYFRAME:
+            has_reference = 0
+        if flags & FLAG_PRESENCE:
+            presence = r.byte()
+
+        temps = [None] * channels
+        for c in range(channels):
+            if not presence & (1 << c):
+                continue
+            if has_reference & (1 << c):
+                last[c] += r.zigzag()
+            else:
+                last[c] = r.zigzag()
+                has_reference |= 1 << c
+            temps[c] = last[c] / 10.0
+
+        relays = [(flags >> b) & 1 for b in range(len(RELAYS))]
+        frames.append((header["startTime"] + i * header["periodSec"], temps, relays))
+
+    if r.pos != len(data):
+        raise DecodeError("%d trailing bytes" % (len(data) - r.pos))
+    return header, frames
+
+
+def read_input(source):
+    if source == "-":
+        return sys.stdin.buffer.read()
+    if source.startswith("http://") or source.startswith("https://"):
+        with urllib.request.urlopen(source, timeout=30) as response:
+            return response.read()
+    with open(source, "rb") as f:
+        return f.read()
+
+
+def main(argv):
+    if len(argv) != 2:
+        print("usage: decode_telemetry.py <file | - | http://host/history.bin?from=&to=>", file=sys.stderr)
+        return 2
+
+    data = read_input(argv[1])
+    try:
+        header, frames = decode(data)
+    except DecodeError as e:
+        print("decode error: %s" % e, file=sys.stderr)
+        return 1
+
+    print("# period=%ds start=%d frames=%d bytes=%d (%.1f bytes/frame)" % (
+        header["periodSec"], header["startTime"], header["frameCount"], len(data),
+        len(data) / max(header["frameCount"], 1)))
+    print(",".join(["t"] + CHANNELS + RELAYS))
+    for time, temps, relays in frames:
+        cells = [str(time)] + ["" if t is None else "%.1f" % t for t in temps] + [str(b) for b in relays]
+        print(",".join(cells))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
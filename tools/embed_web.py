@@ -0,0 +1,104 @@
+# embed_web.py - Gzip web/*.html into src/WebAssets.h
+#
+# Runs as a PlatformIO pre-build script (extra_scripts in platformio.ini) and
+# can also be run by hand: python tools/embed_web.py
+#
+# Each page is gzipped once at build time and embedded in flash, so the web
+# server sends it straight from flash with Content-Encoding: gzip. The ETag is
+# a hash of the compressed bytes; it changes only when the page does.
+import gzip
+import hashlib
+import os
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO
+    PROJECT_DIR = env["PROJECT_DIR"]  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+WEB_DIR = os.path.join(PROJECT_DIR, "web")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "WebAssets.h")
+
+# Served path for each page; index.html is the dashboard at "/"
+PAGES = [
+    ("index.html", "/"),
+    ("manual.html", "/manual"),
+    ("pid.html", "/pid"),
+    ("debug.html", "/debug"),
+    ("wifi.html", "/wifi"),
+]
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+}
+
+
+def symbol_for(filename):
+    return "WEB_" + filename.upper().replace(".", "_").replace("-", "_") + "_GZ"
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def build():
+    out = []
+    out.append("// WebAssets.h - Generated by tools/embed_web.py from web/ - do not edit")
+    out.append("#ifndef WEBASSETS_H")
+    out.append("#define WEBASSETS_H")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("struct WebAsset {")
+    out.append("  const char* path;")
+    out.append("  const char* contentType;")
+    out.append("  const uint8_t* data;      // gzip, in flash")
+    out.append("  size_t length;")
+    out.append("  const char* etag;         // Quoted strong ETag")
+    out.append("};")
+    out.append("")
+
+    table = []
+    for filename, path in PAGES:
+        with open(os.path.join(WEB_DIR, filename), "rb") as f:
+            raw = f.read()
+        # mtime=0 keeps the output (and the ETag) reproducible
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = '\\"' + hashlib.sha1(packed).hexdigest()[:16] + '\\"'
+        symbol = symbol_for(filename)
+        content_type = CONTENT_TYPES[os.path.splitext(filename)[1]]
+
+        out.append("// %s: %d bytes, %d gzipped" % (filename, len(raw), len(packed)))
+        out.append("static const uint8_t %s[] PROGMEM = {" % symbol)
+        out.append(c_array(packed))
+        out.append("};")
+        out.append("")
+        table.append('  {"%s", "%s", %s, sizeof(%s), "%s"},' % (path, content_type, symbol, symbol, etag))
+
+    out.append("static const WebAsset WEB_ASSETS[] = {")
+    out.extend(table)
+    out.append("};")
+    out.append("")
+    out.append("#define WEB_ASSET_COUNT (sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]))")
+    out.append("")
+    out.append("#endif // WEBASSETS_H")
+    out.append("")
+
+    text = "\n".join(out)
+    old = None
+    if os.path.exists(OUTPUT):
+        with open(OUTPUT, "r") as f:
+            old = f.read()
+    # Only rewrite on change so an unchanged tree does not trigger a rebuild
+    if text != old:
+        with open(OUTPUT, "w") as f:
+            f.write(text)
+        print("embed_web: regenerated %s" % os.path.relpath(OUTPUT, PROJECT_DIR))
+
+
+build()
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+# mqtt_check.py - Check the controller's MQTT topics against a local broker
+#
+# Needs the mosquitto clients (mosquitto_sub/mosquitto_pub) on PATH. Point the
+# controller at the broker on the /wifi page, then:
+#   python tools/mqtt_check.py localhost grill/a1b2c3
+#
+# Checks availability, the retained state and discovery configs, telemetry,
+# that an out-of-range setpoint is ignored and that a valid one is applied.
+# The original setpoint is restored afterwards. Exits non-zero on failure.
+import argparse
+import json
+import subprocess
+import sys
+import time
+
+
+def subscribe(args, topics, seconds, count=None):
+    """Return [(topic, payload)] received within the time limit."""
+    cmd = ["mosquitto_sub", "-h", args.host, "-p", str(args.port), "-v", "-W", str(seconds)]
+    if args.user:
+        cmd += ["-u", args.user, "-P", args.password or ""]
+    if count:
+        cmd += ["-C", str(count)]
+    for topic in topics:
+        cmd += ["-t", topic]
+    result = subprocess.run(cmd, capture_output=True, text=True)
+    messages = []
+    for line in result.stdout.splitlines():
+        topic, _, payload = line.partition(" ")
+        messages.append((topic, payload))
+    return messages
+
+
+def publish(args, topic, payload):
+    cmd = ["mosquitto_pub", "-h", args.host, "-p", str(args.port), "-t", topic, "-m", payload]
+    if args.user:
+        cmd += ["-u", args.user, "-P", args.password or ""]
+    subprocess.run(cmd, check=True)
+
+
+def read_state(args):
+    messages = subscribe(args, [args.base + "/state"], 3, count=1)
+    return json.loads(messages[0][1]) if messages else None
+
+
+def wait_for_setpoint(args, value, seconds):
+    deadline = time.time() + seconds
+    while time.time() < deadline:
+        state = read_state(args)
+        if state and state.get("setpoint") == value:
+            return True
+    return False
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("host")
+    parser.add_argument("base", help="base topic, e.g. grill/a1b2c3")
+    parser.add_argument("--port", type=int, default=1883)
+    parser.add_argument("--user")
+    parser.add_argument("--password")
+    args = parser.parse_args()
+
+    failures = []
+
+    def check(ok, what):
+        print(("PASS " if ok else "FAIL ") + what)
+        if not ok:
+            failures.append(what)
+
+    retained = subscribe(args, [args.base + "/availability", args.base + "/state",
+                                "homeassistant/+/+/+/config"], 3)
+    availability = [p for t, p in retained if t == args.base + "/availability"]
+    check(availability == ["online"], "availability is retained 'online'")
+
+    configs = []
+    for topic, payload in retained:
+        if topic.startswith("homeassistant/"):
+            config = json.loads(payload)
+            if config.get("availability_topic") == args.base + "/availability":
+                configs.append(config)
+    check(len(configs) > 0, "discovery configs retained (%d)" % len(configs))
+
+    state = read_state(args)
+    check(state is not None and "grillRunning" in state and "setpoint" in state, "state is retained JSON")
+    if state is None:
+        sys.exit(1)
+    original = state["setpoint"]
+
+    telemetry = subscribe(args, [args.base + "/telemetry"], 70, count=1)
+    check(len(telemetry) == 1 and "grillTemp" in json.loads(telemetry[0][1]), "telemetry published")
+
+    publish(args, args.base + "/setpoint/set", "900")
+    time.sleep(3)
+    check(read_state(args)["setpoint"] == original, "out-of-range setpoint ignored")
+
+    target = 225 if original != 225 else 250
+    publish(args, args.base + "/setpoint/set", str(target))
+    check(wait_for_setpoint(args, target, 10), "setpoint %d applied" % target)
+
+    publish(args, args.base + "/setpoint/set", str(original))
+    wait_for_setpoint(args, original, 10)
+
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+# test_decode_telemetry.py - Tests for the reference /history.bin decoder
+#
+#   python tools/test_decode_telemetry.py
+#
+# GOLDEN_STREAM is the encoder output checked byte for byte by
+# test/test_telemetry_codec, so the firmware and this decoder are held to the
+# same bytes. Keep the two copies identical.
+import contextlib
+import io
+import os
+import sys
+import tempfile
+import unittest
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import decode_telemetry  # noqa: E402
+from decode_telemetry import DecodeError, decode  # noqa: E402
+
+INT16_MAX = 32767
+INT16_MIN_VALUE = -32767   # INT16_MIN itself is the encoder's "no reading"
+
+# Keyframe at frame 0 and 3; presence changes at 1 and 2; INT16 extremes and
+# the largest possible deltas between them at 2-4
+GOLDEN_STREAM = bytes([
+    0x47, 0x54, 0x01, 0x06, 0x01, 0x64, 0x05, 0x03,
+    0x35, 0x03, 0x94, 0x23, 0xF8, 0x0A,
+    0x20, 0x07, 0x02, 0x00, 0xB8, 0x17,
+    0x2F, 0x03, 0xE8, 0xDC, 0x03, 0xF5, 0x8A, 0x04,
+    0x30, 0x03, 0xFE, 0xFF, 0x03, 0xFD, 0xFF, 0x03,
+    0x00, 0xFB, 0xFF, 0x07, 0xFC, 0xFF, 0x07,
+])
+
+GOLDEN_FRAMES = [
+    # (grill, ambient, probe1) in 0.1°F, relay bits
+    ((2250, 700, None), 0x05),
+    ((2251, 700, 1500), 0x00),
+    ((INT16_MAX, INT16_MIN_VALUE, None), 0x0F),
+    ((INT16_MAX, INT16_MIN_VALUE, None), 0x00),
+    ((INT16_MIN_VALUE, INT16_MAX, None), 0x00),
+]
+
+
+def tenths(temps):
+    return [None if t is None else int(round(t * 10)) for t in temps]
+
+
+class DecodeTest(unittest.TestCase):
+    def test_golden_header(self):
+        header, frames = decode(GOLDEN_STREAM)
+        self.assertEqual(header, {"periodSec": 1, "startTime": 100, "frameCount": 5, "keyframeEvery": 3})
+        self.assertEqual([t for t, _, _ in frames], [100, 101, 102, 103, 104])
+
+    def test_golden_frames(self):
+        _, frames = decode(GOLDEN_STREAM)
+        for i, ((_, temps, relays), (expected, bits)) in enumerate(zip(frames, GOLDEN_FRAMES)):
+            with self.subTest(frame=i):
+                self.assertEqual(tenths(temps), list(expected) + [None, None, None])
+                self.assertEqual(relays, [(bits >> b) & 1 for b in range(4)])
+
+    def test_keyframe_resets_references(self):
+        # Frame 3 is a keyframe: the same readings as frame 2, sent as absolute values
+        _, frames = decode(GOLDEN_STREAM)
+        self.assertEqual(frames[2][1], frames[3][1])
+        self.assertEqual(frames[3][1][0], INT16_MAX / 10.0)
+
+    def test_presence_change_keeps_other_channels(self):
+        _, frames = decode(GOLDEN_STREAM)
+        self.assertIsNone(frames[0][1][2])
+        self.assertEqual(frames[1][1][2], 150.0)
+        self.assertIsNone(frames[2][1][2])
+        self.assertEqual(frames[1][1][0], 225.1)
+
+    def test_int16_extremes(self):
+        _, frames = decode(GOLDEN_STREAM)
+        self.assertEqual(tenths(frames[4][1][:2]), [INT16_MIN_VALUE, INT16_MAX])
+
+    def test_empty_stream(self):
+        data = bytes([0x47, 0x54, 0x01, 0x06, 0x01, 0x00, 0x00, 0x3C])
+        header, frames = decode(data)
+        self.assertEqual(header["frameCount"], 0)
+        self.assertEqual(frames, [])
+
+    def test_truncated_stream(self):
+        for length in range(len(GOLDEN_STREAM)):
+            with self.subTest(length=length), self.assertRaises(DecodeError):
+                decode(GOLDEN_STREAM[:length])
+
+    def test_trailing_bytes(self):
+        with self.assertRaisesRegex(DecodeError, "trailing"):
+            decode(GOLDEN_STREAM + b"\x00")
+
+    def test_bad_magic_version_and_channels(self):
+        for offset, value, message in ((0, ord("X"), "magic"), (2, 2, "version"), (3, 4, "channels")):
+            data = bytearray(GOLDEN_STREAM)
+            data[offset] = value
+            with self.subTest(field=message), self.assertRaisesRegex(DecodeError, message):
+                decode(bytes(data))
+
+    def test_overlong_varint(self):
+        data = bytes([0x47, 0x54, 0x01, 0x06]) + b"\xff" * 6 + b"\x01"
+        with self.assertRaisesRegex(DecodeError, "varint"):
+            decode(data)
+
+    def test_csv_output(self):
+        with tempfile.NamedTemporaryFile(suffix=".bin", delete=False) as f:
+            f.write(GOLDEN_STREAM)
+        try:
+            out = io.StringIO()
+            with contextlib.redirect_stdout(out):
+                self.assertEqual(decode_telemetry.main(["decode_telemetry.py", f.name]), 0)
+        finally:
+            os.unlink(f.name)
+
+        lines = out.getvalue().splitlines()
+        self.assertTrue(lines[0].startswith("# period=1s start=100 frames=5"))
+        self.assertEqual(lines[1], "t,grill,ambient,probe1,probe2,probe3,probe4,igniter,auger,hopperFan,blowerFan")
+        self.assertEqual(lines[2], "100,225.0,70.0,,,,,1,0,1,0")
+        self.assertEqual(lines[6], "104,-3276.7,3276.7,,,,,0,0,0,0")
+
+
+if __name__ == "__main__":
+    unittest.main()